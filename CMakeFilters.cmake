@@ -140,3 +140,41 @@ if (HDF5_ENABLE_SZIP_SUPPORT)
     set (EXTERNAL_FILTERS "${EXTERNAL_FILTERS} ENCODE")
   endif ()
 endif ()
+
+#-----------------------------------------------------------------------------
+# Option for Zstandard support
+#-----------------------------------------------------------------------------
+option (HDF5_ENABLE_ZSTD_SUPPORT "Enable Zstandard Filter" OFF)
+if (HDF5_ENABLE_ZSTD_SUPPORT)
+  find_path (ZSTD_INCLUDE_DIR zstd.h)
+  find_library (ZSTD_LIBRARY NAMES zstd zstd_static)
+  if (ZSTD_INCLUDE_DIR AND ZSTD_LIBRARY)
+    set (H5_HAVE_FILTER_ZSTD 1)
+    set (EXTERNAL_FILTERS "${EXTERNAL_FILTERS} ZSTD")
+  else ()
+    message (FATAL_ERROR "Zstandard is Required for Zstandard support in HDF5")
+  endif ()
+  set (LINK_COMP_SHARED_LIBS ${LINK_COMP_SHARED_LIBS} ${ZSTD_LIBRARY})
+  set (LINK_COMP_LIBS ${LINK_COMP_LIBS} ${ZSTD_LIBRARY})
+  INCLUDE_DIRECTORIES (${ZSTD_INCLUDE_DIR})
+  message (STATUS "Filter ZSTD is ON")
+endif ()
+
+#-----------------------------------------------------------------------------
+# Option for LZ4 support
+#-----------------------------------------------------------------------------
+option (HDF5_ENABLE_LZ4_SUPPORT "Enable LZ4 Filter" OFF)
+if (HDF5_ENABLE_LZ4_SUPPORT)
+  find_path (LZ4_INCLUDE_DIR lz4.h)
+  find_library (LZ4_LIBRARY NAMES lz4 lz4_static)
+  if (LZ4_INCLUDE_DIR AND LZ4_LIBRARY)
+    set (H5_HAVE_FILTER_LZ4 1)
+    set (EXTERNAL_FILTERS "${EXTERNAL_FILTERS} LZ4")
+  else ()
+    message (FATAL_ERROR "LZ4 is Required for LZ4 support in HDF5")
+  endif ()
+  set (LINK_COMP_SHARED_LIBS ${LINK_COMP_SHARED_LIBS} ${LZ4_LIBRARY})
+  set (LINK_COMP_LIBS ${LINK_COMP_LIBS} ${LZ4_LIBRARY})
+  INCLUDE_DIRECTORIES (${LZ4_INCLUDE_DIR})
+  message (STATUS "Filter LZ4 is ON")
+endif ()
@@ -155,6 +155,39 @@ if (NOT WINDOWS)
   endif ()
 endif ()
 
+#-----------------------------------------------------------------------------
+#  Check if the io_uring driver can be built
+#-----------------------------------------------------------------------------
+if (NOT WINDOWS)
+  option (HDF5_ENABLE_IOURING_VFD "Build the io_uring Virtual File Driver" OFF)
+  if (HDF5_ENABLE_IOURING_VFD)
+    include (CheckCSourceCompiles)
+    # The driver uses the io_uring system calls directly (no liburing), and
+    # needs the kernel header for 5.6 or later and the __atomic builtins
+    set (CMAKE_REQUIRED_DEFINITIONS_SAVE ${CMAKE_REQUIRED_DEFINITIONS})
+    set (CMAKE_REQUIRED_DEFINITIONS "${CMAKE_REQUIRED_DEFINITIONS} -D_GNU_SOURCE")
+    CHECK_C_SOURCE_COMPILES ("
+      #include <fcntl.h>
+      #include <linux/io_uring.h>
+      #include <sys/syscall.h>
+      int main(void)
+      {
+          unsigned tail = 0;
+          long nrs = __NR_io_uring_setup + __NR_io_uring_enter + __NR_io_uring_register;
+          int ops = IORING_OP_READ + IORING_OP_WRITE + IORING_OP_READ_FIXED + O_DIRECT;
+          __atomic_store_n(&tail, __atomic_load_n(&tail, __ATOMIC_ACQUIRE) + 1, __ATOMIC_RELEASE);
+          return (int)(nrs + ops + IORING_FEAT_SINGLE_MMAP) == 0;
+      }" IOURING_VFD_WORKS)
+    set (CMAKE_REQUIRED_DEFINITIONS ${CMAKE_REQUIRED_DEFINITIONS_SAVE})
+    if (IOURING_VFD_WORKS)
+      set (${HDF_PREFIX}_HAVE_IOURING 1)
+      add_definitions ("-D_GNU_SOURCE")
+    else ()
+      message (STATUS "The io_uring VFD was requested but cannot be built.\nPlease check that the Linux kernel headers are 5.6 or later, and/or re-configure without option HDF5_ENABLE_IOURING_VFD.")
+    endif ()
+  endif ()
+endif ()
+
 #-----------------------------------------------------------------------------
 #  Check if ROS3 driver can be built
 #-----------------------------------------------------------------------------
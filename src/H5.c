@@ -302,6 +302,7 @@ H5_term_library(void)
         /* Try to organize these so the "higher" level components get shut
          * down before "lower" level components that they might rely on. -QAK
          */
+        pending += DOWN(ES);
         pending += DOWN(L);
 
         /* Close the "top" of various interfaces (IDs, etc) but don't shut
@@ -1327,6 +1327,70 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5AC_protect() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5AC_protect_multi
+ *
+ * Purpose:     Protects COUNT entries of the same type, as COUNT calls
+ *		to H5AC_protect() would, but reads the entries that aren't
+ *		in the cache with as few reads as it can.  See
+ *		H5C_protect_multi().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5AC_protect_multi(H5F_t *f, const H5AC_class_t *type, size_t count,
+    const haddr_t addrs[], void *udata[], unsigned flags, void *things[]/*out*/)
+{
+    size_t              u;                      /* Local index variable */
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(f->shared->cache);
+    HDassert(type);
+    HDassert(type->serialize);
+    HDassert(count == 0 || (addrs && udata && things));
+
+    /* Check for unexpected flags -- H5C__FLUSH_COLLECTIVELY_FLAG
+     * only permitted in the parallel case.
+     */
+#ifdef H5_HAVE_PARALLEL
+    HDassert(0 == (flags & (unsigned)(~(H5C__READ_ONLY_FLAG | \
+                                        H5C__FLUSH_LAST_FLAG | \
+                                        H5C__FLUSH_COLLECTIVELY_FLAG))));
+#else /* H5_HAVE_PARALLEL */
+    HDassert(0 == (flags & (unsigned)(~(H5C__READ_ONLY_FLAG | \
+                                        H5C__FLUSH_LAST_FLAG))));
+#endif /* H5_HAVE_PARALLEL */
+
+    /* Check for invalid access request */
+    if((0 == (H5F_INTENT(f) & H5F_ACC_RDWR)) && (0 == (flags & H5C__READ_ONLY_FLAG)))
+	HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "no write intent on file")
+
+#if H5AC_DO_TAGGING_SANITY_CHECKS
+    if(!H5C_get_ignore_tags(f->shared->cache) && H5AC__verify_tag(type) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTTAG, FAIL, "Bad tag value")
+#endif /* H5AC_DO_TAGGING_SANITY_CHECKS */
+
+    if(H5C_protect_multi(f, type, count, addrs, udata, flags, things) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTPROTECT, FAIL, "H5C_protect_multi() failed")
+
+done:
+    /* If currently logging, generate a message for each entry protected */
+    if(f->shared->cache->log_info->logging)
+        for(u = 0; u < count; u++)
+            if(things[u] && H5C_log_write_protect_entry_msg(f->shared->cache, (H5AC_info_t *)things[u], type->id, flags, ret_value) < 0)
+                HDONE_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_protect_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5AC_resize_entry
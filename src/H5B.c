@@ -154,6 +154,8 @@ static herr_t H5B__insert_child(H5B_t *bt, unsigned *bt_flags,
 static herr_t H5B__split(H5F_t *f, H5B_ins_ud_t *bt_ud, unsigned idx,
     void *udata, H5B_ins_ud_t *split_bt_ud/*out*/);
 static H5B_t * H5B__copy(const H5B_t *old_bt);
+static herr_t H5B__load_children(H5F_t *f, const H5AC_class_t *child_class,
+    const H5B_t *bt, void *udata);
 
 
 /*********************/
@@ -1158,6 +1160,17 @@ H5B__iterate_helper(H5F_t *f, const H5B_class_t *type, haddr_t addr,
     if(NULL == (bt = (H5B_t *)H5AC_protect(f, H5AC_BT, addr, &cache_udata, H5AC__READ_ONLY_FLAG)))
         HGOTO_ERROR(H5E_BTREE, H5E_CANTPROTECT, H5_ITER_ERROR, "unable to load B-tree node")
 
+    /* Bring the node's children into the cache together, so the ones that
+     * aren't cached yet can be read with fewer I/O operations
+     */
+    if(bt->level > 0) {
+        if(H5B__load_children(f, H5AC_BT, bt, &cache_udata) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTLOAD, H5_ITER_ERROR, "unable to load B-tree child nodes")
+    } /* end if */
+    else if(type->child_class)
+        if(H5B__load_children(f, type->child_class, bt, f) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTLOAD, H5_ITER_ERROR, "unable to load B-tree child objects")
+
     /* Iterate over node's children */
     for(u = 0; u < bt->nchildren && ret_value == H5_ITER_CONT; u++) {
         if(bt->level > 0)
@@ -1175,6 +1188,62 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5B__iterate_helper() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B__load_children
+ *
+ * Purpose:	Brings the children of node BT, which are of class
+ *		CHILD_CLASS and are loaded with UDATA, into the metadata
+ *		cache, reading the ones that aren't already cached with as
+ *		few reads as possible.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5B__load_children(H5F_t *f, const H5AC_class_t *child_class, const H5B_t *bt,
+    void *udata)
+{
+    void **udatas = NULL;               /* User data for each child */
+    void **things = NULL;               /* The children */
+    unsigned u;                         /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(f);
+    HDassert(child_class);
+    HDassert(bt);
+
+    /* Nothing to gain for a single child */
+    if(bt->nchildren < 2)
+        HGOTO_DONE(SUCCEED)
+
+    if(NULL == (udatas = (void **)H5MM_malloc(bt->nchildren * sizeof(void *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for child user data")
+    if(NULL == (things = (void **)H5MM_calloc(bt->nchildren * sizeof(void *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for children")
+    for(u = 0; u < bt->nchildren; u++)
+        udatas[u] = udata;
+
+    /* Protect the children, which loads them into the cache */
+    if(H5AC_protect_multi(f, child_class, (size_t)bt->nchildren, bt->child, udatas, H5AC__READ_ONLY_FLAG, things) < 0)
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTPROTECT, FAIL, "unable to protect children")
+
+done:
+    /* Release the children */
+    if(things)
+        for(u = 0; u < bt->nchildren; u++)
+            if(things[u] && H5AC_unprotect(f, child_class, bt->child[u], things[u], H5AC__NO_FLAGS_SET) < 0)
+                HDONE_ERROR(H5E_BTREE, H5E_CANTUNPROTECT, FAIL, "unable to release child")
+
+    H5MM_xfree(things);
+    H5MM_xfree(udatas);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5B__load_children() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5B_iterate
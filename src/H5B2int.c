@@ -60,6 +60,8 @@
 static herr_t H5B2__update_child_flush_depends(H5B2_hdr_t *hdr, 
     unsigned depth, const H5B2_node_ptr_t *node_ptrs, unsigned start_idx,
     unsigned end_idx, void *old_parent, void *new_parent);
+static herr_t H5B2__load_children(H5B2_hdr_t *hdr, uint16_t depth,
+    const H5B2_node_ptr_t *node_ptrs, unsigned nchildren);
 
 
 /*********************/
@@ -1570,6 +1572,13 @@ H5B2__iterate_node(H5B2_hdr_t *hdr, uint16_t depth, const H5B2_node_ptr_t *curr_
     else
         node = NULL;
 
+    /* Bring the child nodes into the cache together, so the ones that
+     * aren't cached yet can be read with fewer I/O operations
+     */
+    if(depth > 0 && !hdr->swmr_write)
+        if(H5B2__load_children(hdr, (uint16_t)(depth - 1), node_ptrs, (unsigned)curr_node->node_nrec + 1) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTLOAD, FAIL, "unable to load B-tree child nodes")
+
     /* Iterate through records, in order */
     for(u = 0; u < curr_node->node_nrec && !ret_value; u++) {
         /* Descend into child node, if current node is an internal node */
@@ -1602,6 +1611,104 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5B2__iterate_node() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2__load_children
+ *
+ * Purpose:	Bring the NCHILDREN child nodes, at DEPTH, of an internal
+ *		node into the metadata cache, reading the ones that aren't
+ *		already cached with as few reads as possible.
+ *
+ *		Not for use when the B-tree is open for SWMR writing, since
+ *		the children are loaded without their flush dependency
+ *		parent.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5B2__load_children(H5B2_hdr_t *hdr, uint16_t depth,
+    const H5B2_node_ptr_t *node_ptrs, unsigned nchildren)
+{
+    const H5AC_class_t *child_class;    /* Class of the child nodes */
+    H5B2_internal_cache_ud_t *int_udata = NULL; /* User data for loading internal nodes */
+    H5B2_leaf_cache_ud_t *leaf_udata = NULL;    /* User data for loading leaf nodes */
+    haddr_t *addrs = NULL;              /* Addresses of the child nodes */
+    void **udata = NULL;                /* User data for each child node */
+    void **things = NULL;               /* The child nodes */
+    unsigned u;                         /* Local index */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check arguments. */
+    HDassert(hdr);
+    HDassert(!hdr->swmr_write);
+    HDassert(node_ptrs);
+    HDassert(nchildren > 0);
+
+    /* Allocate space for the requests */
+    if(NULL == (addrs = (haddr_t *)H5MM_malloc(nchildren * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for child node addresses")
+    if(NULL == (udata = (void **)H5MM_malloc(nchildren * sizeof(void *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for child node user data")
+    if(NULL == (things = (void **)H5MM_calloc(nchildren * sizeof(void *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for child nodes")
+    if(depth > 0) {
+        child_class = H5AC_BT2_INT;
+        if(NULL == (int_udata = (H5B2_internal_cache_ud_t *)H5MM_malloc(nchildren * sizeof(H5B2_internal_cache_ud_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for child node user data")
+    } /* end if */
+    else {
+        child_class = H5AC_BT2_LEAF;
+        if(NULL == (leaf_udata = (H5B2_leaf_cache_ud_t *)H5MM_malloc(nchildren * sizeof(H5B2_leaf_cache_ud_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for child node user data")
+    } /* end else */
+
+    /* Set up the requests, as H5B2__protect_internal() and
+     * H5B2__protect_leaf() would
+     */
+    for(u = 0; u < nchildren; u++) {
+        HDassert(H5F_addr_defined(node_ptrs[u].addr));
+        addrs[u] = node_ptrs[u].addr;
+        if(depth > 0) {
+            int_udata[u].f = hdr->f;
+            int_udata[u].hdr = hdr;
+            int_udata[u].parent = NULL;
+            int_udata[u].nrec = node_ptrs[u].node_nrec;
+            int_udata[u].depth = depth;
+            udata[u] = &int_udata[u];
+        } /* end if */
+        else {
+            leaf_udata[u].f = hdr->f;
+            leaf_udata[u].hdr = hdr;
+            leaf_udata[u].parent = NULL;
+            leaf_udata[u].nrec = node_ptrs[u].node_nrec;
+            udata[u] = &leaf_udata[u];
+        } /* end else */
+    } /* end for */
+
+    /* Protect the child nodes, which loads them into the cache */
+    if(H5AC_protect_multi(hdr->f, child_class, (size_t)nchildren, addrs, udata, H5AC__READ_ONLY_FLAG, things) < 0)
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTPROTECT, FAIL, "unable to protect B-tree child nodes")
+
+done:
+    /* Release the child nodes */
+    if(things)
+        for(u = 0; u < nchildren; u++)
+            if(things[u] && H5AC_unprotect(hdr->f, child_class, addrs[u], things[u], H5AC__NO_FLAGS_SET) < 0)
+                HDONE_ERROR(H5E_BTREE, H5E_CANTUNPROTECT, FAIL, "unable to release B-tree child node")
+
+    H5MM_xfree(leaf_udata);
+    H5MM_xfree(int_udata);
+    H5MM_xfree(things);
+    H5MM_xfree(udata);
+    H5MM_xfree(addrs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5B2__load_children() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5B2__delete_node
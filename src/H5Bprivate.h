@@ -30,6 +30,7 @@
 
 /* Private headers needed by this file */
 #include "H5private.h"		/* Generic Functions			*/
+#include "H5ACprivate.h"	/* Metadata cache			*/
 #include "H5Fprivate.h"		/* File access				*/
 #include "H5UCprivate.h"	/* Reference counted object functions	*/
 
@@ -135,6 +136,10 @@ typedef struct H5B_class_t {
     herr_t	(*decode)(const H5B_shared_t*, const uint8_t*, void*);
     herr_t	(*encode)(const H5B_shared_t*, uint8_t*, const void*);
     herr_t	(*debug_key)(FILE*, int, int, const void*, const void*);
+
+    /* cache class of the objects the leaf nodes point to, which are loaded
+     * with the file as their user data, or NULL if they aren't metadata */
+    const H5AC_class_t *child_class;
 } H5B_class_t;
 
 /* Information about B-tree */
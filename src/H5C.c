@@ -101,6 +101,12 @@
 #define H5C_IMAGE_EXTRA_SPACE 0
 #endif /* H5C_DO_MEMORY_SANITY_CHECKS */
 
+/* Largest gap between entries that H5C_protect_multi() reads together,
+ * and the largest read it makes of several entries
+ */
+#define H5C__MULTI_MAX_GAP              1024
+#define H5C__MULTI_MAX_READ_SIZE        (1024 * 1024)
+
 
 /******************/
 /* Local Typedefs */
@@ -109,6 +115,13 @@
 /* Alias for pointer to cache entry, for use when allocating sequences of them */
 typedef H5C_cache_entry_t *H5C_cache_entry_ptr_t;
 
+/* An entry that H5C_protect_multi() reads along with others */
+typedef struct H5C_multi_ent_t {
+    haddr_t addr;               /* Address of the entry */
+    size_t len;                 /* Size of the entry's image */
+    size_t idx;                 /* Index of the entry in the request */
+} H5C_multi_ent_t;
+
 
 /********************/
 /* Local Prototypes */
@@ -157,7 +170,13 @@ static void * H5C_load_entry(H5F_t *             f,
 #endif /* H5_HAVE_PARALLEL */
                              const H5C_class_t * type,
                              haddr_t             addr,
-                             void *              udata);
+                             void *              udata,
+                             const uint8_t *     disk_image);
+
+static void *H5C__protect(H5F_t *f, const H5C_class_t *type, haddr_t addr,
+    void *udata, unsigned flags, const uint8_t *disk_image);
+
+static int H5C__multi_ent_cmp(const void *_ent1, const void *_ent2);
 
 static herr_t H5C__mark_flush_dep_dirty(H5C_cache_entry_t * entry);
 
@@ -464,6 +483,10 @@ H5C_create(size_t		      max_cache_size,
     cache_ptr->image_entries		= NULL;
     cache_ptr->image_buffer		= NULL;
 
+    cache_ptr->num_lazy_image_entries	= 0;
+    cache_ptr->num_lazy_image_entries_left = 0;
+    cache_ptr->lazy_image_entries	= NULL;
+
     /* initialize free space manager related fields: */
     cache_ptr->rdfsm_settled		= FALSE;
     cache_ptr->mdfsm_settled		= FALSE;
@@ -870,6 +893,11 @@ H5C_dest(H5F_t * f)
     if(cache_ptr->log_info != NULL)
         H5MM_xfree(cache_ptr->log_info);
 
+    /* Release entries never loaded from the cache image */
+    if(cache_ptr->lazy_image_entries != NULL)
+        if(H5C__free_lazy_image_entries(cache_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFREE, FAIL, "can't release cache image entries")
+
 #ifndef NDEBUG
 #if H5C_DO_SANITY_CHECKS
     if(cache_ptr->get_entry_ptr_from_addr_counter > 0)
@@ -2178,6 +2206,208 @@ H5C_protect(H5F_t *		f,
             haddr_t 	        addr,
             void *              udata,
 	    unsigned		flags)
+{
+    void *		ret_value = NULL;       /* Return value */
+
+    FUNC_ENTER_NOAPI(NULL)
+
+    if(NULL == (ret_value = H5C__protect(f, type, addr, udata, flags, NULL)))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTPROTECT, NULL, "can't protect entry")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_protect() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_protect_multi
+ *
+ * Purpose:     Protects COUNT entries of the same type, as COUNT calls
+ *		to H5C_protect() would, returning them in THINGS.  The
+ *		I'th entry is at ADDRS[I], and is loaded with UDATA[I] if
+ *		it isn't in the cache.  The addresses must be distinct.
+ *
+ *		The entries that aren't in the cache are read in address
+ *		order, with one read for each run of entries that are
+ *		close together in the file, instead of one read for each
+ *		entry.  Entries whose size isn't known before they are read
+ *		are read one at a time, as are all entries in parallel and
+ *		page buffered files.
+ *
+ *		If an entry can't be protected, none of the entries are
+ *		left protected.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_protect_multi(H5F_t *f, const H5C_class_t *type, size_t count,
+    const haddr_t addrs[], void *udata[], unsigned flags, void *things[]/*out*/)
+{
+    H5C_t *             cache_ptr;
+    H5C_multi_ent_t *   ents = NULL;    /* Entries to read together */
+    size_t              nents = 0;      /* Number of entries to read together */
+    uint8_t *           buf = NULL;     /* Buffer for runs of entries */
+    size_t              buf_size = 0;   /* Size of buffer */
+    size_t              u, v, w;        /* Local index variables */
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* check args */
+    HDassert(f);
+    HDassert(f->shared);
+    cache_ptr = f->shared->cache;
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(type);
+    HDassert(count == 0 || (addrs && udata && things));
+
+    for(u = 0; u < count; u++)
+        things[u] = NULL;
+
+    /* Load the cache image, if requested, before looking for the entries */
+    if(cache_ptr->load_image) {
+        cache_ptr->load_image = FALSE;
+        if(H5C__load_cache_image(f) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, FAIL, "Can't load cache image")
+    } /* end if */
+
+    /* Find the entries that aren't in the cache, if they can be read
+     * together
+     */
+    if(count > 1 && 0 == (type->flags & (H5C__CLASS_SPECULATIVE_LOAD_FLAG | H5C__CLASS_SKIP_READS))
+            && NULL == f->shared->page_buf
+#ifdef H5_HAVE_PARALLEL
+            && !H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI)
+#endif /* H5_HAVE_PARALLEL */
+            ) {
+        H5FD_mem_t cooked_type;         /* Modified type, accounting for switching global heaps */
+        haddr_t eoa;                    /* End-of-allocation in the file */
+
+        /* Get the file's end-of-allocation value (see H5C__verify_len_eoa()) */
+        cooked_type = (type->mem_type == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : type->mem_type;
+        eoa = H5F_get_eoa(f, cooked_type);
+        if(!H5F_addr_defined(eoa))
+            HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "invalid EOA address for file")
+
+        if(NULL == (ents = (H5C_multi_ent_t *)H5MM_malloc(count * sizeof(H5C_multi_ent_t))))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for entry list")
+
+        for(u = 0; u < count; u++) {
+            H5C_cache_entry_t *entry_ptr;
+            size_t len;
+
+            HDassert(H5F_addr_defined(addrs[u]));
+
+            /* Insert the entry from the cache image, if it's there */
+            if(cache_ptr->num_lazy_image_entries_left > 0)
+                if(H5C__load_lazy_image_entry(f, cache_ptr, addrs[u]) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, FAIL, "can't load entry from cache image")
+
+            H5C__SEARCH_INDEX(cache_ptr, addrs[u], entry_ptr, FAIL)
+            if(entry_ptr)
+                continue;
+
+            /* Get the size of the entry's image */
+            if(type->get_initial_load_size(udata[u], &len) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "can't retrieve image size")
+
+            /* Leave entries that aren't wholly in the file for
+             * H5C__protect() to complain about
+             */
+            if(0 == len || H5F_addr_gt(addrs[u] + len, eoa))
+                continue;
+
+            ents[nents].addr = addrs[u];
+            ents[nents].len = len;
+            ents[nents].idx = u;
+            nents++;
+        } /* end for */
+
+        /* Sort the entries by address */
+        if(nents > 1)
+            HDqsort(ents, nents, sizeof(H5C_multi_ent_t), H5C__multi_ent_cmp);
+    } /* end if */
+
+    /* Read each run of entries that are close together in the file, and
+     * load the entries from the run's image
+     */
+    for(u = 0; u < nents; u = v) {
+        haddr_t run_addr = ents[u].addr;                /* Address of the run */
+        haddr_t run_end = ents[u].addr + ents[u].len;   /* End of the run */
+        size_t run_size;                                /* Size of the run */
+
+        for(v = u + 1; v < nents; v++) {
+            haddr_t ent_end = MAX(run_end, ents[v].addr + ents[v].len);
+
+            if(H5F_addr_gt(ents[v].addr, run_end + H5C__MULTI_MAX_GAP) || (ent_end - run_addr) > H5C__MULTI_MAX_READ_SIZE)
+                break;
+            run_end = ent_end;
+        } /* end for */
+
+        /* Leave entries on their own to be read when they're protected */
+        if(v == u + 1)
+            continue;
+
+        /* Read the run */
+        run_size = (size_t)(run_end - run_addr);
+        if(run_size > buf_size) {
+            uint8_t *new_buf;
+
+            if(NULL == (new_buf = (uint8_t *)H5MM_realloc(buf, run_size)))
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for entry images")
+            buf = new_buf;
+            buf_size = run_size;
+        } /* end if */
+        if(H5F_block_read(f, type->mem_type, run_addr, run_size, buf) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_READERROR, FAIL, "Can't read entry images")
+
+        for(w = u; w < v; w++)
+            if(NULL == (things[ents[w].idx] = H5C__protect(f, type, ents[w].addr, udata[ents[w].idx], flags, buf + (ents[w].addr - run_addr))))
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTPROTECT, FAIL, "can't protect entry")
+    } /* end for */
+
+    /* Protect the rest of the entries */
+    for(u = 0; u < count; u++)
+        if(NULL == things[u])
+            if(NULL == (things[u] = H5C__protect(f, type, addrs[u], udata[u], flags, NULL)))
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTPROTECT, FAIL, "can't protect entry")
+
+done:
+    /* Release the entries protected, on error */
+    if(ret_value < 0)
+        for(u = 0; u < count; u++)
+            if(things[u]) {
+                if(H5C_unprotect(f, addrs[u], things[u], H5C__NO_FLAGS_SET) < 0)
+                    HDONE_ERROR(H5E_CACHE, H5E_CANTUNPROTECT, FAIL, "can't unprotect entry")
+                things[u] = NULL;
+            } /* end if */
+
+    H5MM_xfree(buf);
+    H5MM_xfree(ents);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_protect_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__protect
+ *
+ * Purpose:     Protects an entry, as H5C_protect() does.  If DISK_IMAGE
+ *		isn't NULL, it's the image of the entry, already read from
+ *		the file, and is used to load the entry if the entry isn't
+ *		in the cache.
+ *
+ * Return:      Success:        Ptr to the desired entry
+ *              Failure:        NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5C__protect(H5F_t *f, const H5C_class_t *type, haddr_t addr, void *udata,
+    unsigned flags, const uint8_t *disk_image)
 {
     H5C_t *		cache_ptr;
     H5AC_ring_t         ring = H5C_RING_UNDEFINED;
@@ -2195,7 +2425,7 @@ H5C_protect(H5F_t *		f,
     H5C_cache_entry_t *	entry_ptr;
     void *		ret_value = NULL;       /* Return value */
 
-    FUNC_ENTER_NOAPI(NULL)
+    FUNC_ENTER_STATIC
 
     /* check args */
     HDassert( f );
@@ -2234,6 +2464,11 @@ H5C_protect(H5F_t *		f,
         coll_access = H5CX_get_coll_metadata_read();
 #endif /* H5_HAVE_PARALLEL */
 
+    /* Insert the target from the cache image, if it was left there */
+    if(cache_ptr->num_lazy_image_entries_left > 0)
+        if(H5C__load_lazy_image_entry(f, cache_ptr, addr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, NULL, "can't load entry from cache image")
+
     /* first check to see if the target is in cache */
     H5C__SEARCH_INDEX(cache_ptr, addr, entry_ptr, NULL)
 
@@ -2342,7 +2577,7 @@ H5C_protect(H5F_t *		f,
 #ifdef H5_HAVE_PARALLEL
                                            coll_access, 
 #endif /* H5_HAVE_PARALLEL */
-                                           type, addr, udata)))
+                                           type, addr, udata, disk_image)))
             HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, NULL, "can't load entry")
 
         entry_ptr = (H5C_cache_entry_t *)thing;
@@ -2599,7 +2834,35 @@ done:
 #endif /* H5C_DO_EXTREME_SANITY_CHECKS */
 
     FUNC_LEAVE_NOAPI(ret_value)
-} /* H5C_protect() */
+} /* H5C__protect() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__multi_ent_cmp
+ *
+ * Purpose:     Compares the addresses of two entries that
+ *		H5C_protect_multi() reads together, for sorting them.
+ *
+ * Return:      -1, 0 or 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5C__multi_ent_cmp(const void *_ent1, const void *_ent2)
+{
+    const H5C_multi_ent_t *ent1 = (const H5C_multi_ent_t *)_ent1;
+    const H5C_multi_ent_t *ent2 = (const H5C_multi_ent_t *)_ent2;
+    int ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(H5F_addr_lt(ent1->addr, ent2->addr))
+        ret_value = -1;
+    else if(H5F_addr_gt(ent1->addr, ent2->addr))
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__multi_ent_cmp() */
 
 
 /*-------------------------------------------------------------------------
@@ -6487,6 +6750,10 @@ done:
  *              Note that this function simply loads the entry into
  *              core.  It does not insert it into the cache.
  *
+ *              If DISK_IMAGE isn't NULL, it's the entry's image, already
+ *              read from the file, and is used instead of reading the
+ *              image the first time.
+ *
  * Return:      Non-NULL on success / NULL on failure.
  *
  * Programmer:  John Mainzer, 5/18/04
@@ -6500,7 +6767,8 @@ H5C_load_entry(H5F_t *              f,
 #endif /* H5_HAVE_PARALLEL */
                 const H5C_class_t * type,
                 haddr_t             addr,
-                void *              udata)
+                void *              udata,
+                const uint8_t *     disk_image)
 {
     hbool_t     dirty = FALSE;          /* Flag indicating whether thing was dirtied during deserialize */
     uint8_t *   image = NULL;           /* Buffer for disk image                    */
@@ -6591,25 +6859,30 @@ H5C_load_entry(H5F_t *              f,
 #endif /* H5C_DO_MEMORY_SANITY_CHECKS */
             } /* end if */
 
+            /* Use the image the caller read, the first time */
+            if(disk_image && tries == max_tries)
+                H5MM_memcpy(image, disk_image, len);
+            else {
 #ifdef H5_HAVE_PARALLEL
-            if(!coll_access || 0 == mpi_rank) {
+                if(!coll_access || 0 == mpi_rank) {
 #endif /* H5_HAVE_PARALLEL */
-                if(H5F_block_read(f, type->mem_type, addr, len, image) < 0)
-                    HGOTO_ERROR(H5E_CACHE, H5E_READERROR, NULL, "Can't read image*")
+                    if(H5F_block_read(f, type->mem_type, addr, len, image) < 0)
+                        HGOTO_ERROR(H5E_CACHE, H5E_READERROR, NULL, "Can't read image*")
 #ifdef H5_HAVE_PARALLEL
-            } /* end if */
-            /* if the collective metadata read optimization is turned on,
-             * bcast the metadata read from process 0 to all ranks in the file
-             * communicator
-             */
-            if(coll_access) {
-                int buf_size;
+                } /* end if */
+                /* if the collective metadata read optimization is turned on,
+                 * bcast the metadata read from process 0 to all ranks in the file
+                 * communicator
+                 */
+                if(coll_access) {
+                    int buf_size;
 
-                H5_CHECKED_ASSIGN(buf_size, int, len, size_t);
-                if(MPI_SUCCESS != (mpi_code = MPI_Bcast(image, buf_size, MPI_BYTE, 0, comm)))
-                    HMPI_GOTO_ERROR(NULL, "MPI_Bcast failed", mpi_code)
-            } /* end if */
+                    H5_CHECKED_ASSIGN(buf_size, int, len, size_t);
+                    if(MPI_SUCCESS != (mpi_code = MPI_Bcast(image, buf_size, MPI_BYTE, 0, comm)))
+                        HMPI_GOTO_ERROR(NULL, "MPI_Bcast failed", mpi_code)
+                } /* end if */
 #endif /* H5_HAVE_PARALLEL */
+            } /* end else */
 
             /* If the entry could be read speculatively and the length is still
              *  changing, check for updating the actual size
@@ -247,6 +247,12 @@ typedef struct H5CX_t {
     hbool_t err_detect_valid;   /* Whether error detection info is valid */
     H5Z_cb_t filter_cb;         /* Filter callback function (H5D_XFER_FILTER_CB_NAME) */
     hbool_t filter_cb_valid;    /* Whether filter callback function is valid */
+    unsigned filter_nthreads;   /* # of threads for chunk filtering (H5D_XFER_FILTER_NTHREADS_NAME) */
+    hbool_t filter_nthreads_valid; /* Whether # of threads for chunk filtering is valid */
+    unsigned chunk_prefetch;    /* # of chunks to read ahead (H5D_XFER_CHUNK_PREFETCH_NAME) */
+    hbool_t chunk_prefetch_valid; /* Whether # of chunks to read ahead is valid */
+    unsigned conv_nthreads;     /* # of threads for datatype conversion (H5D_XFER_CONV_NTHREADS_NAME) */
+    hbool_t conv_nthreads_valid; /* Whether # of threads for datatype conversion is valid */
     H5Z_data_xform_t *data_transform; /* Data transform info (H5D_XFER_XFORM_NAME) */
     hbool_t data_transform_valid; /* Whether data transform info is valid */
     H5T_vlen_alloc_info_t vl_alloc_info; /* VL datatype alloc info (H5D_XFER_VLEN_*_NAME) */
@@ -355,6 +361,9 @@ typedef struct H5CX_dxpl_cache_t {
 #endif /* H5_HAVE_PARALLEL */
     H5Z_EDC_t err_detect;           /* Error detection info (H5D_XFER_EDC_NAME) */
     H5Z_cb_t filter_cb;             /* Filter callback function (H5D_XFER_FILTER_CB_NAME) */
+    unsigned filter_nthreads;       /* # of threads for chunk filtering (H5D_XFER_FILTER_NTHREADS_NAME) */
+    unsigned chunk_prefetch;        /* # of chunks to read ahead (H5D_XFER_CHUNK_PREFETCH_NAME) */
+    unsigned conv_nthreads;         /* # of threads for datatype conversion (H5D_XFER_CONV_NTHREADS_NAME) */
     H5Z_data_xform_t *data_transform; /* Data transform info (H5D_XFER_XFORM_NAME) */
     H5T_vlen_alloc_info_t vl_alloc_info; /* VL datatype alloc info (H5D_XFER_VLEN_*_NAME) */
     H5T_conv_cb_t dt_conv_cb;       /* Datatype conversion struct (H5D_XFER_CONV_CB_NAME) */
@@ -530,6 +539,18 @@ H5CX__init_package(void)
     if(H5P_get(dx_plist, H5D_XFER_FILTER_CB_NAME, &H5CX_def_dxpl_cache.filter_cb) < 0)
         HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve filter callback function")
 
+    /* Get # of threads for chunk filtering */
+    if(H5P_get(dx_plist, H5D_XFER_FILTER_NTHREADS_NAME, &H5CX_def_dxpl_cache.filter_nthreads) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve # of threads for chunk filtering")
+
+    /* Get # of chunks to read ahead */
+    if(H5P_get(dx_plist, H5D_XFER_CHUNK_PREFETCH_NAME, &H5CX_def_dxpl_cache.chunk_prefetch) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve # of chunks to read ahead")
+
+    /* Get # of threads for datatype conversion */
+    if(H5P_get(dx_plist, H5D_XFER_CONV_NTHREADS_NAME, &H5CX_def_dxpl_cache.conv_nthreads) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve # of threads for datatype conversion")
+
     /* Look at the data transform property */
     /* (Note: 'peek', not 'get' - if this turns out to be a problem, we may need
      *          to copy it and free this in the H5CX terminate routine. -QAK)
@@ -834,6 +855,99 @@ H5CX_push_special(void)
     FUNC_LEAVE_NOAPI_VOID
 } /* end H5CX_push_special() */
 
+#ifdef H5_HAVE_THREADSAFE
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_shared
+ *
+ * Purpose:     Retrieves the API context of the calling thread, for
+ *              helper threads working on its behalf to use with
+ *              H5CX_share().
+ *
+ * Return:      Pointer to the API context (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+void *
+H5CX_get_shared(void)
+{
+    H5CX_node_t **head = H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(head && *head);
+
+    FUNC_LEAVE_NOAPI((void *)*head)
+} /* end H5CX_get_shared() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_share
+ *
+ * Purpose:     Makes an API context from H5CX_get_shared() the context of
+ *              the calling thread, if the thread doesn't have one (i.e.
+ *              it's a helper thread, not the one that owns the context).
+ *
+ * Note:        Retrieving a value that isn't in the context yet changes
+ *              the context, so helper threads must only retrieve values
+ *              that the owning thread has already retrieved.  The owning
+ *              thread must not change the context until the helpers call
+ *              H5CX_unshare().
+ *
+ * Return:      TRUE if the context was made the thread's context, FALSE
+ *              if the thread already had one (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5CX_share(void *api_ctx)
+{
+    H5CX_node_t **head = H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+    hbool_t ret_value = FALSE;          /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(head);
+    HDassert(api_ctx);
+
+    if(NULL == *head) {
+        *head = (H5CX_node_t *)api_ctx;
+        ret_value = TRUE;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_share() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_unshare
+ *
+ * Purpose:     Stops a helper thread from using the API context given to
+ *              H5CX_share().
+ *
+ * Return:      <none>
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5CX_unshare(void)
+{
+    H5CX_node_t **head = H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(head && *head);
+
+    *head = NULL;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5CX_unshare() */
+#endif /* H5_HAVE_THREADSAFE */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5CX_retrieve_state
@@ -2336,6 +2450,105 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5CX_get_filter_cb() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_filter_nthreads
+ *
+ * Purpose:     Retrieves the # of threads to use for chunk filtering for
+ *              the current API call context.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_get_filter_nthreads(unsigned *filter_nthreads)
+{
+    H5CX_node_t **head = H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(filter_nthreads);
+    HDassert(head && *head);
+    HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
+
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_FILTER_NTHREADS_NAME, filter_nthreads)
+
+    /* Get the value */
+    *filter_nthreads = (*head)->ctx.filter_nthreads;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_get_filter_nthreads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_chunk_prefetch
+ *
+ * Purpose:     Retrieves the # of chunks to read ahead for the current API
+ *              call context.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_get_chunk_prefetch(unsigned *chunk_prefetch)
+{
+    H5CX_node_t **head = H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(chunk_prefetch);
+    HDassert(head && *head);
+    HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
+
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_CHUNK_PREFETCH_NAME, chunk_prefetch)
+
+    /* Get the value */
+    *chunk_prefetch = (*head)->ctx.chunk_prefetch;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_get_chunk_prefetch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_conv_nthreads
+ *
+ * Purpose:     Retrieves the # of threads to use for datatype conversion
+ *              for the current API call context.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_get_conv_nthreads(unsigned *conv_nthreads)
+{
+    H5CX_node_t **head = H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(conv_nthreads);
+    HDassert(head && *head);
+    HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
+
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_CONV_NTHREADS_NAME, conv_nthreads)
+
+    /* Get the value */
+    *conv_nthreads = (*head)->ctx.conv_nthreads;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_get_conv_nthreads() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5CX_get_data_transform
@@ -71,6 +71,11 @@ H5_DLL herr_t H5CX_pop(void);
 #endif  /* _H5private_H */
 H5_DLL void H5CX_push_special(void);
 H5_DLL hbool_t H5CX_is_def_dxpl(void);
+#ifdef H5_HAVE_THREADSAFE
+H5_DLL void *H5CX_get_shared(void);
+H5_DLL hbool_t H5CX_share(void *api_ctx);
+H5_DLL void H5CX_unshare(void);
+#endif /* H5_HAVE_THREADSAFE */
 
 /* API context state routines */
 H5_DLL herr_t H5CX_retrieve_state(H5CX_state_t **api_state);
@@ -121,6 +126,9 @@ H5_DLL herr_t H5CX_get_mpio_chunk_opt_ratio(unsigned *mpio_chunk_opt_ratio);
 #endif /* H5_HAVE_PARALLEL */
 H5_DLL herr_t H5CX_get_err_detect(H5Z_EDC_t *err_detect);
 H5_DLL herr_t H5CX_get_filter_cb(H5Z_cb_t *filter_cb);
+H5_DLL herr_t H5CX_get_filter_nthreads(unsigned *filter_nthreads);
+H5_DLL herr_t H5CX_get_chunk_prefetch(unsigned *chunk_prefetch);
+H5_DLL herr_t H5CX_get_conv_nthreads(unsigned *conv_nthreads);
 H5_DLL herr_t H5CX_get_data_transform(H5Z_data_xform_t **data_transform);
 H5_DLL herr_t H5CX_get_vlen_alloc_info(H5T_vlen_alloc_info_t *vl_alloc_info);
 H5_DLL herr_t H5CX_get_dt_conv_cb(H5T_conv_cb_t *cb_struct);
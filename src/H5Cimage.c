@@ -83,11 +83,26 @@
 /* Maximum ring allowed in image */
 #define H5C_MAX_RING_IN_IMAGE   H5C_RING_MDFSM
 
+/* Minimum # of entries decoded by each thread when loading an image */
+#define H5C_IMAGE_DECODE_MIN_ENTRIES    64
+
 
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* Info for the tasks that decode a cache image */
+typedef struct H5C_image_decode_t {
+    const H5F_t *f;                     /* File the image is from */
+    H5C_t *cache_ptr;                   /* Cache the image is loaded into */
+    hbool_t file_is_rw;                 /* Whether the file is opened R/W */
+    const uint8_t **images;             /* Start of each entry to decode */
+    H5C_cache_entry_t **entries;        /* Prefetched entries to decode into */
+    size_t nentries;                    /* # of entries to decode */
+    size_t piece_nentries;              /* # of entries decoded by each task */
+    hbool_t chksum_ok;                  /* Whether the image checksum matched */
+} H5C_image_decode_t;
+
 
 /********************/
 /* Local Prototypes */
@@ -115,8 +130,14 @@ static herr_t H5C__prep_for_file_close__setup_image_entries_array(H5C_t *cache_p
 static herr_t H5C__prep_for_file_close__scan_entries(const H5F_t *f,
     H5C_t *cache_ptr);
 static herr_t H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr);
-static H5C_cache_entry_t *H5C__reconstruct_cache_entry(const H5F_t *f,
-    H5C_t *cache_ptr, const uint8_t **buf);
+static herr_t H5C__decode_image_task(size_t idx, void *_udata);
+static int H5C__lazy_image_entry_cmp(const void *_ent1, const void *_ent2);
+static H5C_lazy_image_entry_t *H5C__find_lazy_image_entry(const H5C_t *cache_ptr,
+    haddr_t addr);
+static herr_t H5C__insert_lazy_image_entry(H5F_t *f, H5C_t *cache_ptr,
+    H5C_lazy_image_entry_t *lazy_ent);
+static herr_t H5C__reconstruct_cache_entry(const H5F_t *f, H5C_t *cache_ptr,
+    hbool_t file_is_rw, const uint8_t *buf, H5C_cache_entry_t *pf_entry_ptr);
 static herr_t H5C__write_cache_image_superblock_msg(H5F_t *f, hbool_t create);
 static herr_t H5C__read_cache_image(H5F_t * f, H5C_t *cache_ptr);
 static herr_t H5C__write_cache_image(H5F_t *f, const H5C_t *cache_ptr);
@@ -862,6 +883,37 @@ H5C__free_image_entries_array(H5C_t * cache_ptr)
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5C__free_image_entries_array() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__free_lazy_image_entries
+ *
+ * Purpose:     Release the list of entries left in a loaded cache image
+ *		(see H5C__reconstruct_cache_contents()), along with the
+ *		image buffer they are in.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__free_lazy_image_entries(H5C_t *cache_ptr)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(cache_ptr->lazy_image_entries);
+    HDassert(cache_ptr->image_buffer);
+
+    cache_ptr->lazy_image_entries = (H5C_lazy_image_entry_t *)H5MM_xfree(cache_ptr->lazy_image_entries);
+    cache_ptr->num_lazy_image_entries = 0;
+    cache_ptr->num_lazy_image_entries_left = 0;
+    cache_ptr->image_buffer = H5MM_xfree(cache_ptr->image_buffer);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5C__free_lazy_image_entries() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C_force_cache_image_load()
@@ -1154,8 +1206,9 @@ H5C__load_cache_image(H5F_t *f)
         if(H5C__reconstruct_cache_contents(f, cache_ptr) < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_CANTDECODE, FAIL, "Can't reconstruct cache contents from image block")
 
-        /* Free the image buffer */
-        cache_ptr->image_buffer = H5MM_xfree(cache_ptr->image_buffer);
+        /* Free the image buffer, unless entries were left in it */
+        if(NULL == cache_ptr->lazy_image_entries)
+            cache_ptr->image_buffer = H5MM_xfree(cache_ptr->image_buffer);
 
         /* Update stats -- must do this now, as we are about
          * to discard the size of the cache image.
@@ -1233,6 +1286,84 @@ H5C_load_cache_image_on_next_protect(H5F_t *f, haddr_t addr, hsize_t len,
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5C_load_cache_image_on_next_protect() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__load_lazy_image_entry
+ *
+ * Purpose:     If the entry at ADDR was left in the loaded cache image
+ *		(see H5C__reconstruct_cache_contents()), insert it in the
+ *		cache as a prefetched entry, so that the protect in
+ *		progress finds it there.  Otherwise, do nothing.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__load_lazy_image_entry(H5F_t *f, H5C_t *cache_ptr, haddr_t addr)
+{
+    H5C_lazy_image_entry_t *lazy_ent;   /* Entry left in the image */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(cache_ptr->num_lazy_image_entries_left > 0);
+
+    /* Insert the entry, if it's still in the image */
+    if(NULL != (lazy_ent = H5C__find_lazy_image_entry(cache_ptr, addr)) && lazy_ent->image)
+        if(H5C__insert_lazy_image_entry(f, cache_ptr, lazy_ent) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTINSERT, FAIL, "can't insert entry from cache image")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__load_lazy_image_entry() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__discard_lazy_image_entry
+ *
+ * Purpose:     If the entry at ADDR was left in the loaded cache image,
+ *		forget it, as the file space it was in has been reused or
+ *		the entry is being expunged.  Otherwise, do nothing.
+ *
+ *		Once no entries are left in the image, the image buffer
+ *		is released.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__discard_lazy_image_entry(H5C_t *cache_ptr, haddr_t addr)
+{
+    H5C_lazy_image_entry_t *lazy_ent;   /* Entry left in the image */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(cache_ptr->num_lazy_image_entries_left > 0);
+
+    if(NULL != (lazy_ent = H5C__find_lazy_image_entry(cache_ptr, addr)) && lazy_ent->image) {
+        lazy_ent->image = NULL;
+        cache_ptr->num_lazy_image_entries_left--;
+
+        /* Release the image once it has no more entries to insert */
+        if(0 == cache_ptr->num_lazy_image_entries_left)
+            if(H5C__free_lazy_image_entries(cache_ptr) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTFREE, FAIL, "can't release cache image entries")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__discard_lazy_image_entry() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C__image_entry_cmp
@@ -1389,6 +1520,18 @@ H5C__prep_image_for_file_close(H5F_t *f, hbool_t *image_generated)
 
     /* Generate the cache image, if requested */
     if(cache_ptr->image_ctl.generate_image) {
+        /* Insert any entries left in the old image, so that the new
+         * image keeps them
+         */
+        if(cache_ptr->num_lazy_image_entries_left > 0) {
+            size_t u;           /* Local index variable */
+
+            for(u = 0; cache_ptr->num_lazy_image_entries_left > 0; u++)
+                if(cache_ptr->lazy_image_entries[u].image)
+                    if(H5C__insert_lazy_image_entry(f, cache_ptr, &cache_ptr->lazy_image_entries[u]) < 0)
+                        HGOTO_ERROR(H5E_CACHE, H5E_CANTINSERT, FAIL, "can't insert entry from cache image")
+        } /* end if */
+
         /* Create the cache image super block extension message.
          * 
          * Note that the base address and length of the metadata cache
@@ -3081,6 +3224,17 @@ done:
  *		reconstruct any flush dependencies.  Order the entries 
  *		in the LRU as indicated by the stored lru_ranks.
  *
+ *		The entries are decoded, and the image checksum is
+ *		verified, by up to f->shared->mdc_image_nthreads threads.
+ *		Only their insertion in the cache is done serially.
+ *
+ *		If lazy loading of the image was requested, clean entries
+ *		that aren't in any flush dependency are instead left in
+ *		the image buffer, and inserted in the cache by
+ *		H5C__load_lazy_image_entry() when they are first
+ *		protected.  In a parallel open, every process thus only
+ *		builds the entries it uses.
+ *
  * Return:      SUCCEED on success, and FAIL on failure.
  *
  * Programmer:  John Mainzer
@@ -3091,10 +3245,25 @@ done:
 static herr_t
 H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr)
 {
+    H5C_image_decode_t  udata;          /* Info for decoding tasks */
+    H5C_cache_entry_t **pf_entries = NULL; /* Prefetched entries to insert */
+    const uint8_t **	pf_images = NULL;  /* Start of those entries in the image */
     H5C_cache_entry_t *	pf_entry_ptr;   /* Pointer to prefetched entry */
     H5C_cache_entry_t *	parent_ptr;     /* Pointer to parent of prefetched entry */
     const uint8_t *	p;              /* Pointer into image buffer */
-    unsigned		u, v;           /* Local index variable */
+    const uint8_t *	p_end;          /* End of the entries in the image buffer */
+    size_t              entry_header_size; /* Size of an entry header in the image */
+    size_t              num_pf_entries = 0; /* # of entries to insert now */
+    size_t              num_inserted = 0;   /* # of those inserted so far */
+    size_t              num_lazy = 0;   /* # of entries left in the image */
+    size_t              npieces = 0;    /* # of tasks decoding entries */
+    size_t              ntasks;         /* # of decoding tasks, with the checksum */
+    unsigned            nthreads;       /* # of threads to decode with */
+    hbool_t             file_is_rw;     /* Whether the file is opened R/W */
+    hbool_t             lazy_load;      /* Whether entries may be left in the image */
+    herr_t              status = SUCCEED;   /* Status of decoding tasks */
+    size_t		u;              /* Local index variable */
+    unsigned		v;              /* Local index variable */
     herr_t 		ret_value = SUCCEED;      /* Return value */
 
     FUNC_ENTER_STATIC
@@ -3107,6 +3276,7 @@ H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr)
     HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
     HDassert(cache_ptr->image_buffer);
     HDassert(cache_ptr->image_len > 0);
+    HDassert(cache_ptr->lazy_image_entries == NULL);
 
     /* Decode metadata cache image header */
     p = (uint8_t *)cache_ptr->image_buffer;
@@ -3119,13 +3289,121 @@ H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr)
     HDassert(cache_ptr->image_data_len <= cache_ptr->image_len);
     HDassert(cache_ptr->num_entries_in_image > 0);
 
-    /* Reconstruct entries in image */
+    /* Key R/W access off of whether the image will be deleted */
+    file_is_rw = cache_ptr->delete_image;
+
+    /* Check whether entries may be left in the image */
+    lazy_load = f->shared->mdc_image_lazy_load;
+
+    /* Allocate the lists of entries to insert now, and of those
+     * left in the image
+     */
+    if(NULL == (pf_images = (const uint8_t **)H5MM_malloc(cache_ptr->num_entries_in_image * sizeof(const uint8_t *))))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for cache image entry list")
+    if(lazy_load)
+        if(NULL == (cache_ptr->lazy_image_entries = (H5C_lazy_image_entry_t *)H5MM_malloc(cache_ptr->num_entries_in_image * sizeof(H5C_lazy_image_entry_t))))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for cache image entry list")
+
+    /* Find the start of each entry in the image, checking that the entries
+     * fill the image up to its checksum
+     */
+    entry_header_size = H5C__cache_image_block_entry_header_size(f);
+    p_end = (const uint8_t *)cache_ptr->image_buffer + cache_ptr->image_data_len - H5F_SIZEOF_CHKSUM;
     for(u = 0; u < cache_ptr->num_entries_in_image; u++) {
-	/* Create the prefetched entry described by the ith
-         * entry in cache_ptr->image_entrise.
+        const uint8_t *q;               /* Pointer into entry header */
+        uint8_t flags;                  /* Entry flags */
+        uint16_t fd_parent_count;       /* # of flush dependency parents */
+        haddr_t addr;                   /* Entry offset */
+        size_t size = 0;                /* Entry length */
+        size_t len_left;                /* Space left in image after entry header */
+        size_t parents_len;             /* Size of flush dependency parent addresses */
+
+        if(p > p_end || (size_t)(p_end - p) < entry_header_size)
+            HGOTO_ERROR(H5E_CACHE, H5E_BADSIZE, FAIL, "cache image entry header overruns image")
+
+        /* Decode flags, parent count, offset and length, skipping the
+         * type, ring, age, child counts and LRU rank
          */
-	if(NULL == (pf_entry_ptr = H5C__reconstruct_cache_entry(f, cache_ptr, &p)))
-            HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "reconstruction of cache entry failed")
+        q = p + 1;
+        flags = *q++;
+        q += 6;
+        UINT16DECODE(q, fd_parent_count);
+        q += 4;
+        H5F_addr_decode(f, &q, &addr);
+        H5F_DECODE_LENGTH(f, q, size);
+
+        len_left = (size_t)(p_end - p) - entry_header_size;
+        parents_len = (size_t)fd_parent_count * H5F_SIZEOF_ADDR(f);
+        if(parents_len > len_left || size > len_left - parents_len)
+            HGOTO_ERROR(H5E_CACHE, H5E_BADSIZE, FAIL, "cache image entry overruns image")
+
+        if(lazy_load && H5F_addr_defined(addr) && size > 0 &&
+                0 == (flags & (H5C__MDCI_ENTRY_DIRTY_FLAG | H5C__MDCI_ENTRY_IS_FD_PARENT_FLAG | H5C__MDCI_ENTRY_IS_FD_CHILD_FLAG))) {
+            cache_ptr->lazy_image_entries[num_lazy].addr = addr;
+            cache_ptr->lazy_image_entries[num_lazy].image = p;
+            num_lazy++;
+        } /* end if */
+        else
+            pf_images[num_pf_entries++] = p;
+
+        p += entry_header_size + parents_len + size;
+    } /* end for */
+    if(p != p_end)
+        HGOTO_ERROR(H5E_CACHE, H5E_BADSIZE, FAIL, "Bad metadata cache image data length")
+
+    /* Sort the entries left in the image, for H5C__load_lazy_image_entry() */
+    if(num_lazy > 0) {
+        HDqsort(cache_ptr->lazy_image_entries, num_lazy, sizeof(H5C_lazy_image_entry_t), H5C__lazy_image_entry_cmp);
+        cache_ptr->num_lazy_image_entries = num_lazy;
+        cache_ptr->num_lazy_image_entries_left = num_lazy;
+    } /* end if */
+    else
+        cache_ptr->lazy_image_entries = (H5C_lazy_image_entry_t *)H5MM_xfree(cache_ptr->lazy_image_entries);
+
+    /* Allocate the prefetched entries to decode */
+    if(num_pf_entries > 0) {
+        if(NULL == (pf_entries = (H5C_cache_entry_t **)H5MM_calloc(num_pf_entries * sizeof(H5C_cache_entry_t *))))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for prefetched entry list")
+        for(u = 0; u < num_pf_entries; u++)
+            if(NULL == (pf_entries[u] = H5FL_CALLOC(H5C_cache_entry_t)))
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for prefetched cache entry")
+
+        /* Spread the entries across the threads */
+        nthreads = MAX(f->shared->mdc_image_nthreads, 1);
+        npieces = MIN(nthreads, num_pf_entries / H5C_IMAGE_DECODE_MIN_ENTRIES);
+        npieces = MAX(npieces, 1);
+    } /* end if */
+    else
+        nthreads = 1;
+
+    /* Decode the entries, and verify the image checksum in one more task */
+    udata.f = f;
+    udata.cache_ptr = cache_ptr;
+    udata.file_is_rw = file_is_rw;
+    udata.images = pf_images;
+    udata.entries = pf_entries;
+    udata.nentries = num_pf_entries;
+    udata.piece_nentries = npieces > 0 ? (num_pf_entries + npieces - 1) / npieces : 0;
+    udata.chksum_ok = FALSE;
+    ntasks = npieces + 1;
+#ifdef H5_HAVE_THREADSAFE
+    if(nthreads > 1 && npieces > 1)
+        status = H5TS_run_tasks(nthreads, ntasks, H5C__decode_image_task, &udata);
+    else
+#endif /* H5_HAVE_THREADSAFE */
+        for(u = 0; u < ntasks; u++)
+            if(H5C__decode_image_task(u, &udata) < 0) {
+                status = FAIL;
+                break;
+            } /* end if */
+    if(!udata.chksum_ok)
+        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "bad checksum on cache image")
+    if(status < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "reconstruction of cache entry failed")
+
+    /* Insert the decoded entries in the cache */
+    for(u = 0; u < num_pf_entries; u++) {
+        pf_entry_ptr = pf_entries[u];
 
 	/* Note that we make no checks on available cache space before 
          * inserting the reconstructed entry into the metadata cache.
@@ -3137,6 +3415,7 @@ H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr)
 
 	/* Insert the prefetched entry in the index */
 	H5C__INSERT_IN_INDEX(cache_ptr, pf_entry_ptr, FAIL)
+        num_inserted++;
 
 	/* If dirty, insert the entry into the slist. */
 	if(pf_entry_ptr->is_dirty)
@@ -3171,7 +3450,7 @@ H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr)
              */
             H5C__UPDATE_RP_FOR_PROTECT(cache_ptr, parent_ptr, FAIL)
             parent_ptr->is_protected = TRUE;
-	    
+
 	    /* Setup the flush dependency */
 	    if(H5C_create_flush_dependency(parent_ptr, pf_entry_ptr) < 0)
 		HGOTO_ERROR(H5E_CACHE, H5E_CANTDEPEND, FAIL, "Can't restore flush dependency")
@@ -3250,8 +3529,10 @@ H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr)
          * epoch markers on reconstruction of the cache -- thus 
          * the following sanity check will have to be revised when
          * we add code to store and restore adaptive resize status.
+         *
+         * Entries left in the image leave holes of their own.
          */
-	HDassert(lru_rank_holes <= H5C__MAX_EPOCH_MARKERS);
+	HDassert(num_lazy > 0 || lru_rank_holes <= H5C__MAX_EPOCH_MARKERS);
     } /* end block */
 #endif /* NDEBUG */
 
@@ -3276,32 +3557,228 @@ H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr)
     } /* end if */
 
 done:
+    /* Release the entries that weren't inserted in the cache */
+    if(pf_entries) {
+        for(u = num_inserted; u < num_pf_entries; u++)
+            if(pf_entries[u]) {
+                pf_entries[u]->image_ptr = H5MM_xfree(pf_entries[u]->image_ptr);
+                pf_entries[u]->fd_parent_addrs = (haddr_t *)H5MM_xfree(pf_entries[u]->fd_parent_addrs);
+                pf_entries[u] = H5FL_FREE(H5C_cache_entry_t, pf_entries[u]);
+            } /* end if */
+        pf_entries = (H5C_cache_entry_t **)H5MM_xfree(pf_entries);
+    } /* end if */
+    pf_images = (const uint8_t **)H5MM_xfree(pf_images);
+
+    /* Don't leave any entries in the image on failure */
+    if(ret_value < 0 && cache_ptr->lazy_image_entries) {
+        cache_ptr->lazy_image_entries = (H5C_lazy_image_entry_t *)H5MM_xfree(cache_ptr->lazy_image_entries);
+        cache_ptr->num_lazy_image_entries = 0;
+        cache_ptr->num_lazy_image_entries_left = 0;
+    } /* end if */
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__reconstruct_cache_contents() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__decode_image_task()
+ *
+ * Purpose:     Task for H5C__reconstruct_cache_contents(): task 0
+ *		verifies the checksum of the cache image, and every other
+ *		task decodes its share of the prefetched entries.
+ *
+ * Note:        Runs on helper threads, so doesn't push errors on the
+ *		error stack.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__decode_image_task(size_t idx, void *_udata)
+{
+    H5C_image_decode_t *udata = (H5C_image_decode_t *)_udata;
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(0 == idx) {
+        const uint8_t *image = (const uint8_t *)udata->cache_ptr->image_buffer;
+        size_t chksum_off = udata->cache_ptr->image_data_len - H5F_SIZEOF_CHKSUM;
+        const uint8_t *p = image + chksum_off;
+        uint32_t stored_chksum;         /* Checksum stored in the image */
+
+        UINT32DECODE(p, stored_chksum);
+        if(stored_chksum != H5_checksum_metadata(image, chksum_off, 0))
+            HGOTO_DONE(FAIL)
+        udata->chksum_ok = TRUE;
+    } /* end if */
+    else {
+        size_t start = (idx - 1) * udata->piece_nentries;
+        size_t end = MIN(start + udata->piece_nentries, udata->nentries);
+        size_t u;                       /* Local index variable */
+
+        for(u = start; u < end; u++)
+            if(H5C__reconstruct_cache_entry(udata->f, udata->cache_ptr, udata->file_is_rw, udata->images[u], udata->entries[u]) < 0)
+                HGOTO_DONE(FAIL)
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__decode_image_task() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__lazy_image_entry_cmp
+ *
+ * Purpose:     Comparison callback for qsort(3) on entries left in the
+ *		cache image, ordering them by address.
+ *
+ * Return:      An integer less than, equal to, or greater than zero if
+ *		the first entry's address is less than, equal to, or
+ *		greater than the second one's.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5C__lazy_image_entry_cmp(const void *_ent1, const void *_ent2)
+{
+    const H5C_lazy_image_entry_t *ent1 = (const H5C_lazy_image_entry_t *)_ent1;
+    const H5C_lazy_image_entry_t *ent2 = (const H5C_lazy_image_entry_t *)_ent2;
+    int ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(H5F_addr_lt(ent1->addr, ent2->addr))
+        ret_value = -1;
+    else if(H5F_addr_gt(ent1->addr, ent2->addr))
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__lazy_image_entry_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__find_lazy_image_entry
+ *
+ * Purpose:     Look for the entry at ADDR among those left in the loaded
+ *		cache image.
+ *
+ * Return:      Pointer to the entry's element of lazy_image_entries, or
+ *		NULL if there isn't one.
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5C_lazy_image_entry_t *
+H5C__find_lazy_image_entry(const H5C_t *cache_ptr, haddr_t addr)
+{
+    size_t lo, hi;                      /* Bounds of binary search */
+    H5C_lazy_image_entry_t *ret_value = NULL;   /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(cache_ptr->lazy_image_entries);
+
+    lo = 0;
+    hi = cache_ptr->num_lazy_image_entries;
+    while(lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if(H5F_addr_lt(cache_ptr->lazy_image_entries[mid].addr, addr))
+            lo = mid + 1;
+        else if(H5F_addr_gt(cache_ptr->lazy_image_entries[mid].addr, addr))
+            hi = mid;
+        else {
+            ret_value = &cache_ptr->lazy_image_entries[mid];
+            break;
+        } /* end else */
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__find_lazy_image_entry() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__insert_lazy_image_entry
+ *
+ * Purpose:     Insert an entry left in the loaded cache image in the
+ *		cache, as a prefetched entry.
+ *
+ *		Once the last entry left in the image has been inserted,
+ *		the image buffer is released.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__insert_lazy_image_entry(H5F_t *f, H5C_t *cache_ptr,
+    H5C_lazy_image_entry_t *lazy_ent)
+{
+    H5C_cache_entry_t *pf_entry_ptr = NULL;     /* Reconstructed cache entry */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(cache_ptr);
+    HDassert(lazy_ent);
+    HDassert(lazy_ent->image);
+
+    if(NULL == (pf_entry_ptr = H5FL_CALLOC(H5C_cache_entry_t)))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for prefetched cache entry")
+    if(H5C__reconstruct_cache_entry(f, cache_ptr, cache_ptr->delete_image, lazy_ent->image, pf_entry_ptr) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "reconstruction of cache entry failed")
+    HDassert(pf_entry_ptr->addr == lazy_ent->addr);
+    HDassert(!pf_entry_ptr->is_dirty);
+    HDassert(pf_entry_ptr->fd_parent_count == 0 && pf_entry_ptr->fd_child_count == 0);
+
+    lazy_ent->image = NULL;
+    cache_ptr->num_lazy_image_entries_left--;
+
+    /* Insert the prefetched entry in the index and the LRU */
+    H5C__INSERT_IN_INDEX(cache_ptr, pf_entry_ptr, FAIL)
+    H5C__UPDATE_RP_FOR_INSERTION(cache_ptr, pf_entry_ptr, FAIL)
+    H5C__UPDATE_STATS_FOR_PREFETCH(cache_ptr, FALSE)
+    pf_entry_ptr = NULL;
+
+    /* Release the image once it has no more entries to insert */
+    if(0 == cache_ptr->num_lazy_image_entries_left)
+        if(H5C__free_lazy_image_entries(cache_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFREE, FAIL, "can't release cache image entries")
+
+done:
+    if(pf_entry_ptr)
+        pf_entry_ptr = H5FL_FREE(H5C_cache_entry_t, pf_entry_ptr);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__insert_lazy_image_entry() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C__reconstruct_cache_entry()
  *
- * Purpose:     Allocate a prefetched metadata cache entry and initialize
- *		it from image buffer.
+ * Purpose:     Initialize a prefetched metadata cache entry, allocated
+ *		and zeroed by the caller, from its image in the cache
+ *		image buffer.
  *
- *		Return a pointer to the newly allocated cache entry,
- *		or NULL on failure.
+ *		May run on helper threads (see H5C__decode_image_task()),
+ *		so doesn't push errors on the error stack.  On failure,
+ *		releases anything it allocated, but not the entry itself.
  *
- * Return:      Pointer to the new instance of H5C_cache_entry on success, 
- *		or NULL on failure.
+ * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  John Mainzer
  *              8/14/15
  *
  *-------------------------------------------------------------------------
  */
-static H5C_cache_entry_t *
+static herr_t
 H5C__reconstruct_cache_entry(const H5F_t *f, H5C_t *cache_ptr,
-    const uint8_t **buf)
+    hbool_t file_is_rw, const uint8_t *buf, H5C_cache_entry_t *pf_entry_ptr)
 {
-    H5C_cache_entry_t *pf_entry_ptr = NULL;     /* Reconstructed cache entry */
     uint8_t             flags = 0;
     hbool_t		is_dirty = FALSE;
 #ifndef NDEBUG	/* only used in assertions */
@@ -3310,26 +3787,19 @@ H5C__reconstruct_cache_entry(const H5F_t *f, H5C_t *cache_ptr,
     hbool_t		is_fd_child = FALSE;
 #endif /* NDEBUG */ /* only used in assertions */
     const uint8_t *	p;
-    hbool_t            file_is_rw;
-    H5C_cache_entry_t *ret_value = NULL;        /* Return value */
+    herr_t              ret_value = SUCCEED;    /* Return value */
 
-    FUNC_ENTER_STATIC
+    FUNC_ENTER_STATIC_NOERR
 
     /* Sanity checks */
     HDassert(cache_ptr);
     HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
     HDassert(cache_ptr->num_entries_in_image > 0);
-    HDassert(buf && *buf);
-
-    /* Key R/W access off of whether the image will be deleted */
-    file_is_rw = cache_ptr->delete_image;
-
-    /* Allocate space for the prefetched cache entry */
-    if(NULL == (pf_entry_ptr = H5FL_CALLOC(H5C_cache_entry_t)))
-	HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, NULL, "memory allocation failed for prefetched cache entry")
+    HDassert(buf);
+    HDassert(pf_entry_ptr);
 
     /* Get pointer to buffer */
-    p = *buf;
+    p = buf;
 
     /* Decode type id */
     pf_entry_ptr->prefetch_type_id = *p++;
@@ -3378,7 +3848,7 @@ H5C__reconstruct_cache_entry(const H5F_t *f, H5C_t *cache_ptr,
     if(!file_is_rw) 
         pf_entry_ptr->fd_dirty_child_count      = 0;
     if(pf_entry_ptr->fd_dirty_child_count > pf_entry_ptr->fd_child_count)
-        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, NULL, "invalid dirty flush dependency child count")
+        HGOTO_DONE(FAIL)
 
     /* Decode dependency parent count */
     UINT16DECODE(p, pf_entry_ptr->fd_parent_count);
@@ -3391,17 +3861,17 @@ H5C__reconstruct_cache_entry(const H5F_t *f, H5C_t *cache_ptr,
     /* Decode entry offset */
     H5F_addr_decode(f, &p, &pf_entry_ptr->addr);
     if(!H5F_addr_defined(pf_entry_ptr->addr))
-        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, NULL, "invalid entry offset")
+        HGOTO_DONE(FAIL)
 
     /* Decode entry length */
     H5F_DECODE_LENGTH(f, p, pf_entry_ptr->size);
     if(pf_entry_ptr->size == 0)
-        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, NULL, "invalid entry size")
+        HGOTO_DONE(FAIL)
 
     /* Verify expected length of entry image */
-    if((size_t)(p - *buf) != H5C__cache_image_block_entry_header_size(f))
-        HGOTO_ERROR(H5E_CACHE, H5E_BADSIZE, NULL, "Bad entry image len")
-    
+    if((size_t)(p - buf) != H5C__cache_image_block_entry_header_size(f))
+        HGOTO_DONE(FAIL)
+
     /* If parent count greater than zero, allocate array for parent 
      * addresses, and decode addresses into the array.
      */
@@ -3409,25 +3879,24 @@ H5C__reconstruct_cache_entry(const H5F_t *f, H5C_t *cache_ptr,
         unsigned u;          /* Local index variable */
 
         if(NULL == (pf_entry_ptr->fd_parent_addrs = (haddr_t *)H5MM_malloc((size_t)(pf_entry_ptr->fd_parent_count) * H5F_SIZEOF_ADDR(f))))
-	    HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, NULL, "memory allocation failed for fd parent addrs buffer")
+	    HGOTO_DONE(FAIL)
 
 	for(u = 0; u < pf_entry_ptr->fd_parent_count; u++) {
             H5F_addr_decode(f, &p, &(pf_entry_ptr->fd_parent_addrs[u]));
             if(!H5F_addr_defined(pf_entry_ptr->fd_parent_addrs[u]))
-                HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, NULL, "invalid flush dependency parent offset")
+                HGOTO_DONE(FAIL)
         } /* end for */
     } /* end if */
 
     /* Allocate buffer for entry image */
     if(NULL == (pf_entry_ptr->image_ptr = H5MM_malloc(pf_entry_ptr->size + H5C_IMAGE_EXTRA_SPACE)))
-	HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, NULL, "memory allocation failed for on disk image buffer")
+	HGOTO_DONE(FAIL)
 #if H5C_DO_MEMORY_SANITY_CHECKS
-    H5MM_memcpy(((uint8_t *)pf_entry_ptr->image_ptr) + size, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE);
+    H5MM_memcpy(((uint8_t *)pf_entry_ptr->image_ptr) + pf_entry_ptr->size, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE);
 #endif /* H5C_DO_MEMORY_SANITY_CHECKS */
 
     /* Copy the entry image from the cache image block */
     H5MM_memcpy(pf_entry_ptr->image_ptr, p, pf_entry_ptr->size);
-    p += pf_entry_ptr->size;
 
     /* Initialize the rest of the fields in the prefetched entry */
     /* (Only need to set non-zero/NULL/FALSE fields, due to calloc() above) */
@@ -3441,14 +3910,9 @@ H5C__reconstruct_cache_entry(const H5F_t *f, H5C_t *cache_ptr,
     /* Sanity checks */
     HDassert(pf_entry_ptr->size > 0 && pf_entry_ptr->size < H5C_MAX_ENTRY_SIZE);
 
-    /* Update buffer pointer */
-    *buf = p;
-
-    ret_value = pf_entry_ptr;
-
 done:
-    if(NULL == ret_value && pf_entry_ptr)
-        pf_entry_ptr = H5FL_FREE(H5C_cache_entry_t, pf_entry_ptr);
+    if(ret_value < 0)
+        pf_entry_ptr->fd_parent_addrs = (haddr_t *)H5MM_xfree(pf_entry_ptr->fd_parent_addrs);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__reconstruct_cache_entry() */
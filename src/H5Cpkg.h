@@ -3453,6 +3453,26 @@ typedef struct H5C_tag_info_t {
 } H5C_tag_info_t;
 
 
+/****************************************************************************
+ *
+ * structure H5C_lazy_image_entry_t
+ *
+ * An entry of the metadata cache image that was left in the image buffer
+ * when the image was loaded, to be made into a prefetched entry the first
+ * time it is protected (see H5C__load_lazy_image_entry()).
+ *
+ * addr: Base address of the entry in the file.
+ *
+ * image: Pointer to the start of the entry in the cache image buffer, or
+ *		NULL once the entry has been inserted into the cache.
+ *
+ ****************************************************************************/
+typedef struct H5C_lazy_image_entry_t {
+    haddr_t addr;               /* Address of the entry */
+    const uint8_t *image;       /* Entry in the image buffer */
+} H5C_lazy_image_entry_t;
+
+
 /****************************************************************************
  *
  * structure H5C_t
@@ -4280,6 +4300,21 @@ typedef struct H5C_tag_info_t {
  *		image_len in which the metadata cache image is assembled, 
  *		or NULL if that	buffer does not exist.
  *
+ * The following fields keep track of the entries of a loaded metadata
+ * cache image that were left in the image buffer (see
+ * H5Pset_mdc_image_load()).  The image buffer is kept until the last
+ * of them is inserted into the cache, or the cache is shut down.
+ *
+ * num_lazy_image_entries: Number of entries in lazy_image_entries.
+ *
+ * num_lazy_image_entries_left: Number of entries in lazy_image_entries
+ *		that haven't been inserted into the cache yet.
+ *
+ * lazy_image_entries: Pointer to a dynamically allocated array of
+ *		num_lazy_image_entries instances of H5C_lazy_image_entry_t,
+ *		sorted by address, for the entries left in the image
+ *		buffer, or NULL if there are no such entries.
+ *
  *
  * Free Space Manager Related fields:
  *
@@ -4787,6 +4822,11 @@ struct H5C_t {
     H5C_image_entry_t *		image_entries;
     void *                      image_buffer;
 
+    /* fields supporting lazy loading of a cache image */
+    size_t                      num_lazy_image_entries;
+    size_t                      num_lazy_image_entries_left;
+    H5C_lazy_image_entry_t *    lazy_image_entries;
+
     /* Free Space Manager Related fields */
     hbool_t 			rdfsm_settled;
     hbool_t			mdfsm_settled;
@@ -4906,6 +4946,9 @@ H5_DLL herr_t H5C__flush_single_entry(H5F_t *f, H5C_cache_entry_t *entry_ptr,
     unsigned flags);
 H5_DLL herr_t H5C__generate_cache_image(H5F_t *f, H5C_t *cache_ptr);
 H5_DLL herr_t H5C__load_cache_image(H5F_t *f);
+H5_DLL herr_t H5C__load_lazy_image_entry(H5F_t *f, H5C_t *cache_ptr,
+    haddr_t addr);
+H5_DLL herr_t H5C__free_lazy_image_entries(H5C_t *cache_ptr);
 H5_DLL herr_t H5C__mark_flush_dep_serialized(H5C_cache_entry_t * entry_ptr);
 H5_DLL herr_t H5C__mark_flush_dep_unserialized(H5C_cache_entry_t * entry_ptr);
 H5_DLL herr_t H5C__make_space_in_cache(H5F_t * f, size_t  space_needed,
@@ -2283,6 +2283,9 @@ H5_DLL herr_t H5C_prep_for_file_close(H5F_t *f);
 H5_DLL herr_t H5C_create_flush_dependency(void *parent_thing, void *child_thing);
 H5_DLL void * H5C_protect(H5F_t *f, const H5C_class_t *type, haddr_t addr,
     void *udata, unsigned flags);
+H5_DLL herr_t H5C_protect_multi(H5F_t *f, const H5C_class_t *type,
+    size_t count, const haddr_t addrs[], void *udata[], unsigned flags,
+    void *things[]);
 H5_DLL herr_t H5C_reset_cache_hit_rate_stats(H5C_t *cache_ptr);
 H5_DLL herr_t H5C_resize_entry(void *thing, size_t new_size);
 H5_DLL herr_t H5C_set_cache_auto_resize_config(H5C_t *cache_ptr, H5C_auto_size_ctl_t *config_ptr);
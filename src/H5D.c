@@ -307,6 +307,52 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dopen2() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dopen_async
+ *
+ * Purpose:     Opens an existing dataset, like H5Dopen2, as an operation
+ *              of the event set ES_ID.  If the open is still in progress
+ *              when this returns, the ID returned waits for it the first
+ *              time it is used, and stops being valid if the open fails.
+ *
+ * Return:      Success:    Object ID of the dataset
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5Dopen_async(hid_t loc_id, const char *name, hid_t dapl_id, hid_t es_id)
+{
+    hid_t               ret_value   = H5I_INVALID_HID;  /* Return value */
+
+    FUNC_ENTER_API(H5I_INVALID_HID)
+    H5TRACE4("i", "i*sii", loc_id, name, dapl_id, es_id);
+
+    /* Check args */
+    if(!name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, H5I_INVALID_HID, "name parameter cannot be NULL")
+    if(!*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, H5I_INVALID_HID, "name parameter cannot be an empty string")
+    if(H5I_EVENTSET != H5I_get_type(es_id))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, H5I_INVALID_HID, "es_id is not an event set ID")
+
+    /* Verify access property list and set up collective metadata if appropriate */
+    if(H5CX_set_apl(&dapl_id, H5P_CLS_DACC, loc_id, FALSE) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, H5I_INVALID_HID, "can't set access property list info")
+
+    /* Check the location */
+    if(NULL == H5I_object(loc_id))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, H5I_INVALID_HID, "invalid location identifier")
+
+    /* Open the dataset */
+    if((ret_value = H5VL_dataset_open_async(loc_id, name, dapl_id, es_id)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, H5I_INVALID_HID, "unable to open dataset")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dopen_async() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Dclose
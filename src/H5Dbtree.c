@@ -190,7 +190,8 @@ H5B_class_t H5B_BTREE[1] = {{
     H5D__btree_remove,		/*remove		*/
     H5D__btree_decode_key,	/*decode		*/
     H5D__btree_encode_key,	/*encode		*/
-    H5D__btree_debug_key	/*debug			*/
+    H5D__btree_debug_key,	/*debug			*/
+    NULL			/*child class		*/
 }};
 
 
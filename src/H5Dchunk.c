@@ -112,6 +112,22 @@
 #define H5D_RDCC_NEWLY_DISABLED_FILTERS 0x02u   /* Filters have been disabled since
                                                  * the last flush */
 
+/* Number of chunks per filter thread in each batch of chunks filtered
+ * concurrently (see H5Pset_filter_nthreads) */
+#define H5D_CHUNK_FILTER_BATCH_FACTOR   2
+
+/* Sizes of the 2Q policy's queues (see H5Pset_chunk_cache_policy): the
+ * A1in FIFO queue gets 1/4 of the cache's bytes and the ghost list keeps
+ * the keys of as many chunks as fit in 1/2 of the cache */
+#define H5D_RDCC_2Q_A1IN_DIV    4
+#define H5D_RDCC_2Q_A1OUT_DIV   2
+
+/* A direct read of several chunks looks them all up with one pass over the
+ * chunk index when there are at least 1/H5D_CHUNK_DIRECT_ITER_RATIO as many
+ * chunks to read as there are chunks in the dataset, instead of querying the
+ * index for each chunk */
+#define H5D_CHUNK_DIRECT_ITER_RATIO     8
+
 
 /******************/
 /* Local Typedefs */
@@ -129,7 +145,11 @@ typedef struct H5D_rdcc_ent_t {
     H5F_block_t chunk_block;    /*offset/length of chunk in file        */
     hsize_t     chunk_idx;      /*index of chunk in dataset             */
     uint8_t    *chunk;        /*the unfiltered chunk data        */
+    uint8_t    *filt_chunk;    /*pre-filtered copy of chunk data, if any */
+    size_t      filt_nbytes;    /*size of pre-filtered chunk data    */
+    unsigned    filt_mask;    /*filter mask for pre-filtered data    */
     unsigned    idx;        /*index in hash table            */
+    hbool_t     hot;        /*accessed again since it was preempted (2Q) */
     struct H5D_rdcc_ent_t *next;/*next item in doubly-linked list    */
     struct H5D_rdcc_ent_t *prev;/*previous item in doubly-linked list    */
     struct H5D_rdcc_ent_t *tmp_next;/*next item in temporary doubly-linked list */
@@ -137,6 +157,14 @@ typedef struct H5D_rdcc_ent_t {
 } H5D_rdcc_ent_t;
 typedef H5D_rdcc_ent_t *H5D_rdcc_ent_ptr_t; /* For free lists */
 
+/* Chunks recently preempted from the FIFO queue of a cache using the 2Q
+ * policy are remembered by their key, without their data: */
+typedef struct H5D_rdcc_ghost_t {
+    hsize_t     key;        /*chunk key (see H5D__chunk_hash_key)    */
+    struct H5D_rdcc_ghost_t *next;/*next (more recent) ghost    */
+    struct H5D_rdcc_ghost_t *prev;/*previous (less recent) ghost    */
+} H5D_rdcc_ghost_t;
+
 /* Callback info for iteration to prune chunks */
 typedef struct H5D_chunk_it_ud1_t {
     H5D_chunk_common_ud_t common;       /* Common info for B-tree user data (must be first) */
@@ -236,6 +264,58 @@ typedef struct H5D_chunk_file_iter_ud_t {
 #endif /* H5_HAVE_PARALLEL */
 } H5D_chunk_file_iter_ud_t;
 
+/* Chunk read from the file ahead of time, to be run through the I/O pipeline
+ * along with the rest of its batch */
+typedef struct H5D_chunk_batch_ent_t {
+    H5D_chunk_info_t    *chunk_info;    /* Chunk's selection info */
+    H5D_chunk_ud_t      udata;          /* Chunk's index info */
+    void                *chunk;         /* Chunk data, or NULL if not pre-loaded */
+    hbool_t             filtered;       /* Whether chunk data must be unfiltered */
+    size_t              nbytes;         /* # of valid bytes in chunk buffer */
+    size_t              alloc;          /* # of bytes allocated for chunk buffer */
+} H5D_chunk_batch_ent_t;
+
+/* Callback info for running a batch of chunks through the I/O pipeline */
+typedef struct H5D_chunk_filter_ud_t {
+    const H5O_pline_t   *pline;         /* I/O pipeline */
+    size_t              chunk_size;     /* Size of an unfiltered chunk */
+    H5Z_EDC_t           err_detect;     /* Error detection info */
+    H5Z_cb_t            filter_cb;      /* I/O filter callback function */
+    H5D_chunk_batch_ent_t *bents;       /* Chunks to unfilter (reads) */
+    H5D_rdcc_ent_t      **ents;         /* Cache entries to filter (writes) */
+} H5D_chunk_filter_ud_t;
+
+/* Batch of chunks of a selection, read ahead of time */
+typedef struct H5D_chunk_batch_t {
+    H5D_chunk_batch_ent_t *ents;        /* Chunks in batch */
+    H5D_chunk_batch_ent_t **load;       /* Chunks to read, sorted by address */
+    haddr_t             *addrs;         /* File addresses of chunks to read */
+    size_t              *sizes;         /* Sizes of chunks to read */
+    void                **bufs;         /* Buffers to read chunks into */
+    size_t              max_nents;      /* Max. # of chunks in batch */
+    size_t              nents;          /* # of chunks in batch */
+    size_t              curr;           /* # of chunks in batch used so far */
+    size_t              nfiltered;      /* # of chunks to unfilter */
+    H5D_chunk_filter_ud_t fudata;       /* Info for unfiltering the chunks */
+#ifdef H5_HAVE_THREADSAFE
+    H5TS_task_group_t   *tasks;         /* Chunks being unfiltered in the background */
+#endif /* H5_HAVE_THREADSAFE */
+} H5D_chunk_batch_t;
+
+/* Chunk of a direct read or write of several chunks */
+typedef struct H5D_chunk_direct_ent_t {
+    H5D_chunk_ud_t      udata;          /* Chunk's index info */
+    size_t              req;            /* Position of chunk in caller's arrays */
+    hbool_t             need_insert;    /* Whether the chunk must be inserted into the index */
+} H5D_chunk_direct_ent_t;
+
+/* Callback info for looking up the chunks of a direct read in the index */
+typedef struct H5D_chunk_direct_it_ud_t {
+    H5D_chunk_direct_ent_t *ents;       /* Chunks, sorted by scaled coordinates */
+    size_t              nents;          /* # of chunks */
+    size_t              nfound;         /* # of chunks found so far */
+} H5D_chunk_direct_it_ud_t;
+
 #ifdef H5_HAVE_PARALLEL
 /* information to construct a collective I/O operation for filling chunks */
 typedef struct H5D_chunk_coll_info_t {
@@ -307,18 +387,49 @@ static herr_t H5D__chunk_file_cb(void *elem, const H5T_t *type, unsigned ndims,
     const hsize_t *coords, void *fm);
 static herr_t H5D__chunk_mem_cb(void *elem, const H5T_t *type, unsigned ndims,
     const hsize_t *coords, void *fm);
+static hsize_t H5D__chunk_hash_key(const H5D_shared_t *shared, const hsize_t *scaled);
 static unsigned H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled);
 static herr_t H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent,
     hbool_t reset);
 static herr_t H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent,
     hbool_t flush);
+static herr_t H5D__chunk_filter_tasks(unsigned nthreads, size_t ntasks,
+    herr_t (*func)(size_t idx, void *udata), void *udata);
+static herr_t H5D__chunk_unfilter_task(size_t idx, void *_udata);
+static herr_t H5D__chunk_prefilter_task(size_t idx, void *_udata);
+static htri_t H5D__chunk_filter_batchable(const H5D_t *dset, unsigned nthreads);
+static int H5D__chunk_batch_addr_cmp(const void *_bent1, const void *_bent2);
+static herr_t H5D__chunk_batch_load(H5D_io_info_t *io_info,
+    const H5D_chunk_map_t *fm, H5SL_node_t **chunk_node, H5D_chunk_batch_t *batch);
+static herr_t H5D__chunk_batch_unfilter(const H5D_t *dset,
+    H5D_chunk_batch_t *batch, unsigned nthreads);
+static herr_t H5D__chunk_batch_wait(H5D_chunk_batch_t *batch);
+static herr_t H5D__chunk_batch_reset(const H5D_t *dset, H5D_chunk_batch_t *batch);
+static herr_t H5D__chunk_prefilter_entries(const H5D_t *dset,
+    unsigned nthreads, size_t max_ents);
+static herr_t H5D__chunk_direct_init(const H5D_t *dset, size_t count,
+    const hsize_t *offsets[], hbool_t flush, hsize_t *scaled,
+    H5D_chunk_direct_ent_t *ents);
+static int H5D__chunk_direct_scaled_cmp(const void *_ent1, const void *_ent2);
+static int H5D__chunk_direct_addr_cmp(const void *_ent1, const void *_ent2);
+static int H5D__chunk_direct_lookup_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata);
+static herr_t H5D__chunk_direct_lookup(const H5D_t *dset, size_t nents,
+    H5D_chunk_direct_ent_t *ents);
 static hbool_t H5D__chunk_is_partial_edge_chunk(unsigned dset_ndims,
     const uint32_t *chunk_dims, const hsize_t *chunk_scaled, const hsize_t *dset_dims);
 static void *H5D__chunk_lock(const H5D_io_info_t *io_info,
-    H5D_chunk_ud_t *udata, hbool_t relax, hbool_t prev_unfilt_chunk);
+    H5D_chunk_ud_t *udata, hbool_t relax, hbool_t prev_unfilt_chunk,
+    void *loaded_chunk);
 static herr_t H5D__chunk_unlock(const H5D_io_info_t *io_info,
     const H5D_chunk_ud_t *udata, hbool_t dirty, void *chunk, uint32_t naccessed);
 static herr_t H5D__chunk_cache_prune(const H5D_t *dset, size_t size);
+static herr_t H5D__chunk_cache_prune_2q(const H5D_t *dset, size_t size);
+static herr_t H5D__chunk_cache_prune_shared(const H5D_t *dset, size_t size);
+static herr_t H5D__chunk_cache_ghost_add(const H5D_t *dset, hsize_t key);
+static hbool_t H5D__chunk_cache_ghost_hit(H5D_rdcc_t *rdcc, hsize_t key);
+static void H5D__chunk_cache_ghost_reset(H5D_rdcc_t *rdcc);
+static void H5D__chunk_cache_touch(const H5D_t *dset);
+static void H5D__chunk_cache_unlink(H5D_rdcc_t *rdcc);
 static herr_t H5D__chunk_prune_fill(H5D_chunk_it_ud1_t *udata, hbool_t new_unfilt_chunk);
 #ifdef H5_HAVE_PARALLEL
 static herr_t H5D__chunk_collective_fill(const H5D_t *dset,
@@ -383,6 +494,12 @@ H5FL_SEQ_DEFINE_STATIC(H5D_rdcc_ent_ptr_t);
 /* Declare a free list to manage H5D_rdcc_ent_t objects */
 H5FL_DEFINE_STATIC(H5D_rdcc_ent_t);
 
+/* Declare a free list to manage H5D_rdcc_file_t objects */
+H5FL_DEFINE_STATIC(H5D_rdcc_file_t);
+
+/* Declare a free list to manage H5D_rdcc_ghost_t objects */
+H5FL_DEFINE_STATIC(H5D_rdcc_ghost_t);
+
 /* Declare a free list to manage the H5D_chunk_info_t struct */
 H5FL_DEFINE(H5D_chunk_info_t);
 
@@ -595,8 +712,13 @@ H5D__chunk_direct_read(const H5D_t *dset, hsize_t *offset, uint32_t* filters,
         HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "chunk address isn't defined")
 
     /* Read the chunk data into the supplied buffer */
-    if(H5F_shared_block_read(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW, udata.chunk_block.offset, udata.chunk_block.length, buf) < 0)
-        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
+    {
+        size_t chunk_size;              /* Size of the chunk */
+
+        H5_CHECKED_ASSIGN(chunk_size, size_t, udata.chunk_block.length, hsize_t);
+        if(H5F_shared_block_read_concurrent(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW, 1, &udata.chunk_block.offset, &chunk_size, &buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
+    } /* end block */
 
     /* Return the filter mask */
     *filters = udata.filter_mask;
@@ -606,6 +728,496 @@ done:
 } /* end H5D__chunk_direct_read() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_direct_init
+ *
+ * Purpose:     Sets up ENTS for a direct read or write of the COUNT chunks
+ *              at the chunk offsets OFFSETS, with the chunks' scaled
+ *              coordinates stored in SCALED, and evicts any of the chunks
+ *              that are in the chunk cache.  When FLUSH is set, dirty
+ *              chunks are written to the file as they are evicted.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_direct_init(const H5D_t *dset, size_t count, const hsize_t *offsets[],
+    hbool_t flush, hsize_t *scaled, H5D_chunk_direct_ent_t *ents)
+{
+    const H5O_layout_t *layout = &(dset->shared->layout);    /* Dataset layout */
+    const H5D_rdcc_t   *rdcc = &(dset->shared->cache.chunk); /* Raw data chunk cache */
+    unsigned    ndims = dset->shared->ndims;    /* Rank of dataset */
+    hsize_t     offset_copy[H5O_LAYOUT_NDIMS];  /* Internal copy of chunk offset */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(offsets);
+    HDassert(scaled);
+    HDassert(ents);
+
+    for(u = 0; u < count; u++) {
+        H5D_chunk_direct_ent_t *ent = &ents[u];
+        hsize_t *chunk_scaled = scaled + (u * (ndims + 1));
+
+        /* Copy the user's offset, so we can be sure it's terminated properly */
+        if(H5D__get_offset_copy(dset, offsets[u], offset_copy) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "failure to copy offset array")
+
+        /* Calculate the index of this chunk */
+        H5VM_chunk_scaled(ndims, offset_copy, layout->u.chunk.dim, chunk_scaled);
+        chunk_scaled[ndims] = 0;
+
+        /* Reset fields about the chunk */
+        ent->udata.common.layout = &(layout->u.chunk);
+        ent->udata.common.storage = &(layout->storage.u.chunk);
+        ent->udata.common.scaled = chunk_scaled;
+        ent->udata.idx_hint = UINT_MAX;
+        ent->udata.chunk_block.offset = HADDR_UNDEF;
+        ent->udata.chunk_block.length = 0;
+        ent->udata.filter_mask = 0;
+        ent->udata.new_unfilt_chunk = FALSE;
+        ent->udata.chunk_idx = 0;
+        ent->req = u;
+        ent->need_insert = FALSE;
+
+        /* Evict the chunk if it's in the chunk cache */
+        if(rdcc->nslots > 0) {
+            H5D_rdcc_ent_t *cache_ent = rdcc->slot[H5D__chunk_hash_val(dset->shared, chunk_scaled)];
+
+            if(cache_ent && !HDmemcmp(cache_ent->scaled, chunk_scaled, ndims * sizeof(hsize_t)))
+                if(H5D__chunk_cache_evict(dset, cache_ent, (flush && cache_ent->dirty)) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
+        } /* end if */
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_direct_init() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_direct_scaled_cmp
+ *
+ * Purpose:     Compares the scaled coordinates of two chunks of a direct
+ *              read or write, for sorting with HDqsort().
+ *
+ * Return:      -1, 0 or 1, like strcmp()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_direct_scaled_cmp(const void *_ent1, const void *_ent2)
+{
+    const H5D_chunk_direct_ent_t *ent1 = (const H5D_chunk_direct_ent_t *)_ent1;
+    const H5D_chunk_direct_ent_t *ent2 = (const H5D_chunk_direct_ent_t *)_ent2;
+    unsigned ndims = ent1->udata.common.layout->ndims - 1;  /* Rank of dataset */
+    unsigned u;                 /* Local index variable */
+    int ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(u = 0; u < ndims; u++)
+        if(ent1->udata.common.scaled[u] != ent2->udata.common.scaled[u]) {
+            ret_value = (ent1->udata.common.scaled[u] < ent2->udata.common.scaled[u]) ? -1 : 1;
+            break;
+        } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_direct_scaled_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_direct_addr_cmp
+ *
+ * Purpose:     Compares the file addresses of two chunks of a direct read
+ *              or write, for sorting with HDqsort().
+ *
+ * Return:      -1, 0 or 1, like strcmp()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_direct_addr_cmp(const void *_ent1, const void *_ent2)
+{
+    const H5D_chunk_direct_ent_t *ent1 = (const H5D_chunk_direct_ent_t *)_ent1;
+    const H5D_chunk_direct_ent_t *ent2 = (const H5D_chunk_direct_ent_t *)_ent2;
+    int ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    ret_value = H5F_addr_cmp(ent1->udata.chunk_block.offset, ent2->udata.chunk_block.offset);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_direct_addr_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_direct_lookup_cb
+ *
+ * Purpose:     Callback for iterating over the chunk index, which sets the
+ *              file information of the chunks of a direct read that have
+ *              the coordinates of the chunk record.
+ *
+ * Return:      H5_ITER_CONT, or H5_ITER_STOP once all of the chunks have
+ *              been found
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_direct_lookup_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
+{
+    H5D_chunk_direct_it_ud_t *udata = (H5D_chunk_direct_it_ud_t *)_udata;  /* User data for callback */
+    H5D_chunk_direct_ent_t key;         /* Chunk to search for */
+    size_t lo = 0, hi = udata->nents;   /* Bounds of binary search */
+    int ret_value = H5_ITER_CONT;       /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Find the first chunk with the record's coordinates */
+    key.udata.common.layout = udata->ents[0].udata.common.layout;
+    key.udata.common.scaled = chunk_rec->scaled;
+    while(lo < hi) {
+        size_t mid = lo + ((hi - lo) / 2);
+
+        if(H5D__chunk_direct_scaled_cmp(&udata->ents[mid], &key) < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    } /* end while */
+
+    /* Set the file information for it, and any duplicates of it */
+    for(; lo < udata->nents && 0 == H5D__chunk_direct_scaled_cmp(&udata->ents[lo], &key); lo++) {
+        udata->ents[lo].udata.chunk_block.offset = chunk_rec->chunk_addr;
+        udata->ents[lo].udata.chunk_block.length = chunk_rec->nbytes;
+        udata->ents[lo].udata.filter_mask = chunk_rec->filter_mask;
+        udata->nfound++;
+    } /* end for */
+
+    /* Stop once all of the chunks have been found */
+    if(udata->nfound == udata->nents)
+        ret_value = H5_ITER_STOP;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_direct_lookup_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_direct_lookup
+ *
+ * Purpose:     Looks up the file information of the NENTS chunks of a
+ *              direct read.  When the read covers a large enough part of
+ *              the dataset, the chunks are looked up with a single pass
+ *              over the chunk index (which sorts ENTS by their
+ *              coordinates), instead of querying the index for each chunk.
+ *
+ *              The chunks must not be in the chunk cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_direct_lookup(const H5D_t *dset, size_t nents, H5D_chunk_direct_ent_t *ents)
+{
+    const H5O_layout_t *layout = &(dset->shared->layout);    /* Dataset layout */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(ents);
+
+    /* No chunks are in the file until its space is allocated */
+    if(!H5D__chunk_is_space_alloc(&layout->storage))
+        HGOTO_DONE(SUCCEED)
+
+    if(nents > 1 && (hsize_t)nents * H5D_CHUNK_DIRECT_ITER_RATIO >= layout->u.chunk.nchunks) {
+        H5O_storage_chunk_t *sc = &(dset->shared->layout.storage.u.chunk);
+        H5D_chk_idx_info_t idx_info;    /* Chunked index info */
+        H5D_chunk_direct_it_ud_t udata; /* User data for iteration callback */
+
+        /* Sort the chunks by their coordinates, for searching */
+        HDqsort(ents, nents, sizeof(H5D_chunk_direct_ent_t), H5D__chunk_direct_scaled_cmp);
+
+        /* Compose chunked index info struct */
+        idx_info.f = dset->oloc.file;
+        idx_info.pline = &dset->shared->dcpl_cache.pline;
+        idx_info.layout = &dset->shared->layout.u.chunk;
+        idx_info.storage = sc;
+
+#ifdef H5_HAVE_PARALLEL
+        /* Disable collective metadata read for chunk indexes, as for
+         * H5D__chunk_lookup() */
+        if(H5F_HAS_FEATURE(idx_info.f, H5FD_FEAT_HAS_MPI))
+            H5CX_set_coll_metadata_read(FALSE);
+#endif /* H5_HAVE_PARALLEL */
+
+        /* Set up user data for iteration callback */
+        udata.ents = ents;
+        udata.nents = nents;
+        udata.nfound = 0;
+
+        /* Find the chunks in the index */
+        if((sc->ops->iterate)(&idx_info, H5D__chunk_direct_lookup_cb, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to iterate over chunk index to look up chunks")
+    } /* end if */
+    else
+        for(u = 0; u < nents; u++)
+            if(H5D__chunk_lookup(dset, ents[u].udata.common.scaled, &ents[u].udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_direct_lookup() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_direct_write_multi
+ *
+ * Purpose:     Internal routine to write COUNT chunks directly into the
+ *              file, allocating file space for all of them before writing
+ *              them with one vector write, in the order of their file
+ *              addresses.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_direct_write_multi(const H5D_t *dset, size_t count,
+    const uint32_t filters[], const hsize_t *offsets[], const size_t data_sizes[],
+    const void *bufs[])
+{
+    const H5O_layout_t *layout = &(dset->shared->layout);       /* Dataset layout */
+    H5D_chk_idx_info_t idx_info;        /* Chunked index info */
+    H5D_chunk_direct_ent_t *ents = NULL;    /* Chunks to write */
+    hsize_t *scaled = NULL;             /* Scaled coordinates of chunks */
+    haddr_t *addrs = NULL;              /* File addresses of chunks */
+    size_t *sizes = NULL;               /* Sizes of chunks */
+    const void **vec_bufs = NULL;       /* Buffers of chunks, in file order */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
+
+    /* Sanity checks */
+    HDassert(layout->type == H5D_CHUNKED);
+    HDassert(count > 0);
+    HDassert(filters && offsets && data_sizes && bufs);
+
+    /* Check for write intent */
+    if(0 == (H5F_INTENT(dset->oloc.file) & H5F_ACC_RDWR))
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "no write intent on file")
+
+    /* Allocate dataspace and initialize it if it hasn't been. */
+    if(!H5D__chunk_is_space_alloc(&layout->storage)) {
+        H5D_io_info_t io_info;              /* to hold the dset info */
+
+        io_info.dset = dset;
+        io_info.f_sh = H5F_SHARED(dset->oloc.file);
+
+        /* Allocate storage */
+        if(H5D__alloc_storage(&io_info, H5D_ALLOC_WRITE, FALSE, NULL) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize storage")
+    } /* end if */
+
+    /* Allocate the chunk information */
+    if(NULL == (ents = (H5D_chunk_direct_ent_t *)H5MM_malloc(count * sizeof(H5D_chunk_direct_ent_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk info")
+    if(NULL == (scaled = (hsize_t *)H5MM_malloc(count * (dset->shared->ndims + 1) * sizeof(hsize_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk coordinates")
+    if(NULL == (addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk addresses")
+    if(NULL == (sizes = (size_t *)H5MM_malloc(count * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk sizes")
+    if(NULL == (vec_bufs = (const void **)H5MM_malloc(count * sizeof(void *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk buffers")
+
+    /* Evict any of the chunks that are in the chunk cache, without flushing
+     * them, since they are about to be overwritten */
+    if(H5D__chunk_direct_init(dset, count, offsets, FALSE, scaled, ents) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up chunk info")
+
+    /* Visit the chunks in the order of their coordinates, so that the index
+     * is queried and updated in order, and duplicates are adjacent */
+    HDqsort(ents, count, sizeof(H5D_chunk_direct_ent_t), H5D__chunk_direct_scaled_cmp);
+
+    /* Compose chunked index info struct */
+    idx_info.f = dset->oloc.file;
+    idx_info.pline = &(dset->shared->dcpl_cache.pline);
+    idx_info.layout = &(dset->shared->layout.u.chunk);
+    idx_info.storage = &(dset->shared->layout.storage.u.chunk);
+
+    /* Allocate file space for each chunk */
+    for(u = 0; u < count; u++) {
+        H5D_chunk_direct_ent_t *ent = &ents[u];
+        H5F_block_t old_chunk;          /* Offset/length of old chunk */
+
+        if(u > 0 && 0 == H5D__chunk_direct_scaled_cmp(&ents[u - 1], ent))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "chunk is written more than once")
+
+        /* Find out the file address of the chunk (if any) */
+        if(H5D__chunk_lookup(dset, ent->udata.common.scaled, &ent->udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+        /* Sanity check */
+        HDassert((H5F_addr_defined(ent->udata.chunk_block.offset) && ent->udata.chunk_block.length > 0) ||
+                (!H5F_addr_defined(ent->udata.chunk_block.offset) && ent->udata.chunk_block.length == 0));
+
+        /* Set the file block information for the old chunk */
+        old_chunk.offset = ent->udata.chunk_block.offset;
+        old_chunk.length = ent->udata.chunk_block.length;
+
+        /* Set up the size of chunk for user data */
+        ent->udata.chunk_block.length = data_sizes[ent->req];
+
+        if(0 == idx_info.pline->nused && H5F_addr_defined(old_chunk.offset))
+            /* If there are no filters and we are overwriting the chunk we can just set values */
+            ent->need_insert = FALSE;
+        else {
+            /* Otherwise, create the chunk it if it doesn't exist, or reallocate the chunk
+             * if its size has changed.
+             */
+            if(H5D__chunk_file_alloc(&idx_info, &old_chunk, &ent->udata.chunk_block, &ent->need_insert, ent->udata.common.scaled) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
+
+            /* Cache the new chunk information */
+            ent->udata.filter_mask = filters[ent->req];
+            H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, &ent->udata);
+        } /* end else */
+
+        /* Make sure the address of the chunk is returned. */
+        if(!H5F_addr_defined(ent->udata.chunk_block.offset))
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk address isn't defined")
+    } /* end for */
+
+    /* Write the chunks to the file, in the order they're in the file */
+    HDqsort(ents, count, sizeof(H5D_chunk_direct_ent_t), H5D__chunk_direct_addr_cmp);
+    for(u = 0; u < count; u++) {
+        addrs[u] = ents[u].udata.chunk_block.offset;
+        sizes[u] = data_sizes[ents[u].req];
+        vec_bufs[u] = bufs[ents[u].req];
+    } /* end for */
+    if(H5F_shared_block_write_vector(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW, (uint32_t)count, addrs, sizes, vec_bufs) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+
+    /* Insert the new chunk records into the index */
+    if(layout->storage.u.chunk.ops->insert)
+        for(u = 0; u < count; u++)
+            if(ents[u].need_insert) {
+                /* Set the chunk's filter mask to the new settings */
+                ents[u].udata.filter_mask = filters[ents[u].req];
+
+                if((layout->storage.u.chunk.ops->insert)(&idx_info, &ents[u].udata, dset) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+            } /* end if */
+
+done:
+    H5MM_xfree(ents);
+    H5MM_xfree(scaled);
+    H5MM_xfree(addrs);
+    H5MM_xfree(sizes);
+    H5MM_xfree(vec_bufs);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__chunk_direct_write_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_direct_read_multi
+ *
+ * Purpose:     Internal routine to read COUNT chunks directly from the
+ *              file, with one vector read, in the order of their file
+ *              addresses.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_direct_read_multi(const H5D_t *dset, size_t count,
+    const hsize_t *offsets[], uint32_t filters[], void *bufs[])
+{
+    const H5O_layout_t *layout = &(dset->shared->layout);    /* Dataset layout */
+    H5D_chunk_direct_ent_t *ents = NULL;    /* Chunks to read */
+    hsize_t *scaled = NULL;             /* Scaled coordinates of chunks */
+    haddr_t *addrs = NULL;              /* File addresses of chunks */
+    size_t *sizes = NULL;               /* Sizes of chunks */
+    void **vec_bufs = NULL;             /* Buffers of chunks, in file order */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
+
+    /* Check args */
+    HDassert(dset && H5D_CHUNKED == layout->type);
+    HDassert(count > 0);
+    HDassert(offsets && filters && bufs);
+
+    for(u = 0; u < count; u++)
+        filters[u] = 0;
+
+    /* Allocate dataspace and initialize it if it hasn't been. */
+    if(!H5D__chunk_is_space_alloc(&layout->storage)
+            && !H5D__chunk_is_data_cached(dset->shared))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "storage is not initialized")
+
+    /* Allocate the chunk information */
+    if(NULL == (ents = (H5D_chunk_direct_ent_t *)H5MM_malloc(count * sizeof(H5D_chunk_direct_ent_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk info")
+    if(NULL == (scaled = (hsize_t *)H5MM_malloc(count * (dset->shared->ndims + 1) * sizeof(hsize_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk coordinates")
+    if(NULL == (addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk addresses")
+    if(NULL == (sizes = (size_t *)H5MM_malloc(count * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk sizes")
+    if(NULL == (vec_bufs = (void **)H5MM_malloc(count * sizeof(void *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk buffers")
+
+    /* Evict any of the chunks that are in the chunk cache, flushing the
+     * dirty ones to disk */
+    if(H5D__chunk_direct_init(dset, count, offsets, TRUE, scaled, ents) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up chunk info")
+
+    /* Find out the file addresses of the chunks */
+    if(H5D__chunk_direct_lookup(dset, count, ents) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk addresses")
+
+    /* Read the chunks into the supplied buffers, in the order they're in
+     * the file */
+    HDqsort(ents, count, sizeof(H5D_chunk_direct_ent_t), H5D__chunk_direct_addr_cmp);
+    for(u = 0; u < count; u++) {
+        /* Make sure the address of the chunk is returned. */
+        if(!H5F_addr_defined(ents[u].udata.chunk_block.offset))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "chunk address isn't defined")
+
+        addrs[u] = ents[u].udata.chunk_block.offset;
+        H5_CHECKED_ASSIGN(sizes[u], size_t, ents[u].udata.chunk_block.length, hsize_t);
+        vec_bufs[u] = bufs[ents[u].req];
+    } /* end for */
+    if(H5F_shared_block_read_concurrent(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW, (uint32_t)count, addrs, sizes, vec_bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunks")
+
+    /* Return the filter masks */
+    for(u = 0; u < count; u++)
+        filters[ents[u].req] = ents[u].udata.filter_mask;
+
+done:
+    H5MM_xfree(ents);
+    H5MM_xfree(scaled);
+    H5MM_xfree(addrs);
+    H5MM_xfree(sizes);
+    H5MM_xfree(vec_bufs);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__chunk_direct_read_multi() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__get_chunk_storage_size
  *
@@ -960,24 +1572,44 @@ H5D__chunk_init(H5F_t *f, const H5D_t * const dset, hid_t dapl_id)
     if(rdcc->nslots == H5D_CHUNK_CACHE_NSLOTS_DEFAULT)
         rdcc->nslots = H5F_RDCC_NSLOTS(f);
 
+    /* Datasets that don't set their own cache size use the file's shared
+     * byte budget, if there is one.
+     */
+    rdcc->file = H5F_RDCC_FILE(f);
+    HDassert(rdcc->file);
     if(H5P_get(dapl, H5D_ACS_DATA_CACHE_BYTE_SIZE_NAME, &rdcc->nbytes_max) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get data cache byte size")
-    if(rdcc->nbytes_max == H5D_CHUNK_CACHE_NBYTES_DEFAULT)
-        rdcc->nbytes_max = H5F_RDCC_NBYTES(f);
+    if(rdcc->nbytes_max == H5D_CHUNK_CACHE_NBYTES_DEFAULT) {
+        if(rdcc->file->nbytes_max > 0) {
+            rdcc->nbytes_max = rdcc->file->nbytes_max;
+            rdcc->use_shared = TRUE;
+        } /* end if */
+        else
+            rdcc->nbytes_max = H5F_RDCC_NBYTES(f);
+    } /* end if */
 
     if(H5P_get(dapl, H5D_ACS_PREEMPT_READ_CHUNKS_NAME, &rdcc->w0) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get preempt read chunks")
     if(rdcc->w0 < 0)
         rdcc->w0 = H5F_RDCC_W0(f);
+    if(H5P_get(dapl, H5D_ACS_DATA_CACHE_POLICY_NAME, &rdcc->policy) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get chunk cache policy")
 
     /* If nbytes_max or nslots is 0, set them both to 0 and avoid allocating space */
-    if(!rdcc->nbytes_max || !rdcc->nslots)
+    if(!rdcc->nbytes_max || !rdcc->nslots) {
         rdcc->nbytes_max = rdcc->nslots = 0;
+        rdcc->use_shared = FALSE;
+    } /* end if */
     else {
         rdcc->slot = H5FL_SEQ_CALLOC(H5D_rdcc_ent_ptr_t, rdcc->nslots);
         if(NULL == rdcc->slot)
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
 
+        /* Create the list of recently preempted chunks for the 2Q policy */
+        if(rdcc->policy == H5D_CHUNK_CACHE_POLICY_2Q)
+            if(NULL == (rdcc->ghosts = H5SL_create(H5SL_TYPE_HSIZE, NULL)))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't create skip list for recently preempted chunks")
+
         /* Reset any cached chunk info for this dataset */
         H5D__chunk_cinfo_cache_reset(&(rdcc->last));
     } /* end else */
@@ -2478,34 +3110,493 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_read
+ * Function:    H5D__chunk_filter_tasks
  *
- * Purpose:    Read from a chunked dataset.
+ * Purpose:     Runs a batch of chunk filtering tasks, spread across
+ *              NTHREADS threads when the library is thread-safe, and
+ *              one after another otherwise.
  *
- * Return:    Non-negative on success/Negative on failure
+ * Note:        The tasks only call into the I/O pipeline and the H5MM
+ *              package, and must not touch the chunk cache's lists or
+ *              the API context.
  *
- * Programmer:    Raymond Lu
- *        Thursday, April 10, 2003
+ * Return:      Non-negative if all tasks succeeded/Negative otherwise
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
-    hsize_t H5_ATTR_UNUSED nelmts, const H5S_t H5_ATTR_UNUSED *file_space, const H5S_t H5_ATTR_UNUSED *mem_space,
-    H5D_chunk_map_t *fm)
+H5D__chunk_filter_tasks(unsigned nthreads, size_t ntasks,
+    herr_t (*func)(size_t idx, void *udata), void *udata)
 {
-    H5SL_node_t *chunk_node;            /* Current node in chunk skip list */
-    H5D_io_info_t nonexistent_io_info;  /* "nonexistent" I/O info object */
-    H5D_io_info_t ctg_io_info;          /* Contiguous I/O info object */
-    H5D_storage_t ctg_store;            /* Chunk storage information as contiguous dataset */
-    H5D_io_info_t cpt_io_info;          /* Compact I/O info object */
-    H5D_storage_t cpt_store;            /* Chunk storage information as compact dataset */
-    hbool_t     cpt_dirty;              /* Temporary placeholder for compact storage "dirty" flag */
-    uint32_t    src_accessed_bytes = 0; /* Total accessed size in a chunk */
-    hbool_t     skip_missing_chunks = FALSE;    /* Whether to skip missing chunks */
-    herr_t    ret_value = SUCCEED;    /*return value        */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
 
-    FUNC_ENTER_STATIC
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef H5_HAVE_THREADSAFE
+    if(nthreads > 1)
+        ret_value = H5TS_run_tasks(nthreads, ntasks, func, udata);
+    else
+#else /* H5_HAVE_THREADSAFE */
+    (void)nthreads;
+#endif /* H5_HAVE_THREADSAFE */
+        for(u = 0; u < ntasks; u++)
+            if((func)(u, udata) < 0)
+                ret_value = FAIL;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_filter_tasks() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_unfilter_task
+ *
+ * Purpose:     Runs one pre-loaded chunk of a read batch backward through
+ *              the I/O pipeline.  If that fails, the chunk is dropped
+ *              from the batch so that it's read again (and the failure
+ *              reported) by the normal, serial path.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_unfilter_task(size_t idx, void *_udata)
+{
+    H5D_chunk_filter_ud_t *udata = (H5D_chunk_filter_ud_t *)_udata;
+    H5D_chunk_batch_ent_t *bent = &udata->bents[idx];
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(bent->chunk && bent->filtered && H5Z_pipeline(udata->pline, H5Z_FLAG_REVERSE,
+            &(bent->udata.filter_mask), udata->err_detect, udata->filter_cb,
+            &bent->nbytes, &bent->alloc, &bent->chunk) < 0) {
+        bent->chunk = H5MM_xfree(bent->chunk);
+        ret_value = FAIL;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_unfilter_task() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_prefilter_task
+ *
+ * Purpose:     Runs a copy of one dirty chunk cache entry forward through
+ *              the I/O pipeline, leaving the result on the entry for
+ *              H5D__chunk_flush_entry() to write.  If that fails, the
+ *              entry is left as it was, so that it's filtered (and the
+ *              failure reported) when it's flushed.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_prefilter_task(size_t idx, void *_udata)
+{
+    H5D_chunk_filter_ud_t *udata = (H5D_chunk_filter_ud_t *)_udata;
+    H5D_rdcc_ent_t *ent = udata->ents[idx];
+    void *buf;                          /* Buffer to filter */
+    size_t alloc = udata->chunk_size;   /* Bytes allocated for BUF */
+    size_t nbytes = udata->chunk_size;  /* Bytes of data in BUF */
+    unsigned filter_mask = 0;           /* Filters skipped */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(NULL == (buf = H5MM_malloc(alloc)))
+        HGOTO_DONE(FAIL)
+    H5MM_memcpy(buf, ent->chunk, alloc);
+    if(H5Z_pipeline(udata->pline, 0, &filter_mask, udata->err_detect,
+            udata->filter_cb, &nbytes, &alloc, &buf) < 0) {
+        H5MM_xfree(buf);
+        HGOTO_DONE(FAIL)
+    } /* end if */
+
+    ent->filt_chunk = (uint8_t *)buf;
+    ent->filt_nbytes = nbytes;
+    ent->filt_mask = filter_mask;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_prefilter_task() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_filter_batchable
+ *
+ * Purpose:     Checks whether a dataset's chunks can be run through its
+ *              I/O pipeline in batches by NTHREADS threads: there must be
+ *              more than one thread, and every filter in the pipeline
+ *              must already be available, since registering a filter
+ *              (possibly loading it as a plugin) from a filter thread
+ *              isn't safe.
+ *
+ * Return:      TRUE/FALSE/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5D__chunk_filter_batchable(const H5D_t *dset, unsigned nthreads)
+{
+    const H5O_pline_t *pline = &(dset->shared->dcpl_cache.pline); /* I/O pipeline */
+    size_t u;                           /* Local index variable */
+    htri_t ret_value = TRUE;            /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(nthreads < 2 || 0 == pline->nused)
+        HGOTO_DONE(FALSE)
+
+    for(u = 0; u < pline->nused; u++) {
+        htri_t avail;                   /* Whether filter is available */
+
+        if((avail = H5Z_filter_avail(pline->filter[u].id)) < 0)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "unable to check filter availability")
+        if(!avail)
+            HGOTO_DONE(FALSE)
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_filter_batchable() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_batch_addr_cmp
+ *
+ * Purpose:     Compares the file addresses of two chunks in a batch, for
+ *              sorting with HDqsort().
+ *
+ * Return:      -1, 0 or 1, like strcmp()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_batch_addr_cmp(const void *_bent1, const void *_bent2)
+{
+    const H5D_chunk_batch_ent_t *bent1 = *(const H5D_chunk_batch_ent_t * const *)_bent1;
+    const H5D_chunk_batch_ent_t *bent2 = *(const H5D_chunk_batch_ent_t * const *)_bent2;
+    int ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    ret_value = H5F_addr_cmp(bent1->udata.chunk_block.offset, bent2->udata.chunk_block.offset);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_batch_addr_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_batch_load
+ *
+ * Purpose:     Looks up the next (up to) BATCH->MAX_NENTS chunks of the
+ *              selection, starting at *CHUNK_NODE, and reads the ones that
+ *              are in the file but not in the chunk cache, in order of
+ *              their file addresses.  *CHUNK_NODE is advanced past the
+ *              chunks in the batch.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_batch_load(H5D_io_info_t *io_info, const H5D_chunk_map_t *fm,
+    H5SL_node_t **chunk_node, H5D_chunk_batch_t *batch)
+{
+    const H5D_t *dset = io_info->dset;  /* Local pointer to the dataset info */
+    const H5O_layout_chunk_t *layout = &(dset->shared->layout.u.chunk); /* Chunk layout */
+    const H5O_pline_t *pline = &(dset->shared->dcpl_cache.pline); /* I/O pipeline */
+    size_t nload = 0;                   /* # of chunks to read */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(chunk_node);
+    HDassert(batch);
+    HDassert(0 == batch->nents);
+
+    batch->curr = 0;
+    batch->nfiltered = 0;
+    for(batch->nents = 0; batch->nents < batch->max_nents && *chunk_node; batch->nents++) {
+        H5D_chunk_batch_ent_t *bent = &batch->ents[batch->nents];
+        htri_t cacheable;               /* Whether the chunk is cacheable */
+
+        bent->chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, *chunk_node);
+        bent->chunk = NULL;
+        bent->filtered = FALSE;
+        *chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, *chunk_node);
+
+        /* Get the info for the chunk in the file */
+        if(H5D__chunk_lookup(dset, bent->chunk_info->scaled, &bent->udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+        /* Skip chunks that won't be read from the file into the cache */
+        if(!H5F_addr_defined(bent->udata.chunk_block.offset) || UINT_MAX != bent->udata.idx_hint)
+            continue;
+        io_info->store->chunk.scaled = bent->chunk_info->scaled;
+        if((cacheable = H5D__chunk_cacheable(io_info, bent->udata.chunk_block.offset, FALSE)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunk is cacheable")
+        if(!cacheable)
+            continue;
+
+        /* Check if the chunk will need to be unfiltered */
+        if(pline->nused > 0 && !((layout->flags & H5O_LAYOUT_CHUNK_DONT_FILTER_PARTIAL_BOUND_CHUNKS)
+                && H5D__chunk_is_partial_edge_chunk(dset->shared->ndims, layout->dim,
+                    bent->chunk_info->scaled, dset->shared->curr_dims))) {
+            bent->filtered = TRUE;
+            batch->nfiltered++;
+        } /* end if */
+
+        batch->load[nload++] = bent;
+    } /* end for */
+
+    /* Read the chunks, in the order they're in the file, with one vector
+     * read so that drivers can have all of them in flight at once
+     */
+    if(nload > 1)
+        HDqsort(batch->load, nload, sizeof(H5D_chunk_batch_ent_t *), H5D__chunk_batch_addr_cmp);
+    for(u = 0; u < nload; u++) {
+        H5D_chunk_batch_ent_t *bent = batch->load[u];
+
+        H5_CHECKED_ASSIGN(bent->nbytes, size_t, bent->udata.chunk_block.length, hsize_t);
+        bent->alloc = bent->nbytes;
+        if(NULL == (bent->chunk = H5D__chunk_mem_alloc(bent->alloc, (bent->filtered ? pline : NULL))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunk")
+        batch->addrs[u] = bent->udata.chunk_block.offset;
+        batch->sizes[u] = bent->nbytes;
+        batch->bufs[u] = bent->chunk;
+    } /* end for */
+    if(nload > 0 && H5F_shared_block_read_vector(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW,
+            (uint32_t)nload, batch->addrs, batch->sizes, batch->bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunks")
+
+done:
+    if(ret_value < 0)
+        H5D__chunk_batch_reset(dset, batch);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_batch_load() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_batch_unfilter
+ *
+ * Purpose:     Starts running the filtered chunks read into a batch
+ *              backward through the I/O pipeline.  With more than one
+ *              thread (in a thread-safe build), the chunks are unfiltered
+ *              in the background by NTHREADS threads and
+ *              H5D__chunk_batch_wait() must be called before they're used.
+ *              Otherwise, they're unfiltered before returning.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_batch_unfilter(const H5D_t *dset, H5D_chunk_batch_t *batch, unsigned nthreads)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(batch);
+
+    if(0 == batch->nfiltered)
+        HGOTO_DONE(SUCCEED)
+
+    /* Retrieve filter settings from API context */
+    batch->fudata.pline = &(dset->shared->dcpl_cache.pline);
+    batch->fudata.chunk_size = dset->shared->layout.u.chunk.size;
+    batch->fudata.bents = batch->ents;
+    batch->fudata.ents = NULL;
+    if(H5CX_get_err_detect(&batch->fudata.err_detect) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get error detection info")
+    if(H5CX_get_filter_cb(&batch->fudata.filter_cb) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
+
+    /* Failures are picked up again when the chunk is locked, so don't check
+     * for them here. */
+#ifdef H5_HAVE_THREADSAFE
+    if(nthreads > 1 && NULL != (batch->tasks = H5TS_start_tasks(nthreads,
+            batch->nents, H5D__chunk_unfilter_task, &batch->fudata)))
+        HGOTO_DONE(SUCCEED)
+#else /* H5_HAVE_THREADSAFE */
+    (void)nthreads;
+#endif /* H5_HAVE_THREADSAFE */
+    (void)H5D__chunk_filter_tasks(1, batch->nents, H5D__chunk_unfilter_task, &batch->fudata);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_batch_unfilter() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_batch_wait
+ *
+ * Purpose:     Waits for the chunks of a batch to be unfiltered, if that's
+ *              happening in the background.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_batch_wait(H5D_chunk_batch_t *batch)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(batch);
+
+#ifdef H5_HAVE_THREADSAFE
+    if(batch->tasks) {
+        /* Failures are picked up again when the chunk is locked */
+        (void)H5TS_wait_tasks(batch->tasks);
+        batch->tasks = NULL;
+    } /* end if */
+#else /* H5_HAVE_THREADSAFE */
+    (void)batch;
+#endif /* H5_HAVE_THREADSAFE */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__chunk_batch_wait() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_batch_reset
+ *
+ * Purpose:     Releases any chunks read into a batch that haven't been
+ *              handed to the chunk cache, and empties the batch.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_batch_reset(const H5D_t *dset, H5D_chunk_batch_t *batch)
+{
+    size_t u;                           /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(batch);
+
+    H5D__chunk_batch_wait(batch);
+    for(u = 0; u < batch->nents; u++)
+        if(batch->ents[u].chunk)
+            batch->ents[u].chunk = H5D__chunk_mem_xfree(batch->ents[u].chunk,
+                    (batch->ents[u].filtered ? &(dset->shared->dcpl_cache.pline) : NULL));
+    batch->nents = 0;
+    batch->curr = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__chunk_batch_reset() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_prefilter_entries
+ *
+ * Purpose:     Runs copies of (up to) MAX_ENTS dirty chunk cache entries,
+ *              starting from the least recently used one, through the
+ *              I/O pipeline using NTHREADS threads.  The results are
+ *              written by H5D__chunk_flush_entry() when the entries are
+ *              flushed or evicted.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_prefilter_entries(const H5D_t *dset, unsigned nthreads, size_t max_ents)
+{
+    const H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk);  /* Raw data chunk cache */
+    H5D_chunk_filter_ud_t fudata;       /* Info for filtering the entries */
+    H5D_rdcc_ent_t *ent;                /* Cache entry */
+    size_t nents = 0;                   /* # of entries to filter */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(dset->shared->dcpl_cache.pline.nused > 0);
+
+    fudata.pline = &(dset->shared->dcpl_cache.pline);
+    fudata.chunk_size = dset->shared->layout.u.chunk.size;
+    fudata.bents = NULL;
+    fudata.ents = NULL;
+
+    if(max_ents > (size_t)rdcc->nused)
+        max_ents = (size_t)rdcc->nused;
+    if(max_ents < 2)
+        HGOTO_DONE(SUCCEED)
+
+    /* Retrieve filter settings from API context */
+    if(H5CX_get_err_detect(&fudata.err_detect) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get error detection info")
+    if(H5CX_get_filter_cb(&fudata.filter_cb) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
+
+    /* Gather the entries to filter */
+    if(NULL == (fudata.ents = (H5D_rdcc_ent_t **)H5MM_malloc(max_ents * sizeof(H5D_rdcc_ent_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk batch")
+    for(ent = rdcc->head; ent && nents < max_ents; ent = ent->next)
+        if(ent->dirty && !ent->locked && !ent->deleted && NULL == ent->filt_chunk
+                && !(ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS))
+            fudata.ents[nents++] = ent;
+
+    /* Filter them.  Failures are picked up again when the entry is
+     * flushed, so don't check for them here. */
+    if(nents > 1)
+        (void)H5D__chunk_filter_tasks(nthreads, nents, H5D__chunk_prefilter_task, &fudata);
+
+done:
+    H5MM_xfree(fudata.ents);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_prefilter_entries() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_read
+ *
+ * Purpose:    Read from a chunked dataset.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ * Programmer:    Raymond Lu
+ *        Thursday, April 10, 2003
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+    hsize_t H5_ATTR_UNUSED nelmts, const H5S_t H5_ATTR_UNUSED *file_space, const H5S_t H5_ATTR_UNUSED *mem_space,
+    H5D_chunk_map_t *fm)
+{
+    H5SL_node_t *chunk_node;            /* Current node in chunk skip list */
+    H5D_io_info_t nonexistent_io_info;  /* "nonexistent" I/O info object */
+    H5D_io_info_t ctg_io_info;          /* Contiguous I/O info object */
+    H5D_storage_t ctg_store;            /* Chunk storage information as contiguous dataset */
+    H5D_io_info_t cpt_io_info;          /* Compact I/O info object */
+    H5D_storage_t cpt_store;            /* Chunk storage information as compact dataset */
+    hbool_t     cpt_dirty;              /* Temporary placeholder for compact storage "dirty" flag */
+    uint32_t    src_accessed_bytes = 0; /* Total accessed size in a chunk */
+    hbool_t     skip_missing_chunks = FALSE;    /* Whether to skip missing chunks */
+    H5D_chunk_batch_t batch[2];         /* Chunks read ahead of time: current & next batch */
+    unsigned    curr_batch = 0;         /* Index of current batch */
+    hbool_t     use_batches = FALSE;    /* Whether chunks are read in batches */
+    H5SL_node_t *batch_node = NULL;     /* Next chunk to read ahead */
+    unsigned    nthreads = 1;           /* # of threads for filtering */
+    herr_t    ret_value = SUCCEED;    /*return value        */
+
+    FUNC_ENTER_STATIC
 
     /* Sanity check */
     HDassert(io_info);
@@ -2513,6 +3604,9 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     HDassert(type_info);
     HDassert(fm);
 
+    /* No chunks read ahead yet */
+    HDmemset(batch, 0, sizeof(batch));
+
     /* Set up "nonexistent" I/O info object */
     H5MM_memcpy(&nonexistent_io_info, io_info, sizeof(nonexistent_io_info));
     nonexistent_io_info.layout_ops = *H5D_LOPS_NONEXISTENT;
@@ -2551,18 +3645,95 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
             skip_missing_chunks = TRUE;
     }
 
+    /* Check if chunks should be read ahead in batches, either because
+     * they were asked to be prefetched or to run them through the I/O
+     * pipeline with multiple threads */
+    if(!fm->use_single && H5SL_count(fm->sel_chunks) > 1) {
+        unsigned prefetch;              /* # of chunks to read ahead */
+        size_t batch_max = 0;           /* Max. # of chunks in a batch */
+        htri_t batchable;               /* Whether to filter in batches */
+
+        if(H5CX_get_chunk_prefetch(&prefetch) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get # of chunks to prefetch")
+        if(H5CX_get_filter_nthreads(&nthreads) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get # of filter threads")
+        if((batchable = H5D__chunk_filter_batchable(io_info->dset, nthreads)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunks can be filtered in batches")
+        if(!batchable)
+            nthreads = 1;
+
+        if(prefetch > 0)
+            batch_max = prefetch;
+        else if(nthreads > 1)
+            batch_max = (size_t)nthreads * H5D_CHUNK_FILTER_BATCH_FACTOR;
+        if(batch_max > 0) {
+            unsigned u;                 /* Local index variable */
+
+            batch_max = MIN(batch_max, H5SL_count(fm->sel_chunks));
+            for(u = 0; u < 2; u++) {
+                batch[u].max_nents = batch_max;
+                if(NULL == (batch[u].ents = (H5D_chunk_batch_ent_t *)H5MM_malloc(batch_max * sizeof(H5D_chunk_batch_ent_t))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk batch")
+                if(NULL == (batch[u].load = (H5D_chunk_batch_ent_t **)H5MM_malloc(batch_max * sizeof(H5D_chunk_batch_ent_t *))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk batch")
+                if(NULL == (batch[u].addrs = (haddr_t *)H5MM_malloc(batch_max * sizeof(haddr_t))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk batch")
+                if(NULL == (batch[u].sizes = (size_t *)H5MM_malloc(batch_max * sizeof(size_t))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk batch")
+                if(NULL == (batch[u].bufs = (void **)H5MM_malloc(batch_max * sizeof(void *))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk batch")
+            } /* end for */
+            use_batches = TRUE;
+            batch_node = H5D_CHUNK_GET_FIRST_NODE(fm);
+        } /* end if */
+    } /* end if */
+
     /* Iterate through nodes in chunk skip list */
     chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
     while(chunk_node) {
         H5D_chunk_info_t *chunk_info;   /* Chunk information */
         H5D_chunk_ud_t udata;        /* Chunk index pass-through    */
+        H5D_chunk_batch_ent_t *bent = NULL; /* Chunk's entry in batch */
 
         /* Get the actual chunk information from the skip list node */
         chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
 
-        /* Get the info for the chunk in the file */
-        if(H5D__chunk_lookup(io_info->dset, chunk_info->scaled, &udata) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+        if(use_batches) {
+            /* Move on to the next batch when the current one is used up */
+            if(batch[curr_batch].curr == batch[curr_batch].nents) {
+                H5D__chunk_batch_reset(io_info->dset, &batch[curr_batch]);
+                curr_batch ^= 1;
+
+                /* Read the next batch now, if it wasn't read ahead */
+                if(0 == batch[curr_batch].nents) {
+                    if(H5D__chunk_batch_load(io_info, fm, &batch_node, &batch[curr_batch]) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read batch of chunks")
+                    if(H5D__chunk_batch_unfilter(io_info->dset, &batch[curr_batch], nthreads) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "unable to unfilter batch of chunks")
+                } /* end if */
+
+                /* Read the batch after that while this one is unfiltered,
+                 * then unfilter it while this one is used */
+                if(H5D__chunk_batch_load(io_info, fm, &batch_node, &batch[curr_batch ^ 1]) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read batch of chunks")
+                H5D__chunk_batch_wait(&batch[curr_batch]);
+                if(H5D__chunk_batch_unfilter(io_info->dset, &batch[curr_batch ^ 1], nthreads) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "unable to unfilter batch of chunks")
+            } /* end if */
+
+            HDassert(batch[curr_batch].curr < batch[curr_batch].nents);
+            bent = &batch[curr_batch].ents[batch[curr_batch].curr++];
+            HDassert(bent->chunk_info == chunk_info);
+        } /* end if */
+
+        if(bent && bent->chunk)
+            /* Use the chunk info looked up when the chunk was read ahead */
+            udata = bent->udata;
+        else {
+            /* Get the info for the chunk in the file */
+            if(H5D__chunk_lookup(io_info->dset, chunk_info->scaled, &udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+        } /* end else */
 
         /* Sanity check */
         HDassert((H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length > 0) ||
@@ -2588,8 +3759,12 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
                 H5_CHECK_OVERFLOW(type_info->src_type_size, /*From:*/ size_t, /*To:*/ uint32_t);
                 src_accessed_bytes = chunk_info->chunk_points * (uint32_t)type_info->src_type_size;
 
-                /* Lock the chunk into the cache */
-                if(NULL == (chunk = H5D__chunk_lock(io_info, &udata, FALSE, FALSE)))
+                /* Lock the chunk into the cache, handing over the chunk
+                 * read ahead, if there is one */
+                chunk = H5D__chunk_lock(io_info, &udata, FALSE, FALSE, (bent ? bent->chunk : NULL));
+                if(bent)
+                    bent->chunk = NULL;
+                if(NULL == chunk)
                     HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
 
                 /* Set up the storage buffer information for this chunk */
@@ -2625,6 +3800,17 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     } /* end while */
 
 done:
+    /* Release any chunks read ahead of time but not used */
+    for(curr_batch = 0; curr_batch < 2; curr_batch++) {
+        if(batch[curr_batch].ents)
+            H5D__chunk_batch_reset(io_info->dset, &batch[curr_batch]);
+        batch[curr_batch].ents = (H5D_chunk_batch_ent_t *)H5MM_xfree(batch[curr_batch].ents);
+        batch[curr_batch].load = (H5D_chunk_batch_ent_t **)H5MM_xfree(batch[curr_batch].load);
+        batch[curr_batch].addrs = (haddr_t *)H5MM_xfree(batch[curr_batch].addrs);
+        batch[curr_batch].sizes = (size_t *)H5MM_xfree(batch[curr_batch].sizes);
+        batch[curr_batch].bufs = (void **)H5MM_xfree(batch[curr_batch].bufs);
+    } /* end for */
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_read() */
 
@@ -2653,6 +3839,9 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     H5D_storage_t cpt_store;            /* Chunk storage information as compact dataset */
     hbool_t     cpt_dirty;              /* Temporary placeholder for compact storage "dirty" flag */
     uint32_t    dst_accessed_bytes = 0; /* Total accessed size in a chunk */
+    unsigned    nthreads = 1;           /* # of threads for filtering */
+    size_t      batch_max = 0;          /* # of chunks in a batch, when filtering in batches */
+    size_t      nchunks = 0;            /* # of chunks visited */
     herr_t    ret_value = SUCCEED;    /* Return value        */
 
     FUNC_ENTER_STATIC
@@ -2679,6 +3868,19 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     /* Initialize temporary compact storage info */
     cpt_store.compact.dirty = &cpt_dirty;
 
+    /* Check if chunks evicted from the cache should be run through the I/O
+     * pipeline in batches */
+    if(!fm->use_single && H5SL_count(fm->sel_chunks) > 1) {
+        htri_t batchable;               /* Whether to filter in batches */
+
+        if(H5CX_get_filter_nthreads(&nthreads) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get # of filter threads")
+        if((batchable = H5D__chunk_filter_batchable(io_info->dset, nthreads)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunks can be filtered in batches")
+        if(batchable)
+            batch_max = (size_t)nthreads * H5D_CHUNK_FILTER_BATCH_FACTOR;
+    } /* end if */
+
     /* Iterate through nodes in chunk skip list */
     chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
     while(chunk_node) {
@@ -2693,6 +3895,16 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
         /* Get the actual chunk information from the skip list node */
         chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
 
+        /* Before each batch of chunks, filter the dirty chunks that are
+         * about to be evicted to make room for it */
+        if(batch_max && 0 == (nchunks++ % batch_max)) {
+            const H5D_rdcc_t *rdcc = &(io_info->dset->shared->cache.chunk);
+
+            if(rdcc->nbytes_used + batch_max * io_info->dset->shared->layout.u.chunk.size > rdcc->nbytes_max)
+                if(H5D__chunk_prefilter_entries(io_info->dset, nthreads, batch_max) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "unable to filter batch of chunks")
+        } /* end if */
+
         /* Look up the chunk */
         if(H5D__chunk_lookup(io_info->dset, chunk_info->scaled, &udata) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
@@ -2723,7 +3935,7 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
                 entire_chunk = FALSE;
 
             /* Lock the chunk into the cache */
-            if(NULL == (chunk = H5D__chunk_lock(io_info, &udata, entire_chunk, FALSE)))
+            if(NULL == (chunk = H5D__chunk_lock(io_info, &udata, entire_chunk, FALSE, NULL)))
                 HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
 
             /* Set up the storage buffer information for this chunk */
@@ -2817,6 +4029,19 @@ H5D__chunk_flush(H5D_t *dset)
     /* Sanity check */
     HDassert(dset);
 
+    /* Run the dirty chunks through the I/O pipeline in batches, if requested */
+    if(rdcc->nused > 1 && dset->shared->dcpl_cache.pline.nused > 0) {
+        unsigned nthreads;              /* # of threads for filtering */
+        htri_t batchable;               /* Whether to filter in batches */
+
+        if(H5CX_get_filter_nthreads(&nthreads) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get # of filter threads")
+        if((batchable = H5D__chunk_filter_batchable(dset, nthreads)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunks can be filtered in batches")
+        if(batchable && H5D__chunk_prefilter_entries(dset, nthreads, (size_t)rdcc->nused) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "unable to filter chunks")
+    } /* end if */
+
     /* Loop over all entries in the chunk cache */
     for(ent = rdcc->head; ent; ent = next) {
     next = ent->next;
@@ -2922,9 +4147,17 @@ H5D__chunk_dest(H5D_t *dset)
     if(nerrors)
         HDONE_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
 
+    /* Remove the dataset from the file's shared cache list */
+    H5D__chunk_cache_unlink(rdcc);
+
     /* Release cache structures */
     if(rdcc->slot)
         rdcc->slot = H5FL_SEQ_FREE(H5D_rdcc_ent_ptr_t, rdcc->slot);
+    if(rdcc->ghosts) {
+        H5D__chunk_cache_ghost_reset(rdcc);
+        if(H5SL_close(rdcc->ghosts) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "can't close skip list for recently preempted chunks")
+    } /* end if */
     HDmemset(rdcc, 0, sizeof(H5D_rdcc_t));
 
     /* Compose chunked index info struct */
@@ -2975,6 +4208,123 @@ done:
 } /* end H5D_chunk_idx_reset() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D_chunk_file_cache_create
+ *
+ * Purpose:     Create the raw data chunk cache state shared by the
+ *              datasets in a file.  NBYTES_MAX is the byte budget shared
+ *              by the datasets that don't set their own chunk cache size,
+ *              or zero to give every dataset a cache of its own.
+ *
+ * Return:      Success:    Pointer to the new state
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+H5D_rdcc_file_t *
+H5D_chunk_file_cache_create(size_t nbytes_max)
+{
+    H5D_rdcc_file_t *rdcc_file = NULL;  /* New shared cache state */
+    H5D_rdcc_file_t *ret_value = NULL;  /* Return value */
+
+    FUNC_ENTER_NOAPI(NULL)
+
+    if(NULL == (rdcc_file = H5FL_CALLOC(H5D_rdcc_file_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for shared chunk cache")
+    rdcc_file->nbytes_max = nbytes_max;
+
+    /* Set return value */
+    ret_value = rdcc_file;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D_chunk_file_cache_create() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D_chunk_file_cache_dest
+ *
+ * Purpose:     Release the raw data chunk cache state of a file.  All of
+ *              the file's datasets must have been closed.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D_chunk_file_cache_dest(H5D_rdcc_file_t *rdcc_file)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity checks */
+    HDassert(rdcc_file);
+    HDassert(NULL == rdcc_file->head);
+    HDassert(0 == rdcc_file->nbytes_used);
+
+    rdcc_file = H5FL_FREE(H5D_rdcc_file_t, rdcc_file);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D_chunk_file_cache_dest() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D_chunk_file_cache_get_stats
+ *
+ * Purpose:     Retrieve the shared budget of a file's raw data chunk
+ *              caches, its usage, and the statistics gathered over all of
+ *              the file's datasets.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D_chunk_file_cache_get_stats(const H5D_rdcc_file_t *rdcc_file,
+    H5F_chunk_cache_stats_t *stats)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity checks */
+    HDassert(rdcc_file);
+    HDassert(stats);
+
+    stats->nbytes_max = rdcc_file->nbytes_max;
+    stats->nbytes_used = rdcc_file->nbytes_used;
+    stats->nentries = rdcc_file->nused;
+    stats->nhits = rdcc_file->stats.nhits;
+    stats->nmisses = rdcc_file->stats.nmisses;
+    stats->nevictions = rdcc_file->stats.nevictions;
+    stats->nflushes = rdcc_file->stats.nflushes;
+    stats->nghost_hits = rdcc_file->stats.nghost_hits;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D_chunk_file_cache_get_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D_chunk_file_cache_reset_stats
+ *
+ * Purpose:     Reset the statistics gathered for a file's raw data chunk
+ *              caches.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D_chunk_file_cache_reset_stats(H5D_rdcc_file_t *rdcc_file)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(rdcc_file);
+
+    HDmemset(&rdcc_file->stats, 0, sizeof(rdcc_file->stats));
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D_chunk_file_cache_reset_stats() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_cinfo_cache_reset
  *
@@ -3122,24 +4472,62 @@ H5D__chunk_create(const H5D_t *dset /*in,out*/)
 {
     unsigned u;                         /* Local index variable */
 
-    for(u = 0; u < dset->shared->layout.u.chunk.ndims; u++)
-    HDassert(dset->shared->layout.u.chunk.dim[u] > 0);
-}
-#endif
+    for(u = 0; u < dset->shared->layout.u.chunk.ndims; u++)
+    HDassert(dset->shared->layout.u.chunk.dim[u] > 0);
+}
+#endif
+
+    /* Compose chunked index info struct */
+    idx_info.f = dset->oloc.file;
+    idx_info.pline = &dset->shared->dcpl_cache.pline;
+    idx_info.layout = &dset->shared->layout.u.chunk;
+    idx_info.storage = sc;
+
+    /* Create the index for the chunks */
+    if((sc->ops->create)(&idx_info) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create chunk index")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_create() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_hash_key
+ *
+ * Purpose:    To combine the dataset's scaled coordinates into one value,
+ *        using the sizes of the faster dimensions.  The value is
+ *        unique for each chunk while the dataset's dimensions don't
+ *        change.
+ *
+ * Return:    Chunk key
+ *
+ *-------------------------------------------------------------------------
+ */
+static hsize_t
+H5D__chunk_hash_key(const H5D_shared_t *shared, const hsize_t *scaled)
+{
+    unsigned ndims = shared->ndims;      /* Rank of dataset */
+    unsigned u;         /* Local index variable */
+    hsize_t ret_value = 0;      /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
 
-    /* Compose chunked index info struct */
-    idx_info.f = dset->oloc.file;
-    idx_info.pline = &dset->shared->dcpl_cache.pline;
-    idx_info.layout = &dset->shared->layout.u.chunk;
-    idx_info.storage = sc;
+    /* Sanity check */
+    HDassert(shared);
+    HDassert(scaled);
 
-    /* Create the index for the chunks */
-    if((sc->ops->create)(&idx_info) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create chunk index")
+    /* If the fastest changing dimension doesn't have enough entropy, use
+     *  other dimensions too
+     */
+    ret_value = scaled[0];
+    for(u = 1; u < ndims; u++) {
+        ret_value <<= shared->cache.chunk.scaled_encode_bits[u];
+        ret_value ^= scaled[u];
+    } /* end for */
 
-done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_create() */
+} /* H5D__chunk_hash_key() */
 
 
 /*-------------------------------------------------------------------------
@@ -3157,10 +4545,7 @@ done:
 static unsigned
 H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled)
 {
-    hsize_t val;        /* Intermediate value */
-    unsigned ndims = shared->ndims;      /* Rank of dataset */
     unsigned ret = 0;   /* Value to return */
-    unsigned u;         /* Local index variable */
 
     FUNC_ENTER_STATIC_NOERR
 
@@ -3168,17 +4553,8 @@ H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled)
     HDassert(shared);
     HDassert(scaled);
 
-    /* If the fastest changing dimension doesn't have enough entropy, use
-     *  other dimensions too
-     */
-    val = scaled[0];
-    for(u = 1; u < ndims; u++) {
-        val <<= shared->cache.chunk.scaled_encode_bits[u];
-        val ^= scaled[u];
-    } /* end for */
-
-    /* Modulo value against the number of array slots */
-    ret = (unsigned)(val % shared->cache.chunk.nslots);
+    /* Modulo the chunk's key against the number of array slots */
+    ret = (unsigned)(H5D__chunk_hash_key(shared, scaled) % shared->cache.chunk.nslots);
 
     FUNC_LEAVE_NOAPI(ret)
 } /* H5D__chunk_hash_val() */
@@ -3381,37 +4757,46 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
             size_t alloc = udata.chunk_block.length;        /* Bytes allocated for BUF    */
             size_t nbytes;              /* Chunk size (in bytes) */
 
-            /* Retrieve filter settings from API context */
-            if(H5CX_get_err_detect(&err_detect) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get error detection info")
-            if(H5CX_get_filter_cb(&filter_cb) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
-
-            if(!reset) {
-                /*
-                 * Copy the chunk to a new buffer before running it through
-                 * the pipeline because we'll want to save the original buffer
-                 * for later.
-                 */
-                if(NULL == (buf = H5MM_malloc(alloc)))
-                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
-                H5MM_memcpy(buf, ent->chunk, alloc);
+            /* Check if the chunk was already run through the pipeline */
+            if(ent->filt_chunk) {
+                buf = ent->filt_chunk;
+                nbytes = ent->filt_nbytes;
+                udata.filter_mask = ent->filt_mask;
+                ent->filt_chunk = NULL;
             } /* end if */
             else {
-                /*
-                 * If we are resetting and something goes wrong after this
-                 * point then it's too late to recover because we may have
-                 * destroyed the original data by calling H5Z_pipeline().
-                 * The only safe option is to continue with the reset
-                 * even if we can't write the data to disk.
-                 */
-                point_of_no_return = TRUE;
-                ent->chunk = NULL;
+                /* Retrieve filter settings from API context */
+                if(H5CX_get_err_detect(&err_detect) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get error detection info")
+                if(H5CX_get_filter_cb(&filter_cb) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
+
+                if(!reset) {
+                    /*
+                     * Copy the chunk to a new buffer before running it through
+                     * the pipeline because we'll want to save the original buffer
+                     * for later.
+                     */
+                    if(NULL == (buf = H5MM_malloc(alloc)))
+                        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
+                    H5MM_memcpy(buf, ent->chunk, alloc);
+                } /* end if */
+                else {
+                    /*
+                     * If we are resetting and something goes wrong after this
+                     * point then it's too late to recover because we may have
+                     * destroyed the original data by calling H5Z_pipeline().
+                     * The only safe option is to continue with the reset
+                     * even if we can't write the data to disk.
+                     */
+                    point_of_no_return = TRUE;
+                    ent->chunk = NULL;
+                } /* end else */
+                H5_CHECKED_ASSIGN(nbytes, size_t, udata.chunk_block.length, hsize_t);
+                if(H5Z_pipeline(&(dset->shared->dcpl_cache.pline), 0, &(udata.filter_mask),
+                        err_detect, filter_cb, &nbytes, &alloc, &buf) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "output pipeline failed")
             } /* end else */
-            H5_CHECKED_ASSIGN(nbytes, size_t, udata.chunk_block.length, hsize_t);
-            if(H5Z_pipeline(&(dset->shared->dcpl_cache.pline), 0, &(udata.filter_mask),
-                    err_detect, filter_cb, &nbytes, &alloc, &buf) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "output pipeline failed")
 #if H5_SIZEOF_SIZE_T > 4
             /* Check for the chunk expanding too much to encode in a 32-bit value */
             if(nbytes > ((size_t)0xffffffff))
@@ -3483,6 +4868,7 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
 
         /* Increment # of flushed entries */
         dset->shared->cache.chunk.stats.nflushes++;
+        dset->shared->cache.chunk.file->stats.nflushes++;
     } /* end if */
 
     /* Reset, but do not free or removed from list */
@@ -3557,6 +4943,10 @@ H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t flush)
                     : &(dset->shared->dcpl_cache.pline)));
     } /* end else */
 
+    /* Release any pre-filtered copy of the chunk that wasn't written */
+    if(ent->filt_chunk)
+        ent->filt_chunk = (uint8_t *)H5MM_xfree(ent->filt_chunk);
+
     /* Unlink from list */
     if(ent->prev)
         ent->prev->next = ent->next;
@@ -3588,6 +4978,12 @@ H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t flush)
     ent->idx = UINT_MAX;
     rdcc->nbytes_used -= dset->shared->layout.u.chunk.size;
     --rdcc->nused;
+    if(!ent->hot)
+        rdcc->nbytes_a1in -= dset->shared->layout.u.chunk.size;
+    if(rdcc->use_shared) {
+        rdcc->file->nbytes_used -= dset->shared->layout.u.chunk.size;
+        --rdcc->file->nused;
+    } /* end if */
 
     /* Free */
     ent = H5FL_FREE(H5D_rdcc_ent_t, ent);
@@ -3624,6 +5020,13 @@ H5D__chunk_cache_prune(const H5D_t *dset, size_t size)
 
     FUNC_ENTER_STATIC
 
+    /* The 2Q policy has its own preemption order */
+    if(rdcc->policy == H5D_CHUNK_CACHE_POLICY_2Q) {
+        if(H5D__chunk_cache_prune_2q(dset, size) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to preempt one or more raw data cache entry")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /*
      * Preemption is accomplished by having multiple pointers (currently two)
      * slide down the list beginning at the head. Pointer p(N+1) will start
@@ -3685,6 +5088,8 @@ H5D__chunk_cache_prune(const H5D_t *dset, size_t size)
         } /* end for */
         if(H5D__chunk_cache_evict(dset, cur, TRUE) < 0)
                     nerrors++;
+                else
+                    rdcc->file->stats.nevictions++;
         } /* end if */
     } /* end for */
 
@@ -3703,6 +5108,395 @@ done:
 } /* end H5D__chunk_cache_prune() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_prune_2q
+ *
+ * Purpose:     Prune the cache of a dataset that uses the 2Q policy until
+ *              there is room for something which is SIZE bytes.
+ *
+ *              The cache list holds two queues: chunks that have not been
+ *              accessed again since they were loaded ("A1in", in FIFO
+ *              order, since hits don't move them) and chunks that were
+ *              loaded again soon after being preempted from A1in ("Am",
+ *              in LRU order, since hits move them to the tail).  The
+ *              oldest A1in chunk is preempted while A1in holds more than
+ *              its share of the cache, otherwise the least recently used
+ *              Am chunk is.  The keys of chunks preempted from A1in are
+ *              remembered in the ghost list.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cache_prune_2q(const H5D_t *dset, size_t size)
+{
+    H5D_rdcc_t  *rdcc = &(dset->shared->cache.chunk);
+    size_t      a1in_max = rdcc->nbytes_max / H5D_RDCC_2Q_A1IN_DIV;  /* Share of the cache for A1in */
+    H5D_rdcc_ent_t *cold, *hot;         /* Oldest A1in & Am candidates */
+    H5D_rdcc_ent_t *cur;                /* Entry to preempt */
+    int         nerrors = 0;            /* Accumulated error count during preemptions */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(rdcc->ghosts);
+
+    cold = hot = rdcc->head;
+    while((rdcc->nbytes_used + size) > rdcc->nbytes_max) {
+        hbool_t     was_hot;            /* Whether the entry preempted was in Am */
+        hsize_t     key;                /* Key of the entry preempted */
+
+        /* Advance to the oldest unlocked entry of each queue */
+        while(cold && (cold->locked || cold->hot))
+            cold = cold->next;
+        while(hot && (hot->locked || !hot->hot))
+            hot = hot->next;
+
+        /* Choose the queue to preempt from */
+        if(cold && (rdcc->nbytes_a1in > a1in_max || NULL == hot)) {
+            cur = cold;
+            cold = cold->next;
+        } /* end if */
+        else if(hot) {
+            cur = hot;
+            hot = hot->next;
+        } /* end if */
+        else
+            /* Nothing to preempt */
+            break;
+
+        was_hot = cur->hot;
+        key = H5D__chunk_hash_key(dset->shared, cur->scaled);
+        if(H5D__chunk_cache_evict(dset, cur, TRUE) < 0)
+            nerrors++;
+        else {
+            rdcc->file->stats.nevictions++;
+            if(!was_hot && H5D__chunk_cache_ghost_add(dset, key) < 0)
+                nerrors++;
+        } /* end else */
+    } /* end while */
+
+    if(nerrors)
+        HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to preempt one or more raw data cache entry")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_prune_2q() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_ghost_add
+ *
+ * Purpose:     Remember the key of a chunk preempted from the A1in queue
+ *              of a dataset's 2Q cache.  The ghost list holds the keys of
+ *              (about) as many chunks as half of the cache, the oldest
+ *              ones are forgotten.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cache_ghost_add(const H5D_t *dset, hsize_t key)
+{
+    H5D_rdcc_t  *rdcc = &(dset->shared->cache.chunk);
+    H5D_rdcc_ghost_t *ghost = NULL;     /* New ghost entry */
+    size_t      nghosts_max;            /* Max. # of ghost entries */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(rdcc->ghosts);
+
+    /* Chunks are only loaded after their ghost was removed, but be safe */
+    if(NULL != H5SL_search(rdcc->ghosts, &key))
+        HGOTO_DONE(SUCCEED)
+
+    /* Add the new ghost at the tail of the list */
+    if(NULL == (ghost = H5FL_MALLOC(H5D_rdcc_ghost_t)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate ghost entry")
+    ghost->key = key;
+    if(H5SL_insert(rdcc->ghosts, ghost, &ghost->key) < 0) {
+        ghost = H5FL_FREE(H5D_rdcc_ghost_t, ghost);
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't insert ghost entry into skip list")
+    } /* end if */
+    ghost->next = NULL;
+    ghost->prev = rdcc->ghost_tail;
+    if(rdcc->ghost_tail)
+        rdcc->ghost_tail->next = ghost;
+    else
+        rdcc->ghost_head = ghost;
+    rdcc->ghost_tail = ghost;
+
+    /* Forget the oldest ghosts */
+    nghosts_max = MAX(1, rdcc->nbytes_max / (H5D_RDCC_2Q_A1OUT_DIV * (size_t)dset->shared->layout.u.chunk.size));
+    while(H5SL_count(rdcc->ghosts) > nghosts_max) {
+        ghost = rdcc->ghost_head;
+        if(NULL == H5SL_remove(rdcc->ghosts, &ghost->key))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "can't remove ghost entry from skip list")
+        rdcc->ghost_head = ghost->next;
+        rdcc->ghost_head->prev = NULL;
+        ghost = H5FL_FREE(H5D_rdcc_ghost_t, ghost);
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_ghost_add() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_ghost_hit
+ *
+ * Purpose:     Check whether a chunk about to be loaded into a dataset's
+ *              2Q cache was recently preempted from the A1in queue, and
+ *              forget its ghost if so.
+ *
+ * Return:      TRUE if the chunk has a ghost, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5D__chunk_cache_ghost_hit(H5D_rdcc_t *rdcc, hsize_t key)
+{
+    H5D_rdcc_ghost_t *ghost;            /* Ghost entry for the chunk */
+    hbool_t     ret_value = FALSE;      /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(rdcc->ghosts);
+
+    if(NULL != (ghost = (H5D_rdcc_ghost_t *)H5SL_remove(rdcc->ghosts, &key))) {
+        if(ghost->prev)
+            ghost->prev->next = ghost->next;
+        else
+            rdcc->ghost_head = ghost->next;
+        if(ghost->next)
+            ghost->next->prev = ghost->prev;
+        else
+            rdcc->ghost_tail = ghost->prev;
+        ghost = H5FL_FREE(H5D_rdcc_ghost_t, ghost);
+
+        ret_value = TRUE;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_ghost_hit() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_ghost_reset
+ *
+ * Purpose:     Forget all the ghosts of a dataset's 2Q cache.
+ *
+ * Return:      (none)
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_cache_ghost_reset(H5D_rdcc_t *rdcc)
+{
+    H5D_rdcc_ghost_t *ghost, *next;     /* Pointer to current & next ghost entries */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(rdcc->ghosts);
+
+    /* The skip list doesn't own the ghosts, release its nodes first */
+    (void)H5SL_release(rdcc->ghosts);
+    for(ghost = rdcc->ghost_head; ghost; ghost = next) {
+        next = ghost->next;
+        ghost = H5FL_FREE(H5D_rdcc_ghost_t, ghost);
+    } /* end for */
+    rdcc->ghost_head = rdcc->ghost_tail = NULL;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_cache_ghost_reset() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_prune_shared
+ *
+ * Purpose:     Prune the caches of the datasets that share the file's
+ *              chunk cache budget until there is room for something which
+ *              is SIZE bytes.  The datasets are visited from least to most
+ *              recently used, and each one is pruned with the usual
+ *              preemption policy (see H5D__chunk_cache_prune) only as far
+ *              as is needed.  DSET is the most recently used dataset, so
+ *              its own chunks are considered last.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cache_prune_shared(const H5D_t *dset, size_t size)
+{
+    H5D_rdcc_file_t *rdcc_file = dset->shared->cache.chunk.file;
+    H5D_rdcc_t  *rdcc, *prev;           /* Dataset caches in the file's list */
+    int         nerrors = 0;            /* Accumulated error count during preemptions */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(dset->shared->cache.chunk.use_shared);
+    HDassert(rdcc_file->head == &(dset->shared->cache.chunk));
+    HDassert(size <= rdcc_file->nbytes_max);
+
+    for(rdcc = rdcc_file->tail; rdcc && (rdcc_file->nbytes_used + size) > rdcc_file->nbytes_max; rdcc = prev) {
+        size_t excess = (rdcc_file->nbytes_used + size) - rdcc_file->nbytes_max;
+
+        prev = rdcc->shared_prev;
+        HDassert(rdcc->owner);
+        HDassert(rdcc->nbytes_max == rdcc_file->nbytes_max);
+
+        /* Shrink this dataset's cache by (up to) the excess.  Asking for
+         * room for "nbytes_max - target" bytes leaves at most "target".
+         */
+        if(rdcc->nbytes_used > 0) {
+            size_t target = rdcc->nbytes_used > excess ? rdcc->nbytes_used - excess : 0;
+
+            if(H5D__chunk_cache_prune(rdcc->owner, rdcc->nbytes_max - target) < 0)
+                nerrors++;
+        } /* end if */
+    } /* end for */
+
+    if(nerrors)
+        HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to preempt one or more raw data cache entry")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_prune_shared() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_touch
+ *
+ * Purpose:     Mark a dataset that uses the file's shared chunk cache
+ *              budget as the most recently used one, adding it to the
+ *              file's list if it isn't there yet.  DSET becomes the
+ *              dataset used to flush chunks that other datasets evict
+ *              from this dataset's cache.
+ *
+ * Return:      (none)
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_cache_touch(const H5D_t *dset)
+{
+    H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk);
+    H5D_rdcc_file_t *rdcc_file = rdcc->file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(rdcc->use_shared);
+
+    rdcc->owner = dset;
+    if(rdcc_file->head != rdcc) {
+        /* Unlink from the current position, if on the list */
+        if(rdcc->shared_prev) {
+            rdcc->shared_prev->shared_next = rdcc->shared_next;
+            if(rdcc->shared_next)
+                rdcc->shared_next->shared_prev = rdcc->shared_prev;
+            else
+                rdcc_file->tail = rdcc->shared_prev;
+        } /* end if */
+
+        /* Insert at the head of the list */
+        rdcc->shared_prev = NULL;
+        rdcc->shared_next = rdcc_file->head;
+        if(rdcc_file->head)
+            rdcc_file->head->shared_prev = rdcc;
+        else
+            rdcc_file->tail = rdcc;
+        rdcc_file->head = rdcc;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_cache_touch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_unlink
+ *
+ * Purpose:     Remove a dataset's chunk cache from the file's shared
+ *              cache list.  The cache must not hold any chunks.
+ *
+ * Return:      (none)
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_cache_unlink(H5D_rdcc_t *rdcc)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    if(rdcc->owner) {
+        HDassert(rdcc->use_shared);
+
+        if(rdcc->shared_prev)
+            rdcc->shared_prev->shared_next = rdcc->shared_next;
+        else
+            rdcc->file->head = rdcc->shared_next;
+        if(rdcc->shared_next)
+            rdcc->shared_next->shared_prev = rdcc->shared_prev;
+        else
+            rdcc->file->tail = rdcc->shared_prev;
+        rdcc->shared_prev = rdcc->shared_next = NULL;
+        rdcc->owner = NULL;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_cache_unlink() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_release
+ *
+ * Purpose:     Called when DSET is closed while the dataset is still
+ *              open through other IDs.  If DSET is the dataset that other
+ *              datasets use to flush this dataset's chunks, flush and
+ *              preempt all of the dataset's cached chunks and take it off
+ *              the file's shared cache list; the next access through one
+ *              of the remaining IDs puts it back.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_cache_release(const H5D_t *dset)
+{
+    H5D_rdcc_t  *rdcc = &(dset->shared->cache.chunk);   /* Dataset's chunk cache */
+    H5D_rdcc_ent_t *ent, *next;         /* Pointer to current & next cache entries */
+    int         nerrors = 0;            /* Accumulated count of errors */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
+
+    if(rdcc->owner == dset) {
+        for(ent = rdcc->head; ent; ent = next) {
+            next = ent->next;
+            if(H5D__chunk_cache_evict(dset, ent, TRUE) < 0)
+                nerrors++;
+        } /* end for */
+        if(nerrors)
+            HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
+
+        H5D__chunk_cache_unlink(rdcc);
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__chunk_cache_release() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_lock
  *
@@ -3721,6 +5515,11 @@ done:
  *        for output functions that are about to overwrite the entire
  *        chunk.
  *
+ *        If LOADED_CHUNK is non-NULL, the chunk isn't in the cache and
+ *        has already been read from the file and run through the I/O
+ *        pipeline into that buffer (see H5D__chunk_batch_load()).  The
+ *        buffer is taken over by this routine, even on failure.
+ *
  * Return:    Success:    Ptr to a file chunk.
  *
  *        Failure:    NULL
@@ -3732,7 +5531,7 @@ done:
  */
 static void *
 H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
-    hbool_t relax, hbool_t prev_unfilt_chunk)
+    hbool_t relax, hbool_t prev_unfilt_chunk, void *loaded_chunk)
 {
     const H5D_t         *dset = io_info->dset;  /* Local pointer to the dataset info */
     const H5O_pline_t   *pline = &(dset->shared->dcpl_cache.pline); /* I/O pipeline info - always equal to the pline passed to H5D__chunk_mem_alloc */
@@ -3757,11 +5556,16 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
     HDassert(dset);
     HDassert(!(udata->new_unfilt_chunk && prev_unfilt_chunk));
     HDassert(!rdcc->tmp_head);
+    HDassert(!loaded_chunk || (!relax && !prev_unfilt_chunk && UINT_MAX == udata->idx_hint));
 
     /* Get the chunk's size */
     HDassert(layout->u.chunk.size > 0);
     H5_CHECKED_ASSIGN(chunk_size, size_t, layout->u.chunk.size, uint32_t);
 
+    /* Make this the most recently used dataset under the file's shared budget */
+    if(rdcc->use_shared)
+        H5D__chunk_cache_touch(dset);
+
     /* Check if the chunk is in the cache */
     if(UINT_MAX != udata->idx_hint) {
         /* Sanity check */
@@ -3785,6 +5589,11 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
          * Already in the cache.  Count a hit.
          */
         rdcc->stats.nhits++;
+        rdcc->file->stats.nhits++;
+
+        /* The chunk may be modified, so drop any pre-filtered copy */
+        if(ent->filt_chunk)
+            ent->filt_chunk = (uint8_t *)H5MM_xfree(ent->filt_chunk);
 
         /* Make adjustments if the edge chunk status changed recently */
         if(pline->nused) {
@@ -3846,12 +5655,30 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
             } /* end else */
         } /* end if */
 
+        if(rdcc->policy == H5D_CHUNK_CACHE_POLICY_2Q) {
+            /*
+             * 2Q: a chunk in the Am queue moves to the tail of the cache.
+             * A chunk in the A1in queue stays where it is, so that
+             * accesses close together count as one.
+             */
+            if(ent->hot && ent->next) {
+                ent->next->prev = ent->prev;
+                if(ent->prev)
+                    ent->prev->next = ent->next;
+                else
+                    rdcc->head = ent->next;
+                ent->prev = rdcc->tail;
+                ent->next = NULL;
+                rdcc->tail->next = ent;
+                rdcc->tail = ent;
+            } /* end if */
+        } /* end if */
         /*
          * If the chunk is not at the beginning of the cache; move it backward
          * by one slot.  This is how we implement the LRU preemption
          * algorithm.
          */
-        if(ent->next) {
+        else if(ent->next) {
             if(ent->next->next)
                 ent->next->next->prev = ent;
             else
@@ -3915,6 +5742,7 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
              * miss because we saved ourselves lots of work.
              */
             rdcc->stats.nhits++;
+            rdcc->file->stats.nhits++;
 
             if(NULL == (chunk = H5D__chunk_mem_alloc(chunk_size, pline)))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for raw data chunk")
@@ -3929,8 +5757,19 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
              *      or an init if it isn't.
              */
 
+            /* Check if the chunk was read (& unfiltered) ahead of time */
+            if(loaded_chunk) {
+                HDassert(H5F_addr_defined(chunk_addr));
+                HDassert(old_pline == pline);
+
+                chunk = loaded_chunk;
+
+                /* Increment # of cache misses */
+                rdcc->stats.nmisses++;
+                rdcc->file->stats.nmisses++;
+            } /* end if */
             /* Check if the chunk exists on disk */
-            if(H5F_addr_defined(chunk_addr)) {
+            else if(H5F_addr_defined(chunk_addr)) {
                 size_t my_chunk_alloc = chunk_alloc;    /* Allocated buffer size */
                 size_t buf_alloc = chunk_alloc;            /* [Re-]allocated buffer size */
 
@@ -3970,6 +5809,7 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
 
                 /* Increment # of cache misses */
                 rdcc->stats.nmisses++;
+                rdcc->file->stats.nmisses++;
             } /* end if */
             else {
                 H5D_fill_value_t    fill_status;
@@ -4024,12 +5864,28 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
             /* Add the chunk to the cache only if the slot is not already locked */
             ent = rdcc->slot[udata->idx_hint];
             if(!ent || !ent->locked) {
+                hbool_t hot = FALSE;    /* Whether the chunk goes in the 2Q policy's Am queue */
+
+                /* With the 2Q policy, a chunk that was preempted from the
+                 * A1in queue recently goes into the Am queue */
+                if(rdcc->policy == H5D_CHUNK_CACHE_POLICY_2Q &&
+                        H5D__chunk_cache_ghost_hit(rdcc, H5D__chunk_hash_key(dset->shared, udata->common.scaled))) {
+                    rdcc->stats.nghost_hits++;
+                    rdcc->file->stats.nghost_hits++;
+                    hot = TRUE;
+                } /* end if */
+
                 /* Preempt enough things from the cache to make room */
                 if(ent) {
                     if(H5D__chunk_cache_evict(io_info->dset, ent, TRUE) < 0)
                         HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk from cache")
+                    rdcc->file->stats.nevictions++;
                 } /* end if */
-                if(H5D__chunk_cache_prune(io_info->dset, chunk_size) < 0)
+                if(rdcc->use_shared) {
+                    if(H5D__chunk_cache_prune_shared(io_info->dset, chunk_size) < 0)
+                        HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk(s) from cache")
+                } /* end if */
+                else if(H5D__chunk_cache_prune(io_info->dset, chunk_size) < 0)
                     HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk(s) from cache")
 
                 /* Create a new entry */
@@ -4048,6 +5904,7 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
                 H5_CHECKED_ASSIGN(ent->rd_count, uint32_t, chunk_size, size_t);
                 H5_CHECKED_ASSIGN(ent->wr_count, uint32_t, chunk_size, size_t);
                 ent->chunk = (uint8_t *)chunk;
+                ent->hot = hot;
 
                 /* Add it to the cache */
                 HDassert(NULL == rdcc->slot[udata->idx_hint]);
@@ -4055,6 +5912,12 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
                 ent->idx = udata->idx_hint;
                 rdcc->nbytes_used += chunk_size;
                 rdcc->nused++;
+                if(!hot)
+                    rdcc->nbytes_a1in += chunk_size;
+                if(rdcc->use_shared) {
+                    rdcc->file->nbytes_used += chunk_size;
+                    rdcc->file->nused++;
+                } /* end if */
 
                 /* Add it to the linked list */
                 if(rdcc->tail) {
@@ -4099,9 +5962,12 @@ done:
         HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, NULL, "Can't release fill buffer info")
 
     /* Release the chunk allocated, on error */
-    if(!ret_value)
+    if(!ret_value) {
         if(chunk)
             chunk = H5D__chunk_mem_xfree(chunk, pline);
+        else if(loaded_chunk)
+            loaded_chunk = H5D__chunk_mem_xfree(loaded_chunk, pline);
+    } /* end if */
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_lock() */
@@ -4887,7 +6753,7 @@ H5D__chunk_update_old_edge_chunks(H5D_t *dset, hsize_t old_dim[])
                     || (UINT_MAX != chk_udata.idx_hint)) {
                 /* Lock the chunk into cache.  H5D__chunk_lock will take care of
                 * updating the chunk to no longer be an edge chunk. */
-                if(NULL == (chunk = (void *)H5D__chunk_lock(&chk_io_info, &chk_udata, FALSE, TRUE)))
+                if(NULL == (chunk = (void *)H5D__chunk_lock(&chk_io_info, &chk_udata, FALSE, TRUE, NULL)))
                     HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to lock raw data chunk")
 
                 /* Unlock the chunk */
@@ -5149,7 +7015,7 @@ H5D__chunk_prune_fill(H5D_chunk_it_ud1_t *udata, hbool_t new_unfilt_chunk)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "unable to select hyperslab")
 
     /* Lock the chunk into the cache, to get a pointer to the chunk buffer */
-    if(NULL == (chunk = (void *)H5D__chunk_lock(io_info, &chk_udata, FALSE, FALSE)))
+    if(NULL == (chunk = (void *)H5D__chunk_lock(io_info, &chk_udata, FALSE, FALSE, NULL)))
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to lock raw data chunk")
 
 
@@ -5818,6 +7684,10 @@ H5D__chunk_update_cache(H5D_t *dset)
     /* Check the rank */
     HDassert((dset->shared->layout.u.chunk.ndims - 1) > 1);
 
+    /* The keys of recently preempted chunks are no longer valid */
+    if(rdcc->ghosts)
+        H5D__chunk_cache_ghost_reset(rdcc);
+
     /* Add temporary entry list to rdcc */
     (void)HDmemset(&tmp_head, 0, sizeof(tmp_head));
     rdcc->tmp_head = &tmp_head;
@@ -51,17 +51,32 @@
 /* Local Macros */
 /****************/
 
+/* Max. # of blocks batched up for each vector read or write */
+#define H5D_CONTIG_VECTOR_SIZE  128
+
 
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* Blocks batched up for a vector read or write */
+typedef struct H5D_contig_vec_t {
+    uint32_t nblocks;           /* # of blocks batched up */
+    haddr_t addrs[H5D_CONTIG_VECTOR_SIZE];      /* File address of each block */
+    size_t sizes[H5D_CONTIG_VECTOR_SIZE];       /* Size of each block */
+    union {
+        void *r[H5D_CONTIG_VECTOR_SIZE];        /* Buffer to read each block into */
+        const void *w[H5D_CONTIG_VECTOR_SIZE];  /* Buffer to write each block from */
+    } bufs;
+} H5D_contig_vec_t;
+
 /* Callback info for sieve buffer readvv operation */
 typedef struct H5D_contig_readvv_sieve_ud_t {
     H5F_shared_t *f_sh;         /* Shared file for dataset */
     H5D_rdcdc_t *dset_contig;   /* Cached information about contiguous data */
     const H5D_contig_storage_t *store_contig;    /* Contiguous storage info for this I/O operation */
     unsigned char *rbuf;        /* Pointer to buffer to fill */
+    H5D_contig_vec_t vec;       /* Blocks too large for the sieve buffer, to read directly */
 } H5D_contig_readvv_sieve_ud_t;
 
 /* Callback info for [plain] readvv operation */
@@ -69,6 +84,7 @@ typedef struct H5D_contig_readvv_ud_t {
     H5F_shared_t *f_sh;         /* Shared file for dataset */
     haddr_t dset_addr;          /* Address of dataset */
     unsigned char *rbuf;        /* Pointer to buffer to fill */
+    H5D_contig_vec_t vec;       /* Blocks to read */
 } H5D_contig_readvv_ud_t;
 
 /* Callback info for sieve buffer writevv operation */
@@ -84,6 +100,7 @@ typedef struct H5D_contig_writevv_ud_t {
     H5F_shared_t *f_sh;         /* Shared file for dataset */
     haddr_t dset_addr;          /* Address of dataset */
     const unsigned char *wbuf;  /* Pointer to buffer to write */
+    H5D_contig_vec_t vec;       /* Blocks to write */
 } H5D_contig_writevv_ud_t;
 
 
@@ -108,6 +125,12 @@ static herr_t H5D__contig_flush(H5D_t *dset);
 /* Helper routines */
 static herr_t H5D__contig_write_one(H5D_io_info_t *io_info, hsize_t offset,
     size_t size);
+static herr_t H5D__contig_vec_read(H5F_shared_t *f_sh, H5D_contig_vec_t *vec,
+    haddr_t addr, size_t size, void *buf);
+static herr_t H5D__contig_vec_read_flush(H5F_shared_t *f_sh, H5D_contig_vec_t *vec);
+static herr_t H5D__contig_vec_write(H5F_shared_t *f_sh, H5D_contig_vec_t *vec,
+    haddr_t addr, size_t size, const void *buf);
+static herr_t H5D__contig_vec_write_flush(H5F_shared_t *f_sh, H5D_contig_vec_t *vec);
 
 
 /*********************/
@@ -700,6 +723,164 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5D__contig_write_one() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_vec_read
+ *
+ * Purpose:	Adds a block to read to a vector of blocks, merging it with
+ *		the last block when they're adjacent both in the file and
+ *		in memory.  The vector is read when it fills up.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_vec_read(H5F_shared_t *f_sh, H5D_contig_vec_t *vec, haddr_t addr,
+    size_t size, void *buf)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(vec);
+
+    /* Extend the last block, if possible */
+    if(vec->nblocks > 0) {
+        uint32_t last = vec->nblocks - 1;   /* Index of last block */
+
+        if(H5F_addr_eq(vec->addrs[last] + vec->sizes[last], addr)
+                && (unsigned char *)vec->bufs.r[last] + vec->sizes[last] == (unsigned char *)buf) {
+            vec->sizes[last] += size;
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+    } /* end if */
+
+    /* Make room for a new block */
+    if(H5D_CONTIG_VECTOR_SIZE == vec->nblocks)
+        if(H5D__contig_vec_read_flush(f_sh, vec) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "vector read failed")
+
+    vec->addrs[vec->nblocks] = addr;
+    vec->sizes[vec->nblocks] = size;
+    vec->bufs.r[vec->nblocks] = buf;
+    vec->nblocks++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5D__contig_vec_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_vec_read_flush
+ *
+ * Purpose:	Reads the blocks batched up in a vector, with one call to
+ *		the file driver if it supports vector I/O.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_vec_read_flush(H5F_shared_t *f_sh, H5D_contig_vec_t *vec)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(vec);
+
+    if(vec->nblocks > 0) {
+        if(H5F_shared_block_read_concurrent(f_sh, H5FD_MEM_DRAW, vec->nblocks, vec->addrs, vec->sizes, vec->bufs.r) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block vector read failed")
+        vec->nblocks = 0;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5D__contig_vec_read_flush() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_vec_write
+ *
+ * Purpose:	Adds a block to write to a vector of blocks, merging it with
+ *		the last block when they're adjacent both in the file and
+ *		in memory.  The vector is written when it fills up.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_vec_write(H5F_shared_t *f_sh, H5D_contig_vec_t *vec, haddr_t addr,
+    size_t size, const void *buf)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(vec);
+
+    /* Extend the last block, if possible */
+    if(vec->nblocks > 0) {
+        uint32_t last = vec->nblocks - 1;   /* Index of last block */
+
+        if(H5F_addr_eq(vec->addrs[last] + vec->sizes[last], addr)
+                && (const unsigned char *)vec->bufs.w[last] + vec->sizes[last] == (const unsigned char *)buf) {
+            vec->sizes[last] += size;
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+    } /* end if */
+
+    /* Make room for a new block */
+    if(H5D_CONTIG_VECTOR_SIZE == vec->nblocks)
+        if(H5D__contig_vec_write_flush(f_sh, vec) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "vector write failed")
+
+    vec->addrs[vec->nblocks] = addr;
+    vec->sizes[vec->nblocks] = size;
+    vec->bufs.w[vec->nblocks] = buf;
+    vec->nblocks++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5D__contig_vec_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_vec_write_flush
+ *
+ * Purpose:	Writes the blocks batched up in a vector, with one call to
+ *		the file driver if it supports vector I/O.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_vec_write_flush(H5F_shared_t *f_sh, H5D_contig_vec_t *vec)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(vec);
+
+    if(vec->nblocks > 0) {
+        if(H5F_shared_block_write_vector(f_sh, H5FD_MEM_DRAW, vec->nblocks, vec->addrs, vec->sizes, vec->bufs.w) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block vector write failed")
+        vec->nblocks = 0;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5D__contig_vec_write_flush() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_readvv_sieve_cb
@@ -750,7 +931,7 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len,
     if(NULL == dset_contig->sieve_buf) {
         /* Check if we can actually hold the I/O request in the sieve buffer */
         if(len > dset_contig->sieve_buf_size) {
-            if(H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
+            if(H5D__contig_vec_read(f_sh, &udata->vec, addr, len, buf) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
         } /* end if */
         else {
@@ -813,7 +994,7 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len,
                 } /* end if */
 
                 /* Read directly into the user's buffer */
-                if(H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
+                if(H5D__contig_vec_read(f_sh, &udata->vec, addr, len, buf) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
             } /* end if */
             /* Element size fits within the buffer size */
@@ -884,10 +1065,10 @@ H5D__contig_readvv_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udata
 
     FUNC_ENTER_STATIC
 
-    /* Write data */
-    if(H5F_shared_block_read(udata->f_sh, H5FD_MEM_DRAW, (udata->dset_addr + dst_off),
+    /* Read data */
+    if(H5D__contig_vec_read(udata->f_sh, &udata->vec, (udata->dset_addr + dst_off),
             len, (udata->rbuf + src_off)) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -939,12 +1120,17 @@ H5D__contig_readvv(const H5D_io_info_t *io_info,
         udata.dset_contig = &(io_info->dset->shared->cache.contig);
         udata.store_contig = &(io_info->store->contig);
         udata.rbuf = (unsigned char *)io_info->u.rbuf;
+        udata.vec.nblocks = 0;
 
         /* Call generic sequence operation routine */
         if((ret_value = H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
                 mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr,
                 H5D__contig_readvv_sieve_cb, &udata)) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vectorized sieve buffer read")
+
+        /* Read the sequences that bypassed the sieve buffer */
+        if(H5D__contig_vec_read_flush(udata.f_sh, &udata.vec) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't perform vectorized read")
     } /* end if */
     else {
         H5D_contig_readvv_ud_t udata;     /* User data for H5VM_opvv() operator */
@@ -953,12 +1139,17 @@ H5D__contig_readvv(const H5D_io_info_t *io_info,
         udata.f_sh = io_info->f_sh;
         udata.dset_addr = io_info->store->contig.dset_addr;
         udata.rbuf = (unsigned char *)io_info->u.rbuf;
+        udata.vec.nblocks = 0;
 
         /* Call generic sequence operation routine */
         if((ret_value = H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
                 mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr,
                 H5D__contig_readvv_cb, &udata)) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vectorized read")
+
+        /* Read the sequences still batched up */
+        if(H5D__contig_vec_read_flush(udata.f_sh, &udata.vec) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't perform vectorized read")
     } /* end else */
 
 done:
@@ -1200,7 +1391,7 @@ H5D__contig_writevv_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udat
     FUNC_ENTER_STATIC
 
     /* Write data */
-    if(H5F_shared_block_write(udata->f_sh, H5FD_MEM_DRAW, (udata->dset_addr + dst_off), len, (udata->wbuf + src_off)) < 0)
+    if(H5D__contig_vec_write(udata->f_sh, &udata->vec, (udata->dset_addr + dst_off), len, (udata->wbuf + src_off)) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
 
 done:
@@ -1267,12 +1458,17 @@ H5D__contig_writevv(const H5D_io_info_t *io_info,
         udata.f_sh = io_info->f_sh;
         udata.dset_addr = io_info->store->contig.dset_addr;
         udata.wbuf = (const unsigned char *)io_info->u.wbuf;
+        udata.vec.nblocks = 0;
 
         /* Call generic sequence operation routine */
         if((ret_value = H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
                 mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr,
                 H5D__contig_writevv_cb, &udata)) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vectorized read")
+
+        /* Write the sequences still batched up */
+        if(H5D__contig_vec_write_flush(udata.f_sh, &udata.vec) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't perform vectorized write")
     } /* end else */
 
 done:
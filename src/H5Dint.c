@@ -2058,6 +2058,11 @@ H5D_close(H5D_t *dataset)
 
     } /* end if */
     else {
+        /* Stop other datasets from flushing this dataset's chunks through this ID */
+        if(dataset->shared->layout.type == H5D_CHUNKED)
+            if(H5D__chunk_cache_release(dataset) < 0)
+                HDONE_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to release shared chunk cache")
+
         /* Decrement the ref. count for this object in the top file */
         if(H5FO_top_decr(dataset->oloc.file, dataset->oloc.addr) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't decrement count for object")
@@ -3755,12 +3760,20 @@ H5D_get_access_plist(const H5D_t *dset)
     /* If the dataset is chunked then copy the rdcc & append flush parameters.
      * Otherwise, use the default values. */
     if(dset->shared->layout.type == H5D_CHUNKED) {
+        size_t rdcc_nbytes = dset->shared->cache.chunk.nbytes_max;  /* Chunk cache size */
+
+        /* Datasets using the file's shared budget report the default size */
+        if(dset->shared->cache.chunk.use_shared)
+            rdcc_nbytes = H5D_CHUNK_CACHE_NBYTES_DEFAULT;
+
         if(H5P_set(new_plist, H5D_ACS_DATA_CACHE_NUM_SLOTS_NAME, &(dset->shared->cache.chunk.nslots)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set data cache number of slots")
-        if(H5P_set(new_plist, H5D_ACS_DATA_CACHE_BYTE_SIZE_NAME, &(dset->shared->cache.chunk.nbytes_max)) < 0)
+        if(H5P_set(new_plist, H5D_ACS_DATA_CACHE_BYTE_SIZE_NAME, &rdcc_nbytes) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set data cache byte size")
         if(H5P_set(new_plist, H5D_ACS_PREEMPT_READ_CHUNKS_NAME, &(dset->shared->cache.chunk.w0)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set preempt read chunks")
+        if(H5P_set(new_plist, H5D_ACS_DATA_CACHE_POLICY_NAME, &(dset->shared->cache.chunk.policy)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set chunk cache policy")
         if(H5P_set(new_plist, H5D_ACS_APPEND_FLUSH_NAME, &dset->shared->append_flush) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set append flush property")
     } else {
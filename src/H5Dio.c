@@ -195,6 +195,60 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dread() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dread_async
+ *
+ * Purpose:     Reads (part of) a data set from the file into application
+ *              memory BUF, like H5Dread, as an operation of the event set
+ *              ES_ID.  The operation may still be in progress when this
+ *              returns, so BUF must not be used until H5ESwait reports
+ *              that the event set's operations have completed.  The IDs
+ *              passed in may be closed right away.
+ *
+ * Return:      SUCCEED/FAIL (a failure of an operation that is still in
+ *              progress is reported by the event set)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dread_async(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
+    hid_t file_space_id, hid_t dxpl_id, void *buf/*out*/, hid_t es_id)
+{
+    herr_t          ret_value   = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "iiiiixi", dset_id, mem_type_id, mem_space_id, file_space_id,
+             dxpl_id, buf, es_id);
+
+    /* Check arguments */
+    if (mem_space_id < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid memory dataspace ID")
+    if (file_space_id < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid file dataspace ID")
+    if (NULL == H5I_object_verify(dset_id, H5I_DATASET))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+    if (H5I_EVENTSET != H5I_get_type(es_id))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "es_id is not an event set ID")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Read the data */
+    if (H5VL_dataset_read_async(dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf, es_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dread_async() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Dread_chunk
@@ -317,6 +371,60 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dwrite() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dwrite_async
+ *
+ * Purpose:     Writes (part of) a data set from application memory BUF to
+ *              the file, like H5Dwrite, as an operation of the event set
+ *              ES_ID.  The operation may still be in progress when this
+ *              returns, so BUF must not be changed until H5ESwait reports
+ *              that the event set's operations have completed.  The IDs
+ *              passed in may be closed right away.
+ *
+ * Return:      SUCCEED/FAIL (a failure of an operation that is still in
+ *              progress is reported by the event set)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dwrite_async(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
+    hid_t file_space_id, hid_t dxpl_id, const void *buf, hid_t es_id)
+{
+    herr_t                  ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "iiiii*xi", dset_id, mem_type_id, mem_space_id, file_space_id,
+             dxpl_id, buf, es_id);
+
+    /* Check arguments */
+    if (mem_space_id < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid memory dataspace ID")
+    if (file_space_id < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid file dataspace ID")
+    if (NULL == H5I_object_verify(dset_id, H5I_DATASET))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+    if (H5I_EVENTSET != H5I_get_type(es_id))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "es_id is not an event set ID")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Write the data */
+    if (H5VL_dataset_write_async(dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf, es_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dwrite_async() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Dwrite_chunk
@@ -374,6 +482,137 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dwrite_chunk() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dwrite_chunks
+ *
+ * Purpose:     Writes COUNT entire chunks to the file directly, the I'th
+ *              chunk being DATA_SIZES[I] bytes from BUFS[I], written at the
+ *              chunk offset OFFSETS[I] with the filter mask FILTERS[I].
+ *
+ *              This is equivalent to calling H5Dwrite_chunk() for each
+ *              chunk, but the chunks' file space is allocated first and
+ *              the chunks are then written with a single vector write
+ *              request, in the order of their file addresses.  A chunk may
+ *              not be written more than once in the same call.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dwrite_chunks(hid_t dset_id, hid_t dxpl_id, size_t count,
+    const uint32_t filters[], const hsize_t *offsets[], const size_t data_sizes[],
+    const void *bufs[])
+{
+    H5VL_object_t  *vol_obj = NULL;
+    size_t          u;                              /* Local index variable */
+    herr_t          ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "iiz*Iu**h*z**x", dset_id, dxpl_id, count, filters, offsets,
+             data_sizes, bufs);
+
+    /* Check arguments */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid dataset ID")
+    if (count > 0 && (!filters || !offsets || !data_sizes || !bufs))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "filters, offsets, data_sizes and bufs cannot be NULL")
+    if ((uint64_t)count > (uint64_t)UINT32_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "too many chunks")
+    for (u = 0; u < count; u++) {
+        if (!bufs[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf cannot be NULL")
+        if (!offsets[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "offset cannot be NULL")
+        if (0 == data_sizes[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "data_size cannot be zero")
+
+        /* Make sure data size is less than 4 GiB */
+        if ((uint64_t)data_sizes[u] > (uint64_t)UINT32_MAX)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid data_size - chunks cannot be > 4 GiB")
+    }
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dxpl_id is not a dataset transfer property list ID")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Write the chunks */
+    if(count > 0 && H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_CHUNK_WRITE_MULTI, dxpl_id, H5_REQUEST_NULL, count, filters, offsets, data_sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write unprocessed chunk data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dwrite_chunks() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dread_chunks
+ *
+ * Purpose:     Reads COUNT entire chunks from the file directly, the I'th
+ *              chunk being the one at the chunk offset OFFSETS[I], into
+ *              BUFS[I], returning its filter mask in FILTERS[I].  Each
+ *              buffer must be large enough for its chunk, as with
+ *              H5Dread_chunk().
+ *
+ *              This is equivalent to calling H5Dread_chunk() for each
+ *              chunk, but the chunks are looked up together and then read
+ *              with a single vector read request, in the order of their
+ *              file addresses.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dread_chunks(hid_t dset_id, hid_t dxpl_id, size_t count,
+    const hsize_t *offsets[], uint32_t filters[], void *bufs[])
+{
+    H5VL_object_t  *vol_obj = NULL;
+    size_t          u;                              /* Local index variable */
+    herr_t          ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE6("e", "iiz**h*Iu**x", dset_id, dxpl_id, count, offsets, filters, bufs);
+
+    /* Check arguments */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+    if (count > 0 && (!offsets || !filters || !bufs))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "offsets, filters and bufs cannot be NULL")
+    if ((uint64_t)count > (uint64_t)UINT32_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "too many chunks")
+    for (u = 0; u < count; u++) {
+        if (!bufs[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf cannot be NULL")
+        if (!offsets[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "offset cannot be NULL")
+    }
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dxpl_id is not a dataset transfer property list ID")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Read the raw chunks */
+    if(count > 0 && H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_CHUNK_READ_MULTI, dxpl_id, H5_REQUEST_NULL, count, offsets, filters, bufs) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read unprocessed chunk data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dread_chunks() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__read
@@ -955,6 +1194,20 @@ H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t do_write,
     type_info->max_type_size = MAX(type_info->src_type_size, type_info->dst_type_size);
     type_info->is_conv_noop = H5T_path_noop(type_info->tpath);
     type_info->is_xform_noop = H5Z_xform_noop(data_transform);
+    type_info->conv_nthreads = 1;
+    if(!type_info->is_conv_noop) {
+        H5T_class_t src_class = H5T_get_class(src_type, FALSE);
+        H5T_class_t dst_class = H5T_get_class(dst_type, FALSE);
+
+        type_info->is_conv_atomic = (hbool_t)(
+                (H5T_INTEGER == src_class || H5T_FLOAT == src_class || H5T_BITFIELD == src_class) &&
+                (H5T_INTEGER == dst_class || H5T_FLOAT == dst_class || H5T_BITFIELD == dst_class));
+
+        /* Atomic conversions may be split across threads */
+        if(type_info->is_conv_atomic)
+            if(H5CX_get_conv_nthreads(&type_info->conv_nthreads) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't retrieve # of threads for type conversion")
+    } /* end if */
     if(type_info->is_xform_noop && type_info->is_conv_noop) {
         type_info->cmpd_subset = NULL;
         type_info->need_bkg = H5T_BKG_NO;
@@ -1026,8 +1279,11 @@ H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t do_write,
         /* Get a temporary buffer for type conversion unless the app has already
          * supplied one through the xfer properties. Instead of allocating a
          * buffer which is the exact size, we allocate the target size.
+         * (Reads with atomic conversions use a smaller buffer, if any, which
+         * H5D__scatgath_read allocates when it needs one)
          */
-        if(NULL == (type_info->tconv_buf = (uint8_t *)tconv_buf)) {
+        if(NULL == (type_info->tconv_buf = (uint8_t *)tconv_buf) &&
+                !(!do_write && type_info->is_conv_atomic && type_info->is_xform_noop)) {
             /* Allocate temporary buffer */
             if(NULL == (type_info->tconv_buf = H5FL_BLK_CALLOC(type_conv, target_size)))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for type conversion")
@@ -103,6 +103,8 @@ typedef struct H5D_type_info_t {
     size_t  max_type_size;               /* Size of largest source/destination type */
     hbool_t is_conv_noop;                /* Whether the type conversion is a NOOP */
     hbool_t is_xform_noop;               /* Whether the data transform is a NOOP */
+    hbool_t is_conv_atomic;              /* Whether the type conversion is between integer, floating-point or bitfield types */
+    unsigned conv_nthreads;              /* # of threads for atomic type conversions */
     const H5T_subset_info_t *cmpd_subset;   /* Info related to the compound subset conversion functions */
     H5T_bkg_t need_bkg;                  /* Type of background buf needed */
     size_t   request_nelmts;             /* Requested strip mine */
@@ -394,16 +396,40 @@ typedef struct H5D_virtual_held_file_t {
 
 /* The raw data chunk cache */
 struct H5D_rdcc_ent_t;  /* Forward declaration of struct used below */
+struct H5D_rdcc_t;      /* Forward declaration of struct used below */
+
+/* The raw data chunk cache state shared by all datasets in a file.  Datasets
+ * that use the shared byte budget are linked into a list in most recently
+ * used order, so that space can be reclaimed from the datasets that have
+ * been idle longest.
+ */
+struct H5D_rdcc_file_t {
+    struct {
+        hsize_t     nhits;      /* Number of cache hits, all datasets   */
+        hsize_t     nmisses;    /* Number of cache misses, all datasets */
+        hsize_t     nevictions; /* Number of preemptions, all datasets  */
+        hsize_t     nflushes;   /* Number of cache flushes, all datasets */
+        hsize_t     nghost_hits; /* Number of 2Q ghost list hits, all datasets */
+    } stats;
+    size_t        nbytes_max;  /* Shared byte budget (0 if not enabled) */
+    size_t        nbytes_used; /* Bytes cached under the shared budget */
+    size_t        nused;       /* Chunks cached under the shared budget */
+    struct H5D_rdcc_t *head;   /* Most recently used dataset cache    */
+    struct H5D_rdcc_t *tail;   /* Least recently used dataset cache   */
+};
+
 typedef struct H5D_rdcc_t {
     struct {
         unsigned    ninits;    /* Number of chunk creations        */
         unsigned    nhits;     /* Number of cache hits            */
         unsigned    nmisses;   /* Number of cache misses        */
         unsigned    nflushes;  /* Number of cache flushes        */
+        unsigned    nghost_hits; /* Number of misses on recently preempted chunks (2Q) */
     } stats;
     size_t        nbytes_max;  /* Maximum cached raw data in bytes    */
     size_t        nslots;      /* Number of chunk slots allocated    */
     double        w0;          /* Chunk preemption policy          */
+    H5D_chunk_cache_policy_t policy; /* Chunk replacement policy    */
     struct H5D_rdcc_ent_t *head; /* Head of doubly linked list        */
     struct H5D_rdcc_ent_t *tail; /* Tail of doubly linked list        */
     struct H5D_rdcc_ent_t *tmp_head; /* Head of temporary doubly linked list.  Chunks on this list are not in the hash table (slot).  The head entry is a sentinel (does not refer to an actual chunk). */
@@ -415,6 +441,19 @@ typedef struct H5D_rdcc_t {
     H5S_t         *single_space;  /* Dataspace for single element I/O on chunks */
     H5D_chunk_info_t    *single_chunk_info;  /* Pointer to single chunk's info */
 
+    /* Information for the 2Q replacement policy */
+    size_t        nbytes_a1in;  /* Cached raw data not yet accessed again after it was loaded, in bytes */
+    H5SL_t        *ghosts;      /* Skip list of recently preempted chunks, by key */
+    struct H5D_rdcc_ghost_t *ghost_head; /* Oldest recently preempted chunk */
+    struct H5D_rdcc_ghost_t *ghost_tail; /* Newest recently preempted chunk */
+
+    /* Information for the file's shared chunk cache */
+    H5D_rdcc_file_t    *file;           /* File-wide chunk cache state */
+    hbool_t             use_shared;     /* Whether nbytes_max is the file's shared budget */
+    const struct H5D_t *owner;          /* Open dataset used to flush entries evicted on behalf of other datasets (NULL if not in the file's list) */
+    struct H5D_rdcc_t  *shared_prev;    /* Previous dataset in the file's list */
+    struct H5D_rdcc_t  *shared_next;    /* Next dataset in the file's list */
+
     /* Cached information about scaled dataspace dimensions */
     hsize_t             scaled_dims[H5S_MAX_RANK];          /* The scaled dim sizes */
     hsize_t             scaled_power2up[H5S_MAX_RANK];      /* The scaled dim sizes, rounded up to next power of 2 */
@@ -652,6 +691,7 @@ H5_DLL herr_t H5D__chunk_set_sizes(H5D_t *dset);
 H5_DLL herr_t H5D__chunk_addrmap(const H5D_io_info_t *io_info, haddr_t chunk_addr[]);
 #endif /* H5_HAVE_PARALLEL */
 H5_DLL herr_t H5D__chunk_update_cache(H5D_t *dset);
+H5_DLL herr_t H5D__chunk_cache_release(const H5D_t *dset);
 H5_DLL herr_t H5D__chunk_copy(H5F_t *f_src, H5O_storage_chunk_t *storage_src,
     H5O_layout_chunk_t *layout_src, H5F_t *f_dst, H5O_storage_chunk_t *storage_dst,
     const H5S_extent_t *ds_extent_src, const H5T_t *dt_src,
@@ -665,6 +705,11 @@ H5_DLL herr_t H5D__chunk_direct_write(const H5D_t *dset, uint32_t filters,
          hsize_t *offset, uint32_t data_size, const void *buf);
 H5_DLL herr_t H5D__chunk_direct_read(const H5D_t *dset, hsize_t *offset,
          uint32_t *filters, void *buf);
+H5_DLL herr_t H5D__chunk_direct_write_multi(const H5D_t *dset, size_t count,
+         const uint32_t filters[], const hsize_t *offsets[],
+         const size_t data_sizes[], const void *bufs[]);
+H5_DLL herr_t H5D__chunk_direct_read_multi(const H5D_t *dset, size_t count,
+         const hsize_t *offsets[], uint32_t filters[], void *bufs[]);
 #ifdef H5D_CHUNK_DEBUG
 H5_DLL herr_t H5D__chunk_stats(const H5D_t *dset, hbool_t headers);
 #endif /* H5D_CHUNK_DEBUG */
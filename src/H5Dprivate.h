@@ -51,6 +51,7 @@
 #define H5D_ACS_DATA_CACHE_NUM_SLOTS_NAME   "rdcc_nslots"    /* Size of raw data chunk cache(slots) */
 #define H5D_ACS_DATA_CACHE_BYTE_SIZE_NAME   "rdcc_nbytes"    /* Size of raw data chunk cache(bytes) */
 #define H5D_ACS_PREEMPT_READ_CHUNKS_NAME    "rdcc_w0"        /* Preemption read chunks first */
+#define H5D_ACS_DATA_CACHE_POLICY_NAME      "rdcc_policy"    /* Raw data chunk cache replacement policy */
 #define H5D_ACS_VDS_VIEW_NAME               "vds_view"       /* VDS view option */
 #define H5D_ACS_VDS_PRINTF_GAP_NAME         "vds_printf_gap" /* VDS printf gap size */
 #define H5D_ACS_VDS_PREFIX_NAME             "vds_prefix"     /* VDS file prefix */
@@ -83,6 +84,9 @@
 #define H5D_XFER_FILTER_CB_NAME         "filter_cb"      /* Filter callback function */
 #define H5D_XFER_CONV_CB_NAME           "type_conv_cb"   /* Type conversion callback function */
 #define H5D_XFER_XFORM_NAME             "data_transform" /* Data transform */
+#define H5D_XFER_FILTER_NTHREADS_NAME   "filter_nthreads" /* # of threads for chunk filtering */
+#define H5D_XFER_CHUNK_PREFETCH_NAME    "chunk_prefetch" /* # of chunks to read ahead */
+#define H5D_XFER_CONV_NTHREADS_NAME     "conv_nthreads"  /* # of threads for datatype conversion */
 #ifdef H5_HAVE_INSTRUMENTED_LIBRARY
 /* Collective chunk instrumentation properties */
 #define H5D_XFER_COLL_CHUNK_LINK_HARD_NAME "coll_chunk_link_hard"
@@ -127,6 +131,9 @@
 /* Typedef for dataset in memory (defined in H5Dpkg.h) */
 typedef struct H5D_t H5D_t;
 
+/* Typedef for the raw data chunk cache state shared by a file's datasets (defined in H5Dpkg.h) */
+typedef struct H5D_rdcc_file_t H5D_rdcc_file_t;
+
 /* Typedef for cached dataset creation property list information */
 typedef struct H5D_dcpl_cache_t {
     H5O_fill_t fill;            /* Fill value info (H5D_CRT_FILL_VALUE_NAME) */
@@ -172,6 +179,11 @@ H5_DLL hid_t H5D_get_access_plist(const H5D_t *dset);
 
 /* Functions that operate on chunked storage */
 H5_DLL herr_t H5D_chunk_idx_reset(H5O_storage_chunk_t *storage, hbool_t reset_addr);
+H5_DLL H5D_rdcc_file_t *H5D_chunk_file_cache_create(size_t nbytes_max);
+H5_DLL herr_t H5D_chunk_file_cache_dest(H5D_rdcc_file_t *rdcc_file);
+H5_DLL herr_t H5D_chunk_file_cache_get_stats(const H5D_rdcc_file_t *rdcc_file,
+    H5F_chunk_cache_stats_t *stats);
+H5_DLL herr_t H5D_chunk_file_cache_reset_stats(H5D_rdcc_file_t *rdcc_file);
 
 /* Functions that operate on virtual storage */
 H5_DLL herr_t H5D_virtual_check_mapping_pre(const H5S_t *vspace,
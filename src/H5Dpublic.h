@@ -101,6 +101,14 @@ typedef enum H5D_vds_view_t {
     H5D_VDS_LAST_AVAILABLE      = 1
 } H5D_vds_view_t;
 
+/* Values for the raw data chunk cache replacement policy */
+typedef enum H5D_chunk_cache_policy_t {
+    H5D_CHUNK_CACHE_POLICY_ERROR = -1,
+    H5D_CHUNK_CACHE_POLICY_LRU  = 0,    /* LRU, weighted by rdcc_w0 (default) */
+    H5D_CHUNK_CACHE_POLICY_2Q   = 1,    /* Scan resistant 2Q                    */
+    H5D_CHUNK_CACHE_POLICY_NTYPES       /* This one must be last!              */
+} H5D_chunk_cache_policy_t;
+
 /* Callback for H5Pset_append_flush() in a dataset access property list */
 typedef herr_t (*H5D_append_cb_t)(hid_t dataset_id, hsize_t *cur_dims, void *op_data);
 
@@ -134,6 +142,8 @@ H5_DLL hid_t H5Dcreate2(hid_t loc_id, const char *name, hid_t type_id,
 H5_DLL hid_t H5Dcreate_anon(hid_t file_id, hid_t type_id, hid_t space_id,
     hid_t plist_id, hid_t dapl_id);
 H5_DLL hid_t H5Dopen2(hid_t file_id, const char *name, hid_t dapl_id);
+H5_DLL hid_t H5Dopen_async(hid_t loc_id, const char *name, hid_t dapl_id,
+    hid_t es_id);
 H5_DLL herr_t H5Dclose(hid_t dset_id);
 H5_DLL hid_t H5Dget_space(hid_t dset_id);
 H5_DLL herr_t H5Dget_space_status(hid_t dset_id, H5D_space_status_t *allocation);
@@ -150,10 +160,19 @@ H5_DLL herr_t H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
 			hid_t file_space_id, hid_t plist_id, void *buf/*out*/);
 H5_DLL herr_t H5Dwrite(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
 			 hid_t file_space_id, hid_t plist_id, const void *buf);
+H5_DLL herr_t H5Dread_async(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
+            hid_t file_space_id, hid_t plist_id, void *buf/*out*/, hid_t es_id);
+H5_DLL herr_t H5Dwrite_async(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
+            hid_t file_space_id, hid_t plist_id, const void *buf, hid_t es_id);
 H5_DLL herr_t H5Dwrite_chunk(hid_t dset_id, hid_t dxpl_id, uint32_t filters, 
             const hsize_t *offset, size_t data_size, const void *buf);
 H5_DLL herr_t H5Dread_chunk(hid_t dset_id, hid_t dxpl_id,
             const hsize_t *offset, uint32_t *filters, void *buf);
+H5_DLL herr_t H5Dwrite_chunks(hid_t dset_id, hid_t dxpl_id, size_t count,
+            const uint32_t filters[], const hsize_t *offsets[],
+            const size_t data_sizes[], const void *bufs[]);
+H5_DLL herr_t H5Dread_chunks(hid_t dset_id, hid_t dxpl_id, size_t count,
+            const hsize_t *offsets[], uint32_t filters[], void *bufs[]);
 H5_DLL herr_t H5Diterate(void *buf, hid_t type_id, hid_t space_id,
             H5D_operator_t op, void *operator_data);
 H5_DLL herr_t H5Dvlen_get_buf_size(hid_t dataset_id, hid_t type_id, hid_t space_id, hsize_t *size);
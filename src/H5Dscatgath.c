@@ -34,6 +34,10 @@
 /* Local Macros */
 /****************/
 
+/* Maximum bytes of elements to gather, convert and scatter at a time for
+ * atomic conversions, which should fit in the cache */
+#define H5D_SCATGATH_STRIP_SIZE         (256 * 1024)
+
 
 /******************/
 /* Local Typedefs */
@@ -47,6 +51,9 @@ static herr_t H5D__scatter_file(const H5D_io_info_t *io_info,
     H5S_sel_iter_t *file_iter, size_t nelmts, const void *buf);
 static size_t H5D__gather_file(const H5D_io_info_t *io_info,
     H5S_sel_iter_t *file_iter, size_t nelmts, void *buf);
+static herr_t H5D__scatgath_read_atomic(const H5D_io_info_t *io_info,
+    const H5D_type_info_t *type_info, hsize_t nelmts, const H5S_t *file_space,
+    const H5S_t *mem_space);
 static herr_t H5D__compound_opt_read(size_t nelmts, H5S_sel_iter_t *iter,
     const H5D_type_info_t *type_info, void *user_buf/*out*/);
 static herr_t H5D__compound_opt_write(size_t nelmts, const H5D_type_info_t *type_info);
@@ -70,6 +77,9 @@ H5FL_SEQ_EXTERN(size_t);
 /* Declare extern free list to manage sequences of hsize_t */
 H5FL_SEQ_EXTERN(hsize_t);
 
+/* Declare extern free list to manage blocks of type conversion data */
+H5FL_BLK_EXTERN(type_conv);
+
 
 
 /*-------------------------------------------------------------------------
@@ -479,6 +489,13 @@ H5D__scatgath_read(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
     if(nelmts == 0)
         HGOTO_DONE(SUCCEED)
 
+    /* Check for a conversion that can be fused with the gather or scatter */
+    if(type_info->is_conv_atomic && type_info->is_xform_noop) {
+        if(H5D__scatgath_read_atomic(io_info, type_info, nelmts, file_space, mem_space) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "fused read failed")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Allocate the iterators */
     if(NULL == (mem_iter = H5FL_MALLOC(H5S_sel_iter_t)))
         HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate memory iterator")
@@ -537,7 +554,12 @@ H5D__scatgath_read(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
             /*
              * Perform datatype conversion.
              */
-            if(H5T_convert(type_info->tpath, type_info->src_type_id, type_info->dst_type_id,
+            if(type_info->is_conv_atomic) {
+                if(H5T_convert_parallel(type_info->tpath, type_info->src_type_id, type_info->dst_type_id,
+                        smine_nelmts, type_info->tconv_buf, type_info->conv_nthreads) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+            } /* end if */
+            else if(H5T_convert(type_info->tpath, type_info->src_type_id, type_info->dst_type_id,
                     smine_nelmts, (size_t)0, (size_t)0, type_info->tconv_buf,
                     type_info->bkg_buf) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
@@ -578,6 +600,142 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__scatgath_read() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__scatgath_read_atomic
+ *
+ * Purpose:	Reads from a contiguous [piece of a] dataset when the
+ *		type conversion is between atomic types (integer,
+ *		floating-point or bitfield) and there is no data transform.
+ *		Each strip of elements is gathered, converted and scattered
+ *		while it is still in the cache, instead of passing over a
+ *		type conversion buffer of up to the size set with
+ *		H5Pset_buffer three times:
+ *
+ *		If the memory selection is contiguous and the memory type
+ *		is at least as large as the file type, each strip is read
+ *		straight into the application's buffer and converted there,
+ *		without a type conversion buffer.
+ *
+ *		Otherwise each strip is gathered into a cache-sized type
+ *		conversion buffer, converted and scattered.
+ *
+ *		When the conversion is split across threads (see
+ *		H5Pset_conv_nthreads), the strips hold enough elements for
+ *		each thread instead.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__scatgath_read_atomic(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+    hsize_t nelmts, const H5S_t *file_space, const H5S_t *mem_space)
+{
+    uint8_t     *buf = (uint8_t *)io_info->u.rbuf; /* Local pointer to application buffer */
+    uint8_t     *tconv_buf = type_info->tconv_buf; /* Type conversion buffer */
+    hbool_t     tconv_buf_allocated = FALSE;    /* Whether the type conversion buffer was allocated */
+    H5S_sel_iter_t *mem_iter = NULL;            /* Memory selection iteration info */
+    hbool_t     mem_iter_init = FALSE;          /* Memory selection iteration info has been initialized */
+    H5S_sel_iter_t *file_iter = NULL;           /* File selection iteration info */
+    hbool_t     file_iter_init = FALSE;         /* File selection iteration info has been initialized */
+    htri_t      direct = FALSE;                 /* Whether to read into the application's buffer */
+    size_t      strip_nelmts;                   /* Maximum elements per strip */
+    hsize_t     smine_start;                    /* Strip mine start loc */
+    size_t      smine_nelmts;                   /* Elements per strip */
+    herr_t      ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(type_info->is_conv_atomic);
+    HDassert(type_info->is_xform_noop);
+    HDassert(H5T_BKG_NO == type_info->need_bkg);
+    HDassert(nelmts > 0);
+
+    /* Allocate and initialize the iterators */
+    if(NULL == (mem_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate memory iterator")
+    if(NULL == (file_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate file iterator")
+    if(H5S_select_iter_init(file_iter, file_space, type_info->src_type_size, H5S_SEL_ITER_GET_SEQ_LIST_SORTED) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize file selection information")
+    file_iter_init = TRUE;
+    if(H5S_select_iter_init(mem_iter, mem_space, type_info->dst_type_size, 0) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize memory selection information")
+    mem_iter_init = TRUE;
+
+    /* Limit the strips to the type conversion buffer and the cache (or to
+     * enough elements for each thread, when the conversion is split across
+     * threads)
+     */
+    if(type_info->conv_nthreads > 1)
+        strip_nelmts = MAX(1, (type_info->conv_nthreads * (size_t)H5T_CONV_PARALLEL_MIN) / type_info->max_type_size);
+    else
+        strip_nelmts = MAX(1, H5D_SCATGATH_STRIP_SIZE / type_info->max_type_size);
+    strip_nelmts = MIN(strip_nelmts, type_info->request_nelmts);
+
+    /* Check whether the elements can be converted in the application's buffer */
+    if(type_info->dst_type_size >= type_info->src_type_size)
+        if((direct = H5S_SELECT_IS_CONTIGUOUS(mem_space)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check if memory selection is contiguous")
+
+    /* Allocate a type conversion buffer if needed and the application
+     * didn't supply one */
+    if(!direct && NULL == tconv_buf) {
+        if(NULL == (tconv_buf = H5FL_BLK_MALLOC(type_conv, strip_nelmts * type_info->max_type_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for type conversion")
+        tconv_buf_allocated = TRUE;
+    } /* end if */
+
+    for(smine_start = 0; smine_start < nelmts; smine_start += smine_nelmts) {
+        uint8_t *conv_buf;      /* Buffer to convert the strip in */
+
+        smine_nelmts = (size_t)MIN(strip_nelmts, (nelmts - smine_start));
+
+        if(direct) {
+            hsize_t mem_off;        /* Offset of sequence in memory */
+            size_t mem_len;         /* Length of sequence in memory */
+            size_t nseq;            /* Number of sequences generated */
+
+            /* Get where the strip goes in the application's buffer */
+            if(H5S_SELECT_ITER_GET_SEQ_LIST(mem_iter, (size_t)1, smine_nelmts, &nseq, &smine_nelmts, &mem_off, &mem_len) < 0)
+                HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, FAIL, "sequence length generation failed")
+            HDassert(1 == nseq && smine_nelmts > 0);
+            conv_buf = buf + mem_off;
+        } /* end if */
+        else
+            conv_buf = tconv_buf;
+
+        /* Gather the strip from the file and convert it */
+        if(H5D__gather_file(io_info, file_iter, smine_nelmts, conv_buf/*out*/) != smine_nelmts)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file gather failed")
+        if(H5T_convert_parallel(type_info->tpath, type_info->src_type_id, type_info->dst_type_id,
+                smine_nelmts, conv_buf, type_info->conv_nthreads) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+        /* Scatter the strip into memory, if it isn't there already */
+        if(!direct)
+            if(H5D__scatter_mem(conv_buf, mem_iter, smine_nelmts, buf/*out*/) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "scatter failed")
+    } /* end for */
+
+done:
+    /* Release resources */
+    if(tconv_buf_allocated)
+        tconv_buf = H5FL_BLK_FREE(type_conv, tconv_buf);
+    if(file_iter_init && H5S_SELECT_ITER_RELEASE(file_iter) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "Can't release selection iterator")
+    if(file_iter)
+        file_iter = H5FL_FREE(H5S_sel_iter_t, file_iter);
+    if(mem_iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "Can't release selection iterator")
+    if(mem_iter)
+        mem_iter = H5FL_FREE(H5S_sel_iter_t, mem_iter);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__scatgath_read_atomic() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__scatgath_write
@@ -689,7 +847,12 @@ H5D__scatgath_write(const H5D_io_info_t *io_info, const H5D_type_info_t *type_in
             /*
              * Perform datatype conversion.
              */
-            if(H5T_convert(type_info->tpath, type_info->src_type_id, type_info->dst_type_id,
+            if(type_info->is_conv_atomic) {
+                if(H5T_convert_parallel(type_info->tpath, type_info->src_type_id, type_info->dst_type_id,
+                        smine_nelmts, type_info->tconv_buf, type_info->conv_nthreads) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+            } /* end if */
+            else if(H5T_convert(type_info->tpath, type_info->src_type_id, type_info->dst_type_id,
                     smine_nelmts, (size_t)0, (size_t)0, type_info->tconv_buf,
                     type_info->bkg_buf) < 0)
                  HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
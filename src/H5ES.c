@@ -0,0 +1,412 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Event sets: collections of asynchronous operations, such as
+ *              the ones started by H5Dread_async, that an application can
+ *              wait for together.
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5ESmodule.h"         /* This source code file is part of the H5ES module */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"          /* Generic Functions                        */
+#include "H5Eprivate.h"         /* Error handling                           */
+#include "H5ESpkg.h"            /* Event Sets                               */
+#include "H5Iprivate.h"         /* IDs                                      */
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+static herr_t H5ES__close_cb(H5ES_t *es);
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/* Package initialization variable */
+hbool_t H5_PKG_INIT_VAR = FALSE;
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Event set ID class */
+static const H5I_class_t H5I_EVENTSET_CLS[1] = {{
+    H5I_EVENTSET,               /* ID class value */
+    0,                          /* Class flags */
+    0,                          /* # of reserved IDs for class */
+    (H5I_free_t)H5ES__close_cb  /* Callback routine for closing objects of this class */
+}};
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__init_package
+ *
+ * Purpose:     Initializes any interface-specific data or routines.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ES__init_package(void)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Initialize the atom group for the event set IDs */
+    if(H5I_register_type(H5I_EVENTSET_CLS) < 0)
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTINIT, FAIL, "unable to initialize interface")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__init_package() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES_term_package
+ *
+ * Purpose:     Terminates the event set interface, after letting the
+ *              operations that are in progress finish.
+ *
+ * Return:      Success:    Positive if anything was done that might
+ *                          affect other interfaces; zero otherwise.
+ *              Failure:    Negative.
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+H5ES_term_package(void)
+{
+    int     n = 0;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(H5_PKG_INIT_VAR) {
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+        /* Finish the operations that are queued and stop the thread */
+        (void)H5ES__stop_thread();
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
+        if(H5I_nmembers(H5I_EVENTSET) > 0) {
+            (void)H5I_clear_type(H5I_EVENTSET, FALSE, FALSE);
+            n++; /*H5I*/
+        } /* end if */
+        else {
+            /* Destroy the event set ID group */
+            n += (H5I_dec_type_ref(H5I_EVENTSET) > 0);
+
+            /* Mark closed */
+            if(0 == n)
+                H5_PKG_INIT_VAR = FALSE;
+        } /* end else */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(n)
+} /* end H5ES_term_package() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__close_cb
+ *
+ * Purpose:     Called when the ref count reaches zero on an event set's ID
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5ES__close_cb(H5ES_t *es)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(es);
+
+    if(H5ES__close(es) < 0)
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CLOSEERROR, FAIL, "unable to close event set");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__close_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5EScreate
+ *
+ * Purpose:     Creates an event set, to pass to the asynchronous
+ *              versions of API routines, such as H5Dread_async.
+ *
+ * Return:      Success:    An ID for the event set
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5EScreate(void)
+{
+    H5ES_t     *es = NULL;              /* New event set */
+    hid_t       ret_value = H5I_INVALID_HID;    /* Return value */
+
+    FUNC_ENTER_API(H5I_INVALID_HID)
+    H5TRACE0("i","");
+
+    if(NULL == (es = H5ES__create()))
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTCREATE, H5I_INVALID_HID, "can't create event set")
+
+    if((ret_value = H5I_register(H5I_EVENTSET, es, TRUE)) < 0)
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTREGISTER, H5I_INVALID_HID, "unable to register event set")
+
+done:
+    if(ret_value < 0 && es)
+        if(H5ES__close(es) < 0)
+            HDONE_ERROR(H5E_EVENTSET, H5E_CLOSEERROR, H5I_INVALID_HID, "unable to release event set")
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5EScreate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ESwait
+ *
+ * Purpose:     Waits for the operations in an event set to finish, for at
+ *              most TIMEOUT nanoseconds.  H5ES_WAIT_FOREVER waits until
+ *              they have all finished and H5ES_WAIT_NONE just checks on
+ *              them.  Other threads can call into the library while this
+ *              one waits.
+ *
+ *              *NUM_IN_PROGRESS is set to the number of operations that
+ *              haven't finished and *ERR_OCCURRED to whether any
+ *              operation in the event set has failed.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ESwait(hid_t es_id, uint64_t timeout, size_t *num_in_progress,
+    hbool_t *op_failed)
+{
+    H5ES_t     *es;                     /* Event set */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iUL*z*b", es_id, timeout, num_in_progress, op_failed);
+
+    /* Check arguments */
+    if(NULL == (es = (H5ES_t *)H5I_object_verify(es_id, H5I_EVENTSET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an event set")
+    if(NULL == num_in_progress)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL num_in_progress pointer")
+    if(NULL == op_failed)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL op_failed pointer")
+
+    if(H5ES__wait(es, timeout, num_in_progress, op_failed) < 0)
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTWAIT, FAIL, "can't wait on operations")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5ESwait() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5EScancel
+ *
+ * Purpose:     Cancels the operations in an event set that haven't been
+ *              started yet.  *NUM_NOT_CANCELED is set to the number of
+ *              operations that were already in progress and
+ *              *ERR_OCCURRED to whether any operation in the event set
+ *              has failed.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5EScancel(hid_t es_id, size_t *num_not_canceled, hbool_t *op_failed)
+{
+    H5ES_t     *es;                     /* Event set */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "i*z*b", es_id, num_not_canceled, op_failed);
+
+    /* Check arguments */
+    if(NULL == (es = (H5ES_t *)H5I_object_verify(es_id, H5I_EVENTSET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an event set")
+    if(NULL == num_not_canceled)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL num_not_canceled pointer")
+    if(NULL == op_failed)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL op_failed pointer")
+
+    if(H5ES__cancel(es, num_not_canceled, op_failed) < 0)
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTCANCEL, FAIL, "can't cancel operations")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5EScancel() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ESget_count
+ *
+ * Purpose:     Retrieves the number of operations in an event set that
+ *              haven't finished.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ESget_count(hid_t es_id, size_t *count)
+{
+    H5ES_t     *es;                     /* Event set */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*z", es_id, count);
+
+    /* Check arguments */
+    if(NULL == (es = (H5ES_t *)H5I_object_verify(es_id, H5I_EVENTSET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an event set")
+
+    if(count)
+        *count = H5ES__get_count(es);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5ESget_count() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ESget_err_status
+ *
+ * Purpose:     Checks whether any operation in an event set has failed.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ESget_err_status(hid_t es_id, hbool_t *op_failed)
+{
+    H5ES_t     *es;                     /* Event set */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*b", es_id, op_failed);
+
+    /* Check arguments */
+    if(NULL == (es = (H5ES_t *)H5I_object_verify(es_id, H5I_EVENTSET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an event set")
+
+    if(op_failed)
+        *op_failed = (hbool_t)(es->err_count > 0);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5ESget_err_status() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ESget_err_count
+ *
+ * Purpose:     Retrieves the number of operations in an event set that
+ *              have failed.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ESget_err_count(hid_t es_id, size_t *num_errs)
+{
+    H5ES_t     *es;                     /* Event set */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*z", es_id, num_errs);
+
+    /* Check arguments */
+    if(NULL == (es = (H5ES_t *)H5I_object_verify(es_id, H5I_EVENTSET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an event set")
+
+    if(num_errs)
+        *num_errs = es->err_count;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5ESget_err_count() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ESclose
+ *
+ * Purpose:     Closes an event set.  The operations in it must have
+ *              finished (see H5ESwait).
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ESclose(hid_t es_id)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", es_id);
+
+    /* Check arguments */
+    if(H5I_EVENTSET != H5I_get_type(es_id))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an event set")
+
+    /* Decrement the counter on the event set.  It will be freed if the
+     * count reaches zero.
+     */
+    if(H5I_dec_app_ref(es_id) < 0)
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTDEC, FAIL, "unable to decrement ref count on event set")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5ESclose() */
+
@@ -0,0 +1,981 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Internal routines for event sets.
+ *
+ *              In thread-safe builds the operations inserted into event
+ *              sets are performed, in the order they were inserted, by a
+ *              single background thread.  The thread takes the library's
+ *              lock for each operation, the same as an application thread
+ *              calling the API, so operations never overlap with other
+ *              calls into the library; the application overlaps its own
+ *              work with the I/O instead.  Threads waiting for operations
+ *              to finish let go of the lock while they wait.
+ *
+ *              An operation that opens an object hands the application a
+ *              "future" ID (see H5I_register_future) right away.  The
+ *              first use of the ID waits for the open to finish.
+ *
+ *              In other builds operations are performed as soon as they
+ *              are inserted into an event set.
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5ESmodule.h"         /* This source code file is part of the H5ES module */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"          /* Generic Functions                        */
+#include "H5Eprivate.h"         /* Error handling                           */
+#include "H5ESpkg.h"            /* Event Sets                               */
+#include "H5FLprivate.h"        /* Free Lists                               */
+#include "H5Iprivate.h"         /* IDs                                      */
+#include "H5VLprivate.h"        /* Virtual Object Layer                     */
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+static H5ES_op_t *H5ES__op_new(H5ES_t *es, H5ES_op_func_t op,
+    H5ES_op_free_func_t free_func, void *ctx);
+static herr_t H5ES__op_perform(H5ES_op_t *op);
+static herr_t H5ES__op_decr(H5ES_op_t *op);
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+static hbool_t H5ES__start_thread(void);
+static void *H5ES__thread(void *arg);
+static void H5ES__op_run(H5ES_op_t *op);
+static herr_t H5ES__queue(H5ES_op_t *op);
+static herr_t H5ES__wait_op(H5ES_op_t *op);
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+static H5ES_op_t *H5ES__insert(hid_t es_id, H5I_type_t type, H5ES_op_func_t op,
+    H5ES_op_free_func_t free_func, void *ctx, hid_t *future_id);
+static herr_t H5ES__future_realize(void *future_object, void **actual_object);
+static herr_t H5ES__future_discard(void *future_object);
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare a free list to manage the H5ES_t struct */
+H5FL_DEFINE_STATIC(H5ES_t);
+
+/* Declare a free list to manage the H5ES_op_t struct */
+H5FL_DEFINE_STATIC(H5ES_op_t);
+
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+/* Lock for the queue of operations, the status of the operations and the
+ * counts of pending operations.  When it's taken along with the library's
+ * lock, the library's lock is taken first.
+ */
+static pthread_mutex_t H5ES_queue_lock_s = PTHREAD_MUTEX_INITIALIZER;
+
+/* Signaled when an operation is queued or the thread should stop */
+static pthread_cond_t H5ES_queue_cond_s = PTHREAD_COND_INITIALIZER;
+
+/* Broadcast when an operation finishes or is canceled */
+static pthread_cond_t H5ES_done_cond_s = PTHREAD_COND_INITIALIZER;
+
+/* Operations waiting for the background thread, in the order inserted */
+static H5ES_op_t *H5ES_queue_head_s = NULL;
+static H5ES_op_t *H5ES_queue_tail_s = NULL;
+
+/* The background thread */
+static pthread_t H5ES_thread_s;
+static hbool_t H5ES_thread_running_s = FALSE;
+static hbool_t H5ES_thread_stop_s = FALSE;
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__create
+ *
+ * Purpose:     Creates a new, empty event set.
+ *
+ * Return:      Success:    Pointer to the event set
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+H5ES_t *
+H5ES__create(void)
+{
+    H5ES_t *ret_value = NULL;           /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if(NULL == (ret_value = H5FL_CALLOC(H5ES_t)))
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTALLOC, NULL, "can't allocate event set object")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__create() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__op_new
+ *
+ * Purpose:     Creates an operation for an event set.
+ *
+ * Return:      Success:    Pointer to the operation
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5ES_op_t *
+H5ES__op_new(H5ES_t *es, H5ES_op_func_t op, H5ES_op_free_func_t free_func,
+    void *ctx)
+{
+    H5ES_op_t *ret_value = NULL;        /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(NULL == (ret_value = H5FL_CALLOC(H5ES_op_t)))
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTALLOC, NULL, "can't allocate event set operation")
+    ret_value->es = es;
+    ret_value->op = op;
+    ret_value->free_func = free_func;
+    ret_value->ctx = ctx;
+    ret_value->status = H5ES_STATUS_IN_PROGRESS;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__op_new() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__op_perform
+ *
+ * Purpose:     Performs an operation in the current API context and
+ *              releases its context.
+ *
+ * Return:      SUCCEED/FAIL (whether the operation succeeded)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5ES__op_perform(H5ES_op_t *op)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(op);
+    HDassert(op->ctx);
+
+    if((op->op)(op->ctx, &op->object) < 0)
+        HDONE_ERROR(H5E_EVENTSET, H5E_CANTOPERATE, FAIL, "asynchronous operation failed")
+
+    /* The operation's context isn't needed any longer.  (Failing to release
+     *  it doesn't undo the operation, so it's not an error for it.)
+     */
+    if(op->free_func)
+        (void)(op->free_func)(op->ctx);
+    op->ctx = NULL;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__op_perform() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__op_decr
+ *
+ * Purpose:     Drops a reference to an operation, freeing it when the
+ *              last one is gone.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5ES__op_decr(H5ES_op_t *op)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(op);
+    HDassert(op->rc > 0);
+
+    if(0 == --op->rc) {
+        /* Operations are only freed once they're finished */
+        HDassert(NULL == op->ctx);
+        HDassert(NULL == op->object);
+
+        if(op->lib_state && H5VL_free_lib_state(op->lib_state) < 0)
+            HDONE_ERROR(H5E_EVENTSET, H5E_CANTRELEASE, FAIL, "can't free library state")
+        op = H5FL_FREE(H5ES_op_t, op);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__op_decr() */
+
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__start_thread
+ *
+ * Purpose:     Starts the background thread, if it isn't running.
+ *
+ * Return:      TRUE if the thread is running, FALSE if it couldn't be
+ *              started
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5ES__start_thread(void)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    if(!H5ES_thread_running_s) {
+        H5ES_thread_stop_s = FALSE;
+        if(0 == pthread_create(&H5ES_thread_s, NULL, H5ES__thread, NULL))
+            H5ES_thread_running_s = TRUE;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(H5ES_thread_running_s)
+} /* end H5ES__start_thread() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__stop_thread
+ *
+ * Purpose:     Waits for the operations that are queued to finish and
+ *              stops the background thread.  If the calling thread holds
+ *              the library's lock, it lets go of it while it waits.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ES__stop_thread(void)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if(H5ES_thread_running_s) {
+        hbool_t have_lock = H5TS_api_lock_held();
+
+        if(have_lock && H5TS_api_lock_release() != 0)
+            HGOTO_ERROR(H5E_EVENTSET, H5E_CANTUNLOCK, FAIL, "can't release the library's lock")
+
+        pthread_mutex_lock(&H5ES_queue_lock_s);
+        H5ES_thread_stop_s = TRUE;
+        pthread_cond_signal(&H5ES_queue_cond_s);
+        pthread_mutex_unlock(&H5ES_queue_lock_s);
+        pthread_join(H5ES_thread_s, NULL);
+        H5ES_thread_running_s = FALSE;
+
+        if(have_lock && H5TS_api_lock_reacquire() != 0)
+            HGOTO_ERROR(H5E_EVENTSET, H5E_CANTLOCK, FAIL, "can't reacquire the library's lock")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__stop_thread() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__thread
+ *
+ * Purpose:     Body of the background thread: performs the queued
+ *              operations in order until it's told to stop and the queue
+ *              is empty.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5ES__thread(void H5_ATTR_UNUSED *arg)
+{
+    for(;;) {
+        H5ES_op_t *op;
+
+        pthread_mutex_lock(&H5ES_queue_lock_s);
+        while(NULL == H5ES_queue_head_s && !H5ES_thread_stop_s)
+            pthread_cond_wait(&H5ES_queue_cond_s, &H5ES_queue_lock_s);
+        if(NULL != (op = H5ES_queue_head_s)) {
+            if(NULL == (H5ES_queue_head_s = op->next))
+                H5ES_queue_tail_s = NULL;
+            op->next = NULL;
+        } /* end if */
+        pthread_mutex_unlock(&H5ES_queue_lock_s);
+
+        if(NULL == op)
+            break;
+
+        /* Perform the operation like an API call would */
+        H5_API_LOCK
+        H5ES__op_run(op);
+        H5_API_UNLOCK
+    } /* end for */
+
+    return NULL;
+} /* end H5ES__thread() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__op_run
+ *
+ * Purpose:     Performs an operation taken off the queue, in the API
+ *              context of the call that inserted it, and records its
+ *              status.  Called by the background thread with the
+ *              library's lock held.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5ES__op_run(H5ES_op_t *op)
+{
+    herr_t      status = FAIL;          /* Whether the operation succeeded */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(op);
+    HDassert(op->lib_state);
+
+    /* Each operation starts with an empty error stack, like an API call */
+    H5E_clear_stack(NULL);
+
+    if(H5VL_restore_lib_state(op->lib_state) >= 0) {
+        status = H5ES__op_perform(op);
+        if(H5VL_reset_lib_state() < 0)
+            status = FAIL;
+    } /* end if */
+    else if(op->ctx) {
+        /* Release the context of the operation that couldn't be performed */
+        if(op->free_func)
+            (void)(op->free_func)(op->ctx);
+        op->ctx = NULL;
+    } /* end else */
+
+    /* Record the status */
+    pthread_mutex_lock(&H5ES_queue_lock_s);
+    op->status = status >= 0 ? H5ES_STATUS_SUCCEED : H5ES_STATUS_FAIL;
+    op->es->npending--;
+    if(status < 0)
+        op->es->err_count++;
+    pthread_cond_broadcast(&H5ES_done_cond_s);
+    pthread_mutex_unlock(&H5ES_queue_lock_s);
+
+    /* Drop the queue's reference to the operation */
+    (void)H5ES__op_decr(op);
+
+    H5E_clear_stack(NULL);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5ES__op_run() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__queue
+ *
+ * Purpose:     Queues an operation for the background thread, with a
+ *              copy of the current API context to perform it in.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5ES__queue(H5ES_op_t *op)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(op);
+    HDassert(op->es);
+
+    if(H5VL_retrieve_lib_state(&op->lib_state) < 0)
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTGET, FAIL, "can't retrieve library state")
+
+    /* The queue holds a reference to the operation until it's finished */
+    op->rc++;
+
+    pthread_mutex_lock(&H5ES_queue_lock_s);
+    if(H5ES_queue_tail_s)
+        H5ES_queue_tail_s->next = op;
+    else
+        H5ES_queue_head_s = op;
+    H5ES_queue_tail_s = op;
+    op->es->npending++;
+    pthread_cond_signal(&H5ES_queue_cond_s);
+    pthread_mutex_unlock(&H5ES_queue_lock_s);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__queue() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__wait_op
+ *
+ * Purpose:     Waits for an operation to finish, letting go of the
+ *              library's lock while waiting.  The caller must hold a
+ *              reference to the operation.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5ES__wait_op(H5ES_op_t *op)
+{
+    H5ES_status_t status;               /* Status of the operation */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(op);
+    HDassert(op->rc > 0);
+
+    pthread_mutex_lock(&H5ES_queue_lock_s);
+    status = op->status;
+    pthread_mutex_unlock(&H5ES_queue_lock_s);
+
+    if(H5ES_STATUS_IN_PROGRESS == status) {
+        if(H5TS_api_lock_release() != 0)
+            HGOTO_ERROR(H5E_EVENTSET, H5E_CANTUNLOCK, FAIL, "can't release the library's lock")
+
+        pthread_mutex_lock(&H5ES_queue_lock_s);
+        while(H5ES_STATUS_IN_PROGRESS == op->status)
+            pthread_cond_wait(&H5ES_done_cond_s, &H5ES_queue_lock_s);
+        pthread_mutex_unlock(&H5ES_queue_lock_s);
+
+        if(H5TS_api_lock_reacquire() != 0)
+            HGOTO_ERROR(H5E_EVENTSET, H5E_CANTLOCK, FAIL, "can't reacquire the library's lock")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__wait_op() */
+
+
+
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__future_realize
+ *
+ * Purpose:     'Realize' callback for the future ID of an asynchronous
+ *              open: waits for the open to finish and hands over the
+ *              object it opened.  If another thread realized the ID
+ *              while this one was waiting, *ACTUAL_OBJECT is set to NULL.
+ *
+ * Return:      SUCCEED/FAIL (whether the open succeeded)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5ES__future_realize(void *future_object, void **actual_object)
+{
+    H5ES_op_t  *op = (H5ES_op_t *)future_object;    /* The open operation */
+    H5ES_status_t status;               /* Status of the open */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(op);
+    HDassert(actual_object);
+
+    *actual_object = NULL;
+
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+    {
+        herr_t wait_ret;                /* Whether the wait succeeded */
+
+        /* Hold on to the operation while waiting, in case the ID goes away */
+        op->rc++;
+        wait_ret = H5ES__wait_op(op);
+        status = op->status;
+        if(wait_ret >= 0 && H5ES_STATUS_SUCCEED == status) {
+            *actual_object = op->object;
+            op->object = NULL;
+        } /* end if */
+        if(H5ES__op_decr(op) < 0)
+            HGOTO_ERROR(H5E_EVENTSET, H5E_CANTDEC, FAIL, "can't release asynchronous operation")
+        if(wait_ret < 0)
+            HGOTO_ERROR(H5E_EVENTSET, H5E_CANTWAIT, FAIL, "can't wait for asynchronous open")
+    }
+#else /* H5ES_HAVE_BACKGROUND_THREAD */
+    status = op->status;
+    if(H5ES_STATUS_SUCCEED == status) {
+        *actual_object = op->object;
+        op->object = NULL;
+    } /* end if */
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
+    if(NULL == *actual_object && H5ES_STATUS_SUCCEED != status)
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTOPENOBJ, FAIL, "asynchronous open failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__future_realize() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__future_discard
+ *
+ * Purpose:     'Discard' callback for the future ID of an asynchronous
+ *              open: drops the ID's reference to the operation, once the
+ *              ID has been realized or removed.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5ES__future_discard(void *future_object)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(H5ES__op_decr((H5ES_op_t *)future_object) < 0)
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTDEC, FAIL, "can't release asynchronous operation")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__future_discard() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__insert
+ *
+ * Purpose:     Inserts an operation into an event set: queues it for the
+ *              background thread or, when there isn't one, performs it
+ *              right away.  If TYPE isn't H5I_BADID, the operation opens
+ *              an object of that type and a future ID for the object is
+ *              returned in *FUTURE_ID.
+ *
+ *              The event set takes over CTX, even when the operation
+ *              can't be inserted.
+ *
+ * Return:      Success:    The operation, with a reference held for the
+ *                          caller
+ *              Failure:    NULL (also when an operation performed right
+ *                          away fails)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5ES_op_t *
+H5ES__insert(hid_t es_id, H5I_type_t type, H5ES_op_func_t op,
+    H5ES_op_free_func_t free_func, void *ctx, hid_t *future_id)
+{
+    H5ES_t     *es;                     /* Event set */
+    H5ES_op_t  *es_op = NULL;           /* Operation */
+    H5ES_op_t  *ret_value = NULL;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(op);
+    HDassert(ctx);
+    HDassert(H5I_BADID == type || future_id);
+
+    if(NULL == (es = (H5ES_t *)H5I_object_verify(es_id, H5I_EVENTSET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not an event set")
+    if(NULL == (es_op = H5ES__op_new(es, op, free_func, ctx)))
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTCREATE, NULL, "can't create asynchronous operation")
+    ctx = NULL;
+    es_op->rc = 1;
+
+    /* Register the future ID before the operation can be performed, so the
+     * object it opens always ends up with the ID
+     */
+    if(H5I_BADID != type) {
+        if((*future_id = H5I_register_future(type, es_op, H5ES__future_realize, H5ES__future_discard)) < 0)
+            HGOTO_ERROR(H5E_EVENTSET, H5E_CANTREGISTER, NULL, "can't register future ID")
+        es_op->rc++;
+    } /* end if */
+
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+    if(H5ES__start_thread()) {
+        if(H5ES__queue(es_op) < 0) {
+            /* Mark the operation failed, so the future ID goes away when used */
+            pthread_mutex_lock(&H5ES_queue_lock_s);
+            es_op->status = H5ES_STATUS_FAIL;
+            pthread_mutex_unlock(&H5ES_queue_lock_s);
+            HGOTO_ERROR(H5E_EVENTSET, H5E_CANTINSERT, NULL, "can't queue asynchronous operation")
+        } /* end if */
+    } /* end if */
+    else
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+    {
+        /* Perform the operation right away */
+        if(H5ES__op_perform(es_op) < 0) {
+            es_op->status = H5ES_STATUS_FAIL;
+            HGOTO_ERROR(H5E_EVENTSET, H5E_CANTOPERATE, NULL, "operation failed")
+        } /* end if */
+        es_op->status = H5ES_STATUS_SUCCEED;
+    } /* end else */
+
+    ret_value = es_op;
+
+done:
+    if(NULL == ret_value) {
+        if(ctx && free_func)
+            (void)(free_func)(ctx);
+        if(es_op) {
+            if(es_op->ctx) {
+                if(es_op->free_func)
+                    (void)(es_op->free_func)(es_op->ctx);
+                es_op->ctx = NULL;
+            } /* end if */
+            if(H5ES__op_decr(es_op) < 0)
+                HDONE_ERROR(H5E_EVENTSET, H5E_CANTDEC, NULL, "can't release asynchronous operation")
+        } /* end if */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__insert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES_insert
+ *
+ * Purpose:     Inserts an operation into an event set.  OP performs the
+ *              operation on CTX, and FREE_FUNC (if not NULL) releases CTX
+ *              afterwards.  The event set takes over CTX, even when the
+ *              operation can't be inserted.
+ *
+ * Return:      SUCCEED/FAIL (an operation that's performed right away
+ *              because there's no background thread fails here; one
+ *              that's queued counts as an error in the event set)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ES_insert(hid_t es_id, H5ES_op_func_t op, H5ES_op_free_func_t free_func,
+    void *ctx)
+{
+    H5ES_op_t  *es_op;                  /* Operation */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if(NULL == (es_op = H5ES__insert(es_id, H5I_BADID, op, free_func, ctx, NULL)))
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTINSERT, FAIL, "can't insert operation into event set")
+    if(H5ES__op_decr(es_op) < 0)
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTDEC, FAIL, "can't release asynchronous operation")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES_insert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES_insert_open
+ *
+ * Purpose:     Inserts an operation that opens an object of type TYPE
+ *              into an event set, like H5ES_insert.  OP returns the
+ *              object, which must be what IDs of TYPE refer to.
+ *
+ * Return:      Success:    An ID for the object.  When the operation is
+ *                          queued this is a future ID, which waits for
+ *                          the open the first time it's used and goes
+ *                          away if the open fails.
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5ES_insert_open(hid_t es_id, H5I_type_t type, H5ES_op_func_t op,
+    H5ES_op_free_func_t free_func, void *ctx)
+{
+    H5ES_op_t  *es_op;                  /* Operation */
+    hid_t       future_id = H5I_INVALID_HID;    /* ID for the object */
+    hid_t       ret_value = H5I_INVALID_HID;    /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    if(NULL == (es_op = H5ES__insert(es_id, type, op, free_func, ctx, &future_id))) {
+        /* The open failed or couldn't be queued, so let go of the future ID */
+        if(future_id >= 0)
+            H5E_BEGIN_TRY {
+                (void)H5I_object(future_id);
+            } H5E_END_TRY;
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTINSERT, H5I_INVALID_HID, "can't insert operation into event set")
+    } /* end if */
+
+    /* Realize the ID now, if the open has already been performed */
+    if(H5ES_STATUS_IN_PROGRESS != es_op->status && NULL == H5I_object(future_id))
+        HDONE_ERROR(H5E_EVENTSET, H5E_CANTOPENOBJ, H5I_INVALID_HID, "can't open object")
+    else
+        ret_value = future_id;
+
+    if(H5ES__op_decr(es_op) < 0)
+        HDONE_ERROR(H5E_EVENTSET, H5E_CANTDEC, H5I_INVALID_HID, "can't release asynchronous operation")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES_insert_open() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__wait
+ *
+ * Purpose:     Waits for the operations in an event set to finish, for at
+ *              most TIMEOUT nanoseconds, letting go of the library's lock
+ *              while waiting.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ES__wait(H5ES_t *es, uint64_t H5ES_ATTR_INLINE_UNUSED timeout,
+    size_t *num_in_progress, hbool_t *op_failed)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+    FUNC_ENTER_PACKAGE
+#else /* H5ES_HAVE_BACKGROUND_THREAD */
+    FUNC_ENTER_PACKAGE_NOERR
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
+    /* Sanity checks */
+    HDassert(es);
+    HDassert(num_in_progress);
+    HDassert(op_failed);
+
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+    pthread_mutex_lock(&H5ES_queue_lock_s);
+    *num_in_progress = es->npending;
+    pthread_mutex_unlock(&H5ES_queue_lock_s);
+
+    if(*num_in_progress > 0 && timeout > 0) {
+        struct timespec deadline;       /* When to stop waiting */
+
+        if(H5ES_WAIT_FOREVER != timeout) {
+            struct timeval now;         /* Current time */
+
+            HDgettimeofday(&now, NULL);
+            deadline.tv_sec = now.tv_sec + (time_t)(timeout / 1000000000);
+            deadline.tv_nsec = (long)now.tv_usec * 1000 + (long)(timeout % 1000000000);
+            if(deadline.tv_nsec >= 1000000000) {
+                deadline.tv_sec++;
+                deadline.tv_nsec -= 1000000000;
+            } /* end if */
+        } /* end if */
+
+        if(H5TS_api_lock_release() != 0)
+            HGOTO_ERROR(H5E_EVENTSET, H5E_CANTUNLOCK, FAIL, "can't release the library's lock")
+
+        pthread_mutex_lock(&H5ES_queue_lock_s);
+        while(es->npending > 0) {
+            if(H5ES_WAIT_FOREVER == timeout)
+                pthread_cond_wait(&H5ES_done_cond_s, &H5ES_queue_lock_s);
+            else if(ETIMEDOUT == pthread_cond_timedwait(&H5ES_done_cond_s, &H5ES_queue_lock_s, &deadline))
+                break;
+        } /* end while */
+        *num_in_progress = es->npending;
+        pthread_mutex_unlock(&H5ES_queue_lock_s);
+
+        if(H5TS_api_lock_reacquire() != 0)
+            HGOTO_ERROR(H5E_EVENTSET, H5E_CANTLOCK, FAIL, "can't reacquire the library's lock")
+    } /* end if */
+
+    *op_failed = (hbool_t)(es->err_count > 0);
+
+done:
+#else /* H5ES_HAVE_BACKGROUND_THREAD */
+    /* Operations are performed when they're inserted */
+    *num_in_progress = 0;
+    *op_failed = (hbool_t)(es->err_count > 0);
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__wait() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__cancel
+ *
+ * Purpose:     Cancels the operations of an event set that the background
+ *              thread hasn't started yet.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ES__cancel(H5ES_t *es, size_t *num_not_canceled, hbool_t *op_failed)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+    FUNC_ENTER_PACKAGE
+#else /* H5ES_HAVE_BACKGROUND_THREAD */
+    FUNC_ENTER_PACKAGE_NOERR
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
+    /* Sanity checks */
+    HDassert(es);
+    HDassert(num_not_canceled);
+    HDassert(op_failed);
+
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+{
+    H5ES_op_t  *canceled = NULL;        /* Operations taken off the queue */
+    H5ES_op_t  *prev = NULL;            /* Previous operation in the queue */
+    H5ES_op_t  *op;                     /* Current operation */
+
+    pthread_mutex_lock(&H5ES_queue_lock_s);
+    op = H5ES_queue_head_s;
+    while(op) {
+        H5ES_op_t *next = op->next;
+
+        if(op->es == es) {
+            if(prev)
+                prev->next = next;
+            else
+                H5ES_queue_head_s = next;
+            if(H5ES_queue_tail_s == op)
+                H5ES_queue_tail_s = prev;
+            op->status = H5ES_STATUS_CANCELED;
+            es->npending--;
+            op->next = canceled;
+            canceled = op;
+        } /* end if */
+        else
+            prev = op;
+        op = next;
+    } /* end while */
+    *num_not_canceled = es->npending;
+    if(canceled)
+        pthread_cond_broadcast(&H5ES_done_cond_s);
+    pthread_mutex_unlock(&H5ES_queue_lock_s);
+
+    /* Release the canceled operations */
+    while(canceled) {
+        op = canceled;
+        canceled = op->next;
+        if(op->free_func)
+            (void)(op->free_func)(op->ctx);
+        op->ctx = NULL;
+        if(H5ES__op_decr(op) < 0)
+            HDONE_ERROR(H5E_EVENTSET, H5E_CANTDEC, FAIL, "can't release asynchronous operation")
+    } /* end while */
+}
+#else /* H5ES_HAVE_BACKGROUND_THREAD */
+    /* Operations are performed when they're inserted */
+    *num_not_canceled = 0;
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
+    *op_failed = (hbool_t)(es->err_count > 0);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__cancel() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__get_count
+ *
+ * Purpose:     Retrieves the number of operations in an event set that
+ *              haven't finished.
+ *
+ * Return:      The number of operations
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5ES__get_count(const H5ES_t *es)
+{
+    size_t ret_value = 0;               /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity check */
+    HDassert(es);
+
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+    pthread_mutex_lock(&H5ES_queue_lock_s);
+    ret_value = es->npending;
+    pthread_mutex_unlock(&H5ES_queue_lock_s);
+#else /* H5ES_HAVE_BACKGROUND_THREAD */
+    ret_value = es->npending;
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__get_count() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__close
+ *
+ * Purpose:     Frees an event set, which must not have any operations
+ *              that haven't finished.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ES__close(H5ES_t *es)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(es);
+
+    if(H5ES__get_count(es) > 0)
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTCLOSEOBJ, FAIL, "can't close event set while operations are in progress")
+
+    es = H5FL_FREE(H5ES_t, es);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__close() */
@@ -0,0 +1,96 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: This file contains declarations which are visible only within
+ *          the H5ES package.  Source files outside the H5ES package should
+ *          include H5ESprivate.h instead.
+ */
+#if !(defined H5ES_FRIEND || defined H5ES_MODULE)
+#error "Do not include this file outside the H5ES package!"
+#endif
+
+#ifndef _H5ESpkg_H
+#define _H5ESpkg_H
+
+/* Get package's private header */
+#include "H5ESprivate.h"
+
+/* Other private headers needed by this file */
+
+
+/**************************/
+/* Package Private Macros */
+/**************************/
+
+/* Operations run on a background thread only in thread-safe builds, where
+ * the library's lock keeps them from running at the same time as the
+ * application's own calls.  Otherwise they are performed as soon as they
+ * are inserted into an event set.
+ */
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5_HAVE_WIN_THREADS)
+#define H5ES_HAVE_BACKGROUND_THREAD
+#endif
+
+/* Marks parameters that only matter when there's a background thread */
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+#define H5ES_ATTR_INLINE_UNUSED /*void*/
+#else
+#define H5ES_ATTR_INLINE_UNUSED H5_ATTR_UNUSED
+#endif
+
+
+/****************************/
+/* Package Private Typedefs */
+/****************************/
+
+/* An event set */
+typedef struct H5ES_t {
+    size_t  npending;           /* # of operations not finished yet (changed under the queue's lock) */
+    size_t  err_count;          /* # of operations that failed */
+} H5ES_t;
+
+/* An operation inserted into an event set */
+typedef struct H5ES_op_t {
+    H5ES_t *es;                 /* Event set the operation is in */
+    H5ES_op_func_t op;          /* Callback performing the operation */
+    H5ES_op_free_func_t free_func;  /* Callback releasing its context */
+    void   *ctx;                /* Operation's context */
+    void   *lib_state;          /* API context of the call that inserted it */
+    void   *object;             /* Object opened by the operation */
+    H5ES_status_t status;       /* Status (changed under the queue's lock) */
+    unsigned rc;                /* # of references: the queue, a future ID and its waiters */
+    struct H5ES_op_t *next;     /* Next operation in the queue */
+} H5ES_op_t;
+
+
+/*****************************/
+/* Package Private Variables */
+/*****************************/
+
+
+/******************************/
+/* Package Private Prototypes */
+/******************************/
+H5_DLL H5ES_t *H5ES__create(void);
+H5_DLL herr_t H5ES__wait(H5ES_t *es, uint64_t timeout, size_t *num_in_progress,
+    hbool_t *op_failed);
+H5_DLL herr_t H5ES__cancel(H5ES_t *es, size_t *num_not_canceled,
+    hbool_t *op_failed);
+H5_DLL size_t H5ES__get_count(const H5ES_t *es);
+H5_DLL herr_t H5ES__close(H5ES_t *es);
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+H5_DLL herr_t H5ES__stop_thread(void);
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
+#endif /* _H5ESpkg_H */
+
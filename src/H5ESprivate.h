@@ -0,0 +1,63 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * This file contains private information about the H5ES module
+ */
+
+#ifndef _H5ESprivate_H
+#define _H5ESprivate_H
+
+/* Include package's public header */
+#include "H5ESpublic.h"
+
+/* Private headers needed by this file */
+#include "H5Iprivate.h"     /* IDs                                  */
+
+
+/**************************/
+/* Library Private Macros */
+/**************************/
+
+
+/****************************/
+/* Library Private Typedefs */
+/****************************/
+
+/* Callback that performs an operation inserted into an event set.  It is
+ * called with the library's lock held, in a copy of the API context of the
+ * call that inserted it, and an operation that opens an object returns the
+ * object in *OBJECT.
+ */
+typedef herr_t (*H5ES_op_func_t)(void *ctx, void **object);
+
+/* Callback that releases the context of an operation, once it has been
+ * performed or canceled (also called with the library's lock held)
+ */
+typedef herr_t (*H5ES_op_free_func_t)(void *ctx);
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/******************************/
+/* Library Private Prototypes */
+/******************************/
+H5_DLL herr_t H5ES_insert(hid_t es_id, H5ES_op_func_t op,
+    H5ES_op_free_func_t free_func, void *ctx);
+H5_DLL hid_t H5ES_insert_open(hid_t es_id, H5I_type_t type, H5ES_op_func_t op,
+    H5ES_op_free_func_t free_func, void *ctx);
+
+#endif /* _H5ESprivate_H */
+
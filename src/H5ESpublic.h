@@ -20,6 +20,17 @@
 /* Public Macros */
 /*****************/
 
+/* Default value for "no event set" / synchronous execution */
+#define H5ES_NONE               (hid_t)0
+
+/* Special "wait" timeout values */
+#define H5ES_WAIT_FOREVER       (UINT64_MAX)    /* Wait until all operations complete */
+#define H5ES_WAIT_NONE          (0)             /* Don't wait for operations to complete,
+                                                 *  just check their status.
+                                                 *  (this allows H5ESwait to behave
+                                                 *   like a 'test' operation)
+                                                 */
+
 /*******************/
 /* Public Typedefs */
 /*******************/
@@ -45,6 +56,16 @@ typedef enum H5ES_status_t {
 extern "C" {
 #endif
 
+H5_DLL hid_t H5EScreate(void);
+H5_DLL herr_t H5ESwait(hid_t es_id, uint64_t timeout, size_t *num_in_progress,
+    hbool_t *op_failed);
+H5_DLL herr_t H5EScancel(hid_t es_id, size_t *num_not_canceled,
+    hbool_t *op_failed);
+H5_DLL herr_t H5ESget_count(hid_t es_id, size_t *count);
+H5_DLL herr_t H5ESget_err_status(hid_t es_id, hbool_t *op_failed);
+H5_DLL herr_t H5ESget_err_count(hid_t es_id, size_t *num_errs);
+H5_DLL herr_t H5ESclose(hid_t es_id);
+
 #ifdef __cplusplus
 }
 #endif
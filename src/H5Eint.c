@@ -681,6 +681,9 @@ H5E_printf_stack(H5E_t *estack, const char *file, const char *func, unsigned lin
 #endif /* H5_HAVE_VASPRINTF */
     char        *tmp = NULL;      /* Buffer to place formatted description in */
     hbool_t     va_started = FALSE; /* Whether the variable argument list is open */
+#ifdef H5_HAVE_THREADSAFE
+    hbool_t     relock = FALSE;     /* Whether the API lock was taken back */
+#endif /* H5_HAVE_THREADSAFE */
     herr_t	ret_value = SUCCEED;    /* Return value */
 
     /*
@@ -698,6 +701,17 @@ H5E_printf_stack(H5E_t *estack, const char *file, const char *func, unsigned lin
     HDassert(min_id > 0);
     HDassert(fmt);
 
+#ifdef H5_HAVE_THREADSAFE
+    /* Take back the API lock if this thread let go of it for a concurrent
+     * read, since pushing the error changes the IDs' reference counts
+     */
+    if(H5TS_api_lock_released()) {
+        if(H5TS_api_lock_reacquire() != 0)
+            HGOTO_DONE(FAIL)
+        relock = TRUE;
+    } /* end if */
+#endif /* H5_HAVE_THREADSAFE */
+
 /* Note that the variable-argument parsing for the format is identical in
  *      the H5Epush2() routine - correct errors and make changes in both
  *      places. -QAK
@@ -750,6 +764,10 @@ done:
     if(tmp)
         H5MM_xfree(tmp);
 #endif /* H5_HAVE_VASPRINTF */
+#ifdef H5_HAVE_THREADSAFE
+    if(relock)
+        H5TS_api_lock_release();
+#endif /* H5_HAVE_THREADSAFE */
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5E_printf_stack() */
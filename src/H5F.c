@@ -852,6 +852,43 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Fflush() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fflush_async
+ *
+ * Purpose:     Flushes the file containing OBJECT_ID, like H5Fflush, as an
+ *              operation of the event set ES_ID.
+ *
+ * Return:      SUCCEED/FAIL (a failure of an operation that is still in
+ *              progress is reported by the event set)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fflush_async(hid_t object_id, H5F_scope_t scope, hid_t es_id)
+{
+    H5I_type_t      obj_type;                       /* Type of object   */
+    herr_t          ret_value = SUCCEED;            /* Return value     */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "iFsi", object_id, scope, es_id);
+
+    /* Get the type of object we're flushing + sanity check */
+    obj_type = H5I_get_type(object_id);
+    if(H5I_FILE != obj_type && H5I_GROUP != obj_type && H5I_DATATYPE != obj_type &&
+            H5I_DATASET != obj_type && H5I_ATTR != obj_type)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file or file object")
+    if(H5I_EVENTSET != H5I_get_type(es_id))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "es_id is not an event set ID")
+
+    /* Flush the object */
+    if(H5VL_file_flush_async(object_id, obj_type, scope, es_id) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "unable to flush file")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Fflush_async() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Fclose
@@ -1926,6 +1963,74 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Fget_mdc_image_info() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fget_chunk_cache_stats
+ *
+ * Purpose:     Retrieves the size of the raw data chunk cache budget
+ *              shared by the file's datasets, how much of it is in use,
+ *              and hit, miss, eviction and flush counts for the chunk
+ *              caches of all datasets in the file since the file was
+ *              opened or the statistics were last reset.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fget_chunk_cache_stats(hid_t file_id, H5F_chunk_cache_stats_t *stats)
+{
+    H5VL_object_t   *vol_obj;                       /* File object */
+    herr_t          ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*x", file_id, stats);
+
+    /* Check args */
+    if(NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+    if(NULL == stats)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL stats pointer")
+
+    /* Get the statistics */
+    if(H5VL_file_optional(vol_obj, H5VL_NATIVE_FILE_GET_CHUNK_CACHE_STATS, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL, stats) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't retrieve chunk cache stats")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fget_chunk_cache_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Freset_chunk_cache_stats
+ *
+ * Purpose:     Resets the counters reported by H5Fget_chunk_cache_stats.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Freset_chunk_cache_stats(hid_t file_id)
+{
+    H5VL_object_t   *vol_obj;                       /* File object */
+    herr_t          ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", file_id);
+
+    /* Check args */
+    if(NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid file identifier")
+
+    /* Reset the statistics */
+    if(H5VL_file_optional(vol_obj, H5VL_NATIVE_FILE_RESET_CHUNK_CACHE_STATS, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "can't reset chunk cache stats")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Freset_chunk_cache_stats() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Fget_eoa
@@ -127,6 +127,7 @@ typedef struct H5FD_core_fapl_t {
 static herr_t H5FD__core_add_dirty_region(H5FD_core_t *file, haddr_t start, haddr_t end);
 static herr_t H5FD__core_destroy_dirty_list(H5FD_core_t *file);
 static herr_t H5FD__core_write_to_bstore(H5FD_core_t *file, haddr_t addr, size_t size);
+static herr_t H5FD__core_extend(H5FD_core_t *file, haddr_t end);
 static herr_t H5FD__core_term(void);
 static void *H5FD__core_fapl_get(H5FD_t *_file);
 static H5FD_t *H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id,
@@ -142,6 +143,10 @@ static herr_t H5FD__core_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, had
             size_t size, void *buf);
 static herr_t H5FD__core_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
             size_t size, const void *buf);
+static herr_t H5FD__core_read_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
+            uint32_t count, const haddr_t addrs[], const size_t sizes[], void *bufs[]);
+static herr_t H5FD__core_write_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
+            uint32_t count, const haddr_t addrs[], const size_t sizes[], const void *bufs[]);
 static herr_t H5FD__core_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t H5FD__core_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t H5FD_core_lock(H5FD_t *_file, hbool_t rw);
@@ -175,6 +180,8 @@ static const H5FD_class_t H5FD_core_g = {
     H5FD__core_get_handle,      /* get_handle           */
     H5FD__core_read,            /* read                 */
     H5FD__core_write,           /* write                */
+    H5FD__core_read_vector,     /* read_vector          */
+    H5FD__core_write_vector,    /* write_vector         */
     H5FD__core_flush,           /* flush                */
     H5FD__core_truncate,        /* truncate             */
     H5FD_core_lock,             /* lock                 */
@@ -1316,6 +1323,58 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__core_read() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_extend
+ *
+ * Purpose:     Allocates more memory for the file image, so it holds at
+ *              least END bytes.
+ *
+ *              Careful of overflow.  Also, if the allocation fails then
+ *              the file should remain in a usable state.  Be careful of
+ *              non-Posix realloc() that doesn't understand what to do
+ *              when the first argument is null.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_extend(H5FD_core_t *file, haddr_t end)
+{
+    unsigned char *x;
+    size_t new_eof;
+    herr_t ret_value = SUCCEED;             /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(end > file->eof);
+
+    /* Determine new size of memory buffer */
+    H5_CHECKED_ASSIGN(new_eof, size_t, file->increment * (end / file->increment), hsize_t);
+    if(end % file->increment)
+        new_eof += file->increment;
+
+    /* (Re)allocate memory for the file buffer, using callbacks if available */
+    if(file->fi_callbacks.image_realloc) {
+        if(NULL == (x = (unsigned char *)file->fi_callbacks.image_realloc(file->mem, new_eof, H5FD_FILE_IMAGE_OP_FILE_RESIZE, file->fi_callbacks.udata)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate memory block of %llu bytes with callback", (unsigned long long)new_eof)
+    } /* end if */
+    else {
+        if(NULL == (x = (unsigned char *)H5MM_realloc(file->mem, new_eof)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate memory block of %llu bytes", (unsigned long long)new_eof)
+    } /* end else */
+
+    HDmemset(x + file->eof, 0, (size_t)(new_eof - file->eof));
+    file->mem = x;
+
+    file->eof = new_eof;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_extend() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD__core_write
@@ -1347,36 +1406,10 @@ H5FD__core_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
     if(REGION_OVERFLOW(addr, size))
         HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "file address overflowed")
 
-    /*
-     * Allocate more memory if necessary, careful of overflow. Also, if the
-     * allocation fails then the file should remain in a usable state.  Be
-     * careful of non-Posix realloc() that doesn't understand what to do when
-     * the first argument is null.
-     */
-    if(addr + size > file->eof) {
-        unsigned char *x;
-        size_t new_eof;
-
-        /* Determine new size of memory buffer */
-        H5_CHECKED_ASSIGN(new_eof, size_t, file->increment * ((addr + size) / file->increment), hsize_t);
-        if((addr + size) % file->increment)
-            new_eof += file->increment;
-
-        /* (Re)allocate memory for the file buffer, using callbacks if available */
-        if(file->fi_callbacks.image_realloc) {
-            if(NULL == (x = (unsigned char *)file->fi_callbacks.image_realloc(file->mem, new_eof, H5FD_FILE_IMAGE_OP_FILE_RESIZE, file->fi_callbacks.udata)))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate memory block of %llu bytes with callback", (unsigned long long)new_eof)
-        } /* end if */
-        else {
-            if(NULL == (x = (unsigned char *)H5MM_realloc(file->mem, new_eof)))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate memory block of %llu bytes", (unsigned long long)new_eof)
-        } /* end else */
-
-        HDmemset(x + file->eof, 0, (size_t)(new_eof - file->eof));
-        file->mem = x;
-
-        file->eof = new_eof;
-    } /* end if */
+    /* Allocate more memory if necessary */
+    if(addr + size > file->eof)
+        if(H5FD__core_extend(file, addr + size) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to extend file image")
 
     /* Add the buffer region to the dirty list if using that optimization */
     if(file->dirty_list) {
@@ -1397,6 +1430,137 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__core_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_read_vector
+ *
+ * Purpose:     Reads COUNT blocks of data from FILE, the I'th one being
+ *              SIZES[I] bytes at address ADDRS[I], into buffer BUFS[I],
+ *              copying them straight out of the file image.
+ *
+ * Return:      Success:    SUCCEED. Results are stored in the caller-
+ *                          supplied buffers BUFS.
+ *              Failure:    FAIL, Contents of buffers BUFS are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_read_vector(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    uint32_t count, const haddr_t addrs[], const size_t sizes[], void *bufs[]/*out*/)
+{
+    H5FD_core_t	*file = (H5FD_core_t*)_file;
+    uint32_t    u;                          /* Local index variable */
+    herr_t ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    for(u = 0; u < count; u++) {
+        haddr_t addr = addrs[u];
+        size_t size = sizes[u];
+        unsigned char *buf = (unsigned char *)bufs[u];
+
+        /* Check for overflow conditions */
+        if(HADDR_UNDEF == addr)
+            HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "file address overflowed")
+        if(REGION_OVERFLOW(addr, size))
+            HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "file address overflowed")
+
+        /* Copy the part which is before the EOF marker */
+        if(addr < file->eof) {
+            size_t nbytes = (size_t)MIN((haddr_t)size, file->eof - addr);
+
+            H5MM_memcpy(buf, file->mem + addr, nbytes);
+            size -= nbytes;
+            buf += nbytes;
+        } /* end if */
+
+        /* Read zeros for the part which is after the EOF markers */
+        if(size > 0)
+            HDmemset(buf, 0, size);
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_read_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_write_vector
+ *
+ * Purpose:     Writes COUNT blocks of data to FILE, the I'th one being
+ *              SIZES[I] bytes from buffer BUFS[I], to address ADDRS[I].
+ *
+ *              The file image is extended at most once for all the blocks
+ *              and each run of blocks that follow each other in the file
+ *              is added to the dirty list as a single region.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_write_vector(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    uint32_t count, const haddr_t addrs[], const size_t sizes[], const void *bufs[])
+{
+    H5FD_core_t *file = (H5FD_core_t*)_file;
+    haddr_t     max_end = 0;                /* End of the last byte written */
+    haddr_t     run_start = HADDR_UNDEF;    /* Start of the current run of blocks */
+    haddr_t     run_end = HADDR_UNDEF;      /* End of the current run of blocks */
+    uint32_t    u;                          /* Local index variable */
+    herr_t      ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    /* Check for overflow conditions */
+    for(u = 0; u < count; u++) {
+        if(REGION_OVERFLOW(addrs[u], sizes[u]))
+            HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "file address overflowed")
+        max_end = MAX(max_end, addrs[u] + sizes[u]);
+    } /* end for */
+
+    /* Allocate more memory if necessary */
+    if(max_end > file->eof)
+        if(H5FD__core_extend(file, max_end) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to extend file image")
+
+    for(u = 0; u < count; u++) {
+        if(0 == sizes[u])
+            continue;
+
+        /* Add runs of blocks to the dirty list if using that optimization */
+        if(file->dirty_list) {
+            if(H5F_addr_defined(run_start) && !H5F_addr_eq(addrs[u], run_end)) {
+                if(H5FD__core_add_dirty_region(file, run_start, run_end - 1) != SUCCEED)
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTINSERT, FAIL, "unable to add core VFD dirty region during write call - addresses: start=%llu end=%llu", (unsigned long long)run_start, (unsigned long long)(run_end - 1))
+                run_start = HADDR_UNDEF;
+            } /* end if */
+            if(!H5F_addr_defined(run_start))
+                run_start = addrs[u];
+            run_end = addrs[u] + sizes[u];
+        } /* end if */
+
+        /* Write from the buffer to memory */
+        H5MM_memcpy(file->mem + addrs[u], bufs[u], sizes[u]);
+
+        /* Mark memory buffer as modified */
+        file->dirty = TRUE;
+    } /* end for */
+
+    /* Add the last run of blocks to the dirty list */
+    if(file->dirty_list && H5F_addr_defined(run_start))
+        if(H5FD__core_add_dirty_region(file, run_start, run_end - 1) != SUCCEED)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINSERT, FAIL, "unable to add core VFD dirty region during write call - addresses: start=%llu end=%llu", (unsigned long long)run_start, (unsigned long long)(run_end - 1))
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_write_vector() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD__core_flush
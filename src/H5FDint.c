@@ -252,6 +252,140 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_read_vector
+ *
+ * Purpose:     Private version of H5FDread_vector()
+ *
+ *              Reads COUNT blocks of data, the I'th one being SIZES[I]
+ *              bytes at address ADDRS[I], into the buffers BUFS[I].  If
+ *              the driver has no read_vector callback, the blocks are read
+ *              one at a time with its read callback.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_read_vector(H5FD_t *file, H5FD_mem_t type, uint32_t count,
+    const haddr_t addrs[], const size_t sizes[], void *bufs[]/*out*/)
+{
+    hid_t           dxpl_id = H5I_INVALID_HID;  /* DXPL for operation */
+    uint32_t        u;                          /* Local index variable */
+    herr_t          ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->cls);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    /* Get proper DXPL for I/O */
+    dxpl_id = H5CX_get_dxpl();
+
+    /* Check the blocks against the 'eoa', unless the file is open for SWMR
+     * read access (see H5FD_read())
+     */
+    if(!(file->access_flags & H5F_ACC_SWMR_READ)) {
+        haddr_t     eoa;
+
+        if(HADDR_UNDEF == (eoa = (file->cls->get_eoa)(file, type)))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed")
+
+        for(u = 0; u < count; u++)
+            if((addrs[u] + file->base_addr + sizes[u]) > eoa)
+                HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu, eoa = %llu", (unsigned long long)(addrs[u] + file->base_addr), (unsigned long long)sizes[u], (unsigned long long)eoa)
+    } /* end if */
+
+    /* Dispatch to driver, all at once if it can and the addresses don't
+     * need to be shifted
+     */
+    if(file->cls->read_vector && 0 == file->base_addr) {
+        if(count > 0 && (file->cls->read_vector)(file, type, dxpl_id, count, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver read vector request failed")
+    } /* end if */
+    else
+        for(u = 0; u < count; u++) {
+#ifndef H5_HAVE_PARALLEL
+            /* The no-op case (see H5FD_read()) */
+            if(0 == sizes[u])
+                continue;
+#endif /* H5_HAVE_PARALLEL */
+
+            if((file->cls->read)(file, type, dxpl_id, addrs[u] + file->base_addr, sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver read request failed")
+        } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_read_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_write_vector
+ *
+ * Purpose:     Private version of H5FDwrite_vector()
+ *
+ *              Writes COUNT blocks of data, the I'th one being SIZES[I]
+ *              bytes from the buffer BUFS[I], to address ADDRS[I].  If
+ *              the driver has no write_vector callback, the blocks are
+ *              written one at a time with its write callback.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_write_vector(H5FD_t *file, H5FD_mem_t type, uint32_t count,
+    const haddr_t addrs[], const size_t sizes[], const void *bufs[])
+{
+    hid_t           dxpl_id;                    /* DXPL for operation */
+    haddr_t         eoa = HADDR_UNDEF;          /* EOA for file */
+    uint32_t        u;                          /* Local index variable */
+    herr_t          ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->cls);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    /* Get proper DXPL for I/O */
+    dxpl_id = H5CX_get_dxpl();
+
+    if(HADDR_UNDEF == (eoa = (file->cls->get_eoa)(file, type)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed")
+    for(u = 0; u < count; u++)
+        if((addrs[u] + file->base_addr + sizes[u]) > eoa)
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size=%llu, eoa=%llu",
+                        (unsigned long long)(addrs[u] + file->base_addr), (unsigned long long)sizes[u], (unsigned long long)eoa)
+
+    /* Dispatch to driver, all at once if it can and the addresses don't
+     * need to be shifted
+     */
+    if(file->cls->write_vector && 0 == file->base_addr) {
+        if(count > 0 && (file->cls->write_vector)(file, type, dxpl_id, count, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver write vector request failed")
+    } /* end if */
+    else
+        for(u = 0; u < count; u++) {
+#ifndef H5_HAVE_PARALLEL
+            /* The no-op case (see H5FD_write()) */
+            if(0 == sizes[u])
+                continue;
+#endif /* H5_HAVE_PARALLEL */
+
+            if((file->cls->write)(file, type, dxpl_id, addrs[u] + file->base_addr, sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver write request failed")
+        } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_write_vector() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD_set_eoa
@@ -0,0 +1,1572 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The Linux io_uring file driver.  Reads and writes are queued to
+ *          an io_uring submission ring and handed to the kernel in batches,
+ *          so that a vector of blocks (see H5FDread_vector) is in flight
+ *          all at once instead of one pread()/pwrite() at a time.
+ *
+ *          The file can optionally be opened with O_DIRECT.  Blocks whose
+ *          address, size and memory buffer are all aligned are then read
+ *          and written in place; other blocks are staged through aligned
+ *          buffers which are registered with the kernel when possible.
+ *
+ *          The ring is set up with the raw system calls, so liburing isn't
+ *          needed.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+
+#include "H5private.h"      /* Generic Functions        */
+#include "H5Eprivate.h"     /* Error handling           */
+#include "H5Fprivate.h"     /* File access              */
+#include "H5FDprivate.h"    /* File drivers             */
+#include "H5FDiouring.h"    /* io_uring file driver     */
+#include "H5FLprivate.h"    /* Free Lists               */
+#include "H5Iprivate.h"     /* IDs                      */
+#include "H5MMprivate.h"    /* Memory management        */
+#include "H5Pprivate.h"     /* Property lists           */
+
+#ifdef H5_HAVE_IOURING
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_IOURING_g = 0;
+
+/* Driver-specific file access properties */
+typedef struct H5FD_iouring_fapl_t {
+    unsigned    queue_depth;    /* # of requests the ring holds                 */
+    size_t      alignment;      /* Alignment for O_DIRECT, or 0 for buffered I/O */
+    size_t      buf_size;       /* Size of each aligned buffer for O_DIRECT I/O */
+} H5FD_iouring_fapl_t;
+
+/* A read or write of one contiguous range of the file */
+typedef struct H5FD_iouring_req_t {
+    haddr_t         addr;       /* File address of the range                    */
+    size_t          size;       /* # of bytes in the range                      */
+    size_t          done;       /* # of bytes transferred so far                */
+    unsigned char   *buf;       /* Buffer the range is transferred to/from      */
+    int             buf_index;  /* Index of registered buffer, or -1            */
+    hbool_t         write;      /* Whether the request is a write               */
+
+    /* Part of the range that belongs to the caller, when the range is
+     * staged through an aligned buffer
+     */
+    unsigned char   *user_buf;  /* Caller's buffer, or NULL if not staged       */
+    size_t          user_off;   /* Offset of caller's data in the range         */
+    size_t          user_len;   /* # of bytes of caller's data                  */
+} H5FD_iouring_req_t;
+
+/* Submission and completion queues, shared with the kernel */
+typedef struct H5FD_iouring_ring_t {
+    int             fd;         /* io_uring file descriptor                     */
+    unsigned        entries;    /* # of submission queue entries                */
+    void            *sq_ring;   /* Mapped submission queue ring                 */
+    size_t          sq_ring_len;
+    void            *cq_ring;   /* Mapped completion queue ring                 */
+    size_t          cq_ring_len;
+    struct io_uring_sqe *sqes;  /* Mapped submission queue entries              */
+    size_t          sqes_len;
+    unsigned        *sq_tail;
+    unsigned        *sq_mask;
+    unsigned        *sq_array;
+    unsigned        *cq_head;
+    unsigned        *cq_tail;
+    unsigned        *cq_mask;
+    struct io_uring_cqe *cqes;
+    hbool_t         fixed_file; /* Whether the file is registered with the ring */
+    hbool_t         fixed_bufs; /* Whether the aligned buffers are registered   */
+} H5FD_iouring_ring_t;
+
+/* The description of a file belonging to this driver.  The 'eoa' and 'eof'
+ * determine the amount of hdf5 address space in use and the high-water mark
+ * of the file.  With O_DIRECT, the writes are rounded out to the alignment
+ * and 'fs_eof' is the size of the filesystem file, which can be larger than
+ * 'eof' until the file is truncated.
+ */
+typedef struct H5FD_iouring_t {
+    H5FD_t              pub;        /* public stuff, must be first          */
+    int                 fd;         /* the filesystem file descriptor       */
+    haddr_t             eoa;        /* end of allocated region              */
+    haddr_t             eof;        /* end of file; current file size       */
+    haddr_t             fs_eof;     /* size of the filesystem file          */
+    H5FD_iouring_fapl_t fa;         /* file access properties               */
+    H5FD_iouring_ring_t ring;       /* the io_uring                         */
+    H5FD_iouring_req_t  *reqs;      /* requests being run                   */
+    size_t              nreqs_alloc; /* # of requests allocated             */
+    unsigned char       *bufs;      /* aligned buffers (O_DIRECT only)      */
+    dev_t               device;     /* file device number                   */
+    ino_t               inode;      /* file i-node number                   */
+
+    /* Information from properties set by 'h5repart' tool
+     *
+     * Whether to eliminate the family driver info and convert this file to
+     * a single file.
+     */
+    hbool_t             fam_to_single;
+} H5FD_iouring_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the second argument
+ *                  of the file seek function.
+ *
+ * SIZE_OVERFLOW:   Checks whether a buffer size of type `hsize_t' is too
+ *                  large to be represented by the `size_t' type.
+ *
+ * REGION_OVERFLOW: Checks whether an address and size pair describe data
+ *                  which can be addressed entirely by the second
+ *                  argument of the file seek function.
+ */
+#define MAXADDR (((haddr_t)1<<(8*sizeof(HDoff_t)-1))-1)
+#define ADDR_OVERFLOW(A)    (HADDR_UNDEF==(A) || ((A) & ~(haddr_t)MAXADDR))
+#define SIZE_OVERFLOW(Z)    ((Z) & ~(hsize_t)MAXADDR)
+#define REGION_OVERFLOW(A,Z)    (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) ||    \
+                                 HADDR_UNDEF==(A)+(Z) ||                    \
+                                (HDoff_t)((A)+(Z))<(HDoff_t)(A))
+
+/* Largest # of bytes transferred by one request (the length of a submission
+ * queue entry is 32 bits)
+ */
+#define H5FD_IOURING_MAX_IO     ((size_t)1 << 30)
+
+/* Max. # of requests run together.  Blocks are run in rounds of a few times
+ * the size of the ring, which keeps the ring full while bounding the memory
+ * used to describe them.
+ */
+#define H5FD_IOURING_ROUND_SIZE(F)  (4 * (size_t)(F)->ring.entries)
+
+/* Access to the ring indices that are shared with the kernel */
+#define H5FD_IOURING_LOAD_ACQUIRE(P)        __atomic_load_n((P), __ATOMIC_ACQUIRE)
+#define H5FD_IOURING_STORE_RELEASE(P, V)    __atomic_store_n((P), (V), __ATOMIC_RELEASE)
+
+/* Prototypes */
+static herr_t H5FD__iouring_term(void);
+static void *H5FD__iouring_fapl_get(H5FD_t *_file);
+static void *H5FD__iouring_fapl_copy(const void *_old_fa);
+static H5FD_t *H5FD__iouring_open(const char *name, unsigned flags, hid_t fapl_id,
+            haddr_t maxaddr);
+static herr_t H5FD__iouring_close(H5FD_t *_file);
+static int H5FD__iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t H5FD__iouring_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD__iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t H5FD__iouring_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD__iouring_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t H5FD__iouring_get_handle(H5FD_t *_file, hid_t fapl, void** file_handle);
+static herr_t H5FD__iouring_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
+            size_t size, void *buf);
+static herr_t H5FD__iouring_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
+            size_t size, const void *buf);
+static herr_t H5FD__iouring_read_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
+            uint32_t count, const haddr_t addrs[], const size_t sizes[], void *bufs[]);
+static herr_t H5FD__iouring_write_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
+            uint32_t count, const haddr_t addrs[], const size_t sizes[], const void *bufs[]);
+static herr_t H5FD__iouring_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t H5FD__iouring_lock(H5FD_t *_file, hbool_t rw);
+static herr_t H5FD__iouring_unlock(H5FD_t *_file);
+
+static herr_t H5FD__iouring_ring_init(H5FD_iouring_ring_t *ring, unsigned entries);
+static herr_t H5FD__iouring_ring_term(H5FD_iouring_ring_t *ring);
+static void H5FD__iouring_queue(H5FD_iouring_t *file, size_t idx);
+static herr_t H5FD__iouring_run(H5FD_iouring_t *file, size_t nreqs);
+static herr_t H5FD__iouring_flush_reqs(H5FD_iouring_t *file, size_t nreqs);
+static hbool_t H5FD__iouring_overlaps(const H5FD_iouring_t *file, size_t nreqs,
+            haddr_t addr, size_t size);
+static herr_t H5FD__iouring_io(H5FD_iouring_t *file, hbool_t do_write, uint32_t count,
+            const haddr_t addrs[], const size_t sizes[], unsigned char *bufs[]);
+
+static const H5FD_class_t H5FD_iouring_g = {
+    "iouring",                  /* name                 */
+    MAXADDR,                    /* maxaddr              */
+    H5F_CLOSE_WEAK,             /* fc_degree            */
+    H5FD__iouring_term,         /* terminate            */
+    NULL,                       /* sb_size              */
+    NULL,                       /* sb_encode            */
+    NULL,                       /* sb_decode            */
+    sizeof(H5FD_iouring_fapl_t), /* fapl_size           */
+    H5FD__iouring_fapl_get,     /* fapl_get             */
+    H5FD__iouring_fapl_copy,    /* fapl_copy            */
+    NULL,                       /* fapl_free            */
+    0,                          /* dxpl_size            */
+    NULL,                       /* dxpl_copy            */
+    NULL,                       /* dxpl_free            */
+    H5FD__iouring_open,         /* open                 */
+    H5FD__iouring_close,        /* close                */
+    H5FD__iouring_cmp,          /* cmp                  */
+    H5FD__iouring_query,        /* query                */
+    NULL,                       /* get_type_map         */
+    NULL,                       /* alloc                */
+    NULL,                       /* free                 */
+    H5FD__iouring_get_eoa,      /* get_eoa              */
+    H5FD__iouring_set_eoa,      /* set_eoa              */
+    H5FD__iouring_get_eof,      /* get_eof              */
+    H5FD__iouring_get_handle,   /* get_handle           */
+    H5FD__iouring_read,         /* read                 */
+    H5FD__iouring_write,        /* write                */
+    H5FD__iouring_read_vector,  /* read_vector          */
+    H5FD__iouring_write_vector, /* write_vector         */
+    NULL,                       /* flush                */
+    H5FD__iouring_truncate,     /* truncate             */
+    H5FD__iouring_lock,         /* lock                 */
+    H5FD__iouring_unlock,       /* unlock               */
+    H5FD_FLMAP_DICHOTOMY        /* fl_map               */
+};
+
+/* Declare a free list to manage the H5FD_iouring_t struct */
+H5FL_DEFINE_STATIC(H5FD_iouring_t);
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__init_package
+ *
+ * Purpose:     Initializes any interface-specific data or routines.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__init_package(void)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if(H5FD_iouring_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize io_uring VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the io_uring driver
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_iouring_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID;          /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    if(H5I_VFL != H5I_get_type(H5FD_IOURING_g))
+        H5FD_IOURING_g = H5FD_register(&H5FD_iouring_g, sizeof(H5FD_class_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_IOURING_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_init() */
+
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD__iouring_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_term(void)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Reset VFL ID */
+    H5FD_IOURING_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_term() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_iouring
+ *
+ * Purpose:     Modify the file access property list to use the
+ *              H5FD_IOURING driver defined in this source file.
+ *
+ *              QUEUE_DEPTH is the number of reads or writes the driver
+ *              has in flight at once.  A non-zero ALIGNMENT opens the
+ *              file with O_DIRECT, and must be the alignment the file
+ *              system requires for file offsets, sizes and memory
+ *              buffers.  Blocks that aren't aligned are staged through
+ *              QUEUE_DEPTH aligned buffers of BUF_SIZE bytes, which must
+ *              be a multiple of ALIGNMENT.  Zero for QUEUE_DEPTH or
+ *              BUF_SIZE selects the default.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_iouring(hid_t fapl_id, unsigned queue_depth, size_t alignment, size_t buf_size)
+{
+    H5P_genplist_t      *plist;         /* Property list pointer */
+    H5FD_iouring_fapl_t fa;             /* io_uring VFD info */
+    herr_t              ret_value;      /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iIuzz", fapl_id, queue_depth, alignment, buf_size);
+
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+
+    HDmemset(&fa, 0, sizeof(H5FD_iouring_fapl_t));
+    fa.queue_depth = queue_depth ? queue_depth : H5FD_IOURING_QUEUE_DEPTH_DEF;
+    fa.alignment = alignment;
+    fa.buf_size = buf_size ? buf_size : H5FD_IOURING_BUF_SIZE_DEF;
+
+    /* The kernel limits the ring to 32K entries */
+    if(fa.queue_depth > 32768)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "queue depth must be at most 32768")
+    if(alignment > 0) {
+        if(!POWER_OF_TWO(alignment))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "alignment must be a power of two")
+        if(fa.buf_size < alignment || fa.buf_size % alignment != 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buffer size must be a multiple of alignment")
+        if(fa.buf_size > H5FD_IOURING_MAX_IO)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buffer size too large")
+    } /* end if */
+
+    ret_value = H5P_set_driver(plist, H5FD_IOURING, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_iouring() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_iouring
+ *
+ * Purpose:     Returns information about the io_uring file access property
+ *              list though the function arguments.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_iouring(hid_t fapl_id, unsigned *queue_depth/*out*/, size_t *alignment/*out*/,
+    size_t *buf_size/*out*/)
+{
+    H5P_genplist_t              *plist;     /* Property list pointer */
+    const H5FD_iouring_fapl_t   *fa;        /* io_uring VFD info */
+    herr_t ret_value = SUCCEED;             /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "ixxx", fapl_id, queue_depth, alignment, buf_size);
+
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if(H5FD_IOURING != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if(NULL == (fa = (const H5FD_iouring_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+
+    if(queue_depth)
+        *queue_depth = fa->queue_depth;
+    if(alignment)
+        *alignment = fa->alignment;
+    if(buf_size)
+        *buf_size = fa->buf_size;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_iouring() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_fapl_get
+ *
+ * Purpose:     Returns a file access property list which indicates how the
+ *              specified file is being accessed. The return list could be
+ *              used to access another file the same way.
+ *
+ * Return:      Success:    Ptr to new file access property list with all
+ *                          members copied from the file struct.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__iouring_fapl_get(H5FD_t *_file)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    void            *ret_value = NULL;      /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set return value */
+    ret_value = H5FD__iouring_fapl_copy(&(file->fa));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_fapl_get() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_fapl_copy
+ *
+ * Purpose:     Copies the io_uring-specific file access properties.
+ *
+ * Return:      Success:    Ptr to a new property list
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__iouring_fapl_copy(const void *_old_fa)
+{
+    const H5FD_iouring_fapl_t   *old_fa = (const H5FD_iouring_fapl_t *)_old_fa;
+    H5FD_iouring_fapl_t         *new_fa = NULL;
+    void                        *ret_value = NULL;      /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(old_fa);
+
+    if(NULL == (new_fa = (H5FD_iouring_fapl_t *)H5MM_malloc(sizeof(H5FD_iouring_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "memory allocation failed")
+    H5MM_memcpy(new_fa, old_fa, sizeof(H5FD_iouring_fapl_t));
+
+    /* Set return value */
+    ret_value = new_fa;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_fapl_copy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_ring_init
+ *
+ * Purpose:     Sets up an io_uring with (at least) ENTRIES submission
+ *              queue entries and maps its queues into memory.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_ring_init(H5FD_iouring_ring_t *ring, unsigned entries)
+{
+    struct io_uring_params  p;          /* Ring setup parameters */
+    void                    *sqes;      /* Mapped submission queue entries */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(ring);
+    HDassert(-1 == ring->fd);
+
+    HDmemset(&p, 0, sizeof(p));
+    if((ring->fd = (int)syscall(__NR_io_uring_setup, entries, &p)) < 0)
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to set up io_uring")
+    ring->entries = p.sq_entries;
+
+    /* Map the submission and completion queue rings, which newer kernels
+     * allow to be mapped at once
+     */
+    ring->sq_ring_len = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    ring->cq_ring_len = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    if(p.features & IORING_FEAT_SINGLE_MMAP)
+        ring->sq_ring_len = ring->cq_ring_len = MAX(ring->sq_ring_len, ring->cq_ring_len);
+    if(MAP_FAILED == (ring->sq_ring = HDmmap(NULL, ring->sq_ring_len, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, ring->fd, (HDoff_t)IORING_OFF_SQ_RING))) {
+        ring->sq_ring = NULL;
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring submission queue")
+    } /* end if */
+    if(p.features & IORING_FEAT_SINGLE_MMAP)
+        ring->cq_ring = ring->sq_ring;
+    else if(MAP_FAILED == (ring->cq_ring = HDmmap(NULL, ring->cq_ring_len, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, ring->fd, (HDoff_t)IORING_OFF_CQ_RING))) {
+        ring->cq_ring = NULL;
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring completion queue")
+    } /* end if */
+    ring->sqes_len = p.sq_entries * sizeof(struct io_uring_sqe);
+    if(MAP_FAILED == (sqes = HDmmap(NULL, ring->sqes_len, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, ring->fd, (HDoff_t)IORING_OFF_SQES)))
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring submission queue entries")
+    ring->sqes = (struct io_uring_sqe *)sqes;
+
+    /* Locate the ring indices */
+    ring->sq_tail = (unsigned *)((unsigned char *)ring->sq_ring + p.sq_off.tail);
+    ring->sq_mask = (unsigned *)((unsigned char *)ring->sq_ring + p.sq_off.ring_mask);
+    ring->sq_array = (unsigned *)((unsigned char *)ring->sq_ring + p.sq_off.array);
+    ring->cq_head = (unsigned *)((unsigned char *)ring->cq_ring + p.cq_off.head);
+    ring->cq_tail = (unsigned *)((unsigned char *)ring->cq_ring + p.cq_off.tail);
+    ring->cq_mask = (unsigned *)((unsigned char *)ring->cq_ring + p.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)((unsigned char *)ring->cq_ring + p.cq_off.cqes);
+
+done:
+    if(ret_value < 0)
+        H5FD__iouring_ring_term(ring);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_ring_init() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_ring_term
+ *
+ * Purpose:     Unmaps the queues of an io_uring and closes it.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_ring_term(H5FD_iouring_ring_t *ring)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(ring);
+
+    /* Drop the ring's reference to the file right away: the kernel tears
+     * the ring down in the background, and until then the file would stay
+     * open (and locked)
+     */
+    if(ring->fixed_file && syscall(__NR_io_uring_register, ring->fd, IORING_UNREGISTER_FILES, NULL, 0) < 0)
+        ret_value = FAIL;
+
+    if(ring->sqes)
+        HDmunmap(ring->sqes, ring->sqes_len);
+    if(ring->cq_ring && ring->cq_ring != ring->sq_ring)
+        HDmunmap(ring->cq_ring, ring->cq_ring_len);
+    if(ring->sq_ring)
+        HDmunmap(ring->sq_ring, ring->sq_ring_len);
+    if(ring->fd >= 0 && HDclose(ring->fd) < 0)
+        ret_value = FAIL;
+    HDmemset(ring, 0, sizeof(H5FD_iouring_ring_t));
+    ring->fd = -1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_ring_term() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_open
+ *
+ * Purpose:     Create and/or opens a file as an HDF5 file.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD__iouring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_iouring_t              *file = NULL;   /* io_uring VFD info        */
+    const H5FD_iouring_fapl_t   *fa;            /* io_uring VFD properties  */
+    H5P_genplist_t              *plist;         /* Property list pointer    */
+    struct iovec                *iov = NULL;    /* Buffers to register      */
+    int                         fd = -1;        /* File descriptor          */
+    int                         o_flags;        /* Flags for open() call    */
+    h5_stat_t                   sb;
+    H5FD_t                      *ret_value = NULL;      /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if(!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if(0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+    if(ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr")
+
+    /* Get the driver specific information */
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
+        HGOTO_ERROR(H5E_VFL, H5E_BADTYPE, NULL, "not a file access property list")
+    if(NULL == (fa = (const H5FD_iouring_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, NULL, "bad VFL driver info")
+
+    /* Build the open flags */
+    o_flags = (H5F_ACC_RDWR & flags) ? O_RDWR : O_RDONLY;
+    if(H5F_ACC_TRUNC & flags)
+        o_flags |= O_TRUNC;
+    if(H5F_ACC_CREAT & flags)
+        o_flags |= O_CREAT;
+    if(H5F_ACC_EXCL & flags)
+        o_flags |= O_EXCL;
+    if(fa->alignment > 0)
+        o_flags |= O_DIRECT;
+
+    /* Open the file */
+    if((fd = HDopen(name, o_flags, H5_POSIX_CREATE_MODE_RW)) < 0) {
+        int myerrno = errno;
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open file: name = '%s', errno = %d, error message = '%s', flags = %x, o_flags = %x", name, myerrno, HDstrerror(myerrno), flags, (unsigned)o_flags);
+    } /* end if */
+    if(HDfstat(fd, &sb) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat file")
+
+    /* Create the new file struct */
+    if(NULL == (file = H5FL_CALLOC(H5FD_iouring_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct")
+    file->fd = fd;
+    fd = -1;
+    file->ring.fd = -1;
+    H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
+    file->fs_eof = file->eof;
+    file->device = sb.st_dev;
+    file->inode = sb.st_ino;
+    H5MM_memcpy(&file->fa, fa, sizeof(H5FD_iouring_fapl_t));
+
+    /* Set up the ring and the requests that are run through it */
+    if(H5FD__iouring_ring_init(&file->ring, file->fa.queue_depth) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "unable to set up io_uring")
+    file->nreqs_alloc = file->ring.entries;
+    if(NULL == (file->reqs = (H5FD_iouring_req_t *)H5MM_malloc(file->nreqs_alloc * sizeof(H5FD_iouring_req_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "unable to allocate requests")
+
+    /* Set up the aligned buffers for O_DIRECT I/O, one per ring entry.
+     * Registering them with the ring saves mapping them on every request,
+     * but is only an optimization: it fails when the buffers exceed the
+     * locked memory limit of older kernels.
+     */
+    if(file->fa.alignment > 0) {
+        size_t u;           /* Local index variable */
+
+        /* NOTE: Use HDfree to release, for compatibility with HDposix_memalign */
+        if(HDposix_memalign((void **)&file->bufs, MAX(file->fa.alignment, sizeof(void *)), file->ring.entries * file->fa.buf_size) != 0) {
+            file->bufs = NULL;
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "unable to allocate aligned buffers")
+        } /* end if */
+        if(NULL == (iov = (struct iovec *)H5MM_malloc(file->ring.entries * sizeof(struct iovec))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "unable to allocate buffer list")
+        for(u = 0; u < file->ring.entries; u++) {
+            iov[u].iov_base = file->bufs + u * file->fa.buf_size;
+            iov[u].iov_len = file->fa.buf_size;
+        } /* end for */
+        if(syscall(__NR_io_uring_register, file->ring.fd, IORING_REGISTER_BUFFERS, iov, file->ring.entries) == 0)
+            file->ring.fixed_bufs = TRUE;
+    } /* end if */
+
+    /* Register the file with the ring, which saves looking it up on every
+     * request (also optional)
+     */
+    if(syscall(__NR_io_uring_register, file->ring.fd, IORING_REGISTER_FILES, &file->fd, 1) == 0)
+        file->ring.fixed_file = TRUE;
+
+    /* Check for non-default FAPL */
+    if(H5P_FILE_ACCESS_DEFAULT != fapl_id) {
+        /* This step is for h5repart tool only. If user wants to change file driver from
+         * family to one that uses single files (sec2, etc.) while using h5repart, this
+         * private property should be set so that in the later step, the library can ignore
+         * the family driver information saved in the superblock.
+         */
+        if(H5P_exist_plist(plist, H5F_ACS_FAMILY_TO_SINGLE_NAME) > 0)
+            if(H5P_get(plist, H5F_ACS_FAMILY_TO_SINGLE_NAME, &file->fam_to_single) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get property of changing family to single")
+    } /* end if */
+
+    /* Set return value */
+    ret_value = (H5FD_t *)file;
+
+done:
+    iov = (struct iovec *)H5MM_xfree(iov);
+    if(NULL == ret_value) {
+        if(fd >= 0)
+            HDclose(fd);
+        if(file) {
+            H5FD__iouring_ring_term(&file->ring);
+            if(file->bufs)
+                HDfree(file->bufs);
+            H5MM_xfree(file->reqs);
+            if(file->fd >= 0)
+                HDclose(file->fd);
+            file = H5FL_FREE(H5FD_iouring_t, file);
+        } /* end if */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_open() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_close
+ *
+ * Purpose:     Closes an HDF5 file.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, file not closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_close(H5FD_t *_file)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(file);
+
+    /* Tear down the ring (which releases the registered file and buffers) */
+    if(H5FD__iouring_ring_term(&file->ring) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close io_uring")
+    if(file->bufs)
+        HDfree(file->bufs);
+    file->reqs = (H5FD_iouring_req_t *)H5MM_xfree(file->reqs);
+
+    /* Close the underlying file */
+    if(HDclose(file->fd) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
+
+    /* Release the file info */
+    file = H5FL_FREE(H5FD_iouring_t, file);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_close() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_iouring_t    *f1 = (const H5FD_iouring_t *)_f1;
+    const H5FD_iouring_t    *f2 = (const H5FD_iouring_t *)_f2;
+    int ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef H5_DEV_T_IS_SCALAR
+    if(f1->device < f2->device) HGOTO_DONE(-1)
+    if(f1->device > f2->device) HGOTO_DONE(1)
+#else /* H5_DEV_T_IS_SCALAR */
+    /* If dev_t isn't a scalar value on this system, just use memcmp to
+     * determine if the values are the same or not.  The actual return value
+     * shouldn't really matter...
+     */
+    if(HDmemcmp(&(f1->device),&(f2->device),sizeof(dev_t)) < 0) HGOTO_DONE(-1)
+    if(HDmemcmp(&(f1->device),&(f2->device),sizeof(dev_t)) > 0) HGOTO_DONE(1)
+#endif /* H5_DEV_T_IS_SCALAR */
+    if(f1->inode < f2->inode) HGOTO_DONE(-1)
+    if(f1->inode > f2->inode) HGOTO_DONE(1)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_query(const H5FD_t *_file, unsigned long *flags /* out */)
+{
+    const H5FD_iouring_t    *file = (const H5FD_iouring_t *)_file;    /* io_uring VFD info */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if(flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;     /* OK to aggregate metadata allocations                             */
+        *flags |= H5FD_FEAT_ACCUMULATE_METADATA;    /* OK to accumulate metadata for faster writes                      */
+        *flags |= H5FD_FEAT_DATA_SIEVE;             /* OK to perform data sieving for faster raw data reads & writes    */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA;    /* OK to aggregate "small" raw data allocations                     */
+        *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default VFD      */
+
+        /* The file descriptor can only be used like any other without O_DIRECT */
+        if(file && 0 == file->fa.alignment)
+            *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE; /* get_handle callback returns a POSIX file descriptor             */
+
+        /* Check for flags that are set by h5repart */
+        if(file && file->fam_to_single)
+            *flags |= H5FD_FEAT_IGNORE_DRVRINFO; /* Ignore the driver info when file is opened (which eliminates it) */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_query() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_iouring_t    *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD__iouring_get_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_set_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              "file", either the filesystem file or the HDF5 file.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__iouring_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_iouring_t    *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD__iouring_get_eof() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_get_handle
+ *
+ * Purpose:     Returns the file handle of io_uring file driver.
+ *
+ * Returns:     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if(!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid")
+    *file_handle = &(file->fd);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_get_handle() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_queue
+ *
+ * Purpose:     Adds a submission queue entry for the part of request IDX
+ *              that hasn't been transferred yet.  The caller must make
+ *              sure there's room in the queue.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__iouring_queue(H5FD_iouring_t *file, size_t idx)
+{
+    H5FD_iouring_ring_t *ring = &file->ring;
+    H5FD_iouring_req_t  *req = &file->reqs[idx];
+    struct io_uring_sqe *sqe;           /* Submission queue entry to fill in */
+    unsigned            tail;           /* Tail of submission queue */
+    unsigned            slot;           /* Index of entry in submission queue */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(req->done < req->size);
+    HDassert(req->size - req->done <= H5FD_IOURING_MAX_IO);
+
+    /* Only this process moves the tail, so it needn't be loaded atomically */
+    tail = *ring->sq_tail;
+    slot = tail & *ring->sq_mask;
+    sqe = &ring->sqes[slot];
+
+    HDmemset(sqe, 0, sizeof(struct io_uring_sqe));
+    if(req->buf_index >= 0) {
+        sqe->opcode = req->write ? IORING_OP_WRITE_FIXED : IORING_OP_READ_FIXED;
+        sqe->buf_index = (__u16)req->buf_index;
+    } /* end if */
+    else
+        sqe->opcode = req->write ? IORING_OP_WRITE : IORING_OP_READ;
+    if(ring->fixed_file) {
+        sqe->fd = 0;
+        sqe->flags = IOSQE_FIXED_FILE;
+    } /* end if */
+    else
+        sqe->fd = file->fd;
+    sqe->off = (__u64)(req->addr + req->done);
+    sqe->addr = (__u64)(uintptr_t)(req->buf + req->done);
+    sqe->len = (__u32)(req->size - req->done);
+    sqe->user_data = (__u64)idx;
+    ring->sq_array[slot] = slot;
+
+    /* Publish the entry to the kernel */
+    H5FD_IOURING_STORE_RELEASE(ring->sq_tail, tail + 1);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__iouring_queue() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_run
+ *
+ * Purpose:     Runs the first NREQS requests of the file through the ring,
+ *              keeping as many of them in flight as the ring holds, and
+ *              waits for all of them to finish.  Requests that are
+ *              already done are skipped.
+ *
+ *              Short transfers are resubmitted for the rest of their
+ *              range, except that reads past the end of the file (and
+ *              short reads with O_DIRECT, which are only possible there)
+ *              are filled with zeros.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_run(H5FD_iouring_t *file, size_t nreqs)
+{
+    H5FD_iouring_ring_t *ring = &file->ring;
+    size_t      next = 0;               /* Next request to queue */
+    unsigned    queued = 0;             /* # of entries queued but not submitted */
+    unsigned    inflight = 0;           /* # of requests queued or in progress */
+    int         err = 0;                /* errno of the first failed request */
+    hbool_t     failed_write = FALSE;   /* Whether the failed request was a write */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    while(inflight > 0 || (0 == err && next < nreqs)) {
+        unsigned head, tail;            /* Completion queue indices */
+        int ret;                        /* System call return value */
+
+        /* Fill the ring with new requests.  After a failure, no new
+         * requests are started, but the ones in flight must finish before
+         * their buffers can be released.
+         */
+        while(0 == err && next < nreqs && inflight < ring->entries) {
+            if(file->reqs[next].done < file->reqs[next].size) {
+                H5FD__iouring_queue(file, next);
+                queued++;
+                inflight++;
+            } /* end if */
+            next++;
+        } /* end while */
+        if(0 == inflight)
+            break;
+
+        /* Submit them and wait for at least one request to complete */
+        if((ret = (int)syscall(__NR_io_uring_enter, ring->fd, queued, 1, IORING_ENTER_GETEVENTS, NULL, (size_t)0)) < 0) {
+            if(EINTR == errno || EAGAIN == errno || EBUSY == errno)
+                continue;
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SYSERRSTR, FAIL, "unable to submit requests to io_uring")
+        } /* end if */
+        queued -= MIN(queued, (unsigned)ret);
+
+        /* Reap the completed requests */
+        head = *ring->cq_head;
+        tail = H5FD_IOURING_LOAD_ACQUIRE(ring->cq_tail);
+        while(head != tail) {
+            const struct io_uring_cqe *cqe = &ring->cqes[head & *ring->cq_mask];
+            H5FD_iouring_req_t *req = &file->reqs[cqe->user_data];
+            int res = cqe->res;
+
+            head++;
+            inflight--;
+            if(res < 0) {
+                /* Retry interrupted requests, give up on failed ones */
+                if(-EINTR != res && -EAGAIN != res) {
+                    if(0 == err) {
+                        err = -res;
+                        failed_write = req->write;
+                    } /* end if */
+                    continue;
+                } /* end if */
+            } /* end if */
+            else if(0 == res) {
+                if(req->write) {
+                    if(0 == err) {
+                        err = EIO;
+                        failed_write = TRUE;
+                    } /* end if */
+                    continue;
+                } /* end if */
+
+                /* End of file: fill the rest of the buffer with zeros */
+                HDmemset(req->buf + req->done, 0, req->size - req->done);
+                req->done = req->size;
+            } /* end if */
+            else {
+                req->done += (size_t)res;
+
+                /* With O_DIRECT, reads are only short at the end of the file */
+                if(!req->write && file->fa.alignment > 0 && req->done < req->size) {
+                    HDmemset(req->buf + req->done, 0, req->size - req->done);
+                    req->done = req->size;
+                } /* end if */
+            } /* end else */
+
+            /* Resubmit the rest of a short transfer */
+            if(req->done < req->size && 0 == err) {
+                H5FD__iouring_queue(file, (size_t)(req - file->reqs));
+                queued++;
+                inflight++;
+            } /* end if */
+        } /* end while */
+        H5FD_IOURING_STORE_RELEASE(ring->cq_head, head);
+    } /* end while */
+
+    if(err)
+        HGOTO_ERROR(H5E_IO, failed_write ? H5E_WRITEERROR : H5E_READERROR, FAIL, "file %s failed: errno = %d, error message = '%s'", failed_write ? "write" : "read", err, HDstrerror(err))
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_run() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_flush_reqs
+ *
+ * Purpose:     Runs the first NREQS requests of the file, which are all
+ *              reads or all writes, copying data between the aligned
+ *              buffers and the caller's buffers for the requests that are
+ *              staged.
+ *
+ *              Staged writes that don't cover their whole (aligned) range
+ *              read the range in first.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_flush_reqs(H5FD_iouring_t *file, size_t nreqs)
+{
+    hbool_t     do_write;               /* Whether the requests are writes */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(0 == nreqs)
+        HGOTO_DONE(SUCCEED)
+    do_write = file->reqs[0].write;
+
+    if(do_write) {
+        hbool_t fill = FALSE;           /* Whether any ranges must be read first */
+
+        /* Read in the ranges that are partially overwritten */
+        for(u = 0; u < nreqs; u++) {
+            H5FD_iouring_req_t *req = &file->reqs[u];
+
+            if(req->user_buf && req->user_len < req->size) {
+                req->write = FALSE;
+                fill = TRUE;
+            } /* end if */
+            else
+                req->done = req->size;
+        } /* end for */
+        if(fill && H5FD__iouring_run(file, nreqs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read ranges to be partially overwritten")
+
+        /* Stage the data to write */
+        for(u = 0; u < nreqs; u++) {
+            H5FD_iouring_req_t *req = &file->reqs[u];
+
+            if(req->user_buf)
+                H5MM_memcpy(req->buf + req->user_off, req->user_buf, req->user_len);
+            req->write = TRUE;
+            req->done = 0;
+        } /* end for */
+    } /* end if */
+
+    if(H5FD__iouring_run(file, nreqs) < 0)
+        HGOTO_ERROR(H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL, "unable to run requests")
+
+    /* Copy the data read out of the aligned buffers */
+    if(!do_write)
+        for(u = 0; u < nreqs; u++) {
+            H5FD_iouring_req_t *req = &file->reqs[u];
+
+            if(req->user_buf)
+                H5MM_memcpy(req->user_buf, req->buf + req->user_off, req->user_len);
+        } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_flush_reqs() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_overlaps
+ *
+ * Purpose:     Checks if the range at ADDR of SIZE bytes overlaps any of
+ *              the first NREQS requests of the file.  Writes to the same
+ *              place can't be in flight together, since the kernel may
+ *              run them in any order.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5FD__iouring_overlaps(const H5FD_iouring_t *file, size_t nreqs, haddr_t addr, size_t size)
+{
+    size_t      u;                      /* Local index variable */
+    hbool_t     ret_value = FALSE;      /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(u = 0; u < nreqs; u++)
+        if(H5F_addr_overlap(file->reqs[u].addr, file->reqs[u].size, addr, size))
+            HGOTO_DONE(TRUE)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_overlaps() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_io
+ *
+ * Purpose:     Reads or writes COUNT blocks, at ADDRS of SIZES bytes, to
+ *              or from BUFS.
+ *
+ *              The blocks are split into requests that are run through
+ *              the ring together.  With O_DIRECT, blocks that aren't
+ *              aligned are staged through the aligned buffers, one buffer
+ *              (and one ring entry) per request, so that many requests are
+ *              run together.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_io(H5FD_iouring_t *file, hbool_t do_write, uint32_t count,
+    const haddr_t addrs[], const size_t sizes[], unsigned char *bufs[])
+{
+    size_t      align = file->fa.alignment;     /* O_DIRECT alignment, or 0 */
+    size_t      nreqs = 0;              /* # of requests to run */
+    size_t      nstaged = 0;            /* # of aligned buffers in use */
+    haddr_t     reqs_end = 0;           /* End of the requests, if they're in order */
+    uint32_t    u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(0 == count || (addrs && sizes && bufs));
+
+    /* Check for overflow conditions */
+    for(u = 0; u < count; u++) {
+        if(!H5F_addr_defined(addrs[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addrs[u])
+        if(REGION_OVERFLOW(addrs[u], sizes[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addrs[u])
+    } /* end for */
+
+    for(u = 0; u < count; u++) {
+        haddr_t         addr = addrs[u];
+        size_t          size = sizes[u];
+        unsigned char   *buf = bufs[u];
+        hbool_t         in_place;       /* Whether to transfer the block directly */
+
+        if(0 == size)
+            continue;
+
+        /* Blocks are transferred in place unless they break O_DIRECT's rules */
+        in_place = (0 == align || (0 == (addr % align) && 0 == (size % align) && 0 == ((uintptr_t)buf % align)));
+
+        while(size > 0) {
+            H5FD_iouring_req_t *req;    /* Request to fill in */
+            haddr_t     req_addr;       /* Address of request */
+            size_t      req_size;       /* Size of request */
+
+            if(in_place) {
+                req_addr = addr;
+                req_size = MIN(size, H5FD_IOURING_MAX_IO);
+                if(align > 0)
+                    req_size -= req_size % align;
+            } /* end if */
+            else {
+                /* Round out to the alignment, up to the size of a buffer */
+                req_addr = addr - (addr % align);
+                req_size = MIN(file->fa.buf_size, (size_t)((addr + size) - req_addr));
+                req_size = ((req_size + align - 1) / align) * align;
+                req_size = MIN(req_size, file->fa.buf_size);
+            } /* end else */
+
+            /* Run the requests so far if they can't be added to, or if this
+             * write may overlap one of them
+             */
+            if(nreqs == H5FD_IOURING_ROUND_SIZE(file) || (!in_place && nstaged == file->ring.entries)
+                    || (do_write && nreqs > 0 && req_addr < reqs_end
+                        && H5FD__iouring_overlaps(file, nreqs, req_addr, req_size))) {
+                if(H5FD__iouring_flush_reqs(file, nreqs) < 0)
+                    HGOTO_ERROR(H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL, "unable to run requests")
+                nreqs = nstaged = 0;
+                reqs_end = 0;
+            } /* end if */
+
+            /* Make room for another request */
+            if(nreqs == file->nreqs_alloc) {
+                H5FD_iouring_req_t *x;  /* Pointer to new requests */
+                size_t new_alloc = 2 * file->nreqs_alloc;
+
+                if(NULL == (x = (H5FD_iouring_req_t *)H5MM_realloc(file->reqs, new_alloc * sizeof(H5FD_iouring_req_t))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate requests")
+                file->reqs = x;
+                file->nreqs_alloc = new_alloc;
+            } /* end if */
+
+            req = &file->reqs[nreqs++];
+            req->addr = req_addr;
+            req->size = req_size;
+            req->done = 0;
+            req->write = do_write;
+            if(in_place) {
+                req->buf = buf;
+                req->buf_index = -1;
+                req->user_buf = NULL;
+                req->user_off = req->user_len = 0;
+            } /* end if */
+            else {
+                req->buf = file->bufs + nstaged * file->fa.buf_size;
+                req->buf_index = file->ring.fixed_bufs ? (int)nstaged : -1;
+                req->user_buf = buf;
+                req->user_off = (size_t)(addr - req_addr);
+                req->user_len = MIN(size, req_size - req->user_off);
+                req_size = req->user_len;
+                nstaged++;
+            } /* end else */
+            reqs_end = (req_addr < reqs_end) ? HADDR_MAX : req->addr + req->size;
+
+            addr += req_size;
+            size -= req_size;
+            buf += req_size;
+        } /* end while */
+    } /* end for */
+
+    if(H5FD__iouring_flush_reqs(file, nreqs) < 0)
+        HGOTO_ERROR(H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL, "unable to run requests")
+
+    /* Update the end of the file */
+    if(do_write)
+        for(u = 0; u < count; u++)
+            if(sizes[u] > 0) {
+                haddr_t end = addrs[u] + sizes[u];
+
+                if(end > file->eof)
+                    file->eof = end;
+                if(align > 0)
+                    end = ((end + align - 1) / align) * align;
+                if(end > file->fs_eof)
+                    file->fs_eof = end;
+            } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_io() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    haddr_t addr, size_t size, void *buf /*out*/)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    unsigned char   *ubuf = (unsigned char *)buf;
+    herr_t          ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(buf);
+
+    if(H5FD__iouring_io(file, FALSE, 1, &addr, &size, &ubuf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_write
+ *
+ * Purpose:     Writes SIZE bytes of data to FILE beginning at address ADDR
+ *              from buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    haddr_t addr, size_t size, const void *buf)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    unsigned char   *ubuf = (unsigned char *)buf;
+    herr_t          ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(buf);
+
+    if(H5FD__iouring_io(file, TRUE, 1, &addr, &size, &ubuf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_read_vector
+ *
+ * Purpose:     Reads COUNT blocks, with all the reads in flight together.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_read_vector(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    uint32_t count, const haddr_t addrs[], const size_t sizes[], void *bufs[] /*out*/)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(H5FD__iouring_io(file, FALSE, count, addrs, sizes, (unsigned char **)bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file vector read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_read_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_write_vector
+ *
+ * Purpose:     Writes COUNT blocks, with all the writes in flight together
+ *              (except where they overlap).
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_write_vector(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    uint32_t count, const haddr_t addrs[], const size_t sizes[], const void *bufs[])
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(H5FD__iouring_io(file, TRUE, count, addrs, sizes, (unsigned char **)bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file vector write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_write_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_truncate
+ *
+ * Purpose:     Makes sure that the true file size is the same as the
+ *              end-of-allocation.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    /* Extend the file to make sure it's large enough, or cut off what
+     * O_DIRECT writes wrote past the end of the data
+     */
+    if(!H5F_addr_eq(file->eoa, file->eof) || !H5F_addr_eq(file->eoa, file->fs_eof)) {
+        if(-1 == HDftruncate(file->fd, (HDoff_t)file->eoa))
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to extend file properly")
+
+        /* Update the eof value */
+        file->eof = file->fs_eof = file->eoa;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_truncate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_lock
+ *
+ * Purpose:     To place an advisory lock on a file.
+ *		The lock type to apply depends on the parameter "rw":
+ *			TRUE--opens for write: an exclusive lock
+ *			FALSE--opens for read: a shared lock
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;    /* VFD file struct  */
+    int lock_flags;                             /* file locking flags       */
+    herr_t ret_value = SUCCEED;                 /* Return value             */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    /* Set exclusive or shared lock based on rw status */
+    lock_flags = rw ? LOCK_EX : LOCK_SH;
+
+    /* Place a non-blocking lock on the file */
+    if(HDflock(file->fd, lock_flags | LOCK_NB) < 0) {
+        if(ENOSYS == errno)
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "file locking disabled on this file system (use HDF5_USE_FILE_LOCKING environment variable to override)")
+        else
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "unable to lock file")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_lock() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_unlock
+ *
+ * Purpose:     To remove the existing lock on the file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_unlock(H5FD_t *_file)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;    /* VFD file struct  */
+    herr_t ret_value = SUCCEED;                 /* Return value             */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    if(HDflock(file->fd, LOCK_UN) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "unable to unlock file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_unlock() */
+
+#endif /* H5_HAVE_IOURING */
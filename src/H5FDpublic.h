@@ -257,6 +257,12 @@ typedef enum H5F_mem_t	H5FD_mem_t;
      * the canonical HDF5 file format.
      */
 #define H5FD_FEAT_DEFAULT_VFD_COMPATIBLE        0x00008000
+    /*
+     * Defining H5FD_FEAT_CONCURRENT_READ for a VFL driver means that its
+     * read and read_vector callbacks may be called by several threads at
+     * once for a file opened read-only, without holding the library's lock.
+     */
+#define H5FD_FEAT_CONCURRENT_READ               0x00010000
 
 
 /* Forward declaration */
@@ -296,6 +302,12 @@ typedef struct H5FD_class_t {
                     haddr_t addr, size_t size, void *buffer);
     herr_t  (*write)(H5FD_t *file, H5FD_mem_t type, hid_t dxpl,
                      haddr_t addr, size_t size, const void *buffer);
+    herr_t  (*read_vector)(H5FD_t *file, H5FD_mem_t type, hid_t dxpl,
+                    uint32_t count, const haddr_t addrs[], const size_t sizes[],
+                    void *bufs[]);
+    herr_t  (*write_vector)(H5FD_t *file, H5FD_mem_t type, hid_t dxpl,
+                    uint32_t count, const haddr_t addrs[], const size_t sizes[],
+                    const void *bufs[]);
     herr_t  (*flush)(H5FD_t *file, hid_t dxpl_id, hbool_t closing);
     herr_t  (*truncate)(H5FD_t *file, hid_t dxpl_id, hbool_t closing);
     herr_t  (*lock)(H5FD_t *file, hbool_t rw);
@@ -379,6 +391,12 @@ H5_DLL herr_t H5FDread(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id,
                        haddr_t addr, size_t size, void *buf/*out*/);
 H5_DLL herr_t H5FDwrite(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id,
                         haddr_t addr, size_t size, const void *buf);
+H5_DLL herr_t H5FDread_vector(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id,
+                       uint32_t count, const haddr_t addrs[], const size_t sizes[],
+                       void *bufs[]/*out*/);
+H5_DLL herr_t H5FDwrite_vector(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id,
+                        uint32_t count, const haddr_t addrs[], const size_t sizes[],
+                        const void *bufs[]);
 H5_DLL herr_t H5FDflush(H5FD_t *file, hid_t dxpl_id, hbool_t closing);
 H5_DLL herr_t H5FDtruncate(H5FD_t *file, hid_t dxpl_id, hbool_t closing);
 H5_DLL herr_t H5FDlock(H5FD_t *file, hbool_t rw);
@@ -268,6 +268,8 @@ static const H5FD_class_t H5FD_ros3_g = {
     H5FD_ros3_get_handle,       /* get_handle           */
     H5FD_ros3_read,             /* read                 */
     H5FD_ros3_write,            /* write                */
+    NULL,                       /* read_vector          */
+    NULL,                       /* write_vector         */
     NULL,                       /* flush                */
     H5FD_ros3_truncate,         /* truncate             */
     H5FD_ros3_lock,             /* lock                 */
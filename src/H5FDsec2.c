@@ -120,6 +120,20 @@ typedef struct H5FD_sec2_t {
                                  HADDR_UNDEF==(A)+(Z) ||                    \
                                 (HDoff_t)((A)+(Z))<(HDoff_t)(A))
 
+#ifdef H5_HAVE_PREADWRITEV
+/* Max. # of buffers passed to one preadv()/pwritev() call */
+#if defined(IOV_MAX) && IOV_MAX < 256
+#define H5FD_SEC2_MAX_IOV   IOV_MAX
+#else
+#define H5FD_SEC2_MAX_IOV   256
+#endif
+
+/* Largest gap between two blocks that a vector read reads through (into a
+ * scratch buffer) rather than starting another preadv() call
+ */
+#define H5FD_SEC2_MAX_GAP   4096
+#endif /* H5_HAVE_PREADWRITEV */
+
 /* Prototypes */
 static herr_t H5FD_sec2_term(void);
 static H5FD_t *H5FD_sec2_open(const char *name, unsigned flags, hid_t fapl_id,
@@ -135,6 +149,12 @@ static herr_t H5FD_sec2_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, hadd
             size_t size, void *buf);
 static herr_t H5FD_sec2_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
             size_t size, const void *buf);
+#ifdef H5_HAVE_PREADWRITEV
+static herr_t H5FD_sec2_read_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
+            uint32_t count, const haddr_t addrs[], const size_t sizes[], void *bufs[]);
+static herr_t H5FD_sec2_write_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
+            uint32_t count, const haddr_t addrs[], const size_t sizes[], const void *bufs[]);
+#endif /* H5_HAVE_PREADWRITEV */
 static herr_t H5FD_sec2_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t H5FD_sec2_lock(H5FD_t *_file, hbool_t rw);
 static herr_t H5FD_sec2_unlock(H5FD_t *_file);
@@ -167,6 +187,13 @@ static const H5FD_class_t H5FD_sec2_g = {
     H5FD_sec2_get_handle,       /* get_handle           */
     H5FD_sec2_read,             /* read                 */
     H5FD_sec2_write,            /* write                */
+#ifdef H5_HAVE_PREADWRITEV
+    H5FD_sec2_read_vector,      /* read_vector          */
+    H5FD_sec2_write_vector,     /* write_vector         */
+#else
+    NULL,                       /* read_vector          */
+    NULL,                       /* write_vector         */
+#endif /* H5_HAVE_PREADWRITEV */
     NULL,                       /* flush                */
     H5FD_sec2_truncate,         /* truncate             */
     H5FD_sec2_lock,             /* lock                 */
@@ -177,6 +204,13 @@ static const H5FD_class_t H5FD_sec2_g = {
 /* Declare a free list to manage the H5FD_sec2_t struct */
 H5FL_DEFINE_STATIC(H5FD_sec2_t);
 
+#ifdef H5_HAVE_PREADWRITEV
+/* Scratch buffer that the gaps between blocks of a vector read are read
+ * into (the contents are never used)
+ */
+static unsigned char H5FD_sec2_gap_g[H5FD_SEC2_MAX_GAP];
+#endif /* H5_HAVE_PREADWRITEV */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD__init_package
@@ -530,6 +564,9 @@ H5FD_sec2_query(const H5FD_t *_file, unsigned long *flags /* out */)
         *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE;    /* get_handle callback returns a POSIX file descriptor              */
         *flags |= H5FD_FEAT_SUPPORTS_SWMR_IO;       /* VFD supports the single-writer/multiple-readers (SWMR) pattern   */
         *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default VFD      */
+#ifdef H5_HAVE_PREADWRITE
+        *flags |= H5FD_FEAT_CONCURRENT_READ;        /* Reads don't use the file position, so threads can read at once  */
+#endif /* H5_HAVE_PREADWRITE */
 
         /* Check for flags that are set by h5repart */
         if(file && file->fam_to_single)
@@ -740,16 +777,22 @@ H5FD_sec2_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUS
         buf = (char *)buf + bytes_read;
     } /* end while */
 
-    /* Update current position */
+#ifndef H5_HAVE_PREADWRITE
+    /* Update current position.  (With pread() the position isn't used, and
+     * leaving it alone lets several threads read at once.)
+     */
     file->pos = addr;
     file->op = OP_READ;
+#endif /* H5_HAVE_PREADWRITE */
 
 done:
+#ifndef H5_HAVE_PREADWRITE
     if(ret_value < 0) {
         /* Reset last file I/O information */
         file->pos = HADDR_UNDEF;
         file->op = OP_UNKNOWN;
     } /* end if */
+#endif /* H5_HAVE_PREADWRITE */
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_sec2_read() */
@@ -855,6 +898,284 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_sec2_write() */
 
+
+#ifdef H5_HAVE_PREADWRITEV
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_sec2_read_vector
+ *
+ * Purpose:     Reads COUNT blocks of data from FILE, the I'th one being
+ *              SIZES[I] bytes at address ADDRS[I], into buffer BUFS[I].
+ *
+ *              Blocks that follow each other in the file, or that are
+ *              separated by at most H5FD_SEC2_MAX_GAP bytes, are read
+ *              with a single preadv() call.
+ *
+ * Return:      Success:    SUCCEED. Results are stored in the caller-
+ *                          supplied buffers BUFS.
+ *              Failure:    FAIL, Contents of buffers BUFS are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_sec2_read_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
+    uint32_t count, const haddr_t addrs[], const size_t sizes[], void *bufs[] /*out*/)
+{
+    H5FD_sec2_t     *file       = (H5FD_sec2_t *)_file;
+    struct iovec    iov[H5FD_SEC2_MAX_IOV]; /* Buffers for one preadv() call */
+    uint32_t        u = 0;                  /* Local index variable */
+    herr_t          ret_value   = SUCCEED;  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    while(u < count) {
+        struct iovec    *curr_iov = iov;    /* First buffer not yet filled */
+        int             niov = 0;           /* # of buffers for preadv() */
+        haddr_t         addr;               /* Address of the run of blocks */
+        haddr_t         end;                /* End of the run of blocks */
+        size_t          size;               /* Bytes left to read for the run */
+
+        /* Skip empty blocks */
+        if(0 == sizes[u]) {
+            u++;
+            continue;
+        } /* end if */
+
+        /* Collect a run of blocks that are close together in the file */
+        addr = end = addrs[u];
+        size = 0;
+        while(u < count && niov < H5FD_SEC2_MAX_IOV) {
+            if(0 == sizes[u]) {
+                u++;
+                continue;
+            } /* end if */
+
+            /* Check for overflow conditions */
+            if(!H5F_addr_defined(addrs[u]))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addrs[u])
+            if(REGION_OVERFLOW(addrs[u], sizes[u]))
+                HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addrs[u])
+
+            /* Stop at blocks out of order, too far away or too large */
+            if(H5F_addr_lt(addrs[u], end) || (addrs[u] - end) > H5FD_SEC2_MAX_GAP
+                    || (size + (size_t)(addrs[u] - end) + sizes[u]) > H5_POSIX_MAX_IO_BYTES)
+                break;
+
+            /* Read through the gap before the block */
+            if(addrs[u] > end) {
+                if(niov + 1 == H5FD_SEC2_MAX_IOV)
+                    break;
+                iov[niov].iov_base = H5FD_sec2_gap_g;
+                iov[niov].iov_len = (size_t)(addrs[u] - end);
+                size += iov[niov].iov_len;
+                niov++;
+            } /* end if */
+
+            iov[niov].iov_base = bufs[u];
+            iov[niov].iov_len = sizes[u];
+            size += sizes[u];
+            niov++;
+            end = addrs[u] + sizes[u];
+            u++;
+        } /* end while */
+
+        /* A block too large for one call, read it by itself */
+        if(0 == niov) {
+            if(H5FD_sec2_read(_file, type, dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+            u++;
+            continue;
+        } /* end if */
+
+        /* Read the run, being careful of interrupted system calls, partial
+         * results, and the end of the file.
+         */
+        while(size > 0) {
+            h5_posix_io_ret_t   bytes_read      = -1;   /* # of bytes actually read */
+
+            do {
+                bytes_read = HDpreadv(file->fd, curr_iov, niov, (HDoff_t)addr);
+            } while(-1 == bytes_read && EINTR == errno);
+
+            if(-1 == bytes_read) { /* error */
+                int myerrno = errno;
+                time_t mytime = HDtime(NULL);
+
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file vector read failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', # of buffers = %d, total read size = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), niov, (unsigned long long)size, (unsigned long long)addr);
+            } /* end if */
+
+            if(0 == bytes_read) {
+                /* end of file but not end of format address space */
+                for(; niov > 0; niov--, curr_iov++)
+                    HDmemset(curr_iov->iov_base, 0, curr_iov->iov_len);
+                break;
+            } /* end if */
+
+            HDassert(bytes_read >= 0);
+            HDassert((size_t)bytes_read <= size);
+
+            size -= (size_t)bytes_read;
+            addr += (haddr_t)bytes_read;
+
+            /* Skip past the buffers filled */
+            while(bytes_read > 0) {
+                if((size_t)bytes_read >= curr_iov->iov_len) {
+                    bytes_read -= (h5_posix_io_ret_t)curr_iov->iov_len;
+                    curr_iov++;
+                    niov--;
+                } /* end if */
+                else {
+                    curr_iov->iov_base = (char *)curr_iov->iov_base + bytes_read;
+                    curr_iov->iov_len -= (size_t)bytes_read;
+                    bytes_read = 0;
+                } /* end else */
+            } /* end while */
+        } /* end while */
+    } /* end while */
+
+    /* (preadv() doesn't move the file position, so it's left alone, as in
+     * H5FD_sec2_read().)
+     */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_sec2_read_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_sec2_write_vector
+ *
+ * Purpose:     Writes COUNT blocks of data to FILE, the I'th one being
+ *              SIZES[I] bytes from buffer BUFS[I], to address ADDRS[I].
+ *
+ *              Blocks that follow each other in the file are written with
+ *              a single pwritev() call.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_sec2_write_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
+    uint32_t count, const haddr_t addrs[], const size_t sizes[], const void *bufs[])
+{
+    H5FD_sec2_t     *file       = (H5FD_sec2_t *)_file;
+    struct iovec    iov[H5FD_SEC2_MAX_IOV]; /* Buffers for one pwritev() call */
+    uint32_t        u = 0;                  /* Local index variable */
+    herr_t          ret_value   = SUCCEED;  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    while(u < count) {
+        struct iovec    *curr_iov = iov;    /* First buffer not yet written */
+        int             niov = 0;           /* # of buffers for pwritev() */
+        haddr_t         addr;               /* Address of the run of blocks */
+        haddr_t         end;                /* End of the run of blocks */
+        size_t          size;               /* Bytes left to write for the run */
+
+        /* Skip empty blocks */
+        if(0 == sizes[u]) {
+            u++;
+            continue;
+        } /* end if */
+
+        /* Collect a run of blocks that follow each other in the file */
+        addr = end = addrs[u];
+        size = 0;
+        while(u < count && niov < H5FD_SEC2_MAX_IOV) {
+            if(0 == sizes[u]) {
+                u++;
+                continue;
+            } /* end if */
+
+            /* Check for overflow conditions */
+            if(!H5F_addr_defined(addrs[u]))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addrs[u])
+            if(REGION_OVERFLOW(addrs[u], sizes[u]))
+                HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu", (unsigned long long)addrs[u], (unsigned long long)sizes[u])
+
+            /* Stop at a block that doesn't follow or is too large */
+            if(!H5F_addr_eq(addrs[u], end) || (size + sizes[u]) > H5_POSIX_MAX_IO_BYTES)
+                break;
+
+            /* (The buffers aren't modified by pwritev()) */
+            iov[niov].iov_base = (void *)bufs[u];
+            iov[niov].iov_len = sizes[u];
+            size += sizes[u];
+            niov++;
+            end = addrs[u] + sizes[u];
+            u++;
+        } /* end while */
+
+        /* A block too large for one call, write it by itself */
+        if(0 == niov) {
+            if(H5FD_sec2_write(_file, type, dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+            u++;
+            continue;
+        } /* end if */
+
+        /* Write the run, being careful of interrupted system calls and
+         * partial results
+         */
+        while(size > 0) {
+            h5_posix_io_ret_t   bytes_wrote     = -1;   /* # of bytes written */
+
+            do {
+                bytes_wrote = HDpwritev(file->fd, curr_iov, niov, (HDoff_t)addr);
+            } while(-1 == bytes_wrote && EINTR == errno);
+
+            if(-1 == bytes_wrote) { /* error */
+                int myerrno = errno;
+                time_t mytime = HDtime(NULL);
+
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file vector write failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', # of buffers = %d, total write size = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), niov, (unsigned long long)size, (unsigned long long)addr);
+            } /* end if */
+
+            HDassert(bytes_wrote > 0);
+            HDassert((size_t)bytes_wrote <= size);
+
+            size -= (size_t)bytes_wrote;
+            addr += (haddr_t)bytes_wrote;
+
+            /* Skip past the buffers written */
+            while(bytes_wrote > 0) {
+                if((size_t)bytes_wrote >= curr_iov->iov_len) {
+                    bytes_wrote -= (h5_posix_io_ret_t)curr_iov->iov_len;
+                    curr_iov++;
+                    niov--;
+                } /* end if */
+                else {
+                    curr_iov->iov_base = (char *)curr_iov->iov_base + bytes_wrote;
+                    curr_iov->iov_len -= (size_t)bytes_wrote;
+                    bytes_wrote = 0;
+                } /* end else */
+            } /* end while */
+        } /* end while */
+
+        /* Update current position and eof */
+        file->pos = end;
+        file->op = OP_WRITE;
+        if(file->pos > file->eof)
+            file->eof = file->pos;
+    } /* end while */
+
+done:
+    if(ret_value < 0) {
+        /* Reset last file I/O information */
+        file->pos = HADDR_UNDEF;
+        file->op = OP_UNKNOWN;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_sec2_write_vector() */
+#endif /* H5_HAVE_PREADWRITEV */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD_sec2_truncate
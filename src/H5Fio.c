@@ -255,6 +255,205 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_block_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_shared_block_read_vector
+ *
+ * Purpose:	Reads COUNT blocks of data from a file/server/etc into
+ *		buffers, the I'th block being SIZES[I] bytes at address
+ *		ADDRS[I], into buffer BUFS[I].  The addresses are relative
+ *		to the base address for the file.
+ *
+ *		Raw data blocks are handed to the file driver all at once
+ *		when the page buffer isn't in use.  Otherwise the blocks are
+ *		read one at a time, as with H5F_shared_block_read().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_block_read_vector(H5F_shared_t *f_sh, H5FD_mem_t type, uint32_t count,
+    const haddr_t addrs[], const size_t sizes[], void *bufs[]/*out*/)
+{
+    H5FD_mem_t  map_type;               /* Mapped memory type */
+    uint32_t    u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    /* Check for attempting I/O on 'temporary' file address */
+    for(u = 0; u < count; u++) {
+        HDassert(H5F_addr_defined(addrs[u]));
+        if(H5F_addr_le(f_sh->tmp_addr, (addrs[u] + sizes[u])))
+            HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+    } /* end for */
+
+    /* Treat global heap as raw data */
+    map_type = (type == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : type;
+
+    /* Metadata and page buffered blocks must pass through the page buffer
+     * and metadata accumulator one at a time */
+    if(H5FD_MEM_DRAW != map_type || f_sh->page_buf) {
+        for(u = 0; u < count; u++)
+            if(H5PB_read(f_sh, map_type, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "read through page buffer failed")
+    } /* end if */
+    else
+        if(H5FD_read_vector(f_sh->lf, map_type, count, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver vector read request failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_block_read_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_shared_block_read_concurrent
+ *
+ * Purpose:	Reads COUNT blocks of raw data, as with
+ *		H5F_shared_block_read_vector(), letting go of the library's
+ *		lock during the read if the file allows concurrent reads
+ *		(see H5Pset_concurrent_reads()), so other threads can use
+ *		the library meanwhile.
+ *
+ *		The buffers must belong to the caller alone (the
+ *		application's buffer or a private conversion buffer, not the
+ *		chunk cache or the sieve buffer), and the caller must not be
+ *		in the middle of changing any state other threads can see.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_block_read_concurrent(H5F_shared_t *f_sh, H5FD_mem_t type, uint32_t count,
+    const haddr_t addrs[], const size_t sizes[], void *bufs[]/*out*/)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+#ifdef H5_HAVE_THREADSAFE
+    if(f_sh->concurrent_reads && H5FD_MEM_DRAW == type) {
+        uint32_t    u;                  /* Local index variable */
+        herr_t      status;             /* Status of the read */
+
+        /* Check for attempting I/O on 'temporary' file address */
+        for(u = 0; u < count; u++) {
+            HDassert(H5F_addr_defined(addrs[u]));
+            if(H5F_addr_le(f_sh->tmp_addr, (addrs[u] + sizes[u])))
+                HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+        } /* end for */
+
+        /* Pages in the page buffer are only used with the lock held, so
+         * the page buffer lets go of the lock itself, around its reads
+         * of the pages it's missing
+         */
+        if(f_sh->page_buf) {
+            if(H5PB_read_concurrent(f_sh, type, count, addrs, sizes, bufs) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "page buffer read failed")
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+
+        /* Read the blocks without the library's lock.  (Errors pushed
+         * during the read take the lock back while they're pushed.)
+         */
+        if(H5TS_api_lock_release() != 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTUNLOCK, FAIL, "can't release API lock")
+        status = H5FD_read_vector(f_sh->lf, type, count, addrs, sizes, bufs);
+        if(H5TS_api_lock_reacquire() != 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTLOCK, FAIL, "can't reacquire API lock")
+        if(status < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver vector read request failed")
+    } /* end if */
+    else
+#endif /* H5_HAVE_THREADSAFE */
+        if(H5F_shared_block_read_vector(f_sh, type, count, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "block vector read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_block_read_concurrent() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_shared_block_write_vector
+ *
+ * Purpose:	Writes COUNT blocks of data from memory to a file/server/etc,
+ *		the I'th block being SIZES[I] bytes from buffer BUFS[I], to
+ *		address ADDRS[I].  The addresses are relative to the base
+ *		address.
+ *
+ *		Raw data blocks are handed to the file driver all at once
+ *		when neither the page buffer nor the metadata accumulator
+ *		need to see them.  Otherwise the blocks are written one at a
+ *		time, as with H5F_shared_block_write().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_block_write_vector(H5F_shared_t *f_sh, H5FD_mem_t type, uint32_t count,
+    const haddr_t addrs[], const size_t sizes[], const void *bufs[])
+{
+    H5FD_mem_t  map_type;               /* Mapped memory type */
+    hbool_t     one_at_a_time;          /* Whether to write the blocks individually */
+    uint32_t    u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(H5F_SHARED_INTENT(f_sh) & H5F_ACC_RDWR);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    /* Check for attempting I/O on 'temporary' file address */
+    for(u = 0; u < count; u++) {
+        HDassert(H5F_addr_defined(addrs[u]));
+        if(H5F_addr_le(f_sh->tmp_addr, (addrs[u] + sizes[u])))
+            HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+    } /* end for */
+
+    /* Treat global heap as raw data */
+    map_type = (type == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : type;
+
+    /* Metadata and page buffered blocks must pass through the page buffer
+     * and metadata accumulator one at a time, as must raw data blocks
+     * that the metadata accumulator has to be updated for */
+    one_at_a_time = (H5FD_MEM_DRAW != map_type || NULL != f_sh->page_buf);
+    if(!one_at_a_time && (f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA)) {
+        if(H5F_SHARED_INTENT(f_sh) & H5F_ACC_SWMR_WRITE)
+            one_at_a_time = TRUE;
+        else
+            for(u = 0; u < count && !one_at_a_time; u++)
+                if(H5F_addr_overlap(addrs[u], sizes[u], f_sh->accum.loc, f_sh->accum.size))
+                    one_at_a_time = TRUE;
+    } /* end if */
+
+    if(one_at_a_time) {
+        for(u = 0; u < count; u++)
+            if(H5PB_write(f_sh, map_type, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write through page buffer failed")
+    } /* end if */
+    else
+        if(H5FD_write_vector(f_sh->lf, map_type, count, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "driver vector write request failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_block_write_vector() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5F_flush_tagged_metadata
@@ -294,6 +294,10 @@ struct H5F_shared_t {
     size_t	rdcc_nslots;	/* Size of raw data chunk cache (slots)	*/
     size_t	rdcc_nbytes;	/* Size of raw data chunk cache	(bytes)	*/
     double	rdcc_w0;	/* Preempt read chunks first? [0.0..1.0]*/
+    struct H5D_rdcc_file_t *rdcc_file; /* Raw data chunk cache state shared by the file's datasets */
+    hbool_t     concurrent_reads;   /* Whether raw data reads may run without the library's lock */
+    unsigned    mdc_image_nthreads; /* # of threads decoding a metadata cache image */
+    hbool_t     mdc_image_lazy_load; /* Whether metadata cache image entries are inserted when first protected */
     size_t      sieve_buf_size; /* Size of the data sieve buffer allocated (in bytes) */
     hsize_t	threshold;	/* Threshold for alignment		*/
     hsize_t	alignment;	/* Alignment				*/
@@ -216,6 +216,19 @@ typedef struct H5F_retry_info_t {
     uint32_t *retries[H5F_NUM_METADATA_READ_RETRY_TYPES];
 } H5F_retry_info_t;
 
+/* Raw data chunk cache settings and statistics for a file */
+/* Used by public routine H5Fget_chunk_cache_stats() */
+typedef struct H5F_chunk_cache_stats_t {
+    size_t   nbytes_max;    /* Byte budget shared by the datasets (0 if none, see H5Pset_shared_chunk_cache) */
+    size_t   nbytes_used;   /* Bytes of chunks currently cached under the shared budget */
+    size_t   nentries;      /* Number of chunks currently cached under the shared budget */
+    hsize_t  nhits;         /* Chunk accesses that found the chunk in a cache */
+    hsize_t  nmisses;       /* Chunk accesses that read the chunk from the file */
+    hsize_t  nevictions;    /* Chunks preempted from a cache to make room for others */
+    hsize_t  nflushes;      /* Dirty chunks written to the file */
+    hsize_t  nghost_hits;   /* Misses on chunks recently preempted from a 2Q cache's FIFO queue */
+} H5F_chunk_cache_stats_t;
+
 /* Callback for H5Pset_object_flush_cb() in a file access property list */
 typedef herr_t (*H5F_flush_cb_t)(hid_t object_id, void *udata);
 
@@ -233,6 +246,7 @@ H5_DLL hid_t  H5Fopen(const char *filename, unsigned flags,
                 hid_t access_plist);
 H5_DLL hid_t  H5Freopen(hid_t file_id);
 H5_DLL herr_t H5Fflush(hid_t object_id, H5F_scope_t scope);
+H5_DLL herr_t H5Fflush_async(hid_t object_id, H5F_scope_t scope, hid_t es_id);
 H5_DLL herr_t H5Fclose(hid_t file_id);
 H5_DLL herr_t H5Fdelete(const char *filename, hid_t fapl_id);
 H5_DLL hid_t  H5Fget_create_plist(hid_t file_id);
@@ -278,6 +292,8 @@ H5_DLL herr_t H5Freset_page_buffering_stats(hid_t file_id);
 H5_DLL herr_t H5Fget_page_buffering_stats(hid_t file_id, unsigned accesses[2],
     unsigned hits[2], unsigned misses[2], unsigned evictions[2], unsigned bypasses[2]);
 H5_DLL herr_t H5Fget_mdc_image_info(hid_t file_id, haddr_t *image_addr, hsize_t *image_size);
+H5_DLL herr_t H5Fget_chunk_cache_stats(hid_t file_id, H5F_chunk_cache_stats_t *stats);
+H5_DLL herr_t H5Freset_chunk_cache_stats(hid_t file_id);
 H5_DLL herr_t H5Fget_dset_no_attrs_hint(hid_t file_id, hbool_t *minimize);
 H5_DLL herr_t H5Fset_dset_no_attrs_hint(hid_t file_id, hbool_t minimize);
 
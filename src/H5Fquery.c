@@ -676,6 +676,29 @@ H5F_rdcc_w0(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->rdcc_w0)
 } /* end H5F_rdcc_w0() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_rdcc_file
+ *
+ * Purpose:  Retrieve the raw data chunk cache state that is shared by
+ *           all datasets in the file.
+ *
+ * Return:   Success:    Pointer to the file's chunk cache state
+ *           Failure:    (should not happen)
+ *-------------------------------------------------------------------------
+ */
+struct H5D_rdcc_file_t *
+H5F_rdcc_file(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->rdcc_file)
+} /* end H5F_rdcc_file() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5F_get_base_addr
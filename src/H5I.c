@@ -40,7 +40,6 @@
 #include "H5Ipkg.h"             /* IDs                                      */
 #include "H5MMprivate.h"        /* Memory management                        */
 #include "H5Oprivate.h"         /* Object headers                           */
-#include "H5SLprivate.h"        /* Skip Lists                               */
 #include "H5Tpkg.h"             /* Datatypes                                */
 #include "H5VLprivate.h"        /* Virtual Object Layer                     */
 
@@ -51,6 +50,16 @@
 #define H5I_MAKE(g,i)	((((hid_t)(g) & TYPE_MASK) << ID_BITS) |	  \
 			     ((hid_t)(i) & ID_MASK))
 
+/* Smallest ID hash table, as log2 of the number of slots */
+#define H5I_HASH_MIN_BITS       6
+
+/* Hash table slot to start probing at for an ID (Fibonacci hashing, which
+ * spreads the consecutive IDs of a type over the whole table) */
+#define H5I_HASH(id, bits)      ((size_t)(((uint64_t)(id) * (uint64_t)0x9E3779B97F4A7C15ULL) >> (64 - (bits))))
+
+/* Marker for a hash table slot whose ID was removed */
+#define H5I_HASH_TOMB           (&H5I_hash_tomb_g)
+
 /* Local typedefs */
 
 /* Atom information structure used */
@@ -59,6 +68,11 @@ typedef struct H5I_id_info_t {
     unsigned	count;		/* ref. count for this atom		    */
     unsigned    app_count;      /* ref. count of application visible atoms  */
     const void	*obj_ptr;	/* pointer associated with the atom	    */
+    hbool_t     marked;         /* removed while iterating over the type    */
+    H5I_future_realize_func_t realize_cb; /* 'realize' callback of a future ID */
+    H5I_future_discard_func_t discard_cb; /* 'discard' callback of a future ID */
+    struct H5I_id_info_t *prev; /* previous ID of the type, in ID order     */
+    struct H5I_id_info_t *next; /* next ID of the type, in ID order         */
 } H5I_id_info_t;
 
 /* ID type structure used */
@@ -67,9 +81,20 @@ typedef struct {
     unsigned	init_count;	/* # of times this type has been initialized*/
     uint64_t	id_count;	/* Current number of IDs held		    */
     uint64_t	nextid;		/* ID to use for the next atom		    */
-    H5SL_t      *ids;           /* Pointer to skip list that stores IDs     */
+    H5I_id_info_t **hash;       /* Open-addressing hash table of the IDs    */
+    unsigned    hash_bits;      /* log2 of the number of slots in 'hash'    */
+    size_t      hash_used;      /* # of slots holding IDs or tombstones     */
+    H5I_id_info_t *first;       /* First ID of the type, in ID order        */
+    H5I_id_info_t *last;        /* Last ID of the type, in ID order         */
+    H5I_id_info_t *last_found;  /* ID found by the last lookup              */
+    unsigned    iterating;      /* # of iterations over the IDs in progress */
+    size_t      nmarked;        /* # of IDs removed during iterations       */
+    size_t      nfutures;       /* # of future IDs not realized yet         */
 } H5I_id_type_t;
 
+/* Callback for H5I__iterate_ids */
+typedef int (*H5I_id_op_t)(H5I_id_info_t *info, void *udata);
+
 typedef struct {
     H5I_search_func_t   app_cb;     /* Application's callback routine */
     void               *app_key;    /* Application's "key" (user data) */
@@ -119,6 +144,9 @@ static H5I_id_type_t *H5I_id_type_list_g[H5I_MAX_NUM_TYPES];
 /* and/or increase size of hid_t */
 static int H5I_next_type = (int)H5I_NTYPES;
 
+/* Tombstone for the hash table slots of removed IDs */
+static H5I_id_info_t H5I_hash_tomb_g;
+
 /* Declare a free list to manage the H5I_id_info_t struct */
 H5FL_DEFINE_STATIC(H5I_id_info_t);
 
@@ -131,18 +159,27 @@ H5FL_DEFINE_STATIC(H5I_class_t);
 H5FL_EXTERN(H5VL_object_t);
 
 /*--------------------- Local function prototypes ---------------------------*/
+static herr_t H5I__rehash(H5I_id_type_t *type_ptr, unsigned bits);
+static herr_t H5I__insert_id(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr);
+static H5I_id_info_t *H5I__unhash_id(H5I_id_type_t *type_ptr, hid_t id);
+static void H5I__release_id(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr);
+static int H5I__iterate_ids(H5I_id_type_t *type_ptr, H5I_id_op_t op, void *udata);
 static void *H5I__unwrap(void *obj_ptr, H5I_type_t type);
-static htri_t H5I__clear_type_cb(void *_id, void *key, void *udata);
+static int H5I__clear_type_cb(H5I_id_info_t *id, void *udata);
 static int H5I__destroy_type(H5I_type_t type);
 static void *H5I__remove_verify(hid_t id, H5I_type_t id_type);
 static void *H5I__remove_common(H5I_id_type_t *type_ptr, hid_t id);
 static int H5I__inc_type_ref(H5I_type_t type);
 static int H5I__get_type_ref(H5I_type_t type);
 static int H5I__search_cb(void *obj, hid_t id, void *_udata);
+static H5I_id_info_t *H5I__lookup_id(H5I_id_type_t *type_ptr, hid_t id);
+static H5I_id_info_t *H5I__realize_future(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr);
+static herr_t H5I__realize_futures(H5I_id_type_t *type_ptr);
 static H5I_id_info_t *H5I__find_id(hid_t id);
 static int H5I__iterate_pub_cb(void *obj, hid_t id, void *udata);
-static int H5I__find_id_cb(void *_item, void *_key, void *_udata);
-static int H5I__id_dump_cb(void *_item, void *_key, void *_udata);
+static int H5I__iterate_cb(H5I_id_info_t *item, void *udata);
+static int H5I__find_id_cb(H5I_id_info_t *item, void *udata);
+static int H5I__id_dump_cb(H5I_id_info_t *item, void *udata);
 
 
 /*-------------------------------------------------------------------------
@@ -172,7 +209,7 @@ H5I_term_package(void)
 
         /* How many types are still being used? */
         for(type = 0; type < H5I_next_type; type++)
-            if((type_ptr = H5I_id_type_list_g[type]) && type_ptr->ids)
+            if((type_ptr = H5I_id_type_list_g[type]) && type_ptr->hash)
                 n++;
 
         /* If no types are used then clean up */
@@ -180,7 +217,7 @@ H5I_term_package(void)
             for(type = 0; type < H5I_next_type; type++) {
                 type_ptr = H5I_id_type_list_g[type];
                 if(type_ptr) {
-                    HDassert(NULL == type_ptr->ids);
+                    HDassert(NULL == type_ptr->hash);
                     type_ptr = H5FL_FREE(H5I_id_type_t, type_ptr);
                     H5I_id_type_list_g[type] = NULL;
                     n++;
@@ -317,8 +354,12 @@ H5I_register_type(const H5I_class_t *cls)
         type_ptr->cls = cls;
         type_ptr->id_count = 0;
         type_ptr->nextid = cls->reserved;
-        if(NULL == (type_ptr->ids = H5SL_create(H5SL_TYPE_HID, NULL)))
-            HGOTO_ERROR(H5E_ATOM, H5E_CANTCREATE, FAIL, "skip list creation failed")
+        type_ptr->first = type_ptr->last = type_ptr->last_found = NULL;
+        type_ptr->iterating = 0;
+        type_ptr->nmarked = 0;
+        type_ptr->nfutures = 0;
+        if(H5I__rehash(type_ptr, H5I_HASH_MIN_BITS) < 0)
+            HGOTO_ERROR(H5E_ATOM, H5E_CANTCREATE, FAIL, "ID hash table creation failed")
     } /* end if */
 
     /* Increment the count of the times this type has been initialized */
@@ -327,8 +368,7 @@ H5I_register_type(const H5I_class_t *cls)
 done:
     if(ret_value < 0) {	/* Clean up on error */
         if(type_ptr) {
-            if(type_ptr->ids)
-                H5SL_close(type_ptr->ids);
+            type_ptr->hash = (H5I_id_info_t **)H5MM_xfree(type_ptr->hash);
             (void)H5FL_FREE(H5I_id_type_t, type_ptr);
         } /* end if */
     } /* end if */
@@ -336,6 +376,264 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_register_type() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__rehash
+ *
+ * Purpose:     Rebuilds the hash table of a type with 2^BITS slots,
+ *              dropping the tombstones of removed IDs.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5I__rehash(H5I_id_type_t *type_ptr, unsigned bits)
+{
+    H5I_id_info_t **hash;               /* New hash table */
+    size_t      mask = ((size_t)1 << bits) - 1; /* Mask for slot numbers */
+    size_t      used = 0;               /* # of slots used in new table */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(type_ptr);
+    HDassert(bits >= H5I_HASH_MIN_BITS && bits < 64);
+
+    if(NULL == (hash = (H5I_id_info_t **)H5MM_calloc((mask + 1) * sizeof(H5I_id_info_t *))))
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTALLOC, FAIL, "can't allocate ID hash table")
+
+    /* Move the IDs over */
+    if(type_ptr->hash) {
+        size_t old_size = (size_t)1 << type_ptr->hash_bits;
+        size_t u;
+
+        for(u = 0; u < old_size; u++) {
+            H5I_id_info_t *item = type_ptr->hash[u];
+
+            if(item && item != H5I_HASH_TOMB) {
+                size_t v;
+
+                for(v = H5I_HASH(item->id, bits); hash[v]; v = (v + 1) & mask)
+                    ;
+                hash[v] = item;
+                used++;
+            } /* end if */
+        } /* end for */
+
+        H5MM_xfree(type_ptr->hash);
+    } /* end if */
+
+    type_ptr->hash = hash;
+    type_ptr->hash_bits = bits;
+    type_ptr->hash_used = used;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__rehash() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__insert_id
+ *
+ * Purpose:     Adds an ID to the hash table of a type and links it into
+ *              the type's list of IDs, which is kept in ID order for
+ *              iterating.  The ID must not be in the type already.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5I__insert_id(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr)
+{
+    H5I_id_info_t *prev;                /* ID to link the new ID after */
+    size_t      mask;                   /* Mask for slot numbers */
+    size_t      u;                      /* Slot for the new ID */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(type_ptr);
+    HDassert(type_ptr->hash);
+    HDassert(id_ptr);
+
+    /* Keep at least half of the slots empty, so probes stay short.  The
+     * table is rebuilt a quarter full, which also clears the tombstones
+     * left by IDs that were removed.
+     */
+    if(2 * (type_ptr->hash_used + 1) > ((size_t)1 << type_ptr->hash_bits)) {
+        unsigned bits = H5I_HASH_MIN_BITS;
+
+        while(((size_t)1 << bits) < 4 * ((size_t)type_ptr->id_count + 1))
+            bits++;
+        if(H5I__rehash(type_ptr, bits) < 0)
+            HGOTO_ERROR(H5E_ATOM, H5E_CANTRESIZE, FAIL, "can't resize ID hash table")
+    } /* end if */
+
+    /* Put the ID in the first free slot */
+    mask = ((size_t)1 << type_ptr->hash_bits) - 1;
+    for(u = H5I_HASH(id_ptr->id, type_ptr->hash_bits); type_ptr->hash[u] && type_ptr->hash[u] != H5I_HASH_TOMB; u = (u + 1) & mask)
+        ;
+    if(NULL == type_ptr->hash[u])
+        type_ptr->hash_used++;
+    type_ptr->hash[u] = id_ptr;
+
+    /* Link the ID into the list.  New IDs almost always go at the end. */
+    for(prev = type_ptr->last; prev && prev->id > id_ptr->id; prev = prev->prev)
+        ;
+    id_ptr->marked = FALSE;
+    id_ptr->prev = prev;
+    id_ptr->next = prev ? prev->next : type_ptr->first;
+    if(id_ptr->next)
+        id_ptr->next->prev = id_ptr;
+    else
+        type_ptr->last = id_ptr;
+    if(prev)
+        prev->next = id_ptr;
+    else
+        type_ptr->first = id_ptr;
+
+    /* A new ID is usually used right away */
+    type_ptr->last_found = id_ptr;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__insert_id() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__unhash_id
+ *
+ * Purpose:     Removes an ID from the hash table of a type, so it can no
+ *              longer be found.  The ID stays in the type's list until it
+ *              is released with H5I__release_id.
+ *
+ * Return:      Success:    The ID's info struct
+ *              Failure:    NULL (the ID is not in the type)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5I_id_info_t *
+H5I__unhash_id(H5I_id_type_t *type_ptr, hid_t id)
+{
+    H5I_id_info_t *item;                /* ID in the current slot */
+    size_t      mask;                   /* Mask for slot numbers */
+    size_t      u;                      /* Current slot */
+    H5I_id_info_t *ret_value = NULL;    /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(type_ptr);
+    HDassert(type_ptr->hash);
+
+    mask = ((size_t)1 << type_ptr->hash_bits) - 1;
+    for(u = H5I_HASH(id, type_ptr->hash_bits); NULL != (item = type_ptr->hash[u]); u = (u + 1) & mask)
+        if(item != H5I_HASH_TOMB && item->id == id) {
+            type_ptr->hash[u] = H5I_HASH_TOMB;
+            if(type_ptr->last_found == item)
+                type_ptr->last_found = NULL;
+            ret_value = item;
+            break;
+        } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__unhash_id() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__release_id
+ *
+ * Purpose:     Unlinks an ID removed with H5I__unhash_id from the type's
+ *              list and frees it.  While the type is being iterated over
+ *              the ID is only marked, and it is freed when the last
+ *              iteration finishes, so iterations can go on from any ID
+ *              the callbacks remove.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5I__release_id(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(type_ptr);
+    HDassert(id_ptr);
+    HDassert(!id_ptr->marked);
+
+    if(type_ptr->iterating > 0) {
+        id_ptr->marked = TRUE;
+        type_ptr->nmarked++;
+    } /* end if */
+    else {
+        if(id_ptr->prev)
+            id_ptr->prev->next = id_ptr->next;
+        else
+            type_ptr->first = id_ptr->next;
+        if(id_ptr->next)
+            id_ptr->next->prev = id_ptr->prev;
+        else
+            type_ptr->last = id_ptr->prev;
+        id_ptr = H5FL_FREE(H5I_id_info_t, id_ptr);
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5I__release_id() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__iterate_ids
+ *
+ * Purpose:     Calls OP for each ID of a type, in ID order, until OP
+ *              returns something other than H5_ITER_CONT.  OP may remove
+ *              any IDs of the type, and the removed IDs are not visited.
+ *
+ * Return:      The last value returned by OP, or H5_ITER_CONT if there
+ *              are no IDs
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5I__iterate_ids(H5I_id_type_t *type_ptr, H5I_id_op_t op, void *udata)
+{
+    H5I_id_info_t *item;                /* Current ID */
+    int         ret_value = H5_ITER_CONT;   /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(type_ptr);
+    HDassert(op);
+
+    type_ptr->iterating++;
+    for(item = type_ptr->first; item && H5_ITER_CONT == ret_value; item = item->next)
+        if(!item->marked)
+            ret_value = (*op)(item, udata);
+    type_ptr->iterating--;
+
+    /* Free the IDs removed during the iterations */
+    if(0 == type_ptr->iterating && type_ptr->nmarked > 0) {
+        H5I_id_info_t *next;            /* Next ID */
+
+        for(item = type_ptr->first; item; item = next) {
+            next = item->next;
+            if(item->marked) {
+                item->marked = FALSE;
+                H5I__release_id(type_ptr, item);
+            } /* end if */
+        } /* end for */
+        type_ptr->nmarked = 0;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__iterate_ids() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Itype_exists
@@ -566,8 +864,11 @@ H5I_clear_type(H5I_type_t type, hbool_t force, hbool_t app_ref)
     udata.force = force;
     udata.app_ref = app_ref;
 
+    /* Get the objects of future IDs, so they can be freed */
+    H5I__realize_futures(udata.type_ptr);
+
     /* Attempt to free all ids in the type */
-    if(H5SL_try_free_safe(udata.type_ptr->ids, H5I__clear_type_cb, &udata) < 0)
+    if(H5I__iterate_ids(udata.type_ptr, H5I__clear_type_cb, &udata) < 0)
         HGOTO_ERROR(H5E_ATOM, H5E_CANTDELETE, FAIL, "can't free ids in type")
 
 done:
@@ -581,19 +882,18 @@ done:
  * Purpose:     Attempts to free the specified ID, calling the free
  *              function for the object.
  *
- * Return:      TRUE/FALSE/FAIL
+ * Return:      H5_ITER_CONT (always)
  *
  * Programmer:  Neil Fortner
  *              Friday, July 10, 2015
  *
  *-------------------------------------------------------------------------
  */
-static htri_t
-H5I__clear_type_cb(void *_id, void H5_ATTR_UNUSED *key, void *_udata)
+static int
+H5I__clear_type_cb(H5I_id_info_t *id, void *_udata)
 {
-    H5I_id_info_t       *id = (H5I_id_info_t *)_id; /* Current ID being worked with */
     H5I_clear_type_ud_t *udata = (H5I_clear_type_ud_t *)_udata; /* udata struct */
-    htri_t              ret_value = FALSE;    /* Return value */
+    hbool_t             remove_id = FALSE;  /* Whether to remove the ID */
 
     FUNC_ENTER_STATIC_NOERR
 
@@ -619,25 +919,25 @@ H5I__clear_type_cb(void *_id, void H5_ATTR_UNUSED *key, void *_udata)
 #endif /*H5I_DEBUG*/
 
                 /* Indicate node should be removed from list */
-                ret_value = TRUE;
+                remove_id = TRUE;
             } /* end if */
         } /* end if */
         else {
             /* Indicate node should be removed from list */
-            ret_value = TRUE;
+            remove_id = TRUE;
         } /* end else */
 
-        /* Remove ID if requested */
-        if(ret_value) {
+        /* Remove ID if requested (and the free function didn't) */
+        if(remove_id && H5I__unhash_id(udata->type_ptr, id->id)) {
             /* Free ID info */
-            id = H5FL_FREE(H5I_id_info_t, id);
+            H5I__release_id(udata->type_ptr, id);
 
             /* Decrement the number of IDs in the type */
             udata->type_ptr->id_count--;
         } /* end if */
     } /* end if */
 
-    FUNC_LEAVE_NOAPI(ret_value)
+    FUNC_LEAVE_NOAPI(H5_ITER_CONT)
 } /* end H5I__clear_type_cb() */
 
 
@@ -715,9 +1015,14 @@ H5I__destroy_type(H5I_type_t type)
     if(type_ptr->cls->flags & H5I_CLASS_IS_APPLICATION)
         type_ptr->cls = H5FL_FREE(H5I_class_t, (void *)type_ptr->cls);
 
-    if(H5SL_close(type_ptr->ids) < 0)
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTCLOSEOBJ, FAIL, "can't close skip list")
-    type_ptr->ids = NULL;
+    /* Free the hash table and any IDs left marked by an iteration in progress */
+    while(type_ptr->first) {
+        H5I_id_info_t *next = type_ptr->first->next;
+
+        (void)H5FL_FREE(H5I_id_info_t, type_ptr->first);
+        type_ptr->first = next;
+    } /* end while */
+    type_ptr->hash = (H5I_id_info_t **)H5MM_xfree(type_ptr->hash);
 
     type_ptr = H5FL_FREE(H5I_id_type_t, type_ptr);
     H5I_id_type_list_g[type] = NULL;
@@ -796,10 +1101,12 @@ H5I_register(H5I_type_t type, const void *object, hbool_t app_ref)
     id_ptr->count       = 1; /* initial reference count */
     id_ptr->app_count   = !!app_ref;
     id_ptr->obj_ptr     = object;
+    id_ptr->realize_cb  = NULL;
+    id_ptr->discard_cb  = NULL;
 
     /* Insert into the type */
-    if (H5SL_insert(type_ptr->ids, id_ptr, &id_ptr->id) < 0)
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, H5I_INVALID_HID, "can't insert ID node into skip list")
+    if (H5I__insert_id(type_ptr, id_ptr) < 0)
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, H5I_INVALID_HID, "can't insert ID node into hash table")
     type_ptr->id_count++;
     type_ptr->nextid++;
 
@@ -810,6 +1117,9 @@ H5I_register(H5I_type_t type, const void *object, hbool_t app_ref)
     ret_value = new_id;
 
 done:
+    if (ret_value < 0 && id_ptr)
+        id_ptr = H5FL_FREE(H5I_id_info_t, id_ptr);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_register() */
 
@@ -871,16 +1181,65 @@ H5I_register_using_existing_id(H5I_type_t type, void *object, hbool_t app_ref, h
     id_ptr->count       = 1; /* initial reference count*/
     id_ptr->app_count   = !!app_ref;
     id_ptr->obj_ptr     = object;
+    id_ptr->realize_cb  = NULL;
+    id_ptr->discard_cb  = NULL;
 
     /* Insert into the type */
-    if(H5SL_insert(type_ptr->ids, id_ptr, &id_ptr->id) < 0)
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, FAIL, "can't insert ID node into skip list")
+    if(H5I__insert_id(type_ptr, id_ptr) < 0) {
+        id_ptr = H5FL_FREE(H5I_id_info_t, id_ptr);
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, FAIL, "can't insert ID node into hash table")
+    } /* end if */
     type_ptr->id_count++;
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_register_using_existing_id() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I_register_future
+ *
+ * Purpose:     Registers a "future" ID for an object that is still being
+ *              created.  The ID refers to FUTURE_OBJECT until it is first
+ *              looked up, when REALIZE_CB is called to get the actual
+ *              object and the ID is switched over to it.  If REALIZE_CB
+ *              fails the ID is removed.  Either way, DISCARD_CB is then
+ *              called to release FUTURE_OBJECT.
+ *
+ * Return:      Success:    New object ID
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5I_register_future(H5I_type_t type, const void *future_object,
+    H5I_future_realize_func_t realize_cb, H5I_future_discard_func_t discard_cb)
+{
+    H5I_id_type_t  *type_ptr;               /* ptr to the type                  */
+    hid_t           ret_value = H5I_INVALID_HID;    /* return value             */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    /* Check arguments */
+    HDassert(future_object);
+    HDassert(realize_cb);
+    HDassert(discard_cb);
+
+    /* Register the ID for the future object */
+    if((ret_value = H5I_register(type, future_object, TRUE)) < 0)
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTREGISTER, H5I_INVALID_HID, "can't register ID")
+
+    /* Make it a future ID (H5I_register leaves the new ID as the last one found) */
+    type_ptr = H5I_id_type_list_g[type];
+    HDassert(type_ptr->last_found && type_ptr->last_found->id == ret_value);
+    type_ptr->last_found->realize_cb = realize_cb;
+    type_ptr->last_found->discard_cb = discard_cb;
+    type_ptr->nfutures++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I_register_future() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5I_subst
@@ -1232,11 +1591,11 @@ H5I__remove_common(H5I_id_type_t *type_ptr, hid_t id)
     HDassert(type_ptr);
 
     /* Get the ID node for the ID */
-    if(NULL == (curr_id = (H5I_id_info_t *)H5SL_remove(type_ptr->ids, &id)))
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTDELETE, NULL, "can't remove ID node from skip list")
+    if(NULL == (curr_id = H5I__unhash_id(type_ptr, id)))
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTDELETE, NULL, "can't remove ID node from hash table")
 
     ret_value = (void *)curr_id->obj_ptr;       /* (Casting away const OK -QAK) */
-    curr_id = H5FL_FREE(H5I_id_info_t, curr_id);
+    H5I__release_id(type_ptr, curr_id);
 
     /* Decrement the number of IDs in the type */
     (type_ptr->id_count)--;
@@ -1277,6 +1636,10 @@ H5I_remove(hid_t id)
     if(type_ptr == NULL || type_ptr->init_count <= 0)
         HGOTO_ERROR(H5E_ATOM, H5E_BADGROUP, NULL, "invalid type")
 
+    /* Get the object of a future ID */
+    if(type_ptr->nfutures > 0 && NULL == H5I__find_id(id))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, NULL, "can't locate ID")
+
     /* Remove the node from the type */
     if(NULL == (ret_value = H5I__remove_common(type_ptr, id)))
         HGOTO_ERROR(H5E_ATOM, H5E_CANTDELETE, NULL, "can't remove ID node")
@@ -2061,9 +2424,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5I__iterate_cb(void *_item, void H5_ATTR_UNUSED *_key, void *_udata)
+H5I__iterate_cb(H5I_id_info_t *item, void *_udata)
 {
-    H5I_id_info_t *item = (H5I_id_info_t *)_item;       /* Pointer to the ID node */
     H5I_iterate_ud_t *udata = (H5I_iterate_ud_t *)_udata; /* User data for callback */
     int ret_value = H5_ITER_CONT;     /* Callback return value */
 
@@ -2145,8 +2507,11 @@ H5I_iterate(H5I_type_t type, H5I_search_func_t func, void *udata, hbool_t app_re
         iter_udata.app_ref      = app_ref;
         iter_udata.obj_type     = type;
 
+        /* Get the objects of future IDs */
+        H5I__realize_futures(type_ptr);
+
         /* Iterate over IDs */
-        if((iter_status = H5SL_iterate(type_ptr->ids, H5I__iterate_cb, &iter_udata)) < 0)
+        if((iter_status = H5I__iterate_ids(type_ptr, H5I__iterate_cb, &iter_udata)) < 0)
             HGOTO_ERROR(H5E_ATOM, H5E_BADITER, FAIL, "iteration failed")
     } /* end if */
 
@@ -2154,12 +2519,155 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_iterate() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__lookup_id
+ *
+ * Purpose:     Finds the info struct of an ID in its type's hash table,
+ *              without realizing it if it is a future ID.
+ *
+ * Return:      Success:    A pointer to the ID's info struct
+ *              Failure:    NULL (the ID is not in the type)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5I_id_info_t *
+H5I__lookup_id(H5I_id_type_t *type_ptr, hid_t id)
+{
+    H5I_id_info_t	*item;			/*ID in the current slot */
+    size_t		mask;			/*mask for slot numbers	*/
+    size_t		u;			/*current slot		*/
+    H5I_id_info_t	*ret_value = NULL;	/* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(type_ptr);
+
+    /* Check the ID found by the last lookup before probing the table */
+    if(type_ptr->last_found && type_ptr->last_found->id == id)
+        HGOTO_DONE(type_ptr->last_found)
+
+    /* Locate the ID node for the ID */
+    mask = ((size_t)1 << type_ptr->hash_bits) - 1;
+    for(u = H5I_HASH(id, type_ptr->hash_bits); NULL != (item = type_ptr->hash[u]); u = (u + 1) & mask)
+        if(item != H5I_HASH_TOMB && item->id == id) {
+            type_ptr->last_found = item;
+            ret_value = item;
+            break;
+        } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__lookup_id() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__realize_future
+ *
+ * Purpose:     Switches a future ID over to its actual object, or removes
+ *              the ID if the object couldn't be created.  The 'realize'
+ *              callback may release the library's lock while it waits, so
+ *              another thread may realize or remove the ID meanwhile.
+ *
+ * Return:      Success:    A pointer to the ID's info struct
+ *              Failure:    NULL (the ID is gone)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5I_id_info_t *
+H5I__realize_future(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr)
+{
+    hid_t       id;                     /* The future ID */
+    void       *future_object;          /* Object the ID refers to now */
+    void       *actual_object = NULL;   /* Object the ID will refer to */
+    H5I_future_discard_func_t discard_cb;   /* Callback releasing the future object */
+    herr_t      status;                 /* Whether the object was created */
+    H5I_id_info_t *ret_value = NULL;    /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(type_ptr);
+    HDassert(id_ptr);
+    HDassert(id_ptr->realize_cb);
+
+    id = id_ptr->id;
+    future_object = (void *)id_ptr->obj_ptr;    /* (Casting away const OK) */
+    discard_cb = id_ptr->discard_cb;
+
+    /* Get the actual object */
+    status = (id_ptr->realize_cb)(future_object, &actual_object);
+
+    /* Look the ID up again, unless another thread got to it first */
+    if(NULL != (id_ptr = H5I__lookup_id(type_ptr, id)) && id_ptr->realize_cb) {
+        HDassert(id_ptr->obj_ptr == future_object);
+        id_ptr->realize_cb = NULL;
+        id_ptr->discard_cb = NULL;
+        type_ptr->nfutures--;
+
+        if(status >= 0 && actual_object) {
+            id_ptr->obj_ptr = actual_object;
+            actual_object = NULL;
+            ret_value = id_ptr;
+        } /* end if */
+        else {
+            (void)H5I__unhash_id(type_ptr, id);
+            H5I__release_id(type_ptr, id_ptr);
+            type_ptr->id_count--;
+        } /* end else */
+
+        (void)(discard_cb)(future_object);
+    } /* end if */
+    else
+        ret_value = id_ptr;
+
+    /* Close an object nobody can get to any more */
+    if(actual_object && type_ptr->cls->free_func)
+        (void)(type_ptr->cls->free_func)(actual_object);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__realize_future() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__realize_futures
+ *
+ * Purpose:     Realizes all the future IDs of a type, so the objects of
+ *              its IDs can be walked over.
+ *
+ * Return:      SUCCEED (futures that fail are removed)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5I__realize_futures(H5I_id_type_t *type_ptr)
+{
+    H5I_id_info_t *item;                /* Current ID */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(type_ptr);
+
+    /* Start over after each one, as the list may change while it waits */
+    while(type_ptr->nfutures > 0) {
+        for(item = type_ptr->first; item; item = item->next)
+            if(item->realize_cb)
+                break;
+        HDassert(item);
+        (void)H5I__realize_future(type_ptr, item);
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5I__realize_futures() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5I__find_id
  *
  * Purpose:     Given an object ID find the info struct that describes the
- *              object.
+ *              object.  A future ID is realized first.
  *
  * Return:      Success:    A pointer to the object's info struct.
  *
@@ -2184,8 +2692,9 @@ H5I__find_id(hid_t id)
     if(!type_ptr || type_ptr->init_count <= 0)
         HGOTO_DONE(NULL)
 
-    /* Locate the ID node for the ID */
-    ret_value = (H5I_id_info_t *)H5SL_search(type_ptr->ids, &id);
+    /* Locate the ID node for the ID, getting the object of a future ID */
+    if(NULL != (ret_value = H5I__lookup_id(type_ptr, id)) && ret_value->realize_cb)
+        ret_value = H5I__realize_future(type_ptr, ret_value);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -2298,9 +2807,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5I__find_id_cb(void *_item, void H5_ATTR_UNUSED *_key, void *_udata)
+H5I__find_id_cb(H5I_id_info_t *item, void *_udata)
 {
-    H5I_id_info_t *item = (H5I_id_info_t *)_item;       /* Pointer to the ID node */
     H5I_get_id_ud_t *udata = (H5I_get_id_ud_t *)_udata;     /* Pointer to user data */
     H5I_type_t type = udata->obj_type;
     const void *obj_ptr = NULL;
@@ -2362,8 +2870,11 @@ H5I_find_id(const void *object, H5I_type_t type, hid_t *id)
         udata.obj_type  = type;
         udata.ret_id    = H5I_INVALID_HID;
 
+        /* Get the objects of future IDs */
+        H5I__realize_futures(type_ptr);
+
         /* Iterate over IDs for the ID type */
-        if ((iter_status = H5SL_iterate(type_ptr->ids, H5I__find_id_cb, &udata)) < 0)
+        if ((iter_status = H5I__iterate_ids(type_ptr, H5I__find_id_cb, &udata)) < 0)
             HGOTO_ERROR(H5E_ATOM, H5E_BADITER, FAIL, "iteration failed")
 
         *id = udata.ret_id;
@@ -2384,9 +2895,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5I__id_dump_cb(void *_item, void H5_ATTR_UNUSED *_key, void *_udata)
+H5I__id_dump_cb(H5I_id_info_t *item, void *_udata)
 {
-    H5I_id_info_t  *item    = (H5I_id_info_t *)_item;       /* Pointer to the ID node */
     H5I_type_t      type    = *(H5I_type_t *)_udata;        /* User data */
     H5G_name_t     *path    = NULL;                         /* Path to file object */
     const void     *obj_ptr = NULL;                         /* Pointer to VOL connector object */
@@ -2446,6 +2956,7 @@ H5I__id_dump_cb(void *_item, void H5_ATTR_UNUSED *_key, void *_udata)
         case H5I_ERROR_MSG:
         case H5I_ERROR_STACK:
         case H5I_SPACE_SEL_ITER:
+        case H5I_EVENTSET:
         case H5I_NTYPES:
         default:
             break;   /* Other types of IDs are not stored in files */
@@ -2492,7 +3003,8 @@ H5I_dump_ids_for_type(H5I_type_t type)
         /* List */
         if(type_ptr->id_count > 0) {
             HDfprintf(stderr, "	 List:\n");
-            H5SL_iterate(type_ptr->ids, H5I__id_dump_cb, &type);
+            H5I__realize_futures(type_ptr);
+            H5I__iterate_ids(type_ptr, H5I__id_dump_cb, &type);
         }
     }
     else
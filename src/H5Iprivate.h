@@ -55,6 +55,15 @@ typedef struct H5I_class_t {
     H5I_free_t free_func;       /* Free function for object's of this type */
 } H5I_class_t;
 
+/* Callbacks for "future" IDs, whose objects are still being created.  The
+ * first lookup of a future ID calls its 'realize' callback, which may wait
+ * (releasing the library's lock) until the actual object exists, and the
+ * ID then refers to that object.  The 'discard' callback releases the
+ * future object once the ID no longer needs it.
+ */
+typedef herr_t (*H5I_future_realize_func_t)(void *future_object, void **actual_object);
+typedef herr_t (*H5I_future_discard_func_t)(void *future_object);
+
 
 /*****************************/
 /* Library-private Variables */
@@ -97,6 +106,8 @@ H5_DLL htri_t H5I_is_file_object(hid_t id);
 /* ID registration functions */
 H5_DLL hid_t H5I_register(H5I_type_t type, const void *object, hbool_t app_ref);
 H5_DLL herr_t H5I_register_using_existing_id(H5I_type_t type, void *object, hbool_t app_ref, hid_t existing_id);
+H5_DLL hid_t H5I_register_future(H5I_type_t type, const void *future_object,
+    H5I_future_realize_func_t realize_cb, H5I_future_discard_func_t discard_cb);
 
 /* Debugging functions */
 H5_DLL herr_t H5I_dump_ids_for_type(H5I_type_t type);
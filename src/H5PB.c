@@ -114,6 +114,16 @@ typedef struct {
     hbool_t actual_slist;
 } H5PB_ud1_t;
 
+#ifdef H5_HAVE_THREADSAFE
+/* A piece of a block, to be copied out of a page read for it */
+typedef struct {
+    uint8_t *buf;                       /* Where the piece goes */
+    uint32_t read;                      /* Index of the read of the page */
+    size_t offset;                      /* Offset of the piece in the page */
+    size_t len;                         /* Length of the piece */
+} H5PB_piece_t;
+#endif /* H5_HAVE_THREADSAFE */
+
 
 /********************/
 /* Package Typedefs */
@@ -124,8 +134,11 @@ typedef struct {
 /* Local Prototypes */
 /********************/
 static herr_t H5PB__insert_entry(H5PB_t *page_buf, H5PB_entry_t *page_entry);
+static void H5PB__hit_entry(H5PB_t *page_buf, H5PB_entry_t *page_entry, H5FD_mem_t type);
 static htri_t H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type);
 static herr_t H5PB__write_entry(H5F_shared_t *f_sh, H5PB_entry_t *page_entry);
+static herr_t H5PB__read_ahead(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t type,
+    haddr_t page_addr, size_t page_size, haddr_t eoa, void *page/*out*/);
 
 
 /*********************/
@@ -184,6 +197,10 @@ H5PB_reset_stats(H5PB_t *page_buf)
     page_buf->evictions[1] = 0;
     page_buf->bypasses[0] = 0;
     page_buf->bypasses[1] = 0;
+    page_buf->prefetches[0] = 0;
+    page_buf->prefetches[1] = 0;
+    page_buf->prefetch_hits[0] = 0;
+    page_buf->prefetch_hits[1] = 0;
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 }  /* H5PB_reset_stats() */
@@ -201,6 +218,8 @@ H5PB_reset_stats(H5PB_t *page_buf)
  *              --misses: the number of metadata and raw data misses in the page buffer layer
  *              --evictions: the number of metadata and raw data evictions from the page buffer layer
  *              --bypasses: the number of metadata and raw data accesses that bypass the page buffer layer
+ *              --prefetches: the number of metadata and raw data pages read ahead (optional)
+ *              --prefetch_hits: the number of metadata and raw data pages read ahead that were then accessed (optional)
  *
  * Return:	    Non-negative on success/Negative on failure
  *
@@ -210,7 +229,8 @@ H5PB_reset_stats(H5PB_t *page_buf)
  */
 herr_t 
 H5PB_get_stats(const H5PB_t *page_buf, unsigned accesses[2], unsigned hits[2],
-    unsigned misses[2], unsigned evictions[2], unsigned bypasses[2])
+    unsigned misses[2], unsigned evictions[2], unsigned bypasses[2],
+    unsigned prefetches[2], unsigned prefetch_hits[2])
 {
     FUNC_ENTER_NOAPI_NOERR
 
@@ -227,6 +247,14 @@ H5PB_get_stats(const H5PB_t *page_buf, unsigned accesses[2], unsigned hits[2],
     evictions[1] = page_buf->evictions[1];
     bypasses[0] = page_buf->bypasses[0];
     bypasses[1] = page_buf->bypasses[1];
+    if(prefetches) {
+        prefetches[0] = page_buf->prefetches[0];
+        prefetches[1] = page_buf->prefetches[1];
+    } /* end if */
+    if(prefetch_hits) {
+        prefetch_hits[0] = page_buf->prefetch_hits[0];
+        prefetch_hits[1] = page_buf->prefetch_hits[1];
+    } /* end if */
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 }  /* H5PB_get_stats */
@@ -262,6 +290,10 @@ H5PB_print_stats(const H5PB_t *page_buf)
     HDprintf("\t Evictions: %u\n", page_buf->evictions[0]);
     HDprintf("\t Bypasses: %u\n", page_buf->bypasses[0]);
     HDprintf("\t Hit Rate = %f%%\n", ((double)page_buf->hits[0]/(page_buf->accesses[0] - page_buf->bypasses[0]))*100);
+    HDprintf("\t Pages Read Ahead: %u\n", page_buf->prefetches[0]);
+    HDprintf("\t Read-Ahead Hits: %u\n", page_buf->prefetch_hits[0]);
+    if(page_buf->prefetches[0])
+        HDprintf("\t Read-Ahead Hit Rate = %f%%\n", ((double)page_buf->prefetch_hits[0]/page_buf->prefetches[0])*100);
     HDprintf("*****************\n\n");
 
     HDprintf("******* RAWDATA\n");
@@ -271,6 +303,10 @@ H5PB_print_stats(const H5PB_t *page_buf)
     HDprintf("\t Evictions: %u\n", page_buf->evictions[1]);
     HDprintf("\t Bypasses: %u\n", page_buf->bypasses[1]);
     HDprintf("\t Hit Rate = %f%%\n", ((double)page_buf->hits[1]/(page_buf->accesses[1]-page_buf->bypasses[0]))*100);
+    HDprintf("\t Pages Read Ahead: %u\n", page_buf->prefetches[1]);
+    HDprintf("\t Read-Ahead Hits: %u\n", page_buf->prefetch_hits[1]);
+    if(page_buf->prefetches[1])
+        HDprintf("\t Read-Ahead Hit Rate = %f%%\n", ((double)page_buf->prefetch_hits[1]/page_buf->prefetches[1])*100);
     HDprintf("*****************\n\n");
 
     FUNC_LEAVE_NOAPI(SUCCEED)
@@ -289,7 +325,8 @@ H5PB_print_stats(const H5PB_t *page_buf)
  *-------------------------------------------------------------------------
  */
 herr_t
-H5PB_create(H5F_shared_t *f_sh, size_t size, unsigned page_buf_min_meta_perc, unsigned page_buf_min_raw_perc)
+H5PB_create(H5F_shared_t *f_sh, size_t size, unsigned page_buf_min_meta_perc, unsigned page_buf_min_raw_perc,
+    unsigned page_buf_read_ahead)
 {
     H5PB_t *page_buf = NULL;
     herr_t ret_value = SUCCEED;    /* Return value */
@@ -327,6 +364,11 @@ H5PB_create(H5F_shared_t *f_sh, size_t size, unsigned page_buf_min_meta_perc, un
     page_buf->min_meta_count = (unsigned)((size * page_buf_min_meta_perc) / (f_sh->fs_page_size * 100));
     page_buf->min_raw_count = (unsigned)((size * page_buf_min_raw_perc) / (f_sh->fs_page_size * 100));
 
+    /* Set up read-ahead */
+    page_buf->ra_max_pages = page_buf_read_ahead;
+    page_buf->ra_next[0] = HADDR_UNDEF;
+    page_buf->ra_next[1] = HADDR_UNDEF;
+
     if(NULL == (page_buf->slist_ptr = H5SL_create(H5SL_TYPE_HADDR, NULL)))
         HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTCREATE, FAIL, "can't create skip list")
     if(NULL == (page_buf->mf_slist_ptr = H5SL_create(H5SL_TYPE_HADDR, NULL)))
@@ -506,6 +548,9 @@ H5PB_dest(H5F_shared_t *f_sh)
         if(H5FL_fac_term(page_buf->page_fac) < 0)
             HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTRELEASE, FAIL, "can't destroy page buffer page factory")
 
+        /* Release the read-ahead buffer */
+        page_buf->ra_buf = H5MM_xfree(page_buf->ra_buf);
+
         f_sh->page_buf = H5FL_FREE(H5PB_t, page_buf);
     } /* end if */
 
@@ -878,14 +923,8 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
                 /* copy the requested data from the page into the input buffer */
                 H5MM_memcpy((uint8_t *)buf + buf_offset, (uint8_t *)page_entry->page_buf_ptr + offset, access_size);
 
-                /* Update LRU */
-                H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
-
-                /* Update statistics */
-                if(type == H5FD_MEM_DRAW)
-                    page_buf->hits[1]++;
-                else
-                    page_buf->hits[0]++;
+                /* Update LRU and statistics */
+                H5PB__hit_entry(page_buf, page_entry, type);
             } /* end if */
             /* if not found */
             else {
@@ -934,9 +973,18 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
                 if(search_addr + page_size > eoa)
                     page_size = (size_t)(eoa - search_addr);
 
-                /* Read page from VFD */
-                if(H5FD_read(file, type, search_addr, page_size, new_page_buf) < 0)
-                    HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver read request failed")
+                /* Read page from VFD, along with the pages after it when
+                 * reading ahead.  (Pages are only read ahead in files that
+                 * aren't being written, where every page below the EOA is
+                 * on disk.)
+                 */
+                if(page_buf->ra_max_pages > 0 && !bypass_pb && !(H5F_ACC_RDWR & H5F_SHARED_INTENT(f_sh))) {
+                    if(H5PB__read_ahead(f_sh, page_buf, type, search_addr, page_size, eoa, new_page_buf) < 0)
+                        HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver read request failed")
+                } /* end if */
+                else
+                    if(H5FD_read(file, type, search_addr, page_size, new_page_buf) < 0)
+                        HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver read request failed")
 
                 /* Copy the requested data from the page into the input buffer */
                 offset = (0 == i ? addr - search_addr : 0);
@@ -969,6 +1017,219 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5PB_read() */
 
+
+#ifdef H5_HAVE_THREADSAFE
+/*-------------------------------------------------------------------------
+ * Function:	H5PB_read_concurrent
+ *
+ * Purpose:	Reads COUNT blocks of raw data through the page buffer, as
+ *		H5PB_read() does for one block, letting go of the library's
+ *		lock while the file driver reads the pages that aren't in
+ *		the page buffer (see H5F_shared_block_read_concurrent()).
+ *
+ *		The parts of blocks in pages that are in the page buffer are
+ *		copied out of them before the lock is let go.  Missing pages
+ *		are read into pages no other thread can see, along with the
+ *		blocks too large for the page buffer, with one call to the
+ *		driver.  Once the lock is taken back, the pages read are put
+ *		in the page buffer, unless another thread put them there in
+ *		the meantime.  The page buffer itself is only ever used with
+ *		the lock held.
+ *
+ *		The file must be open read-only, so that there are no dirty
+ *		pages to bring into the blocks read directly.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_read_concurrent(H5F_shared_t *f_sh, H5FD_mem_t type, uint32_t count,
+    const haddr_t addrs[], const size_t sizes[], void *bufs[]/*out*/)
+{
+    H5PB_t *page_buf;                   /* Page buffering info for this file */
+    H5PB_entry_t *page_entry;           /* Pointer to a page entry */
+    H5PB_piece_t *pieces = NULL;        /* Pieces of blocks in the pages read */
+    haddr_t *rd_addrs = NULL;           /* Addresses of the reads */
+    size_t *rd_sizes = NULL;            /* Sizes of the reads */
+    void **rd_bufs = NULL;              /* Buffers for the reads */
+    hbool_t *rd_pages = NULL;           /* Whether each read is of a page */
+    uint32_t nreads = 0;                /* Number of reads */
+    size_t npieces = 0;                 /* Number of pieces */
+    haddr_t eoa;                        /* End of the file's address space */
+    herr_t status;                      /* Status of the read */
+    size_t v;                           /* Local index variable */
+    uint32_t u;                         /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(f_sh->page_buf);
+    HDassert(H5FD_MEM_DRAW == type);
+    HDassert(!(H5F_ACC_RDWR & H5F_SHARED_INTENT(f_sh)));
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    /* Get pointer to page buffer info for this file */
+    page_buf = f_sh->page_buf;
+
+    if(0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    /* A block is either read directly or lies in at most two pages */
+    if(NULL == (rd_addrs = (haddr_t *)H5MM_malloc(2 * count * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "memory allocation failed for read addresses")
+    if(NULL == (rd_sizes = (size_t *)H5MM_malloc(2 * count * sizeof(size_t))))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "memory allocation failed for read sizes")
+    if(NULL == (rd_bufs = (void **)H5MM_malloc(2 * count * sizeof(void *))))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "memory allocation failed for read buffers")
+    if(NULL == (rd_pages = (hbool_t *)H5MM_malloc(2 * count * sizeof(hbool_t))))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "memory allocation failed for read flags")
+    if(NULL == (pieces = (H5PB_piece_t *)H5MM_malloc(2 * count * sizeof(H5PB_piece_t))))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "memory allocation failed for block pieces")
+
+    /* Retrieve the 'eoa' for the file */
+    if(HADDR_UNDEF == (eoa = H5F_shared_get_eoa(f_sh, type)))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "driver get_eoa request failed")
+
+    for(u = 0; u < count; u++) {
+        /* Update statistics */
+        page_buf->accesses[1]++;
+
+        /* Blocks as large as a page bypass the page buffer */
+        if(sizes[u] >= page_buf->page_size) {
+            page_buf->bypasses[1]++;
+
+            rd_addrs[nreads] = addrs[u];
+            rd_sizes[nreads] = sizes[u];
+            rd_bufs[nreads] = bufs[u];
+            rd_pages[nreads] = FALSE;
+            nreads++;
+        } /* end if */
+        else {
+            haddr_t end_addr = addrs[u] + sizes[u];     /* End of the block */
+            haddr_t page_addr;                          /* Address of the current page */
+            size_t buf_offset = 0;                      /* Offset of the current piece in the block */
+
+            for(page_addr = (addrs[u] / page_buf->page_size) * page_buf->page_size;
+                    H5F_addr_lt(page_addr, end_addr); page_addr += page_buf->page_size) {
+                haddr_t piece_addr = MAX(addrs[u], page_addr);
+                size_t offset = (size_t)(piece_addr - page_addr);
+                size_t len = (size_t)(MIN(end_addr, page_addr + page_buf->page_size) - piece_addr);
+
+                /* Copy the piece out of the page if it's in the page buffer */
+                if(NULL != (page_entry = (H5PB_entry_t *)H5SL_search(page_buf->slist_ptr, (void *)(&page_addr)))) {
+                    H5MM_memcpy((uint8_t *)bufs[u] + buf_offset, (uint8_t *)page_entry->page_buf_ptr + offset, len);
+
+                    /* Update LRU and statistics */
+                    H5PB__hit_entry(page_buf, page_entry, type);
+                } /* end if */
+                else {
+                    /* Read the page, unless it's already being read for
+                     * the piece before this one
+                     */
+                    if(0 == nreads || !rd_pages[nreads - 1] || !H5F_addr_eq(rd_addrs[nreads - 1], page_addr)) {
+                        /* If the entire page falls outside the EOA, then fail */
+                        if(page_addr > eoa)
+                            HGOTO_ERROR(H5E_PAGEBUF, H5E_BADVALUE, FAIL, "reading an entire page that is outside the file EOA")
+
+                        if(NULL == (rd_bufs[nreads] = H5FL_FAC_MALLOC(page_buf->page_fac)))
+                            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "memory allocation failed for page buffer entry")
+                        rd_addrs[nreads] = page_addr;
+                        rd_pages[nreads] = TRUE;
+
+                        /* Don't read beyond the EOA */
+                        if(page_addr + page_buf->page_size > eoa)
+                            rd_sizes[nreads] = (size_t)(eoa - page_addr);
+                        else
+                            rd_sizes[nreads] = page_buf->page_size;
+                        nreads++;
+
+                        /* Update statistics */
+                        page_buf->misses[1]++;
+                    } /* end if */
+                    else
+                        page_buf->hits[1]++;
+
+                    pieces[npieces].buf = (uint8_t *)bufs[u] + buf_offset;
+                    pieces[npieces].read = nreads - 1;
+                    pieces[npieces].offset = offset;
+                    pieces[npieces].len = len;
+                    npieces++;
+                } /* end else */
+
+                buf_offset += len;
+            } /* end for */
+        } /* end else */
+    } /* end for */
+
+    /* Read the missing pages and the large blocks without the library's lock */
+    if(nreads > 0) {
+        if(H5TS_api_lock_release() != 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTUNLOCK, FAIL, "can't release API lock")
+        status = H5FD_read_vector(f_sh->lf, type, nreads, rd_addrs, rd_sizes, rd_bufs);
+        if(H5TS_api_lock_reacquire() != 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTLOCK, FAIL, "can't reacquire API lock")
+        if(status < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver vector read request failed")
+    } /* end if */
+
+    /* Copy the pieces out of the pages read */
+    for(v = 0; v < npieces; v++)
+        H5MM_memcpy(pieces[v].buf, (uint8_t *)rd_bufs[pieces[v].read] + pieces[v].offset, pieces[v].len);
+
+    /* Put the pages read in the page buffer */
+    for(u = 0; u < nreads; u++) {
+        if(!rd_pages[u])
+            continue;
+
+        /* Skip pages another thread read and inserted in the meantime */
+        if(NULL != H5SL_search(page_buf->slist_ptr, (void *)(&rd_addrs[u])))
+            continue;
+
+        /* Make space for the new entry */
+        if((H5SL_count(page_buf->slist_ptr) * page_buf->page_size) >= page_buf->max_size) {
+            htri_t can_make_space;
+
+            if((can_make_space = H5PB__make_space(f_sh, page_buf, type)) < 0)
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_NOSPACE, FAIL, "make space in Page buffer Failed")
+            if(0 == can_make_space)
+                continue;
+        } /* end if */
+
+        /* Create the new PB entry */
+        if(NULL == (page_entry = H5FL_CALLOC(H5PB_entry_t)))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_NOSPACE, FAIL, "memory allocation failed")
+
+        page_entry->page_buf_ptr = rd_bufs[u];
+        page_entry->addr = rd_addrs[u];
+        page_entry->type = (H5F_mem_page_t)type;
+        page_entry->is_dirty = FALSE;
+
+        /* Insert page into PB */
+        if(H5PB__insert_entry(page_buf, page_entry) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTSET, FAIL, "error inserting new page in page buffer")
+        rd_bufs[u] = NULL;
+    } /* end for */
+
+done:
+    /* Release the pages that didn't go in the page buffer */
+    if(rd_bufs)
+        for(u = 0; u < nreads; u++)
+            if(rd_pages[u] && rd_bufs[u])
+                rd_bufs[u] = H5FL_FAC_FREE(page_buf->page_fac, rd_bufs[u]);
+
+    H5MM_xfree(pieces);
+    H5MM_xfree(rd_pages);
+    H5MM_xfree(rd_bufs);
+    H5MM_xfree(rd_sizes);
+    H5MM_xfree(rd_addrs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB_read_concurrent() */
+#endif /* H5_HAVE_THREADSAFE */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5PB_write
@@ -1359,6 +1620,58 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5PB__insert_entry() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__hit_entry()
+ *
+ * Purpose:	Moves a page that an access of type TYPE was satisfied from
+ *		to the top of the LRU list and counts the hit.  If the page
+ *		was read ahead and this is the first access to it, counts
+ *		that too and gives the page the type of this access (it was
+ *		given the type of the access it was read ahead of).
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5PB__hit_entry(H5PB_t *page_buf, H5PB_entry_t *page_entry, H5FD_mem_t type)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(page_buf);
+    HDassert(page_entry);
+
+    /* Update LRU */
+    H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
+
+    /* Update statistics */
+    if(type == H5FD_MEM_DRAW)
+        page_buf->hits[1]++;
+    else
+        page_buf->hits[0]++;
+
+    if(page_entry->prefetched) {
+        hbool_t was_raw = (H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type);
+
+        if(was_raw && H5FD_MEM_DRAW != type) {
+            page_buf->raw_count--;
+            page_buf->meta_count++;
+        } /* end if */
+        else if(!was_raw && H5FD_MEM_DRAW == type) {
+            page_buf->meta_count--;
+            page_buf->raw_count++;
+        } /* end if */
+        page_entry->type = (H5F_mem_page_t)type;
+        page_entry->prefetched = FALSE;
+
+        page_buf->prefetch_hits[was_raw ? 1 : 0]++;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5PB__hit_entry() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5PB__make_space()
@@ -1449,6 +1762,15 @@ H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type)
     else
         page_buf->evictions[0]++;
 
+    /* A page read ahead that was never used means the read-ahead window
+     * is too large for the access pattern, so shrink it.
+     */
+    if(page_entry->prefetched) {
+        unsigned idx = (H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type) ? 1 : 0;
+
+        page_buf->ra_window[idx] /= 2;
+    } /* end if */
+
     /* Release page */
     page_entry->page_buf_ptr = H5FL_FAC_FREE(page_buf->page_fac, page_entry->page_buf_ptr);
     page_entry = H5FL_FREE(H5PB_entry_t, page_entry);
@@ -1513,3 +1835,130 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5PB__write_entry() */
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__read_ahead()
+ *
+ * Purpose: Read a page that missed in the page buffer into PAGE, and if
+ *          the miss continues a run of sequential or clustered misses,
+ *          the pages after it in the same driver read, inserting those
+ *          into the page buffer.
+ *
+ *          A miss is taken as sequential when it is at or a little past
+ *          the page after the last pages read for the same class of
+ *          data (metadata or raw data).  Each sequential miss doubles
+ *          the number of pages read ahead, up to the configured limit or
+ *          a quarter of the page buffer, whichever is smaller; any other
+ *          miss halves it, as does evicting a page read ahead before it
+ *          was used.  Read-ahead stops at the EOA and at the first page
+ *          already in the page buffer.
+ *
+ *          PAGE_SIZE is the number of bytes of the missed page that are
+ *          below EOA, so it is less than a full page for the last page.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__read_ahead(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t type,
+    haddr_t page_addr, size_t page_size, haddr_t eoa, void *page/*out*/)
+{
+    unsigned idx = (H5FD_MEM_DRAW == type) ? 1 : 0;   /* Index of the class of data read */
+    unsigned max_window;            /* Largest read-ahead window allowed */
+    unsigned nahead = 0;            /* # of pages to read ahead */
+    size_t read_size;               /* # of bytes to read */
+    unsigned u;                     /* Local index variable */
+    herr_t ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(f_sh);
+    HDassert(page_buf);
+    HDassert(page_buf->ra_max_pages > 0);
+    HDassert(page);
+
+    /* Don't let the pages read ahead take over the page buffer */
+    max_window = (unsigned)MIN(page_buf->ra_max_pages, (page_buf->max_size / page_buf->page_size) / 4);
+
+    /* Adjust the window for the pattern of misses */
+    if(H5F_addr_defined(page_buf->ra_next[idx]) && H5F_addr_ge(page_addr, page_buf->ra_next[idx])
+            && (page_addr - page_buf->ra_next[idx]) / page_buf->page_size <= MAX(page_buf->ra_window[idx], 1))
+        page_buf->ra_window[idx] = MIN(page_buf->ra_window[idx] > 0 ? 2 * page_buf->ra_window[idx] : 2, max_window);
+    else
+        page_buf->ra_window[idx] /= 2;
+
+    /* Count the pages to read ahead, making space for them */
+    while(nahead < page_buf->ra_window[idx]) {
+        haddr_t next_addr = page_addr + ((hsize_t)(nahead + 1) * page_buf->page_size);
+
+        /* Stop at the EOA or at a page already in the page buffer */
+        if(H5F_addr_ge(next_addr, eoa) || NULL != H5SL_search(page_buf->slist_ptr, &next_addr))
+            break;
+
+        /* Make space for the page, leaving space for the missed page */
+        if(((H5SL_count(page_buf->slist_ptr) + 1) * page_buf->page_size) >= page_buf->max_size) {
+            htri_t can_make_space;
+
+            if((can_make_space = H5PB__make_space(f_sh, page_buf, type)) < 0)
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_NOSPACE, FAIL, "make space in Page buffer Failed")
+            if(0 == can_make_space)
+                break;
+        } /* end if */
+
+        nahead++;
+    } /* end while */
+
+    /* Read the missed page by itself when there are no pages to read ahead */
+    if(0 == nahead) {
+        if(H5FD_read(f_sh->lf, type, page_addr, page_size, page) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver read request failed")
+    } /* end if */
+    else {
+        /* Allocate the buffer for reading runs of pages */
+        if(NULL == page_buf->ra_buf)
+            if(NULL == (page_buf->ra_buf = H5MM_malloc(((size_t)max_window + 1) * page_buf->page_size)))
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "memory allocation failed for read-ahead buffer")
+        HDassert(nahead <= max_window);
+
+        /* Read the missed page and the pages after it, up to the EOA */
+        read_size = (size_t)MIN((hsize_t)(nahead + 1) * page_buf->page_size, eoa - page_addr);
+        if(H5FD_read(f_sh->lf, type, page_addr, read_size, page_buf->ra_buf) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver read request failed")
+        H5MM_memcpy(page, page_buf->ra_buf, page_size);
+
+        /* Put the pages read ahead into the page buffer */
+        for(u = 1; u <= nahead; u++) {
+            H5PB_entry_t *page_entry;   /* Entry for page read ahead */
+            void *new_page_buf;         /* Buffer for page read ahead */
+            size_t offset = u * page_buf->page_size;    /* Offset of page in buffer read */
+
+            if(NULL == (new_page_buf = H5FL_FAC_MALLOC(page_buf->page_fac)))
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "memory allocation failed for page buffer entry")
+            H5MM_memcpy(new_page_buf, (uint8_t *)page_buf->ra_buf + offset, MIN(page_buf->page_size, read_size - offset));
+
+            if(NULL == (page_entry = H5FL_CALLOC(H5PB_entry_t))) {
+                new_page_buf = H5FL_FAC_FREE(page_buf->page_fac, new_page_buf);
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_NOSPACE, FAIL, "memory allocation failed")
+            } /* end if */
+            page_entry->page_buf_ptr = new_page_buf;
+            page_entry->addr = page_addr + offset;
+            page_entry->type = (H5F_mem_page_t)type;
+            page_entry->is_dirty = FALSE;
+            page_entry->prefetched = TRUE;
+
+            if(H5PB__insert_entry(page_buf, page_entry) < 0)
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTSET, FAIL, "error inserting new page in page buffer")
+
+            page_buf->prefetches[idx]++;
+        } /* end for */
+    } /* end else */
+
+    /* Remember where the pages read end */
+    page_buf->ra_next[idx] = page_addr + ((hsize_t)(nahead + 1) * page_buf->page_size);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__read_ahead() */
@@ -37,6 +37,7 @@ typedef struct H5PB_entry_t {
     haddr_t	    addr;               /* Address of the page in the file */
     H5F_mem_page_t  type;               /* Type of the page entry (H5F_MEM_PAGE_RAW/META) */
     hbool_t         is_dirty;           /* Flag indicating whether the page has dirty data or not */
+    hbool_t         prefetched;         /* Flag indicating whether the page was read ahead and not accessed yet */
 
     /* Fields supporting replacement policies */
     struct H5PB_entry_t     *next;      /* next pointer in the LRU list */
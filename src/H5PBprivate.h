@@ -67,12 +67,20 @@ typedef struct H5PB_t {
 
     H5FL_fac_head_t     *page_fac;           /* Factory for allocating pages */
 
+    /* Read-ahead (index 0 for metadata, 1 for raw data) */
+    unsigned            ra_max_pages;       /* Maximum # of pages to read ahead (0 disables read-ahead) */
+    unsigned            ra_window[2];       /* # of pages to read ahead of the next sequential miss */
+    haddr_t             ra_next[2];         /* Address of the page following the last pages read from the file */
+    void                *ra_buf;            /* Buffer for reading runs of pages, ra_max_pages + 1 pages long */
+
     /* Statistics */
     unsigned            accesses[2];
     unsigned            hits[2];
     unsigned            misses[2];
     unsigned            evictions[2];
     unsigned            bypasses[2];
+    unsigned            prefetches[2];      /* # of pages read ahead */
+    unsigned            prefetch_hits[2];   /* # of pages read ahead that were then accessed */
 } H5PB_t;
 
 /*****************************/
@@ -85,7 +93,8 @@ typedef struct H5PB_t {
 /***************************************/
 
 /* General routines */
-H5_DLL herr_t H5PB_create(H5F_shared_t *f_sh, size_t page_buffer_size, unsigned page_buf_min_meta_perc, unsigned page_buf_min_raw_perc);
+H5_DLL herr_t H5PB_create(H5F_shared_t *f_sh, size_t page_buffer_size, unsigned page_buf_min_meta_perc, unsigned page_buf_min_raw_perc,
+    unsigned page_buf_read_ahead);
 H5_DLL herr_t H5PB_flush(H5F_shared_t *f_sh);
 H5_DLL herr_t H5PB_dest(H5F_shared_t *f_sh);
 H5_DLL herr_t H5PB_add_new_page(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t page_addr);
@@ -93,11 +102,16 @@ H5_DLL herr_t H5PB_update_entry(H5PB_t *page_buf, haddr_t addr, size_t size, con
 H5_DLL herr_t H5PB_remove_entry(const H5F_shared_t *f_sh, haddr_t addr);
 H5_DLL herr_t H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *buf/*out*/);
 H5_DLL herr_t H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const void *buf);
+#ifdef H5_HAVE_THREADSAFE
+H5_DLL herr_t H5PB_read_concurrent(H5F_shared_t *f_sh, H5FD_mem_t type, uint32_t count,
+    const haddr_t addrs[], const size_t sizes[], void *bufs[]/*out*/);
+#endif /* H5_HAVE_THREADSAFE */
 
 /* Statistics routines */
 H5_DLL herr_t H5PB_reset_stats(H5PB_t *page_buf);
 H5_DLL herr_t H5PB_get_stats(const H5PB_t *page_buf, unsigned accesses[2],
-    unsigned hits[2], unsigned misses[2], unsigned evictions[2], unsigned bypasses[2]);
+    unsigned hits[2], unsigned misses[2], unsigned evictions[2], unsigned bypasses[2],
+    unsigned prefetches[2], unsigned prefetch_hits[2]);
 H5_DLL herr_t H5PB_print_stats(const H5PB_t *page_buf);
 
 #endif /* !_H5PBprivate_H */
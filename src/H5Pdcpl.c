@@ -3047,6 +3047,70 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pset_shuffle() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_bitshuffle
+ *
+ * Purpose:	Adds the bitshuffle filter (H5Z_FILTER_BITSHUFFLE) to a
+ *              dataset's filter pipeline.  The bits of the elements are
+ *              transposed in blocks of BLOCK_SIZE elements (a multiple of
+ *              8, or zero for a default of about 8 KiB), and each block is
+ *              then compressed with COMPRESSION: H5Z_BITSHUFFLE_COMP_NONE,
+ *              H5Z_BITSHUFFLE_COMP_LZ4 or H5Z_BITSHUFFLE_COMP_ZSTD (at the
+ *              default level).
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_bitshuffle(hid_t plist_id, unsigned block_size, unsigned compression)
+{
+    H5O_pline_t         pline;
+    H5P_genplist_t *plist;      /* Property list pointer */
+    unsigned cd_values[H5Z_BITSHUFFLE_USER_NPARMS];     /* Filter parameters */
+    herr_t ret_value=SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "iIuIu", plist_id, block_size, compression);
+
+    /* Check arguments */
+    if(TRUE != H5P_isa_class(plist_id, H5P_DATASET_CREATE))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset creation property list")
+    if(block_size % 8)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "block size must be a multiple of 8")
+    if(compression != H5Z_BITSHUFFLE_COMP_NONE && compression != H5Z_BITSHUFFLE_COMP_LZ4 && compression != H5Z_BITSHUFFLE_COMP_ZSTD)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid compression")
+#ifndef H5_HAVE_FILTER_LZ4
+    if(compression == H5Z_BITSHUFFLE_COMP_LZ4)
+        HGOTO_ERROR(H5E_PLINE, H5E_UNSUPPORTED, FAIL, "LZ4 compression is not available")
+#endif /* H5_HAVE_FILTER_LZ4 */
+#ifndef H5_HAVE_FILTER_ZSTD
+    if(compression == H5Z_BITSHUFFLE_COMP_ZSTD)
+        HGOTO_ERROR(H5E_PLINE, H5E_UNSUPPORTED, FAIL, "Zstandard compression is not available")
+#endif /* H5_HAVE_FILTER_ZSTD */
+
+    /* Get the plist structure */
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(plist_id)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set the parameters for the filter */
+    cd_values[0] = block_size;
+    cd_values[1] = compression;
+    cd_values[2] = H5Z_ZSTD_DEFAULT_LEVEL;
+
+    /* Add the filter */
+    if(H5P_peek(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get pipeline")
+    if(H5Z_append(&pline, H5Z_FILTER_BITSHUFFLE, H5Z_FLAG_OPTIONAL, (size_t)H5Z_BITSHUFFLE_USER_NPARMS, cd_values) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to add bitshuffle filter to pipeline")
+    if(H5P_poke(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to set pipeline")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_bitshuffle() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_nbit
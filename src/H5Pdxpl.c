@@ -152,6 +152,21 @@
 #define H5D_XFER_XFORM_COPY         H5P__dxfr_xform_copy
 #define H5D_XFER_XFORM_CMP          H5P__dxfr_xform_cmp
 #define H5D_XFER_XFORM_CLOSE        H5P__dxfr_xform_close
+/* Definitions for chunk filtering thread count property */
+#define H5D_XFER_FILTER_NTHREADS_SIZE   sizeof(unsigned)
+#define H5D_XFER_FILTER_NTHREADS_DEF    1
+#define H5D_XFER_FILTER_NTHREADS_ENC    H5P__encode_unsigned
+#define H5D_XFER_FILTER_NTHREADS_DEC    H5P__decode_unsigned
+/* Definitions for chunk prefetch property */
+#define H5D_XFER_CHUNK_PREFETCH_SIZE    sizeof(unsigned)
+#define H5D_XFER_CHUNK_PREFETCH_DEF     0
+#define H5D_XFER_CHUNK_PREFETCH_ENC     H5P__encode_unsigned
+#define H5D_XFER_CHUNK_PREFETCH_DEC     H5P__decode_unsigned
+/* Definitions for datatype conversion thread count property */
+#define H5D_XFER_CONV_NTHREADS_SIZE     sizeof(unsigned)
+#define H5D_XFER_CONV_NTHREADS_DEF      1
+#define H5D_XFER_CONV_NTHREADS_ENC      H5P__encode_unsigned
+#define H5D_XFER_CONV_NTHREADS_DEC      H5P__decode_unsigned
 
 
 /******************/
@@ -250,6 +265,9 @@ static const H5Z_EDC_t H5D_def_enable_edc_g = H5D_XFER_EDC_DEF;            /* De
 static const H5Z_cb_t H5D_def_filter_cb_g = H5D_XFER_FILTER_CB_DEF;        /* Default value for filter callback */
 static const H5T_conv_cb_t H5D_def_conv_cb_g = H5D_XFER_CONV_CB_DEF;       /* Default value for datatype conversion callback */
 static const void *H5D_def_xfer_xform_g = H5D_XFER_XFORM_DEF;          /* Default value for data transform */
+static const unsigned H5D_def_filter_nthreads_g = H5D_XFER_FILTER_NTHREADS_DEF; /* Default value for chunk filtering thread count */
+static const unsigned H5D_def_chunk_prefetch_g = H5D_XFER_CHUNK_PREFETCH_DEF; /* Default value for chunk prefetch */
+static const unsigned H5D_def_conv_nthreads_g = H5D_XFER_CONV_NTHREADS_DEF; /* Default value for datatype conversion thread count */
 
 
 /*-------------------------------------------------------------------------
@@ -400,6 +418,24 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
             H5D_XFER_XFORM_DEL, H5D_XFER_XFORM_COPY, H5D_XFER_XFORM_CMP, H5D_XFER_XFORM_CLOSE) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the chunk filtering thread count property */
+    if(H5P__register_real(pclass, H5D_XFER_FILTER_NTHREADS_NAME, H5D_XFER_FILTER_NTHREADS_SIZE, &H5D_def_filter_nthreads_g,
+            NULL, NULL, NULL, H5D_XFER_FILTER_NTHREADS_ENC, H5D_XFER_FILTER_NTHREADS_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the chunk prefetch property */
+    if(H5P__register_real(pclass, H5D_XFER_CHUNK_PREFETCH_NAME, H5D_XFER_CHUNK_PREFETCH_SIZE, &H5D_def_chunk_prefetch_g,
+            NULL, NULL, NULL, H5D_XFER_CHUNK_PREFETCH_ENC, H5D_XFER_CHUNK_PREFETCH_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the datatype conversion thread count property */
+    if(H5P__register_real(pclass, H5D_XFER_CONV_NTHREADS_NAME, H5D_XFER_CONV_NTHREADS_SIZE, &H5D_def_conv_nthreads_g,
+            NULL, NULL, NULL, H5D_XFER_CONV_NTHREADS_ENC, H5D_XFER_CONV_NTHREADS_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__dxfr_reg_prop() */
@@ -1726,6 +1762,235 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_hyper_vector_size() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_filter_nthreads
+ *
+ * Purpose:	Set the number of threads used to run the I/O filter
+ *              pipeline on independent chunks of a chunked dataset during
+ *              a read or write.  Chunks are still read from and written to
+ *              the file (and the chunk index is still updated) in order, on
+ *              the calling thread; only the filtering is spread over the
+ *              threads.
+ *
+ *              The default is 1, which filters each chunk on the calling
+ *              thread as it is accessed.  Values greater than 1 only use
+ *              additional threads when the library is built thread-safe.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_filter_nthreads(hid_t plist_id, unsigned nthreads)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, nthreads);
+
+    /* Check arguments */
+    if(nthreads < 1)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "number of threads must be at least 1")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if(H5P_set(plist, H5D_XFER_FILTER_NTHREADS_NAME, &nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_filter_nthreads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_filter_nthreads
+ *
+ * Purpose:	Reads the value previously set with H5Pset_filter_nthreads().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_filter_nthreads(hid_t plist_id, unsigned *nthreads/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, nthreads);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Return values */
+    if(nthreads)
+        if(H5P_get(plist, H5D_XFER_FILTER_NTHREADS_NAME, nthreads) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_filter_nthreads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_chunk_prefetch
+ *
+ * Purpose:	Set the number of chunks to read ahead when reading a
+ *              chunked dataset.  Chunks of the selection that aren't in
+ *              the chunk cache are looked up in the chunk index and read
+ *              from the file (in file address order) that many at a time,
+ *              while the chunks read previously are being run through the
+ *              I/O filter pipeline and copied to the application's buffer.
+ *
+ *              When more than one filter thread is set with
+ *              H5Pset_filter_nthreads, chunks read ahead are unfiltered in
+ *              the background by those threads.
+ *
+ *              The default is 0, which reads each chunk when it's needed.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_prefetch(hid_t plist_id, unsigned nchunks)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, nchunks);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if(H5P_set(plist, H5D_XFER_CHUNK_PREFETCH_NAME, &nchunks) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_prefetch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_chunk_prefetch
+ *
+ * Purpose:	Reads the value previously set with H5Pset_chunk_prefetch().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_prefetch(hid_t plist_id, unsigned *nchunks/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, nchunks);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Return values */
+    if(nchunks)
+        if(H5P_get(plist, H5D_XFER_CHUNK_PREFETCH_NAME, nchunks) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_prefetch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_conv_nthreads
+ *
+ * Purpose:	Set the number of threads used to convert the data between
+ *              the file's and the memory's datatypes during a read or
+ *              write.  Each buffer of data is split into runs of whole
+ *              elements, which are converted at the same time.  Only
+ *              the library's own conversions between integer,
+ *              floating-point and bitfield types are split; other
+ *              conversions, conversions with an exception callback set
+ *              with H5Pset_type_conv_cb and small buffers are converted
+ *              on the calling thread.
+ *
+ *              The default is 1, which converts the data on the calling
+ *              thread.  Values greater than 1 only use additional threads
+ *              when the library is built thread-safe.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_conv_nthreads(hid_t plist_id, unsigned nthreads)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, nthreads);
+
+    /* Check arguments */
+    if(nthreads < 1)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "number of threads must be at least 1")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if(H5P_set(plist, H5D_XFER_CONV_NTHREADS_NAME, &nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_conv_nthreads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_conv_nthreads
+ *
+ * Purpose:	Reads the value previously set with H5Pset_conv_nthreads().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_conv_nthreads(hid_t plist_id, unsigned *nthreads/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, nthreads);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Return values */
+    if(nthreads)
+        if(H5P_get(plist, H5D_XFER_CONV_NTHREADS_NAME, nthreads) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_conv_nthreads() */
+
 
 /*-------------------------------------------------------------------------
  * Function:       H5P__dxfr_io_xfer_mode_enc
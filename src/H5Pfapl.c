@@ -271,6 +271,30 @@
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEF            0
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_ENC            H5P__encode_unsigned
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEC            H5P__decode_unsigned
+/* Definition for the page buffer's read-ahead limit */
+#define H5F_ACS_PAGE_BUFFER_READ_AHEAD_SIZE             sizeof(unsigned)
+#define H5F_ACS_PAGE_BUFFER_READ_AHEAD_DEF              0
+#define H5F_ACS_PAGE_BUFFER_READ_AHEAD_ENC              H5P__encode_unsigned
+#define H5F_ACS_PAGE_BUFFER_READ_AHEAD_DEC              H5P__decode_unsigned
+/* Definition for the raw data chunk cache budget shared by a file's datasets */
+#define H5F_ACS_SHARED_CHUNK_CACHE_SIZE_SIZE    sizeof(size_t)
+#define H5F_ACS_SHARED_CHUNK_CACHE_SIZE_DEF     0
+#define H5F_ACS_SHARED_CHUNK_CACHE_SIZE_ENC     H5P__encode_size_t
+#define H5F_ACS_SHARED_CHUNK_CACHE_SIZE_DEC     H5P__decode_size_t
+/* Definition for whether raw data reads may run without the library's lock */
+#define H5F_ACS_CONCURRENT_READS_SIZE           sizeof(hbool_t)
+#define H5F_ACS_CONCURRENT_READS_DEF            FALSE
+#define H5F_ACS_CONCURRENT_READS_ENC            H5P__encode_hbool_t
+#define H5F_ACS_CONCURRENT_READS_DEC            H5P__decode_hbool_t
+/* Definitions for loading a metadata cache image */
+#define H5F_ACS_MDC_IMAGE_NTHREADS_SIZE         sizeof(unsigned)
+#define H5F_ACS_MDC_IMAGE_NTHREADS_DEF          1
+#define H5F_ACS_MDC_IMAGE_NTHREADS_ENC          H5P__encode_unsigned
+#define H5F_ACS_MDC_IMAGE_NTHREADS_DEC          H5P__decode_unsigned
+#define H5F_ACS_MDC_IMAGE_LAZY_LOAD_SIZE        sizeof(hbool_t)
+#define H5F_ACS_MDC_IMAGE_LAZY_LOAD_DEF         FALSE
+#define H5F_ACS_MDC_IMAGE_LAZY_LOAD_ENC         H5P__encode_hbool_t
+#define H5F_ACS_MDC_IMAGE_LAZY_LOAD_DEC         H5P__decode_hbool_t
 /* Definition for file VOL connector properties (ID, etc.) */
 #define H5F_ACS_VOL_CONN_SIZE                   sizeof(H5VL_connector_prop_t)
 #define H5F_ACS_VOL_CONN_DEF                    {H5_DEFAULT_VOL, NULL}
@@ -447,6 +471,11 @@ static const H5AC_cache_image_config_t H5F_def_mdc_initCacheImageCfg_g = H5F_ACS
 static const size_t H5F_def_page_buf_size_g = H5F_ACS_PAGE_BUFFER_SIZE_DEF;      /* Default page buffer size */
 static const unsigned H5F_def_page_buf_min_meta_perc_g = H5F_ACS_PAGE_BUFFER_MIN_META_PERC_DEF;      /* Default page buffer minimum metadata size */
 static const unsigned H5F_def_page_buf_min_raw_perc_g = H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEF;      /* Default page buffer mininum raw data size */
+static const unsigned H5F_def_page_buf_read_ahead_g = H5F_ACS_PAGE_BUFFER_READ_AHEAD_DEF;      /* Default page buffer read-ahead limit */
+static const size_t H5F_def_shared_rdcc_nbytes_g = H5F_ACS_SHARED_CHUNK_CACHE_SIZE_DEF;      /* Default shared raw data chunk cache budget */
+static const hbool_t H5F_def_concurrent_reads_g = H5F_ACS_CONCURRENT_READS_DEF;      /* Default setting for concurrent raw data reads */
+static const unsigned H5F_def_mdc_image_nthreads_g = H5F_ACS_MDC_IMAGE_NTHREADS_DEF;      /* Default # of threads decoding a metadata cache image */
+static const hbool_t H5F_def_mdc_image_lazy_load_g = H5F_ACS_MDC_IMAGE_LAZY_LOAD_DEF;      /* Default setting for lazy loading of a metadata cache image */
 
 
 /*-------------------------------------------------------------------------
@@ -698,6 +727,36 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the page buffer read-ahead limit */
+    if(H5P__register_real(pclass, H5F_ACS_PAGE_BUFFER_READ_AHEAD_NAME, H5F_ACS_PAGE_BUFFER_READ_AHEAD_SIZE, &H5F_def_page_buf_read_ahead_g,
+            NULL, NULL, NULL, H5F_ACS_PAGE_BUFFER_READ_AHEAD_ENC, H5F_ACS_PAGE_BUFFER_READ_AHEAD_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the byte budget of the shared raw data chunk cache */
+    if(H5P__register_real(pclass, H5F_ACS_SHARED_CHUNK_CACHE_SIZE_NAME, H5F_ACS_SHARED_CHUNK_CACHE_SIZE_SIZE, &H5F_def_shared_rdcc_nbytes_g,
+            NULL, NULL, NULL, H5F_ACS_SHARED_CHUNK_CACHE_SIZE_ENC, H5F_ACS_SHARED_CHUNK_CACHE_SIZE_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the concurrent raw data reads flag */
+    if(H5P__register_real(pclass, H5F_ACS_CONCURRENT_READS_NAME, H5F_ACS_CONCURRENT_READS_SIZE, &H5F_def_concurrent_reads_g,
+            NULL, NULL, NULL, H5F_ACS_CONCURRENT_READS_ENC, H5F_ACS_CONCURRENT_READS_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the # of threads decoding a metadata cache image */
+    if(H5P__register_real(pclass, H5F_ACS_MDC_IMAGE_NTHREADS_NAME, H5F_ACS_MDC_IMAGE_NTHREADS_SIZE, &H5F_def_mdc_image_nthreads_g,
+            NULL, NULL, NULL, H5F_ACS_MDC_IMAGE_NTHREADS_ENC, H5F_ACS_MDC_IMAGE_NTHREADS_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the metadata cache image lazy load flag */
+    if(H5P__register_real(pclass, H5F_ACS_MDC_IMAGE_LAZY_LOAD_NAME, H5F_ACS_MDC_IMAGE_LAZY_LOAD_SIZE, &H5F_def_mdc_image_lazy_load_g,
+            NULL, NULL, NULL, H5F_ACS_MDC_IMAGE_LAZY_LOAD_ENC, H5F_ACS_MDC_IMAGE_LAZY_LOAD_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the file VOL connector ID & info */
     /* (Note: this property should not have an encode/decode callback -QAK) */
     if(H5P__register_real(pclass, H5F_ACS_VOL_CONN_NAME, H5F_ACS_VOL_CONN_SIZE, &def_vol_prop,
@@ -5369,6 +5428,334 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_page_buffer_size() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_page_buffer_read_ahead
+ *
+ * Purpose:     Sets the maximum number of pages the page buffer reads
+ *              ahead of page accesses that it sees are sequential or
+ *              clustered.
+ *
+ *              When a page that is not in the page buffer is read soon
+ *              after the pages just before it, the pages following it
+ *              are read too, in the same driver read.  The number of
+ *              pages read ahead grows while the accesses keep moving
+ *              forward and shrinks when they don't, or when pages read
+ *              ahead are evicted without being used, and is never more
+ *              than MAX_PAGES or a quarter of the page buffer.  Pages
+ *              are only read ahead for files opened read-only.
+ *
+ *              A MAX_PAGES of zero (the default) disables read-ahead.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_page_buffer_read_ahead(hid_t plist_id, unsigned max_pages)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, max_pages);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set limit */
+    if(H5P_set(plist, H5F_ACS_PAGE_BUFFER_READ_AHEAD_NAME, &max_pages) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set page buffer read-ahead limit")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_page_buffer_read_ahead() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_page_buffer_read_ahead
+ *
+ * Purpose:     Retrieves the maximum number of pages the page buffer
+ *              reads ahead.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_page_buffer_read_ahead(hid_t plist_id, unsigned *max_pages/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, max_pages);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get limit */
+    if(max_pages)
+        if(H5P_get(plist, H5F_ACS_PAGE_BUFFER_READ_AHEAD_NAME, max_pages) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get page buffer read-ahead limit")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_page_buffer_read_ahead() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_shared_chunk_cache
+ *
+ * Purpose:     Sets the size of a raw data chunk cache budget that is
+ *              shared by all chunked datasets opened from the file.
+ *
+ *              When NBYTES is non-zero, a dataset whose access property
+ *              list leaves the chunk cache byte size at its default
+ *              (H5D_CHUNK_CACHE_NBYTES_DEFAULT) no longer gets a private
+ *              budget of rdcc_nbytes bytes; instead the chunks cached
+ *              for all such datasets count against NBYTES, and making
+ *              room for a chunk preempts chunks of the datasets that
+ *              were used least recently first.  The number of hash table
+ *              slots and the preemption policy of each dataset are still
+ *              set with H5Pset_cache / H5Pset_chunk_cache.
+ *
+ *              An NBYTES of zero (the default) gives every dataset its
+ *              own chunk cache, as before.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_shared_chunk_cache(hid_t plist_id, size_t nbytes)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", plist_id, nbytes);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set size */
+    if(H5P_set(plist, H5F_ACS_SHARED_CHUNK_CACHE_SIZE_NAME, &nbytes) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set shared chunk cache size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_shared_chunk_cache() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_shared_chunk_cache
+ *
+ * Purpose:     Retrieves the size of the raw data chunk cache budget
+ *              shared by the file's datasets.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_shared_chunk_cache(hid_t plist_id, size_t *nbytes/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, nbytes);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get size */
+    if(nbytes)
+        if(H5P_get(plist, H5F_ACS_SHARED_CHUNK_CACHE_SIZE_NAME, nbytes) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get shared chunk cache size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_shared_chunk_cache() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_concurrent_reads
+ *
+ * Purpose:     Sets whether raw data reads from the file may run in
+ *              several threads at once.
+ *
+ *              With a thread-safe build of the library, every API call
+ *              holds one global lock, so threads reading different files
+ *              normally take turns.  When CONCURRENT is TRUE, a file
+ *              opened read-only with a driver that allows it (the sec2
+ *              driver, on systems with pread()) lets go of the lock while
+ *              raw data is read straight into the application's or the
+ *              library's private buffers.  With the page buffer, the
+ *              lock is let go while the pages it's missing are read, and
+ *              cached pages are copied from with the lock held.  Opening
+ *              objects, metadata reads, the chunk cache and data sieve
+ *              buffers are still serialized.  The file and the datasets
+ *              being read must not be closed by one thread while another
+ *              reads them.
+ *
+ *              The setting has no effect for files opened read-write,
+ *              other drivers, or builds without thread-safety.  The
+ *              default is FALSE.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_concurrent_reads(hid_t plist_id, hbool_t concurrent)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ib", plist_id, concurrent);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if(H5P_set(plist, H5F_ACS_CONCURRENT_READS_NAME, &concurrent) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set concurrent reads flag")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_concurrent_reads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_concurrent_reads
+ *
+ * Purpose:     Retrieves whether raw data reads from the file may run in
+ *              several threads at once.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_concurrent_reads(hid_t plist_id, hbool_t *concurrent/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, concurrent);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if(concurrent)
+        if(H5P_get(plist, H5F_ACS_CONCURRENT_READS_NAME, concurrent) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get concurrent reads flag")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_concurrent_reads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_mdc_image_load
+ *
+ * Purpose:     Sets how a metadata cache image stored in the file (see
+ *              H5Pset_mdc_image_config()) is loaded when the file is
+ *              opened.
+ *
+ *              NTHREADS is the number of threads that decode the entries
+ *              of the image and verify its checksum.  Only inserting the
+ *              entries in the cache is done by one thread.  More than
+ *              one thread is only used with thread-safe builds of the
+ *              library, and for images with many entries.
+ *
+ *              When LAZY is TRUE and the file is opened read-only, clean
+ *              entries of the image that aren't in any flush dependency
+ *              are left in the image, and only inserted in the cache
+ *              when they are first used.  The image is then kept in
+ *              memory until the last of them is inserted, or the file
+ *              is closed.
+ *
+ *              The defaults are one thread, and FALSE.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_mdc_image_load(hid_t plist_id, unsigned nthreads, hbool_t lazy)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "iIub", plist_id, nthreads, lazy);
+
+    /* Check argument */
+    if(0 == nthreads)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "# of threads must be positive")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set values */
+    if(H5P_set(plist, H5F_ACS_MDC_IMAGE_NTHREADS_NAME, &nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set # of threads for metadata cache image")
+    if(H5P_set(plist, H5F_ACS_MDC_IMAGE_LAZY_LOAD_NAME, &lazy) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set metadata cache image lazy load flag")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_mdc_image_load() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_mdc_image_load
+ *
+ * Purpose:     Retrieves how a metadata cache image stored in the file
+ *              is loaded when the file is opened.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_mdc_image_load(hid_t plist_id, unsigned *nthreads/*out*/, hbool_t *lazy/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ixx", plist_id, nthreads, lazy);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get values */
+    if(nthreads)
+        if(H5P_get(plist, H5F_ACS_MDC_IMAGE_NTHREADS_NAME, nthreads) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get # of threads for metadata cache image")
+    if(lazy)
+        if(H5P_get(plist, H5F_ACS_MDC_IMAGE_LAZY_LOAD_NAME, lazy) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get metadata cache image lazy load flag")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_mdc_image_load() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5P_set_vol
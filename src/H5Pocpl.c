@@ -102,6 +102,8 @@ static herr_t H5P__ocrt_pipeline_close(const char *name, size_t size, void *valu
 /* Local routines */
 static herr_t H5P__set_filter(H5P_genplist_t *plist, H5Z_filter_t filter,
     unsigned int flags, size_t cd_nelmts, const unsigned int cd_values[/*cd_nelmts*/]);
+static herr_t H5P__set_zstd(hid_t plist_id, int level, const unsigned char *dict,
+    size_t dict_size);
 
 /*********************/
 /* Package Variables */
@@ -1239,6 +1241,184 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pset_deflate() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_lz4
+ *
+ * Purpose:     Adds the LZ4 compression filter (H5Z_FILTER_LZ4) to a
+ *              dataset or group link filter pipeline.  The data is
+ *              compressed in blocks of BLOCK_SIZE bytes, or in blocks of
+ *              H5Z_LZ4_DEFAULT_BLOCK_SIZE bytes if BLOCK_SIZE is zero.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_lz4(hid_t plist_id, unsigned block_size)
+{
+    H5P_genplist_t  *plist;                 /* Property list */
+    H5O_pline_t     pline;                  /* Filter pipeline */
+    herr_t          ret_value = SUCCEED;    /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, block_size);
+
+    /* Check arguments */
+    if(block_size > H5Z_LZ4_DEFAULT_BLOCK_SIZE)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid lz4 block size")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_OBJECT_CREATE)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get the pipeline property to append to */
+    if(H5P_peek(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get pipeline")
+
+    /* Add the filter */
+    if(H5Z_append(&pline, H5Z_FILTER_LZ4, H5Z_FLAG_OPTIONAL, (size_t)1, &block_size) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to add lz4 filter to pipeline")
+
+    /* Put the I/O pipeline information back into the property list */
+    if(H5P_poke(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set pipeline")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_lz4() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_zstd
+ *
+ * Purpose:     Adds the Zstandard compression filter (H5Z_FILTER_ZSTD) to
+ *              a dataset or group link filter pipeline, with compression
+ *              level LEVEL.  Levels go from H5Z_ZSTD_MIN_LEVEL (fastest) up
+ *              to H5Z_ZSTD_MAX_LEVEL (best compression), and zero selects
+ *              the library's default level.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_zstd(hid_t plist_id, int level)
+{
+    herr_t          ret_value = SUCCEED;    /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIs", plist_id, level);
+
+    if(H5P__set_zstd(plist_id, level, NULL, (size_t)0) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to add zstd filter to pipeline")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_zstd() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_zstd_dict
+ *
+ * Purpose:     Adds the Zstandard compression filter (H5Z_FILTER_ZSTD) to
+ *              a dataset or group link filter pipeline, like H5Pset_zstd,
+ *              compressing with the DICT_SIZE byte dictionary DICT (e.g.
+ *              one made with "zstd --train").  The dictionary is stored in
+ *              the filter's parameters, so it is limited to
+ *              H5Z_ZSTD_MAX_DICT_SIZE bytes.
+ *
+ *              Data compressed with a dictionary can only be read by
+ *              versions of the library that have this function, not by
+ *              the Zstandard filter plugin.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_zstd_dict(hid_t plist_id, int level, const void *dict, size_t dict_size)
+{
+    herr_t          ret_value = SUCCEED;    /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iIs*xz", plist_id, level, dict, dict_size);
+
+    /* Check arguments */
+    if(NULL == dict)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no zstd dictionary")
+    if(0 == dict_size || dict_size > H5Z_ZSTD_MAX_DICT_SIZE)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid zstd dictionary size")
+
+    if(H5P__set_zstd(plist_id, level, (const unsigned char *)dict, dict_size) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to add zstd filter to pipeline")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_zstd_dict() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5P__set_zstd
+ *
+ * Purpose:     Adds the Zstandard compression filter to a pipeline, with an
+ *              optional dictionary packed into the filter's parameters.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__set_zstd(hid_t plist_id, int level, const unsigned char *dict, size_t dict_size)
+{
+    H5P_genplist_t  *plist;                 /* Property list */
+    H5O_pline_t     pline;                  /* Filter pipeline */
+    unsigned        *cd_values = NULL;      /* Filter parameters */
+    size_t          cd_nelmts;              /* Number of filter parameters */
+    size_t          u;                      /* Local index variable */
+    herr_t          ret_value = SUCCEED;    /* return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check arguments */
+    if(level < H5Z_ZSTD_MIN_LEVEL || level > H5Z_ZSTD_MAX_LEVEL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid zstd compression level")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_OBJECT_CREATE)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set up the filter parameters: the level, then the dictionary's size
+     * and its bytes, packed into the parameters in little-endian order */
+    cd_nelmts = dict ? H5Z_ZSTD_DICT_NPARMS(dict_size) : 1;
+    if(NULL == (cd_values = (unsigned *)H5MM_calloc(cd_nelmts * sizeof(unsigned))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for zstd parameters")
+    cd_values[H5Z_ZSTD_PARM_LEVEL] = (unsigned)level;
+    if(dict) {
+        cd_values[H5Z_ZSTD_PARM_DICT_SIZE] = (unsigned)dict_size;
+        for(u = 0; u < dict_size; u++)
+            cd_values[H5Z_ZSTD_PARM_DICT + (u / 4)] |= (unsigned)dict[u] << (8 * (u % 4));
+    } /* end if */
+
+    /* Get the pipeline property to append to */
+    if(H5P_peek(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get pipeline")
+
+    /* Add the filter */
+    if(H5Z_append(&pline, H5Z_FILTER_ZSTD, H5Z_FLAG_OPTIONAL, cd_nelmts, cd_values) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to add zstd filter to pipeline")
+
+    /* Put the I/O pipeline information back into the property list */
+    if(H5P_poke(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set pipeline")
+
+done:
+    if(cd_values)
+        H5MM_xfree(cd_values);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5P__set_zstd() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_fletcher32
@@ -297,6 +297,10 @@ H5_DLL herr_t H5Pget_filter_by_id2(hid_t plist_id, H5Z_filter_t id,
 H5_DLL htri_t H5Pall_filters_avail(hid_t plist_id);
 H5_DLL herr_t H5Premove_filter(hid_t plist_id, H5Z_filter_t filter);
 H5_DLL herr_t H5Pset_deflate(hid_t plist_id, unsigned aggression);
+H5_DLL herr_t H5Pset_lz4(hid_t plist_id, unsigned block_size);
+H5_DLL herr_t H5Pset_zstd(hid_t plist_id, int level);
+H5_DLL herr_t H5Pset_zstd_dict(hid_t plist_id, int level, const void *dict,
+    size_t dict_size);
 H5_DLL herr_t H5Pset_fletcher32(hid_t plist_id);
 
 /* File creation property list (FCPL) routines */
@@ -392,6 +396,14 @@ H5_DLL herr_t H5Pset_mdc_image_config(hid_t plist_id, H5AC_cache_image_config_t
 H5_DLL herr_t H5Pget_mdc_image_config(hid_t plist_id, H5AC_cache_image_config_t *config_ptr /*out*/);
 H5_DLL herr_t H5Pset_page_buffer_size(hid_t plist_id, size_t buf_size, unsigned min_meta_per, unsigned min_raw_per);
 H5_DLL herr_t H5Pget_page_buffer_size(hid_t plist_id, size_t *buf_size, unsigned *min_meta_per, unsigned *min_raw_per);
+H5_DLL herr_t H5Pset_page_buffer_read_ahead(hid_t plist_id, unsigned max_pages);
+H5_DLL herr_t H5Pget_page_buffer_read_ahead(hid_t plist_id, unsigned *max_pages/*out*/);
+H5_DLL herr_t H5Pset_shared_chunk_cache(hid_t plist_id, size_t nbytes);
+H5_DLL herr_t H5Pget_shared_chunk_cache(hid_t plist_id, size_t *nbytes/*out*/);
+H5_DLL herr_t H5Pset_concurrent_reads(hid_t plist_id, hbool_t concurrent);
+H5_DLL herr_t H5Pget_concurrent_reads(hid_t plist_id, hbool_t *concurrent/*out*/);
+H5_DLL herr_t H5Pset_mdc_image_load(hid_t plist_id, unsigned nthreads, hbool_t lazy);
+H5_DLL herr_t H5Pget_mdc_image_load(hid_t plist_id, unsigned *nthreads/*out*/, hbool_t *lazy/*out*/);
 
 /* Dataset creation property list (DCPL) routines */
 H5_DLL herr_t H5Pset_layout(hid_t plist_id, H5D_layout_t layout);
@@ -417,6 +429,7 @@ H5_DLL herr_t H5Pget_external(hid_t plist_id, unsigned idx, size_t name_size,
           hsize_t *size/*out*/);
 H5_DLL herr_t H5Pset_szip(hid_t plist_id, unsigned options_mask, unsigned pixels_per_block);
 H5_DLL herr_t H5Pset_shuffle(hid_t plist_id);
+H5_DLL herr_t H5Pset_bitshuffle(hid_t plist_id, unsigned block_size, unsigned compression);
 H5_DLL herr_t H5Pset_nbit(hid_t plist_id);
 H5_DLL herr_t H5Pset_scaleoffset(hid_t plist_id, H5Z_SO_scale_type_t scale_type, int scale_factor);
 H5_DLL herr_t H5Pset_fill_value(hid_t plist_id, hid_t type_id,
@@ -441,6 +454,10 @@ H5_DLL herr_t H5Pget_chunk_cache(hid_t dapl_id,
        size_t *rdcc_nslots/*out*/,
        size_t *rdcc_nbytes/*out*/,
        double *rdcc_w0/*out*/);
+H5_DLL herr_t H5Pset_chunk_cache_policy(hid_t dapl_id,
+       H5D_chunk_cache_policy_t policy);
+H5_DLL herr_t H5Pget_chunk_cache_policy(hid_t dapl_id,
+       H5D_chunk_cache_policy_t *policy/*out*/);
 H5_DLL herr_t H5Pset_virtual_view(hid_t plist_id, H5D_vds_view_t view);
 H5_DLL herr_t H5Pget_virtual_view(hid_t plist_id, H5D_vds_view_t *view);
 H5_DLL herr_t H5Pset_virtual_printf_gap(hid_t plist_id, hsize_t gap_size);
@@ -485,6 +502,12 @@ H5_DLL herr_t H5Pset_hyper_vector_size(hid_t fapl_id, size_t size);
 H5_DLL herr_t H5Pget_hyper_vector_size(hid_t fapl_id, size_t *size/*out*/);
 H5_DLL herr_t H5Pset_type_conv_cb(hid_t dxpl_id, H5T_conv_except_func_t op, void* operate_data);
 H5_DLL herr_t H5Pget_type_conv_cb(hid_t dxpl_id, H5T_conv_except_func_t *op, void** operate_data);
+H5_DLL herr_t H5Pset_filter_nthreads(hid_t plist_id, unsigned nthreads);
+H5_DLL herr_t H5Pget_filter_nthreads(hid_t plist_id, unsigned *nthreads/*out*/);
+H5_DLL herr_t H5Pset_chunk_prefetch(hid_t plist_id, unsigned nchunks);
+H5_DLL herr_t H5Pget_chunk_prefetch(hid_t plist_id, unsigned *nchunks/*out*/);
+H5_DLL herr_t H5Pset_conv_nthreads(hid_t plist_id, unsigned nthreads);
+H5_DLL herr_t H5Pget_conv_nthreads(hid_t plist_id, unsigned *nthreads/*out*/);
 #ifdef H5_HAVE_PARALLEL
 H5_DLL herr_t H5Pget_mpio_actual_chunk_opt_mode(hid_t plist_id, H5D_mpio_actual_chunk_opt_mode_t *actual_chunk_opt_mode);
 H5_DLL herr_t H5Pget_mpio_actual_io_mode(hid_t plist_id, H5D_mpio_actual_io_mode_t *actual_io_mode);
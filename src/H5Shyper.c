@@ -75,6 +75,18 @@
     } while(0) /* end H5S_HYPER_PROJ_INT_ADD_SKIP() */
 
 
+/* Macro to get the last coordinate of a block in a dimension, for
+ * H5S__hyper_build_spans_helper() */
+#define H5S_HYPER_BLOCK_HIGH(UDATA, IDX, DIM)                   \
+    ((UDATA)->start[((IDX) * (UDATA)->rank) + (DIM)] +          \
+        ((UDATA)->block ? ((UDATA)->block[((IDX) * (UDATA)->rank) + (DIM)] - 1) : 0))
+
+/* Longest sequence list kept for an irregular hyperslab selection, and the
+ * size of the first buffer allocated for one */
+#define H5S_HYPER_SEQ_CACHE_MAX_SEQ     (32 * 1024)
+#define H5S_HYPER_SEQ_CACHE_INIT_SEQ    64
+
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -106,6 +118,42 @@ typedef struct {
 #error H5S_MAX_RANK too large for ps_clean_bitmap field in H5S_hyper_project_intersect_ud_t struct
 #endif
 
+/* A block's position in the dimension being swept by
+ * H5S__hyper_build_spans_helper() */
+typedef struct {
+    hsize_t low;            /* Block's first coordinate in the dimension */
+    size_t idx;             /* Index of the block */
+} H5S_hyper_block_ent_t;
+
+/* Information for building a span tree from a list of blocks */
+typedef struct {
+    unsigned rank;          /* Rank of the dataspace */
+    const hsize_t *start;   /* Starting coordinates of the blocks */
+    const hsize_t *block;   /* Sizes of the blocks (NULL for single elements) */
+    size_t nalloc[H5S_MAX_RANK];                /* # of blocks the buffers for each dimension hold */
+    H5S_hyper_block_ent_t *ents[H5S_MAX_RANK];  /* Blocks sorted by their low coordinate, for each dimension */
+    size_t *active[H5S_MAX_RANK];               /* Blocks covering the current position, for each dimension */
+} H5S_hyper_build_ud_t;
+
+/* Sequence list generated for an irregular hyperslab selection.  Offsets
+ * are relative to the selection's first element, so the list stays valid
+ * when the selection is moved with a selection offset (H5Soffset_simple) or
+ * H5S_select_adjust_*().
+ */
+typedef struct H5S_hyper_seq_cache_t {
+    /* Layout the list was generated for */
+    size_t elmt_size;               /* Size of the elements */
+    hsize_t slab[H5S_MAX_RANK];     /* Cumulative size of each dimension in bytes */
+    hsize_t nelem;                  /* # of elements in the selection */
+
+    /* Sequence list */
+    unsigned rc;            /* # of references: the selection and iterators using the list */
+    hbool_t too_long;       /* Whether the selection has more sequences than are kept */
+    size_t nseq;            /* # of sequences (0 until the selection is iterated over again) */
+    hsize_t *off;           /* Offsets of the sequences, in bytes */
+    size_t *len;            /* Lengths of the sequences, in bytes */
+} H5S_hyper_seq_cache_t;
+
 
 /********************/
 /* Local Prototypes */
@@ -142,6 +190,8 @@ static herr_t H5S__hyper_add_disjoint_spans(H5S_t *space, H5S_hyper_span_info_t
 static H5S_hyper_span_info_t *H5S__hyper_make_spans(unsigned rank,
     const hsize_t *start, const hsize_t *stride,
     const hsize_t *count, const hsize_t *block);
+static H5S_hyper_span_info_t *H5S__hyper_build_spans(unsigned rank,
+    size_t num_blocks, const hsize_t *start, const hsize_t *block);
 static herr_t H5S__hyper_update_diminfo(H5S_t *space, H5S_seloper_t op,
     const H5S_hyper_dim_t *new_hyper_diminfo);
 static herr_t H5S__hyper_generate_spans(H5S_t *space);
@@ -153,6 +203,8 @@ static herr_t H5S__fill_in_new_space(H5S_t *space1, H5S_seloper_t op,
 static herr_t H5S__generate_hyperslab(H5S_t *space, H5S_seloper_t op,
     const hsize_t start[], const hsize_t stride[], const hsize_t count[],
     const hsize_t block[]);
+static herr_t H5S__hyper_fixup_op(H5S_t *space, H5S_seloper_t *op,
+    hbool_t *finished);
 static herr_t H5S__set_regular_hyperslab(H5S_t *space, const hsize_t start[],
     const hsize_t *app_stride, const hsize_t app_count[], const hsize_t *app_block,
     const hsize_t *opt_stride, const hsize_t opt_count[], const hsize_t *opt_block);
@@ -165,6 +217,15 @@ static herr_t H5S__hyper_iter_get_seq_list_opt(H5S_sel_iter_t *iter, size_t maxs
     size_t maxelem, size_t *nseq, size_t *nelem, hsize_t *off, size_t *len);
 static herr_t H5S__hyper_iter_get_seq_list_single(H5S_sel_iter_t *iter, size_t maxseq,
     size_t maxelem, size_t *nseq, size_t *nelem, hsize_t *off, size_t *len);
+static herr_t H5S__hyper_iter_get_seq_list_cache(H5S_sel_iter_t *iter, size_t maxseq,
+    size_t maxelem, size_t *nseq, size_t *nelem, hsize_t *off, size_t *len);
+static herr_t H5S__hyper_iter_init_seq_cache(const H5S_t *space,
+    H5S_sel_iter_t *iter);
+static herr_t H5S__hyper_seq_cache_build(H5S_sel_iter_t *iter,
+    H5S_hyper_seq_cache_t *ent, hsize_t base);
+static void H5S__hyper_seq_cache_dec_ref(H5S_hyper_seq_cache_t *ent);
+static void H5S__hyper_seq_cache_reset(H5S_hyper_sel_t *hslab);
+static void H5S__hyper_iter_leave_seq_cache(H5S_sel_iter_t *iter);
 static herr_t H5S__hyper_proj_int_build_proj(H5S_hyper_project_intersect_ud_t *udata);
 static herr_t H5S__hyper_proj_int_iterate(const H5S_hyper_span_info_t *ss_span_info,
     const H5S_hyper_span_info_t *sis_span_info, hsize_t count, unsigned depth,
@@ -299,6 +360,9 @@ H5FL_BARR_DEFINE_STATIC(H5S_hyper_span_info_t, hbounds_t, H5S_MAX_RANK * 2);
 /* Declare extern free list to manage the H5S_sel_iter_t struct */
 H5FL_EXTERN(H5S_sel_iter_t);
 
+/* Declare a free list to manage the H5S_hyper_seq_cache_t struct */
+H5FL_DEFINE_STATIC(H5S_hyper_seq_cache_t);
+
 /* Current operation generation */
 /* (Start with '1' to avoid clashing with '0' value in newly allocated structs) */
 static uint64_t H5S_hyper_op_gen_g = 1;
@@ -556,6 +620,266 @@ H5S__hyper_get_op_gen(void)
 } /* end H5S__hyper_op_gen() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5S__hyper_seq_cache_dec_ref
+ *
+ * Purpose:     Drop a reference to a cached sequence list, releasing it
+ *              when there are none left.
+ *
+ * Return:      None
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5S__hyper_seq_cache_dec_ref(H5S_hyper_seq_cache_t *ent)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(ent);
+    HDassert(ent->rc > 0);
+
+    if(--ent->rc == 0) {
+        ent->off = (hsize_t *)H5MM_xfree(ent->off);
+        ent->len = (size_t *)H5MM_xfree(ent->len);
+        ent = H5FL_FREE(H5S_hyper_seq_cache_t, ent);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5S__hyper_seq_cache_dec_ref() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5S__hyper_seq_cache_reset
+ *
+ * Purpose:     Drop the sequence list cached for a hyperslab selection,
+ *              when its spans are about to change.
+ *
+ * Return:      None
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5S__hyper_seq_cache_reset(H5S_hyper_sel_t *hslab)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    if(hslab && hslab->seq_cache) {
+        H5S__hyper_seq_cache_dec_ref(hslab->seq_cache);
+        hslab->seq_cache = NULL;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5S__hyper_seq_cache_reset() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5S__hyper_seq_cache_build
+ *
+ * Purpose:     Generate the whole sequence list for an irregular hyperslab
+ *              iterator that has not been used yet, and store it in ENT
+ *              relative to BASE, the byte offset of the selection's first
+ *              element.  The iterator is left at the start of the
+ *              selection.
+ *
+ *              Selections with more than H5S_HYPER_SEQ_CACHE_MAX_SEQ
+ *              sequences are flagged in ENT and not stored.
+ *
+ * Return:      Non-negative on success, negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5S__hyper_seq_cache_build(H5S_sel_iter_t *iter, H5S_hyper_seq_cache_t *ent,
+    hsize_t base)
+{
+    H5S_hyper_iter_t saved;     /* Iterator's starting position */
+    hsize_t elmt_left;          /* # of elements in the selection */
+    size_t nalloc;              /* # of sequences the buffers hold */
+    size_t nseq_tot = 0;        /* # of sequences generated */
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(iter);
+    HDassert(!iter->u.hyp.diminfo_valid);
+    HDassert(NULL == iter->u.hyp.seq_cache);
+    HDassert(ent);
+    HDassert(NULL == ent->off);
+
+    /* Save the iterator's position */
+    H5MM_memcpy(&saved, &iter->u.hyp, sizeof(saved));
+    elmt_left = iter->elmt_left;
+
+    /* Allocate the first buffers */
+    nalloc = (size_t)MIN(elmt_left, H5S_HYPER_SEQ_CACHE_INIT_SEQ);
+    if(NULL == (ent->off = (hsize_t *)H5MM_malloc(sizeof(hsize_t) * nalloc)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate sequence offsets")
+    if(NULL == (ent->len = (size_t *)H5MM_malloc(sizeof(size_t) * nalloc)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate sequence lengths")
+
+    /* Run the iterator over the whole selection */
+    while(iter->elmt_left > 0) {
+        size_t nseq;            /* # of sequences generated by this call */
+        size_t nelem;           /* # of elements generated by this call */
+
+        /* Grow the buffers when they are full */
+        if(nseq_tot == nalloc) {
+            void *tmp_ptr;      /* Reallocated buffer */
+
+            if(nalloc == H5S_HYPER_SEQ_CACHE_MAX_SEQ) {
+                ent->too_long = TRUE;
+                HGOTO_DONE(SUCCEED)
+            } /* end if */
+            nalloc = MIN(nalloc * 2, H5S_HYPER_SEQ_CACHE_MAX_SEQ);
+
+            if(NULL == (tmp_ptr = H5MM_realloc(ent->off, sizeof(hsize_t) * nalloc)))
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't reallocate sequence offsets")
+            ent->off = (hsize_t *)tmp_ptr;
+            if(NULL == (tmp_ptr = H5MM_realloc(ent->len, sizeof(size_t) * nalloc)))
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't reallocate sequence lengths")
+            ent->len = (size_t *)tmp_ptr;
+        } /* end if */
+
+        if(H5S__hyper_iter_get_seq_list(iter, nalloc - nseq_tot, (size_t)-1, &nseq, &nelem, ent->off + nseq_tot, ent->len + nseq_tot) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "sequence length generation failed")
+        nseq_tot += nseq;
+    } /* end while */
+
+    /* Make the offsets relative to the first element */
+    for(u = 0; u < nseq_tot; u++)
+        ent->off[u] -= base;
+    ent->nseq = nseq_tot;
+
+done:
+    /* Put the iterator back at the start of the selection */
+    H5MM_memcpy(&iter->u.hyp, &saved, sizeof(saved));
+    iter->elmt_left = elmt_left;
+
+    if(ret_value < 0 || 0 == ent->nseq) {
+        ent->off = (hsize_t *)H5MM_xfree(ent->off);
+        ent->len = (size_t *)H5MM_xfree(ent->len);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_seq_cache_build() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5S__hyper_iter_init_seq_cache
+ *
+ * Purpose:     Set up a new irregular hyperslab iterator to use the
+ *              sequence list cached for its selection.  The first time
+ *              the selection is iterated over nothing is generated; the
+ *              second time the whole sequence list is generated and kept
+ *              with the selection; from then on iterators hand out the
+ *              kept list, shifted to the selection's current location,
+ *              instead of walking the span tree again.
+ *
+ *              The list is dropped when the selection's spans change, or
+ *              when it is iterated over with a different element size or
+ *              dataspace extent.
+ *
+ * Return:      Non-negative on success, negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5S__hyper_iter_init_seq_cache(const H5S_t *space, H5S_sel_iter_t *iter)
+{
+    H5S_hyper_sel_t *hslab;     /* Selection's hyperslab information */
+    H5S_hyper_seq_cache_t *ent; /* Cached sequence list */
+    hsize_t base;               /* Byte offset of the selection's first element */
+    unsigned u;                 /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(space);
+    HDassert(iter);
+    HDassert(!iter->u.hyp.diminfo_valid);
+    HDassert(iter->elmt_size > 0);
+
+    /* Drop a list generated for a different layout */
+    hslab = space->select.sel_info.hslab;
+    ent = hslab->seq_cache;
+    if(ent && (ent->elmt_size != iter->elmt_size || ent->nelem != iter->elmt_left
+            || HDmemcmp(ent->slab, iter->u.hyp.slab, iter->rank * sizeof(hsize_t)))) {
+        H5S__hyper_seq_cache_reset(hslab);
+        ent = NULL;
+    } /* end if */
+
+    /* Only record the layout the first time */
+    if(NULL == ent) {
+        if(NULL == (ent = H5FL_CALLOC(H5S_hyper_seq_cache_t)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate sequence list cache")
+        ent->elmt_size = iter->elmt_size;
+        H5MM_memcpy(ent->slab, iter->u.hyp.slab, iter->rank * sizeof(hsize_t));
+        ent->nelem = iter->elmt_left;
+        ent->rc = 1;
+        hslab->seq_cache = ent;
+
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+    if(ent->too_long)
+        HGOTO_DONE(SUCCEED)
+
+    /* Compute the byte offset of the selection's first element */
+    for(u = 0, base = 0; u < iter->rank; u++)
+        base += iter->u.hyp.loc_off[u];
+
+    /* Generate the list the second time */
+    if(NULL == ent->off) {
+        if(H5S__hyper_seq_cache_build(iter, ent, base) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "can't build sequence list")
+        if(NULL == ent->off)
+            HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Hand out the cached list */
+    ent->rc++;
+    iter->u.hyp.seq_cache = ent;
+    iter->u.hyp.seq_base = base;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_iter_init_seq_cache() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5S__hyper_iter_leave_seq_cache
+ *
+ * Purpose:     Stop using the cached sequence list in an iterator and move
+ *              its regular position to where the list left off, so the
+ *              iterator's other callbacks can be used.
+ *
+ * Return:      None
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5S__hyper_iter_leave_seq_cache(H5S_sel_iter_t *iter)
+{
+    H5S_hyper_seq_cache_t *ent;     /* Cached sequence list */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(iter);
+    HDassert(iter->u.hyp.seq_cache);
+
+    ent = iter->u.hyp.seq_cache;
+    iter->u.hyp.seq_cache = NULL;
+
+    /* The span position hasn't moved since the iterator was set up */
+    if(ent->nelem > iter->elmt_left)
+        (void)H5S__hyper_iter_next(iter, (size_t)(ent->nelem - iter->elmt_left));
+
+    H5S__hyper_seq_cache_dec_ref(ent);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5S__hyper_iter_leave_seq_cache() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5S__hyper_iter_init
  *
@@ -594,6 +918,11 @@ H5S__hyper_iter_init(const H5S_t *space, H5S_sel_iter_t *iter)
     /* Initialize the hyperslab iterator's rank */
     iter->u.hyp.iter_rank = 0;
 
+    /* Not using a cached sequence list yet */
+    iter->u.hyp.seq_cache = NULL;
+    iter->u.hyp.seq_idx = 0;
+    iter->u.hyp.seq_used = 0;
+
     /* Get the rank of the dataspace */
     rank = iter->rank;
 
@@ -785,6 +1114,11 @@ H5S__hyper_iter_init(const H5S_t *space, H5S_sel_iter_t *iter)
         for(u = 0; u < rank; u++)
             /* Compute the sequential element offset */
             iter->u.hyp.loc_off[u] = ((hsize_t)((hssize_t)iter->u.hyp.off[u] + iter->sel_off[u])) * iter->u.hyp.slab[u];
+
+        /* Check for a sequence list cached for the selection */
+        if(iter->elmt_size > 0 && iter->elmt_left > 0)
+            if(H5S__hyper_iter_init_seq_cache(space, iter) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "can't set up cached sequence list")
     } /* end if */
 
     /* Initialize type of selection iterator */
@@ -817,6 +1151,10 @@ H5S__hyper_iter_coords(const H5S_sel_iter_t *iter, hsize_t *coords)
     HDassert(iter);
     HDassert(coords);
 
+    /* Stop using a cached sequence list */
+    if(iter->u.hyp.seq_cache)
+        H5S__hyper_iter_leave_seq_cache((H5S_sel_iter_t *)iter);  /* Casting away const OK */
+
     /* Copy the offset of the current point */
 
     /* Check for a single "regular" hyperslab */
@@ -908,6 +1246,10 @@ H5S__hyper_iter_block(const H5S_sel_iter_t *iter, hsize_t *start, hsize_t *end)
     HDassert(start);
     HDassert(end);
 
+    /* Stop using a cached sequence list */
+    if(iter->u.hyp.seq_cache)
+        H5S__hyper_iter_leave_seq_cache((H5S_sel_iter_t *)iter);  /* Casting away const OK */
+
     /* Copy the offset of the current point */
 
     /* Check for a single "regular" hyperslab */
@@ -982,6 +1324,10 @@ H5S__hyper_iter_has_next_block(const H5S_sel_iter_t *iter)
     /* Check args */
     HDassert(iter);
 
+    /* Stop using a cached sequence list */
+    if(iter->u.hyp.seq_cache)
+        H5S__hyper_iter_leave_seq_cache((H5S_sel_iter_t *)iter);  /* Casting away const OK */
+
     /* Check for a single "regular" hyperslab */
     if(iter->u.hyp.diminfo_valid) {
         const H5S_hyper_dim_t *tdiminfo;    /* Temporary pointer to diminfo information */
@@ -1033,6 +1379,10 @@ H5S__hyper_iter_next(H5S_sel_iter_t *iter, size_t nelem)
 
     FUNC_ENTER_STATIC_NOERR
 
+    /* Stop using a cached sequence list */
+    if(iter->u.hyp.seq_cache)
+        H5S__hyper_iter_leave_seq_cache(iter);
+
     /* Check for the special case of just one H5Sselect_hyperslab call made */
     /* (i.e. a regular hyperslab selection */
     if(iter->u.hyp.diminfo_valid) {
@@ -1240,6 +1590,10 @@ H5S__hyper_iter_next_block(H5S_sel_iter_t *iter)
 
     FUNC_ENTER_STATIC_NOERR
 
+    /* Stop using a cached sequence list */
+    if(iter->u.hyp.seq_cache)
+        H5S__hyper_iter_leave_seq_cache(iter);
+
     /* Check for the special case of just one H5Sselect_hyperslab call made */
     /* (i.e. a regular hyperslab selection) */
     if(iter->u.hyp.diminfo_valid) {
@@ -2566,6 +2920,120 @@ H5S__hyper_iter_get_seq_list_single(H5S_sel_iter_t *iter, size_t maxseq, size_t
 } /* end H5S__hyper_iter_get_seq_list_single() */
 
 
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_iter_get_seq_list_cache
+ PURPOSE
+    Create a list of offsets & lengths for a selection from a cached list
+ USAGE
+    herr_t H5S__hyper_iter_get_seq_list_cache(iter,maxseq,maxelem,nseq,nelem,off,len)
+        H5S_sel_iter_t *iter;   IN/OUT: Selection iterator describing last
+                                    position of interest in selection.
+        size_t maxseq;          IN: Maximum number of sequences to generate
+        size_t maxelem;         IN: Maximum number of elements to include in the
+                                    generated sequences
+        size_t *nseq;           OUT: Actual number of sequences generated
+        size_t *nelem;          OUT: Actual number of elements in sequences generated
+        hsize_t *off;           OUT: Array of offsets (in bytes)
+        size_t *len;            OUT: Array of lengths (in bytes)
+ RETURNS
+    Non-negative on success/Negative on failure.
+ DESCRIPTION
+    Copy the next part of the sequence list cached for the shape of a
+    regular hyperslab selection, adding the byte offset of the selection's
+    first element to the offsets.  Start/Restart from the position in the
+    ITER parameter.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static herr_t
+H5S__hyper_iter_get_seq_list_cache(H5S_sel_iter_t *iter, size_t maxseq,
+    size_t maxelem, size_t *nseq, size_t *nelem, hsize_t *off, size_t *len)
+{
+    const H5S_hyper_seq_cache_t *ent;   /* Cached sequence list */
+    const hsize_t *ent_off;     /* Cached sequence offsets */
+    const size_t *ent_len;      /* Cached sequence lengths */
+    hsize_t base;               /* Byte offset of the selection's first element */
+    size_t elem_size;           /* Size of each element iterated over */
+    size_t max_bytes;           /* Most bytes to put in the sequences */
+    size_t tot_bytes = 0;       /* # of bytes put in the sequences */
+    size_t idx;                 /* Index of the current cached sequence */
+    size_t curr_seq = 0;        /* # of sequences generated */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Check args */
+    HDassert(iter);
+    HDassert(iter->u.hyp.seq_cache);
+    HDassert(iter->elmt_left > 0);
+    HDassert(maxseq > 0);
+    HDassert(maxelem > 0);
+    HDassert(nseq);
+    HDassert(nelem);
+    HDassert(off);
+    HDassert(len);
+
+    /* Set up some local variables */
+    ent = iter->u.hyp.seq_cache;
+    ent_off = ent->off;
+    ent_len = ent->len;
+    base = iter->u.hyp.seq_base;
+    elem_size = iter->elmt_size;
+    idx = iter->u.hyp.seq_idx;
+
+    /* Work in bytes, which are always a multiple of the element size */
+    if(maxelem > ((size_t)-1 / elem_size))
+        max_bytes = ((size_t)-1 / elem_size) * elem_size;
+    else
+        max_bytes = maxelem * elem_size;
+
+    /* Finish a sequence that was cut short by the last call */
+    if(iter->u.hyp.seq_used > 0) {
+        size_t seq_left = ent_len[idx] - iter->u.hyp.seq_used;    /* # of bytes left in the sequence */
+
+        tot_bytes = MIN(seq_left, max_bytes);
+        off[0] = base + ent_off[idx] + iter->u.hyp.seq_used;
+        len[0] = tot_bytes;
+        curr_seq = 1;
+
+        if(tot_bytes == seq_left) {
+            iter->u.hyp.seq_used = 0;
+            idx++;
+        } /* end if */
+        else
+            iter->u.hyp.seq_used += tot_bytes;
+    } /* end if */
+
+    /* Copy whole sequences while they fit */
+    while(curr_seq < maxseq && tot_bytes < max_bytes && idx < ent->nseq) {
+        off[curr_seq] = base + ent_off[idx];
+        if(ent_len[idx] > (max_bytes - tot_bytes)) {
+            /* Only part of the sequence fits */
+            len[curr_seq] = max_bytes - tot_bytes;
+            iter->u.hyp.seq_used = len[curr_seq];
+        } /* end if */
+        else {
+            len[curr_seq] = ent_len[idx];
+            idx++;
+        } /* end else */
+        tot_bytes += len[curr_seq];
+        curr_seq++;
+    } /* end while */
+
+    /* Update the iterator */
+    iter->u.hyp.seq_idx = idx;
+    iter->elmt_left -= tot_bytes / elem_size;
+
+    /* Set the number of sequences generated and elements used */
+    *nseq = curr_seq;
+    *nelem = tot_bytes / elem_size;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5S__hyper_iter_get_seq_list_cache() */
+
+
 /*--------------------------------------------------------------------------
  NAME
     H5S__hyper_iter_get_seq_list
@@ -2615,8 +3083,11 @@ H5S__hyper_iter_get_seq_list(H5S_sel_iter_t *iter, size_t maxseq,
     HDassert(off);
     HDassert(len);
 
+    /* Check for a cached sequence list for the selection's shape */
+    if(iter->u.hyp.seq_cache)
+        ret_value = H5S__hyper_iter_get_seq_list_cache(iter, maxseq, maxelem, nseq, nelem, off, len);
     /* Check for the special case of just one H5Sselect_hyperslab call made */
-    if(iter->u.hyp.diminfo_valid) {
+    else if(iter->u.hyp.diminfo_valid) {
         const H5S_hyper_dim_t *tdiminfo;    /* Temporary pointer to diminfo information */
         const hssize_t *sel_off;    /* Selection offset in dataspace */
         unsigned ndims;         /* Number of dimensions of dataset */
@@ -2757,6 +3228,10 @@ H5S__hyper_iter_release(H5S_sel_iter_t *iter)
     if(iter->u.hyp.spans != NULL)
         H5S__hyper_free_span_info(iter->u.hyp.spans);
 
+    /* Drop the iterator's reference to the cached sequence list */
+    if(iter->u.hyp.seq_cache != NULL)
+        H5S__hyper_seq_cache_dec_ref(iter->u.hyp.seq_cache);
+
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5S__hyper_iter_release() */
 
@@ -3254,6 +3729,9 @@ H5S__hyper_copy(H5S_t *dst, const H5S_t *src, hbool_t share_selection)
     dst_hslab->unlim_dim = src_hslab->unlim_dim;
     dst_hslab->num_elem_non_unlim = src_hslab->num_elem_non_unlim;
 
+    /* The copy generates its own sequence list */
+    dst_hslab->seq_cache = NULL;
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5S__hyper_copy() */
@@ -5758,6 +6236,9 @@ H5S__hyper_release(H5S_t *space)
         if(space->select.sel_info.hslab->span_lst != NULL)
             H5S__hyper_free_span_info(space->select.sel_info.hslab->span_lst);
 
+        /* Release the cached sequence list */
+        H5S__hyper_seq_cache_reset(space->select.sel_info.hslab);
+
         /* Release space for the hyperslab selection information */
         space->select.sel_info.hslab = H5FL_FREE(H5S_hyper_sel_t, space->select.sel_info.hslab);
     } /* end if */
@@ -6137,6 +6618,7 @@ H5S_hyper_add_span_element(H5S_t *space, unsigned rank, const hsize_t *coords)
 
         /* Set the selection to the new span tree */
         space->select.sel_info.hslab->span_lst = head;
+        space->select.sel_info.hslab->seq_cache = NULL;
 
         /* Set selection type */
         space->select.type = H5S_sel_hyper;
@@ -6153,6 +6635,9 @@ H5S_hyper_add_span_element(H5S_t *space, unsigned rank, const hsize_t *coords)
     else {
         int first_dim_modified = -1;            /* Index of first dimension modified */
 
+        /* Drop the cached sequence list */
+        H5S__hyper_seq_cache_reset(space->select.sel_info.hslab);
+
         /* Add the element to the current set of spans */
         if(H5S__hyper_add_span_element_helper(space->select.sel_info.hslab->span_lst, rank, coords, &first_dim_modified) < 0)
             HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't insert coordinate into span tree")
@@ -6789,6 +7274,7 @@ H5S__hyper_project_simple(const H5S_t *base_space, H5S_t *new_space,
 
     /* Set unlim_dim */
     new_space->select.sel_info.hslab->unlim_dim = -1;
+    new_space->select.sel_info.hslab->seq_cache = NULL;
 
     /* Check for a "regular" hyperslab selection */
     /* (No need to rebuild the dimension info yet -QAK) */
@@ -8250,11 +8736,28 @@ H5S__hyper_merge_spans(H5S_t *space, H5S_hyper_span_info_t *new_spans)
     HDassert(space);
     HDassert(new_spans);
 
+    /* Drop the cached sequence list */
+    H5S__hyper_seq_cache_reset(space->select.sel_info.hslab);
+
     /* If this is the first span tree in the hyperslab selection, just use it */
     if(space->select.sel_info.hslab->span_lst == NULL) {
         space->select.sel_info.hslab->span_lst = new_spans;
         space->select.sel_info.hslab->span_lst->count++;
     } /* end if */
+    /* If the new spans are all past the end of the current selection in the
+     *  slowest changing dimension and the current span tree isn't shared,
+     *  just append them.  (This keeps building a selection one block at a
+     *  time, in order, from taking time proportional to the number of blocks
+     *  already selected)
+     */
+    else if(space->select.sel_info.hslab->span_lst->count == 1 &&
+            space->select.sel_info.hslab->span_lst->high_bounds[0] < new_spans->low_bounds[0]) {
+        H5S_hyper_span_t *span;     /* Span to append */
+
+        for(span = new_spans->head; span; span = span->next)
+            if(H5S__hyper_append_span(&space->select.sel_info.hslab->span_lst, space->extent.rank, span->low, span->high, span->down) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, FAIL, "can't append hyperslab span")
+    } /* end if */
     else {
         H5S_hyper_span_info_t *merged_spans;
 
@@ -8585,68 +9088,309 @@ done:
 } /* end H5S__hyper_make_spans() */
 
 
-/*--------------------------------------------------------------------------
- NAME
-    H5S__hyper_update_diminfo
- PURPOSE
-    Attempt to update optimized hyperslab information quickly.  (It can be
-    recovered with regular selection).  If this algorithm cannot determine
-    the optimized dimension info quickly, this function will simply mark it
-    as invalid and unknown if it can be built (H5S_DIMINFO_VALID_NO), so
-    H5S__hyper_rebuild can be run later to determine for sure.
- USAGE
-    herr_t H5S__hyper_update_diminfo(space, op, new_hyper_diminfo)
-        H5S_t *space;       IN: Dataspace to check
-        H5S_seloper_t op;   IN: The operation being performed on the
-                                selection
-        const H5S_hyper_dim_t new_hyper_diminfo; IN: The new selection that
-                                                     is being combined with
-                                                     the current
- RETURNS
-    >=0 on success, <0 on failure
- DESCRIPTION
-    Examine the span tree for a hyperslab selection and rebuild
-    the start/stride/count/block information for the selection, if possible.
-
- GLOBAL VARIABLES
- COMMENTS, BUGS, ASSUMPTIONS
- EXAMPLES
- REVISION LOG
---------------------------------------------------------------------------*/
-static herr_t
-H5S__hyper_update_diminfo(H5S_t *space, H5S_seloper_t op,
-    const H5S_hyper_dim_t *new_hyper_diminfo)
+/*-------------------------------------------------------------------------
+ * Function:    H5S__hyper_cmp_block_ent
+ *
+ * Purpose:     Compares two blocks by their low coordinate in the dimension
+ *              being swept, for sorting them with HDqsort().
+ *
+ * Return:      An integer less than, equal to, or greater than zero if the
+ *              first block starts before, at the same place as, or after
+ *              the second one
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5S__hyper_cmp_block_ent(const void *_ent1, const void *_ent2)
 {
-    herr_t ret_value = SUCCEED;      /* Return value */
+    const H5S_hyper_block_ent_t *ent1 = (const H5S_hyper_block_ent_t *)_ent1;
+    const H5S_hyper_block_ent_t *ent2 = (const H5S_hyper_block_ent_t *)_ent2;
+    int ret_value = 0;          /* Return value */
 
     FUNC_ENTER_STATIC_NOERR
 
-    /* Check args */
-    HDassert(space);
-    HDassert(new_hyper_diminfo);
+    if(ent1->low < ent2->low)
+        ret_value = -1;
+    else if(ent1->low > ent2->low)
+        ret_value = 1;
+    else if(ent1->idx < ent2->idx)
+        ret_value = -1;
+    else if(ent1->idx > ent2->idx)
+        ret_value = 1;
 
-    /* Check for conditions that prevent us from using the fast algorithm here */
-    /* (and instead require H5S__hyper_rebuild) */
-    if(!((op == H5S_SELECT_OR) || (op == H5S_SELECT_XOR))
-            || space->select.sel_info.hslab->diminfo_valid != H5S_DIMINFO_VALID_YES
-            || !space->select.sel_info.hslab->span_lst->head)
-        space->select.sel_info.hslab->diminfo_valid = H5S_DIMINFO_VALID_NO;
-    else {
-        H5S_hyper_dim_t tmp_diminfo[H5S_MAX_RANK];  /* Temporary dimension info */
-        hbool_t found_nonidentical_dim = FALSE;
-        unsigned curr_dim;
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_cmp_block_ent() */
 
-        /* Copy current diminfo.opt values */
-        H5MM_memcpy(tmp_diminfo, space->select.sel_info.hslab->diminfo.opt, sizeof(tmp_diminfo));
 
-        /* Loop over dimensions */
-        for(curr_dim = 0; curr_dim < space->extent.rank; curr_dim++) {
-            /* Check for this being identical */
-            if((tmp_diminfo[curr_dim].start != new_hyper_diminfo[curr_dim].start)
-                    || (tmp_diminfo[curr_dim].stride != new_hyper_diminfo[curr_dim].stride)
-                    || (tmp_diminfo[curr_dim].count != new_hyper_diminfo[curr_dim].count)
-                    || (tmp_diminfo[curr_dim].block != new_hyper_diminfo[curr_dim].block)) {
-                hsize_t high_start, high_count, high_block;         /* The start, count & block values for the higher block */
+/*-------------------------------------------------------------------------
+ * Function:    H5S__hyper_build_spans_helper
+ *
+ * Purpose:     Builds the span tree for the union of some blocks, from
+ *              dimension DIM down.
+ *
+ *              The blocks are sorted by their low coordinate in DIM and
+ *              swept in order, keeping the blocks covering the current
+ *              position.  Each stretch of DIM covered by the same blocks
+ *              becomes a span, whose spans in the next dimension down are
+ *              built from just those blocks.  The stretches are appended
+ *              in order, so neighbouring spans with the same spans below
+ *              them are merged as they're added, without the repeated
+ *              clipping and merging of adding the blocks one at a time.
+ *
+ *              BLOCKS holds the indices of the blocks, or is NULL for the
+ *              first NUM_BLOCKS blocks.
+ *
+ * Return:      Success:    Pointer to the new span tree
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5S_hyper_span_info_t *
+H5S__hyper_build_spans_helper(H5S_hyper_build_ud_t *udata, unsigned dim,
+    const size_t *blocks, size_t num_blocks)
+{
+    H5S_hyper_block_ent_t *ents;        /* Blocks, sorted by low coordinate */
+    size_t     *active;                 /* Blocks covering the current position */
+    size_t      nactive = 0;            /* # of blocks covering the current position */
+    size_t      next = 0;               /* Next block to start covering the dimension */
+    hsize_t     pos = 0;                /* Current position in the dimension */
+    H5S_hyper_span_info_t *down = NULL; /* Spans in the next dimension down */
+    H5S_hyper_span_info_t *span_tree = NULL;    /* Spans in this dimension */
+    size_t      u, v;                   /* Local index variables */
+    H5S_hyper_span_info_t *ret_value = NULL;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(udata);
+    HDassert(dim < udata->rank);
+    HDassert(num_blocks > 0);
+
+    /* Make certain the buffers for this dimension are large enough */
+    if(num_blocks > udata->nalloc[dim]) {
+        H5S_hyper_block_ent_t *new_ents;    /* Reallocated sorted blocks */
+        size_t *new_active;                 /* Reallocated active blocks */
+
+        if(NULL == (new_ents = (H5S_hyper_block_ent_t *)H5MM_realloc(udata->ents[dim], num_blocks * sizeof(H5S_hyper_block_ent_t))))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate block list")
+        udata->ents[dim] = new_ents;
+        if(NULL == (new_active = (size_t *)H5MM_realloc(udata->active[dim], num_blocks * sizeof(size_t))))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate block list")
+        udata->active[dim] = new_active;
+        udata->nalloc[dim] = num_blocks;
+    } /* end if */
+    ents = udata->ents[dim];
+    active = udata->active[dim];
+
+    /* Sort the blocks by their low coordinate in this dimension */
+    for(u = 0; u < num_blocks; u++) {
+        ents[u].idx = blocks ? blocks[u] : u;
+        ents[u].low = udata->start[(ents[u].idx * udata->rank) + dim];
+    } /* end for */
+    HDqsort(ents, num_blocks, sizeof(H5S_hyper_block_ent_t), H5S__hyper_cmp_block_ent);
+
+    /* Sweep over the dimension */
+    while(next < num_blocks || nactive > 0) {
+        hsize_t end;        /* End of the current span */
+
+        /* Skip to the next block when no blocks cover the current position */
+        if(0 == nactive)
+            pos = ents[next].low;
+
+        /* Add the blocks starting at the current position */
+        while(next < num_blocks && ents[next].low == pos)
+            active[nactive++] = ents[next++].idx;
+
+        /* The span ends when a block starts or ends */
+        end = (next < num_blocks) ? (ents[next].low - 1) : HSIZET_MAX;
+        for(u = 0; u < nactive; u++) {
+            hsize_t high = H5S_HYPER_BLOCK_HIGH(udata, active[u], dim);
+
+            if(high < end)
+                end = high;
+        } /* end for */
+
+        /* Build the spans in the next dimension down from the blocks covering this span */
+        if(dim + 1 < udata->rank)
+            if(NULL == (down = H5S__hyper_build_spans_helper(udata, dim + 1, active, nactive)))
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, NULL, "can't build hyperslab spans")
+
+        /* Append the span */
+        if(H5S__hyper_append_span(&span_tree, udata->rank - dim, pos, end, down) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, NULL, "can't append hyperslab span")
+        if(down) {
+            H5S__hyper_free_span_info(down);
+            down = NULL;
+        } /* end if */
+
+        /* Drop the blocks that end with the span */
+        for(u = v = 0; u < nactive; u++)
+            if(H5S_HYPER_BLOCK_HIGH(udata, active[u], dim) != end)
+                active[v++] = active[u];
+        nactive = v;
+
+        pos = end + 1;
+    } /* end while */
+
+    /* Set return value */
+    ret_value = span_tree;
+    span_tree = NULL;
+
+done:
+    if(down)
+        H5S__hyper_free_span_info(down);
+    if(span_tree)
+        H5S__hyper_free_span_info(span_tree);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_build_spans_helper() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5S__hyper_build_spans
+ *
+ * Purpose:     Builds the span tree for the union of a list of blocks,
+ *              which may overlap and may be in any order.  START holds
+ *              NUM_BLOCKS starting coordinates, one after the other, and
+ *              BLOCK the size of each block in the same layout, or is NULL
+ *              for single elements.  Blocks with no elements are skipped,
+ *              but at least one block must have elements.
+ *
+ *              The blocks are sorted in each dimension rather than merged
+ *              into the span tree one at a time, so disjoint blocks take
+ *              O(n log n) time to add instead of O(n^2).
+ *
+ * Return:      Success:    Pointer to the new span tree
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5S_hyper_span_info_t *
+H5S__hyper_build_spans(unsigned rank, size_t num_blocks, const hsize_t *start,
+    const hsize_t *block)
+{
+    H5S_hyper_build_ud_t udata;         /* Information for building the span tree */
+    size_t     *blocks = NULL;          /* Indices of the blocks with elements */
+    size_t      nblocks = num_blocks;   /* # of blocks with elements */
+    unsigned    u;                      /* Local index variable */
+    H5S_hyper_span_info_t *ret_value = NULL;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(rank > 0);
+    HDassert(rank <= H5S_MAX_RANK);
+    HDassert(num_blocks > 0);
+    HDassert(start);
+
+    HDmemset(&udata, 0, sizeof(udata));
+    udata.rank = rank;
+    udata.start = start;
+    udata.block = block;
+
+    /* Leave out blocks with no elements */
+    if(block) {
+        size_t v;       /* Local index variable */
+
+        for(v = 0, nblocks = 0; v < num_blocks; v++) {
+            for(u = 0; u < rank; u++)
+                if(0 == block[(v * rank) + u])
+                    break;
+            if(u == rank) {
+                if(NULL == blocks && nblocks < v) {
+                    size_t w;   /* Local index variable */
+
+                    /* Allocate the list of blocks the first time one is skipped */
+                    if(NULL == (blocks = (size_t *)H5MM_malloc(num_blocks * sizeof(size_t))))
+                        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate block list")
+                    for(w = 0; w < nblocks; w++)
+                        blocks[w] = w;
+                } /* end if */
+                if(blocks)
+                    blocks[nblocks] = v;
+                nblocks++;
+            } /* end if */
+        } /* end for */
+        HDassert(nblocks > 0);
+    } /* end if */
+
+    /* Build the span tree */
+    if(NULL == (ret_value = H5S__hyper_build_spans_helper(&udata, 0, blocks, nblocks)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, NULL, "can't build hyperslab spans")
+
+done:
+    for(u = 0; u < rank; u++) {
+        H5MM_xfree(udata.ents[u]);
+        H5MM_xfree(udata.active[u]);
+    } /* end for */
+    H5MM_xfree(blocks);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_build_spans() */
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_update_diminfo
+ PURPOSE
+    Attempt to update optimized hyperslab information quickly.  (It can be
+    recovered with regular selection).  If this algorithm cannot determine
+    the optimized dimension info quickly, this function will simply mark it
+    as invalid and unknown if it can be built (H5S_DIMINFO_VALID_NO), so
+    H5S__hyper_rebuild can be run later to determine for sure.
+ USAGE
+    herr_t H5S__hyper_update_diminfo(space, op, new_hyper_diminfo)
+        H5S_t *space;       IN: Dataspace to check
+        H5S_seloper_t op;   IN: The operation being performed on the
+                                selection
+        const H5S_hyper_dim_t new_hyper_diminfo; IN: The new selection that
+                                                     is being combined with
+                                                     the current
+ RETURNS
+    >=0 on success, <0 on failure
+ DESCRIPTION
+    Examine the span tree for a hyperslab selection and rebuild
+    the start/stride/count/block information for the selection, if possible.
+
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static herr_t
+H5S__hyper_update_diminfo(H5S_t *space, H5S_seloper_t op,
+    const H5S_hyper_dim_t *new_hyper_diminfo)
+{
+    herr_t ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Check args */
+    HDassert(space);
+    HDassert(new_hyper_diminfo);
+
+    /* Check for conditions that prevent us from using the fast algorithm here */
+    /* (and instead require H5S__hyper_rebuild) */
+    if(!((op == H5S_SELECT_OR) || (op == H5S_SELECT_XOR))
+            || space->select.sel_info.hslab->diminfo_valid != H5S_DIMINFO_VALID_YES
+            || !space->select.sel_info.hslab->span_lst->head)
+        space->select.sel_info.hslab->diminfo_valid = H5S_DIMINFO_VALID_NO;
+    else {
+        H5S_hyper_dim_t tmp_diminfo[H5S_MAX_RANK];  /* Temporary dimension info */
+        hbool_t found_nonidentical_dim = FALSE;
+        unsigned curr_dim;
+
+        /* Copy current diminfo.opt values */
+        H5MM_memcpy(tmp_diminfo, space->select.sel_info.hslab->diminfo.opt, sizeof(tmp_diminfo));
+
+        /* Loop over dimensions */
+        for(curr_dim = 0; curr_dim < space->extent.rank; curr_dim++) {
+            /* Check for this being identical */
+            if((tmp_diminfo[curr_dim].start != new_hyper_diminfo[curr_dim].start)
+                    || (tmp_diminfo[curr_dim].stride != new_hyper_diminfo[curr_dim].stride)
+                    || (tmp_diminfo[curr_dim].count != new_hyper_diminfo[curr_dim].count)
+                    || (tmp_diminfo[curr_dim].block != new_hyper_diminfo[curr_dim].block)) {
+                hsize_t high_start, high_count, high_block;         /* The start, count & block values for the higher block */
 
                 /* Dimension is not identical */
                 /* Check if we already found a nonidentical dim - only one is
@@ -9157,6 +9901,10 @@ H5S__fill_in_new_space(H5S_t *space1, H5S_seloper_t op,
     *span2_owned = FALSE;
     *updated_spans = FALSE;
 
+    /* Drop space1's cached sequence list when its spans will change */
+    if(*result == space1)
+        H5S__hyper_seq_cache_reset(space1->select.sel_info.hslab);
+
     /* The result shares the same info from space1 */
     if(*result == NULL) {
         if(NULL == ((*result) = H5S_copy(space1, TRUE, TRUE)))
@@ -9439,6 +10187,7 @@ H5S__generate_hyperslab(H5S_t *space, H5S_seloper_t op, const hsize_t start[],
         /* Free current selection */
         if(NULL != space->select.sel_info.hslab->span_lst)
             H5S__hyper_free_span_info(space->select.sel_info.hslab->span_lst);
+        H5S__hyper_seq_cache_reset(space->select.sel_info.hslab);
 
         /* Set the hyperslab selection to the new span tree */
         space->select.sel_info.hslab->span_lst = new_spans;
@@ -9534,6 +10283,7 @@ H5S__set_regular_hyperslab(H5S_t *space, const hsize_t start[],
     /* Set the diminfo */
     space->select.num_elem = 1;
     space->select.sel_info.hslab->unlim_dim = -1;
+    space->select.sel_info.hslab->seq_cache = NULL;
     for(u = 0; u < space->extent.rank; u++) {
         /* Set application and optimized hyperslab info */
         space->select.sel_info.hslab->diminfo.app[u].start = start[u];
@@ -9821,6 +10571,132 @@ done:
 } /* end H5S__hyper_regular_and_single_block() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5S__hyper_fixup_op
+ *
+ * Purpose:     Prepares a dataspace for a hyperslab operation, mapping the
+ *              operation onto the dataspace's current selection when that
+ *              isn't a hyperslab selection.  Sets FINISHED when the
+ *              operation leaves nothing more to do.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5S__hyper_fixup_op(H5S_t *space, H5S_seloper_t *op, hbool_t *finished)
+{
+    herr_t ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(space);
+    HDassert(op);
+    HDassert(finished);
+
+    *finished = FALSE;
+
+    switch(H5S_GET_SELECT_TYPE(space)) {
+        case H5S_SEL_NONE:   /* No elements selected in dataspace */
+            switch(*op) {
+                case H5S_SELECT_SET:   /* Select "set" operation */
+                    /* Change "none" selection to hyperslab selection */
+                    break;
+
+                case H5S_SELECT_OR:    /* Binary "or" operation for hyperslabs */
+                case H5S_SELECT_XOR:   /* Binary "xor" operation for hyperslabs */
+                case H5S_SELECT_NOTA:  /* Binary "B not A" operation for hyperslabs */
+                    *op = H5S_SELECT_SET; /* Maps to "set" operation when applied to "none" selection */
+                    break;
+
+                case H5S_SELECT_AND:   /* Binary "and" operation for hyperslabs */
+                case H5S_SELECT_NOTB:  /* Binary "A not B" operation for hyperslabs */
+                    *finished = TRUE;        /* Selection stays "none" */
+                    break;
+
+                case H5S_SELECT_NOOP:
+                case H5S_SELECT_APPEND:
+                case H5S_SELECT_PREPEND:
+                case H5S_SELECT_INVALID:
+                default:
+                    HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+            } /* end switch */
+            break;
+
+        case H5S_SEL_ALL:    /* All elements selected in dataspace */
+            switch(*op) {
+                case H5S_SELECT_SET:   /* Select "set" operation */
+                    /* Change "all" selection to hyperslab selection */
+                    break;
+
+                case H5S_SELECT_OR:    /* Binary "or" operation for hyperslabs */
+                    *finished = TRUE;        /* Selection stays "all" */
+                    break;
+
+                case H5S_SELECT_AND:   /* Binary "and" operation for hyperslabs */
+                    *op = H5S_SELECT_SET; /* Maps to "set" operation when applied to "none" selection */
+                    break;
+
+                case H5S_SELECT_XOR:   /* Binary "xor" operation for hyperslabs */
+                case H5S_SELECT_NOTB:  /* Binary "A not B" operation for hyperslabs */
+                    /* Convert current "all" selection to "real" hyperslab selection */
+                    /* Then allow operation to proceed */
+                    {
+                        const hsize_t *tmp_start;       /* Temporary start information */
+                        const hsize_t *tmp_stride;      /* Temporary stride information */
+                        const hsize_t *tmp_count;       /* Temporary count information */
+                        const hsize_t *tmp_block;       /* Temporary block information */
+
+                        /* Set up temporary information for the dimensions */
+                        tmp_start = H5S_hyper_zeros_g;
+                        tmp_stride = tmp_count = H5S_hyper_ones_g;
+                        tmp_block = space->extent.size;
+
+                        /* Convert to hyperslab selection */
+                        if(H5S_select_hyperslab(space, H5S_SELECT_SET, tmp_start, tmp_stride, tmp_count, tmp_block) < 0)
+                            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTDELETE, FAIL, "can't convert selection")
+                    } /* end case */
+                    break;
+
+                case H5S_SELECT_NOTA:  /* Binary "B not A" operation for hyperslabs */
+                    /* Convert to "none" selection */
+                    if(H5S_select_none(space) < 0)
+                        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't convert selection")
+                    *finished = TRUE;
+                    break;
+
+                case H5S_SELECT_NOOP:
+                case H5S_SELECT_APPEND:
+                case H5S_SELECT_PREPEND:
+                case H5S_SELECT_INVALID:
+                default:
+                    HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+            } /* end switch */
+            break;
+
+        case H5S_SEL_HYPERSLABS:
+            /* Hyperslab operation on hyperslab selection, OK */
+            break;
+
+        case H5S_SEL_POINTS: /* Can't combine hyperslab operations and point selections currently */
+            if(*op == H5S_SELECT_SET)      /* Allow only "set" operation to proceed */
+                break;
+            /* Else fall through to error */
+            H5_ATTR_FALLTHROUGH
+
+        case H5S_SEL_ERROR:
+        case H5S_SEL_N:
+        default:
+            HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+    } /* end switch */
+
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_fixup_op() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5S_select_hyperslab
  *
@@ -9844,6 +10720,7 @@ H5S_select_hyperslab(H5S_t *space, H5S_seloper_t op, const hsize_t start[],
     const hsize_t *opt_count;       /* Optimized count information */
     const hsize_t *opt_block;       /* Optimized block information */
     int unlim_dim = -1;             /* Unlimited dimension in selection, of -1 if none */
+    hbool_t finished;               /* Whether the operation has nothing left to do */
     unsigned u;                     /* Local index variable */
     herr_t ret_value = SUCCEED;     /* Return value */
 
@@ -9966,96 +10843,10 @@ H5S_select_hyperslab(H5S_t *space, H5S_seloper_t op, const hsize_t start[],
     } /* end if */
 
     /* Fixup operation for non-hyperslab selections */
-    switch(H5S_GET_SELECT_TYPE(space)) {
-        case H5S_SEL_NONE:   /* No elements selected in dataspace */
-            switch(op) {
-                case H5S_SELECT_SET:   /* Select "set" operation */
-                    /* Change "none" selection to hyperslab selection */
-                    break;
-
-                case H5S_SELECT_OR:    /* Binary "or" operation for hyperslabs */
-                case H5S_SELECT_XOR:   /* Binary "xor" operation for hyperslabs */
-                case H5S_SELECT_NOTA:  /* Binary "B not A" operation for hyperslabs */
-                    op = H5S_SELECT_SET; /* Maps to "set" operation when applied to "none" selection */
-                    break;
-
-                case H5S_SELECT_AND:   /* Binary "and" operation for hyperslabs */
-                case H5S_SELECT_NOTB:  /* Binary "A not B" operation for hyperslabs */
-                    HGOTO_DONE(SUCCEED);        /* Selection stays "none" */
-
-                case H5S_SELECT_NOOP:
-                case H5S_SELECT_APPEND:
-                case H5S_SELECT_PREPEND:
-                case H5S_SELECT_INVALID:
-                default:
-                    HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
-            } /* end switch */
-            break;
-
-        case H5S_SEL_ALL:    /* All elements selected in dataspace */
-            switch(op) {
-                case H5S_SELECT_SET:   /* Select "set" operation */
-                    /* Change "all" selection to hyperslab selection */
-                    break;
-
-                case H5S_SELECT_OR:    /* Binary "or" operation for hyperslabs */
-                    HGOTO_DONE(SUCCEED);        /* Selection stays "all" */
-
-                case H5S_SELECT_AND:   /* Binary "and" operation for hyperslabs */
-                    op = H5S_SELECT_SET; /* Maps to "set" operation when applied to "none" selection */
-                    break;
-
-                case H5S_SELECT_XOR:   /* Binary "xor" operation for hyperslabs */
-                case H5S_SELECT_NOTB:  /* Binary "A not B" operation for hyperslabs */
-                    /* Convert current "all" selection to "real" hyperslab selection */
-                    /* Then allow operation to proceed */
-                    {
-                        const hsize_t *tmp_start;       /* Temporary start information */
-                        const hsize_t *tmp_stride;      /* Temporary stride information */
-                        const hsize_t *tmp_count;       /* Temporary count information */
-                        const hsize_t *tmp_block;       /* Temporary block information */
-
-                        /* Set up temporary information for the dimensions */
-                        tmp_start = H5S_hyper_zeros_g;
-                        tmp_stride = tmp_count = H5S_hyper_ones_g;
-                        tmp_block = space->extent.size;
-
-                        /* Convert to hyperslab selection */
-                        if(H5S_select_hyperslab(space, H5S_SELECT_SET, tmp_start, tmp_stride, tmp_count, tmp_block) < 0)
-                            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTDELETE, FAIL, "can't convert selection")
-                    } /* end case */
-                    break;
-
-                case H5S_SELECT_NOTA:  /* Binary "B not A" operation for hyperslabs */
-                    /* Convert to "none" selection */
-                    if(H5S_select_none(space) < 0)
-                        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't convert selection")
-                    HGOTO_DONE(SUCCEED);
-
-                case H5S_SELECT_NOOP:
-                case H5S_SELECT_APPEND:
-                case H5S_SELECT_PREPEND:
-                case H5S_SELECT_INVALID:
-                default:
-                    HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
-            } /* end switch */
-            break;
-
-        case H5S_SEL_HYPERSLABS:
-            /* Hyperslab operation on hyperslab selection, OK */
-            break;
-
-        case H5S_SEL_POINTS: /* Can't combine hyperslab operations and point selections currently */
-            if(op == H5S_SELECT_SET)      /* Allow only "set" operation to proceed */
-                break;
-            /* Else fall through to error */
-            H5_ATTR_FALLTHROUGH
-
-        case H5S_SEL_ERROR:
-        case H5S_SEL_N:
-        default:
-            HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
-    } /* end switch */
+    if(H5S__hyper_fixup_op(space, &op, &finished) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't prepare selection for operation")
+    if(finished)
+        HGOTO_DONE(SUCCEED)
 
     if(op == H5S_SELECT_SET) {
         /* Set selection to regular hyperslab */
@@ -10203,6 +10994,225 @@ done:
 } /* end H5Sselect_hyperslab() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5S_select_blocks
+ *
+ * Purpose:     Internal version of H5Sselect_blocks().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5S_select_blocks(H5S_t *space, H5S_seloper_t op, size_t num_blocks,
+    const hsize_t *start, const hsize_t *block)
+{
+    H5S_hyper_span_info_t *new_spans = NULL;    /* Span tree for the blocks */
+    unsigned    rank;                   /* Rank of the dataspace */
+    size_t      nblocks = 0;            /* # of blocks with elements */
+    hbool_t     finished;               /* Whether the operation has nothing left to do */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check args */
+    HDassert(space);
+    HDassert(start || 0 == num_blocks);
+    HDassert(op >= H5S_SELECT_SET && op <= H5S_SELECT_NOTA);
+
+    /* Check the blocks */
+    rank = space->extent.rank;
+    for(u = 0; u < num_blocks; u++) {
+        hbool_t empty = FALSE;      /* Whether the block has no elements */
+        unsigned v;                 /* Local index variable */
+
+        for(v = 0; v < rank; v++) {
+            hsize_t blk_start = start[(u * rank) + v];
+            hsize_t blk_size = block ? block[(u * rank) + v] : 1;
+
+            if(H5S_UNLIMITED == blk_size || H5S_UNLIMITED == blk_start
+                    || (blk_start + blk_size) < blk_start)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid block")
+            if(0 == blk_size)
+                empty = TRUE;
+        } /* end for */
+        if(!empty)
+            nblocks++;
+    } /* end for */
+
+    /* Blocks without elements work like a zero-sized hyperslab */
+    if(0 == nblocks) {
+        switch(op) {
+            case H5S_SELECT_SET:   /* Select "set" operation */
+            case H5S_SELECT_AND:   /* Binary "and" operation for hyperslabs */
+            case H5S_SELECT_NOTA:  /* Binary "B not A" operation for hyperslabs */
+                /* Convert to "none" selection */
+                if(H5S_select_none(space) < 0)
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't convert selection")
+                HGOTO_DONE(SUCCEED);
+
+            case H5S_SELECT_OR:    /* Binary "or" operation for hyperslabs */
+            case H5S_SELECT_XOR:   /* Binary "xor" operation for hyperslabs */
+            case H5S_SELECT_NOTB:  /* Binary "A not B" operation for hyperslabs */
+                HGOTO_DONE(SUCCEED);        /* Selection stays same */
+
+            case H5S_SELECT_NOOP:
+            case H5S_SELECT_APPEND:
+            case H5S_SELECT_PREPEND:
+            case H5S_SELECT_INVALID:
+            default:
+                HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+        } /* end switch */
+    } /* end if */
+
+    /* Build the span tree for the blocks */
+    if(NULL == (new_spans = H5S__hyper_build_spans(rank, num_blocks, start, block)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, FAIL, "can't build hyperslab spans for blocks")
+
+    /* Check for operating on unlimited selection */
+    if((H5S_GET_SELECT_TYPE(space) == H5S_SEL_HYPERSLABS)
+            && (space->select.sel_info.hslab->unlim_dim >= 0)
+            && (op != H5S_SELECT_SET)) {
+        /* Check for invalid operation */
+        if(!((op == H5S_SELECT_AND) || (op == H5S_SELECT_NOTA)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_UNSUPPORTED, FAIL, "unsupported operation on unlimited selection")
+        HDassert(space->select.sel_info.hslab->diminfo_valid);
+
+        /* Clip unlimited selection to include new selection */
+        if(H5S_hyper_clip_unlim(space, new_spans->high_bounds[space->select.sel_info.hslab->unlim_dim] + 1) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCLIP, FAIL, "failed to clip unlimited selection")
+
+        /* If an empty space was returned it must be "none" */
+        HDassert((space->select.num_elem > (hsize_t)0) || (space->select.type->type == H5S_SEL_NONE));
+    } /* end if */
+
+    /* Fixup operation for non-hyperslab selections */
+    if(H5S__hyper_fixup_op(space, &op, &finished) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't prepare selection for operation")
+    if(finished)
+        HGOTO_DONE(SUCCEED)
+
+    if(op == H5S_SELECT_SET) {
+        /* If we are setting a new selection, remove current selection first */
+        if(H5S_SELECT_RELEASE(space) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTDELETE, FAIL, "can't release selection")
+
+        /* Allocate space for the hyperslab selection information */
+        if(NULL == (space->select.sel_info.hslab = H5FL_CALLOC(H5S_hyper_sel_t)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate hyperslab info")
+
+        /* Set selection type */
+        space->select.type = H5S_sel_hyper;
+
+        /* Set unlim_dim */
+        space->select.sel_info.hslab->unlim_dim = -1;
+
+        /* Set the hyperslab selection to the new span tree */
+        space->select.sel_info.hslab->span_lst = new_spans;
+        new_spans = NULL;
+
+        /* Set the number of elements in current selection */
+        space->select.num_elem = H5S__hyper_spans_nelem(space->select.sel_info.hslab->span_lst);
+
+        /* Attempt to build "optimized" start/stride/count/block information
+         * from resulting hyperslab span tree.
+         */
+        H5S__hyper_rebuild(space);
+    } /* end if */
+    else {
+        hbool_t new_spans_owned = FALSE;
+        hbool_t updated_spans = FALSE;
+
+        /* Sanity check */
+        HDassert(H5S_GET_SELECT_TYPE(space) == H5S_SEL_HYPERSLABS);
+
+        /* Check if there's no hyperslab span information currently */
+        if(NULL == space->select.sel_info.hslab->span_lst)
+            if(H5S__hyper_generate_spans(space) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_UNINITIALIZED, FAIL, "dataspace does not have span tree")
+
+        /* Set selection type */
+        space->select.type = H5S_sel_hyper;
+
+        /* Combine the new spans with the current selection */
+        if(H5S__fill_in_new_space(space, op, new_spans, TRUE, &new_spans_owned, &updated_spans, &space) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't combine blocks with selection")
+        if(new_spans_owned)
+            new_spans = NULL;
+
+        /* The regular hyperslab information may need to be rebuilt */
+        if(updated_spans)
+            space->select.sel_info.hslab->diminfo_valid = H5S_DIMINFO_VALID_NO;
+    } /* end else */
+
+done:
+    if(new_spans)
+        H5S__hyper_free_span_info(new_spans);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S_select_blocks() */
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5Sselect_blocks
+ PURPOSE
+    Specify a list of blocks to combine with the current selection
+ USAGE
+    herr_t H5Sselect_blocks(dsid, op, num_blocks, start, block)
+        hid_t dsid;             IN: Dataspace ID of selection to modify
+        H5S_seloper_t op;       IN: Operation to perform on current selection
+        size_t num_blocks;      IN: Number of blocks
+        const hsize_t *start;   IN: Starting coordinates of each block
+        const hsize_t *block;   IN: Size of each block
+ RETURNS
+    Non-negative on success/Negative on failure
+ DESCRIPTION
+    Combines the union of a list of blocks with the current selection for a
+    dataspace, the same way as calling H5Sselect_hyperslab() with
+    H5S_SELECT_OR for each block and then combining the result with the
+    current selection using OP.  The START and BLOCK arrays are 2-D arrays
+    of size <dataspace rank> by NUM_BLOCKS, holding the starting coordinates
+    and the size of each block.  If BLOCK is NULL, each block is a single
+    element.  The blocks may overlap and may be given in any order.
+    Building the selection takes O(n log n) time for n blocks that don't
+    overlap, instead of the O(n^2) time of adding them one at a time.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5Sselect_blocks(hid_t space_id, H5S_seloper_t op, size_t num_blocks,
+    const hsize_t *start, const hsize_t *block)
+{
+    H5S_t *space;               /* Dataspace to modify selection of */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE5("e", "iSsz*h*h", space_id, op, num_blocks, start, block);
+
+    /* Check args */
+    if(NULL == (space = (H5S_t *)H5I_object_verify(space_id, H5I_DATASPACE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataspace")
+    if(H5S_SCALAR == H5S_GET_EXTENT_TYPE(space))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "hyperslab doesn't support H5S_SCALAR space")
+    if(H5S_NULL == H5S_GET_EXTENT_TYPE(space))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "hyperslab doesn't support H5S_NULL space")
+    if(start == NULL && num_blocks > 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "blocks not specified")
+    if(!(op >= H5S_SELECT_SET && op <= H5S_SELECT_NOTA))
+        HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+
+    if(H5S_select_blocks(space, op, num_blocks, start, block) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to select blocks")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Sselect_blocks() */
+
+
 /*--------------------------------------------------------------------------
  NAME
     H5S_combine_hyperslab
@@ -226,6 +226,7 @@ typedef struct {
     int unlim_dim;                      /* Dimension where selection is unlimited, or -1 if none */
     hsize_t num_elem_non_unlim;         /* # of elements in a "slice" excluding the unlimited dimension */
     H5S_hyper_span_info_t *span_lst;    /* List of hyperslab span information of all dimensions */
+    struct H5S_hyper_seq_cache_t *seq_cache; /* Sequence list generated for the spans, or NULL */
 } H5S_hyper_sel_t;
 
 /* Selection information methods */
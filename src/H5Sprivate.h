@@ -70,6 +70,12 @@ typedef struct {
     hssize_t sel_off[H5S_MAX_RANK];     /* "Flattened" selection offset information */
     hbool_t flattened[H5S_MAX_RANK];    /* Whether this dimension has been flattened */
 
+    /* Cached sequence list fields (irregular hyperslab selections only) */
+    struct H5S_hyper_seq_cache_t *seq_cache; /* Sequence list cached for the selection (NULL when not used) */
+    hsize_t seq_base;       /* Byte offset of the selection's first element */
+    size_t seq_idx;         /* Next sequence in the list */
+    size_t seq_used;        /* # of bytes of that sequence already returned */
+
     /* Irregular hyperslab selection fields */
     hsize_t loc_off[H5S_MAX_RANK]; /* Byte offset in buffer, for each dimension's current offset */
     H5S_hyper_span_info_t *spans;  /* Pointer to copy of the span tree */
@@ -280,6 +286,8 @@ H5_DLL herr_t H5S_select_elements(H5S_t *space, H5S_seloper_t op,
 /* Operations on hyperslab selections */
 H5_DLL herr_t H5S_select_hyperslab(H5S_t *space, H5S_seloper_t op, const hsize_t start[],
     const hsize_t *stride, const hsize_t count[], const hsize_t *block);
+H5_DLL herr_t H5S_select_blocks(H5S_t *space, H5S_seloper_t op,
+    size_t num_blocks, const hsize_t *start, const hsize_t *block);
 H5_DLL herr_t H5S_combine_hyperslab(H5S_t *old_space, H5S_seloper_t op,
     const hsize_t start[], const hsize_t *stride, const hsize_t count[],
     const hsize_t *block, H5S_t **new_space);
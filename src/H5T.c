@@ -301,6 +301,19 @@
 /* Local Typedefs */
 /******************/
 
+#ifdef H5_HAVE_THREADSAFE
+/* Info for converting a buffer in pieces with H5T_convert_parallel() */
+typedef struct H5T_conv_parallel_t {
+    H5T_path_t *tpath;          /* Conversion path */
+    hid_t src_id;               /* Source datatype ID */
+    hid_t dst_id;               /* Destination datatype ID */
+    uint8_t *buf;               /* Buffer to convert */
+    size_t nelmts;              /* Total # of elements to convert */
+    size_t piece_nelmts;        /* # of elements in each piece (but the last) */
+    size_t piece_elmt_size;     /* Bytes per element where the pieces are converted */
+    void *api_ctx;              /* API context of the calling thread */
+} H5T_conv_parallel_t;
+#endif /* H5_HAVE_THREADSAFE */
 
 /********************/
 /* Local Prototypes */
@@ -313,6 +326,9 @@ static herr_t H5T__set_size(H5T_t *dt, size_t size);
 static herr_t H5T__close_cb(H5T_t *dt);
 static H5T_path_t *H5T__path_find_real(const H5T_t *src, const H5T_t *dst, const char *name, H5T_conv_func_t *conv);
 static hbool_t H5T__detect_vlen_ref(const H5T_t *dt);
+#ifdef H5_HAVE_THREADSAFE
+static herr_t H5T__conv_parallel_piece(size_t idx, void *_udata);
+#endif /* H5_HAVE_THREADSAFE */
 
 
 /*****************************/
@@ -1787,6 +1803,7 @@ H5Tcopy(hid_t obj_id)
         case H5I_ERROR_MSG:
         case H5I_ERROR_STACK:
         case H5I_SPACE_SEL_ITER:
+        case H5I_EVENTSET:
         case H5I_NTYPES:
         default:
             HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, H5I_INVALID_HID, "not a datatype or dataset")
@@ -5111,6 +5128,178 @@ done:
 } /* end H5T_convert() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:  H5T_path_parallel
+ *
+ * Purpose:   Checks whether a conversion path can be split across threads
+ *            by H5T_convert_parallel(): it must be one of the library's
+ *            own conversions between integer, floating-point and bitfield
+ *            types, which keep no state while converting.
+ *
+ * Return:    TRUE/FALSE (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5T_path_parallel(const H5T_path_t *p)
+{
+    H5T_class_t src_class, dst_class;   /* Datatype classes */
+    hbool_t ret_value = FALSE;          /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(p);
+
+    if(!p->is_noop && !p->conv.is_app && p->src && p->dst) {
+        src_class = H5T_get_class(p->src, FALSE);
+        dst_class = H5T_get_class(p->dst, FALSE);
+        if((H5T_INTEGER == src_class || H5T_FLOAT == src_class || H5T_BITFIELD == src_class)
+                && (H5T_INTEGER == dst_class || H5T_FLOAT == dst_class || H5T_BITFIELD == dst_class))
+            ret_value = TRUE;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_path_parallel() */
+
+#ifdef H5_HAVE_THREADSAFE
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T__conv_parallel_piece
+ *
+ * Purpose:   Converts piece IDX of a buffer for H5T_convert_parallel(),
+ *            in place where the piece starts.  Runs on the calling thread
+ *            or on a helper thread, which borrows the calling thread's
+ *            API context for the conversion exception callback.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__conv_parallel_piece(size_t idx, void *_udata)
+{
+    H5T_conv_parallel_t *udata = (H5T_conv_parallel_t *)_udata;
+    size_t start = idx * udata->piece_nelmts;   /* First element of the piece */
+    hbool_t shared;                     /* Whether the API context is borrowed */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    shared = H5CX_share(udata->api_ctx);
+
+    /* Call the library's conversion function directly, H5T_convert()
+     * changes the path's state.
+     */
+    if((udata->tpath->conv.u.lib_func)(udata->src_id, udata->dst_id, &(udata->tpath->cdata),
+            MIN(udata->piece_nelmts, udata->nelmts - start), (size_t)0, (size_t)0,
+            udata->buf + (start * udata->piece_elmt_size), NULL) < 0)
+        ret_value = FAIL;
+
+    if(shared)
+        H5CX_unshare();
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_parallel_piece() */
+#endif /* H5_HAVE_THREADSAFE */
+
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T_convert_parallel
+ *
+ * Purpose:   Converts NELMTS packed elements in BUF like H5T_convert(),
+ *            with up to NTHREADS threads converting runs of whole elements
+ *            at the same time, when the path allows it (see
+ *            H5T_path_parallel()), the library is thread-safe, there's no
+ *            conversion exception callback and there are enough elements
+ *            for each thread.  Otherwise the elements are converted with
+ *            H5T_convert() on the calling thread.
+ *
+ *            Each piece is converted in place where the larger of its
+ *            source and destination elements would start, so when the
+ *            sizes differ the pieces are spread out before converting
+ *            (for larger destination elements) or packed together
+ *            afterwards (for smaller ones).
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T_convert_parallel(H5T_path_t *tpath, hid_t src_id, hid_t dst_id,
+    size_t nelmts, void *buf, unsigned nthreads)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(tpath);
+    HDassert(buf);
+
+#ifdef H5_HAVE_THREADSAFE
+    if(nthreads > 1 && H5T_path_parallel(tpath)) {
+        size_t src_size = tpath->src->shared->size;     /* Source element size */
+        size_t dst_size = tpath->dst->shared->size;     /* Destination element size */
+        size_t max_size = MAX(src_size, dst_size);      /* Larger element size */
+        size_t npieces;                 /* # of pieces to convert */
+        H5T_conv_cb_t cb_struct;        /* Conversion exception callback */
+
+        /* Get conversion exception callback property (which also leaves
+         * it in the API context for the helper threads)
+         */
+        if(H5CX_get_dt_conv_cb(&cb_struct) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "unable to get conversion exception callback")
+
+        /* Application callbacks may not expect to be called from several threads */
+        npieces = MIN(nthreads, (nelmts * max_size) / H5T_CONV_PARALLEL_MIN);
+        if(NULL == cb_struct.func && npieces > 1) {
+            H5T_conv_parallel_t udata;  /* Info for the pieces */
+            uint8_t *ubuf = (uint8_t *)buf;
+            size_t u;                   /* Local index variable */
+
+            udata.tpath = tpath;
+            udata.src_id = src_id;
+            udata.dst_id = dst_id;
+            udata.buf = ubuf;
+            udata.nelmts = nelmts;
+            udata.piece_nelmts = (nelmts + npieces - 1) / npieces;
+            udata.piece_elmt_size = max_size;
+            udata.api_ctx = H5CX_get_shared();
+
+            /* Spread out the pieces, from the last one down, so each has
+             * room for its larger destination elements
+             */
+            if(dst_size > src_size)
+                for(u = npieces - 1; u > 0; u--)
+                    HDmemmove(ubuf + (u * udata.piece_nelmts * dst_size), ubuf + (u * udata.piece_nelmts * src_size),
+                            MIN(udata.piece_nelmts, nelmts - (u * udata.piece_nelmts)) * src_size);
+
+            tpath->cdata.command = H5T_CONV_CONV;
+            if(H5TS_run_tasks(nthreads, npieces, H5T__conv_parallel_piece, &udata) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+            /* Pack the converted pieces together */
+            if(dst_size < src_size)
+                for(u = 1; u < npieces; u++)
+                    HDmemmove(ubuf + (u * udata.piece_nelmts * dst_size), ubuf + (u * udata.piece_nelmts * src_size),
+                            MIN(udata.piece_nelmts, nelmts - (u * udata.piece_nelmts)) * dst_size);
+
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+    } /* end if */
+#else /* H5_HAVE_THREADSAFE */
+    (void)nthreads;
+#endif /* H5_HAVE_THREADSAFE */
+
+    if(H5T_convert(tpath, src_id, dst_id, nelmts, (size_t)0, (size_t)0, buf, NULL) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_convert_parallel() */
+
+
 /*-------------------------------------------------------------------------
  * Function:  H5T_oloc
  *
@@ -26,6 +26,18 @@ typedef struct H5TS_cancel_struct {
     unsigned int cancel_count;
 } H5TS_cancel_t;
 
+/* task group shared by the threads of H5TS_run_tasks()/H5TS_start_tasks() */
+struct H5TS_task_group_t {
+    H5TS_mutex_simple_t lock;       /* protects the fields below */
+    size_t next;                    /* index of next task to hand out */
+    size_t ntasks;                  /* total number of tasks */
+    H5TS_task_func_t func;          /* task callback */
+    void *udata;                    /* task callback context */
+    hbool_t failed;                 /* whether any task failed */
+    H5TS_thread_t *threads;         /* helper threads */
+    unsigned nhelpers;              /* number of helper threads running */
+};
+
 /* Global variable definitions */
 #ifdef H5_HAVE_WIN_THREADS
 H5TS_once_t H5TS_first_init_g;
@@ -36,6 +48,9 @@ H5TS_key_t H5TS_errstk_key_g;
 H5TS_key_t H5TS_funcstk_key_g;
 H5TS_key_t H5TS_apictx_key_g;
 H5TS_key_t H5TS_cancel_key_g;
+#ifndef H5_HAVE_WIN_THREADS
+static H5TS_key_t H5TS_unlock_key_g;   /* Lock count of a thread that has let go of the API lock */
+#endif /* H5_HAVE_WIN_THREADS */
 
 
 /*--------------------------------------------------------------------------
@@ -115,6 +130,9 @@ H5TS_pthread_first_thread_init(void)
 
     /* initialize key for thread cancellability mechanism */
     pthread_key_create(&H5TS_cancel_key_g, H5TS_key_destructor);
+
+    /* initialize key for threads that have let go of the API lock */
+    pthread_key_create(&H5TS_unlock_key_g, NULL);
 }
 #endif /* H5_HAVE_WIN_THREADS */
 
@@ -218,6 +236,158 @@ H5TS_mutex_unlock(H5TS_mutex_t *mutex)
 #endif /* H5_HAVE_WIN_THREADS */
 } /* H5TS_mutex_unlock */
 
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_api_lock_release
+ *
+ * USAGE
+ *    H5TS_api_lock_release()
+ *
+ * RETURNS
+ *    0 on success and non-zero on error.
+ *
+ * DESCRIPTION
+ *    Lets go of the global API lock held by this thread, however many
+ *    times it has been acquired, so other threads can enter the library
+ *    while this one does something slow that touches no shared library
+ *    state, such as reading raw data into its own buffers.  The lock
+ *    must be taken back with H5TS_api_lock_reacquire() before the thread
+ *    uses any shared state again.  (A no-op with Windows threads.)
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_api_lock_release(void)
+{
+#ifdef  H5_HAVE_WIN_THREADS
+    return 0;
+#else /* H5_HAVE_WIN_THREADS */
+    unsigned int lock_count;
+    herr_t ret_value = pthread_mutex_lock(&H5_g.init_lock.atomic_lock);
+
+    if(ret_value)
+        return ret_value;
+
+    HDassert(H5_g.init_lock.lock_count > 0);
+    HDassert(pthread_equal(HDpthread_self(), H5_g.init_lock.owner_thread));
+    lock_count = H5_g.init_lock.lock_count;
+    H5_g.init_lock.lock_count = 0;
+
+    ret_value = pthread_mutex_unlock(&H5_g.init_lock.atomic_lock);
+
+    /* Remember the count, to restore it when the lock is taken back */
+    if(0 == ret_value)
+        ret_value = pthread_setspecific(H5TS_unlock_key_g, (void *)(uintptr_t)lock_count);
+    if(0 == ret_value)
+        ret_value = pthread_cond_signal(&H5_g.init_lock.cond_var);
+
+    return ret_value;
+#endif /* H5_HAVE_WIN_THREADS */
+} /* H5TS_api_lock_release */
+
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_api_lock_reacquire
+ *
+ * USAGE
+ *    H5TS_api_lock_reacquire()
+ *
+ * RETURNS
+ *    0 on success and non-zero on error.
+ *
+ * DESCRIPTION
+ *    Takes back the global API lock that this thread let go of with
+ *    H5TS_api_lock_release(), waiting for other threads to leave the
+ *    library if need be.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_api_lock_reacquire(void)
+{
+#ifdef  H5_HAVE_WIN_THREADS
+    return 0;
+#else /* H5_HAVE_WIN_THREADS */
+    unsigned int lock_count = (unsigned int)(uintptr_t)pthread_getspecific(H5TS_unlock_key_g);
+    herr_t ret_value;
+
+    HDassert(lock_count > 0);
+
+    if(0 != (ret_value = pthread_mutex_lock(&H5_g.init_lock.atomic_lock)))
+        return ret_value;
+
+    while(H5_g.init_lock.lock_count)
+        pthread_cond_wait(&H5_g.init_lock.cond_var, &H5_g.init_lock.atomic_lock);
+    H5_g.init_lock.owner_thread = HDpthread_self();
+    H5_g.init_lock.lock_count = lock_count;
+
+    ret_value = pthread_mutex_unlock(&H5_g.init_lock.atomic_lock);
+
+    if(0 == ret_value)
+        ret_value = pthread_setspecific(H5TS_unlock_key_g, NULL);
+
+    return ret_value;
+#endif /* H5_HAVE_WIN_THREADS */
+} /* H5TS_api_lock_reacquire */
+
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_api_lock_released
+ *
+ * USAGE
+ *    H5TS_api_lock_released()
+ *
+ * RETURNS
+ *    TRUE if this thread has let go of the global API lock with
+ *    H5TS_api_lock_release() and not taken it back yet, FALSE otherwise.
+ *
+ *--------------------------------------------------------------------------
+ */
+hbool_t
+H5TS_api_lock_released(void)
+{
+#ifdef  H5_HAVE_WIN_THREADS
+    return FALSE;
+#else /* H5_HAVE_WIN_THREADS */
+    return (hbool_t)(NULL != pthread_getspecific(H5TS_unlock_key_g));
+#endif /* H5_HAVE_WIN_THREADS */
+} /* H5TS_api_lock_released */
+
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_api_lock_held
+ *
+ * USAGE
+ *    H5TS_api_lock_held()
+ *
+ * RETURNS
+ *    TRUE if this thread holds the global API lock, FALSE otherwise
+ *    (always FALSE with Windows threads).
+ *
+ *--------------------------------------------------------------------------
+ */
+hbool_t
+H5TS_api_lock_held(void)
+{
+#ifdef  H5_HAVE_WIN_THREADS
+    return FALSE;
+#else /* H5_HAVE_WIN_THREADS */
+    hbool_t ret_value = FALSE;
+
+    if(0 == pthread_mutex_lock(&H5_g.init_lock.atomic_lock)) {
+        ret_value = (hbool_t)(H5_g.init_lock.lock_count > 0 &&
+                pthread_equal(HDpthread_self(), H5_g.init_lock.owner_thread));
+        (void)pthread_mutex_unlock(&H5_g.init_lock.atomic_lock);
+    } /* end if */
+
+    return ret_value;
+#endif /* H5_HAVE_WIN_THREADS */
+} /* H5TS_api_lock_held */
+
 
 /*--------------------------------------------------------------------------
  * NAME
@@ -528,5 +698,237 @@ H5TS_create_thread(void *(*func)(void *), H5TS_attr_t *attr, void *udata)
 
 } /* H5TS_create_thread */
 
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS__task_worker
+ *
+ * RETURNS
+ *    NULL
+ *
+ * DESCRIPTION
+ *    Thread body for H5TS_run_tasks(): repeatedly claims the next
+ *    unclaimed task from the group and runs it, until none are left.
+ *
+ *--------------------------------------------------------------------------
+ */
+static void *
+H5TS__task_worker(void *_grp)
+{
+    H5TS_task_group_t *grp = (H5TS_task_group_t *)_grp;
+
+    for(;;) {
+        size_t idx;
+
+        H5TS_mutex_lock_simple(&grp->lock);
+        if(grp->next >= grp->ntasks) {
+            H5TS_mutex_unlock_simple(&grp->lock);
+            break;
+        } /* end if */
+        idx = grp->next++;
+        H5TS_mutex_unlock_simple(&grp->lock);
+
+        if((grp->func)(idx, grp->udata) < 0) {
+            H5TS_mutex_lock_simple(&grp->lock);
+            grp->failed = TRUE;
+            H5TS_mutex_unlock_simple(&grp->lock);
+        } /* end if */
+    } /* end for */
+
+    return NULL;
+} /* H5TS__task_worker */
+
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS__task_group_init
+ *
+ * RETURNS
+ *    Nothing
+ *
+ * DESCRIPTION
+ *    Initializes a task group, with no helper threads yet.
+ *
+ *--------------------------------------------------------------------------
+ */
+static void
+H5TS__task_group_init(H5TS_task_group_t *grp, size_t ntasks, H5TS_task_func_t func, void *udata)
+{
+    H5TS_mutex_init(&grp->lock);
+    grp->next = 0;
+    grp->ntasks = ntasks;
+    grp->func = func;
+    grp->udata = udata;
+    grp->failed = FALSE;
+    grp->threads = NULL;
+    grp->nhelpers = 0;
+} /* H5TS__task_group_init */
+
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS__task_group_spawn
+ *
+ * RETURNS
+ *    Nothing
+ *
+ * DESCRIPTION
+ *    Starts up to 'nhelpers' helper threads working on a task group.  If a
+ *    thread can't be created, the group just gets fewer helpers.
+ *
+ *--------------------------------------------------------------------------
+ */
+static void
+H5TS__task_group_spawn(H5TS_task_group_t *grp, unsigned nhelpers)
+{
+    if(nhelpers == 0)
+        return;
+
+    /* Don't use H5MM calls here, helper threads are below the library */
+    if(NULL == (grp->threads = (H5TS_thread_t *)HDmalloc(sizeof(H5TS_thread_t) * nhelpers)))
+        return;
+    for(grp->nhelpers = 0; grp->nhelpers < nhelpers; grp->nhelpers++) {
+#ifdef H5_HAVE_WIN_THREADS
+        if(NULL == (grp->threads[grp->nhelpers] = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)H5TS__task_worker, grp, 0, NULL)))
+            break;
+#else /* H5_HAVE_WIN_THREADS */
+        if(pthread_create(&grp->threads[grp->nhelpers], NULL, H5TS__task_worker, grp))
+            break;
+#endif /* H5_HAVE_WIN_THREADS */
+    } /* end for */
+} /* H5TS__task_group_spawn */
+
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS__task_group_finish
+ *
+ * RETURNS
+ *    SUCCEED if every task in the group succeeded, FAIL otherwise.
+ *
+ * DESCRIPTION
+ *    Waits for a task group's helper threads and releases its resources
+ *    (but not the group itself).  The calling thread helps with any
+ *    tasks that haven't been started yet.
+ *
+ *--------------------------------------------------------------------------
+ */
+static herr_t
+H5TS__task_group_finish(H5TS_task_group_t *grp)
+{
+    unsigned u;
+
+    /* The calling thread works on the tasks too */
+    H5TS__task_worker(grp);
+
+    /* Wait for the helpers */
+    for(u = 0; u < grp->nhelpers; u++) {
+        H5TS_wait_for_thread(grp->threads[u]);
+#ifdef H5_HAVE_WIN_THREADS
+        CloseHandle(grp->threads[u]);
+#endif /* H5_HAVE_WIN_THREADS */
+    } /* end for */
+    if(grp->threads)
+        HDfree(grp->threads);
+
+    H5TS_mutex_destroy(&grp->lock);
+
+    return grp->failed ? FAIL : SUCCEED;
+} /* H5TS__task_group_finish */
+
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_run_tasks
+ *
+ * RETURNS
+ *    SUCCEED if every task succeeded, FAIL otherwise.
+ *
+ * DESCRIPTION
+ *    Runs 'func' once for each task index in [0, ntasks), spread over up
+ *    to 'nthreads' threads (the calling thread is one of them), and waits
+ *    for all of them to finish.  Tasks must be independent of each other
+ *    and must not enter the library through the public API.
+ *
+ *    If a helper thread can't be created, the remaining tasks are simply
+ *    run by the threads that do exist.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_run_tasks(unsigned nthreads, size_t ntasks, H5TS_task_func_t func, void *udata)
+{
+    H5TS_task_group_t grp;
+
+    H5TS__task_group_init(&grp, ntasks, func, udata);
+
+    /* Spawn helper threads, if there's more than one task to share */
+    if(nthreads > 1 && ntasks > 1)
+        H5TS__task_group_spawn(&grp, (unsigned)MIN(nthreads, ntasks) - 1);
+
+    return H5TS__task_group_finish(&grp);
+} /* H5TS_run_tasks */
+
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_start_tasks
+ *
+ * RETURNS
+ *    The task group on success, NULL if it couldn't be allocated.
+ *
+ * DESCRIPTION
+ *    Like H5TS_run_tasks(), but returns as soon as up to 'nthreads'
+ *    helper threads have been started on the tasks, leaving the calling
+ *    thread free to do other work.  H5TS_wait_tasks() must be called on
+ *    the group to finish the tasks and release it.
+ *
+ *    If no helper thread can be created, the tasks are run by the calling
+ *    thread before returning.
+ *
+ *--------------------------------------------------------------------------
+ */
+H5TS_task_group_t *
+H5TS_start_tasks(unsigned nthreads, size_t ntasks, H5TS_task_func_t func, void *udata)
+{
+    H5TS_task_group_t *grp;
+
+    if(NULL == (grp = (H5TS_task_group_t *)HDmalloc(sizeof(H5TS_task_group_t))))
+        return NULL;
+    H5TS__task_group_init(grp, ntasks, func, udata);
+
+    if(nthreads > 0 && ntasks > 0)
+        H5TS__task_group_spawn(grp, (unsigned)MIN(nthreads, ntasks));
+    if(0 == grp->nhelpers)
+        H5TS__task_worker(grp);
+
+    return grp;
+} /* H5TS_start_tasks */
+
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_wait_tasks
+ *
+ * RETURNS
+ *    SUCCEED if every task in the group succeeded, FAIL otherwise.
+ *
+ * DESCRIPTION
+ *    Waits for the tasks started by H5TS_start_tasks() to finish and
+ *    releases the task group.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_wait_tasks(H5TS_task_group_t *grp)
+{
+    herr_t ret_value;
+
+    ret_value = H5TS__task_group_finish(grp);
+    HDfree(grp);
+
+    return ret_value;
+} /* H5TS_wait_tasks */
+
 #endif  /* H5_HAVE_THREADSAFE */
 
@@ -61,6 +61,7 @@ typedef INIT_ONCE H5TS_once_t;
 #define H5TS_mutex_init(mutex) InitializeCriticalSection(mutex)
 #define H5TS_mutex_lock_simple(mutex) EnterCriticalSection(mutex)
 #define H5TS_mutex_unlock_simple(mutex) LeaveCriticalSection(mutex)
+#define H5TS_mutex_destroy(mutex) DeleteCriticalSection(mutex)
 
 /* Functions called from DllMain */
 H5_DLL BOOL CALLBACK H5TS_win32_process_enter(PINIT_ONCE InitOnce, PVOID Parameter, PVOID *lpContex);
@@ -102,9 +103,16 @@ typedef pthread_once_t H5TS_once_t;
 #define H5TS_mutex_init(mutex) pthread_mutex_init(mutex, NULL)
 #define H5TS_mutex_lock_simple(mutex) pthread_mutex_lock(mutex)
 #define H5TS_mutex_unlock_simple(mutex) pthread_mutex_unlock(mutex)
+#define H5TS_mutex_destroy(mutex) pthread_mutex_destroy(mutex)
 
 #endif /* H5_HAVE_WIN_THREADS */
 
+/* Callback for each task run by H5TS_run_tasks() */
+typedef herr_t (*H5TS_task_func_t)(size_t idx, void *udata);
+
+/* Group of tasks being run in the background (see H5TS_start_tasks()) */
+typedef struct H5TS_task_group_t H5TS_task_group_t;
+
 /* External global variables */
 extern H5TS_once_t H5TS_first_init_g;
 extern H5TS_key_t H5TS_errstk_key_g;
@@ -119,9 +127,16 @@ extern      "C"
 H5_DLL void   H5TS_pthread_first_thread_init(void);
 H5_DLL herr_t H5TS_mutex_lock(H5TS_mutex_t *mutex);
 H5_DLL herr_t H5TS_mutex_unlock(H5TS_mutex_t *mutex);
+H5_DLL herr_t H5TS_api_lock_release(void);
+H5_DLL herr_t H5TS_api_lock_reacquire(void);
+H5_DLL hbool_t H5TS_api_lock_released(void);
+H5_DLL hbool_t H5TS_api_lock_held(void);
 H5_DLL herr_t H5TS_cancel_count_inc(void);
 H5_DLL herr_t H5TS_cancel_count_dec(void);
 H5_DLL H5TS_thread_t H5TS_create_thread(void *(*func)(void *), H5TS_attr_t * attr, void *udata);
+H5_DLL herr_t H5TS_run_tasks(unsigned nthreads, size_t ntasks, H5TS_task_func_t func, void *udata);
+H5_DLL H5TS_task_group_t *H5TS_start_tasks(unsigned nthreads, size_t ntasks, H5TS_task_func_t func, void *udata);
+H5_DLL herr_t H5TS_wait_tasks(H5TS_task_group_t *grp);
 
 #if defined c_plusplus || defined __cplusplus
 }
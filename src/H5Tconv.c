@@ -236,7 +236,7 @@
 
 #define H5T_CONV_sS(STYPE,DTYPE,ST,DT,D_MIN,D_MAX) {			      \
     HDcompile_assert(sizeof(ST)<=sizeof(DT));				      \
-    H5T_CONV(H5T_CONV_xX, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)              \
+    H5T_CONV(H5T_CONV_xX, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, NULL)        \
 }
 
 #define H5T_CONV_sU_CORE(STYPE,DTYPE,S,D,ST,DT,D_MIN,D_MAX) {			      \
@@ -261,7 +261,7 @@
 
 #define H5T_CONV_sU(STYPE,DTYPE,ST,DT,D_MIN,D_MAX) {			      \
     HDcompile_assert(sizeof(ST)<=sizeof(DT));				      \
-    H5T_CONV(H5T_CONV_sU, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)              \
+    H5T_CONV(H5T_CONV_sU, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, NULL)        \
 }
 
 /* Define to 1 if overflow is possible during conversion, 0 otherwise
@@ -345,17 +345,17 @@
 
 #define H5T_CONV_uS(STYPE, DTYPE, ST, DT, D_MIN, D_MAX) {                     \
     HDcompile_assert(sizeof(ST) <= sizeof(DT));                               \
-    H5T_CONV(H5T_CONV_uS, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)              \
+    H5T_CONV(H5T_CONV_uS, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, NULL)        \
 }
 
 #define H5T_CONV_uU(STYPE,DTYPE,ST,DT,D_MIN,D_MAX) {			      \
     HDcompile_assert(sizeof(ST)<=sizeof(DT));				      \
-    H5T_CONV(H5T_CONV_xX, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)              \
+    H5T_CONV(H5T_CONV_xX, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, NULL)        \
 }
 
 #define H5T_CONV_Ss(STYPE,DTYPE,ST,DT,D_MIN,D_MAX) {			      \
     HDcompile_assert(sizeof(ST)>=sizeof(DT));				      \
-    H5T_CONV(H5T_CONV_Xx, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)              \
+    H5T_CONV(H5T_CONV_Xx, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, NULL)        \
 }
 
 #define H5T_CONV_Su_CORE(STYPE,DTYPE,S,D,ST,DT,D_MIN,D_MAX) {			      \
@@ -391,17 +391,17 @@
 
 #define H5T_CONV_Su(STYPE,DTYPE,ST,DT,D_MIN,D_MAX) {			      \
     HDcompile_assert(sizeof(ST)>=sizeof(DT));				      \
-    H5T_CONV(H5T_CONV_Su, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)              \
+    H5T_CONV(H5T_CONV_Su, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, NULL)        \
 }
 
 #define H5T_CONV_Us(STYPE,DTYPE,ST,DT,D_MIN,D_MAX) {			      \
     HDcompile_assert(sizeof(ST)>=sizeof(DT));				      \
-    H5T_CONV(H5T_CONV_Ux, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)              \
+    H5T_CONV(H5T_CONV_Ux, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, NULL)        \
 }
 
 #define H5T_CONV_Uu(STYPE,DTYPE,ST,DT,D_MIN,D_MAX) {			      \
     HDcompile_assert(sizeof(ST)>=sizeof(DT));				      \
-    H5T_CONV(H5T_CONV_Ux, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)              \
+    H5T_CONV(H5T_CONV_Ux, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, NULL)        \
 }
 
 #define H5T_CONV_su_CORE(STYPE,DTYPE,S,D,ST,DT,D_MIN,D_MAX) {			      \
@@ -428,7 +428,7 @@
 
 #define H5T_CONV_su(STYPE,DTYPE,ST,DT,D_MIN,D_MAX) {			      \
     HDcompile_assert(sizeof(ST)==sizeof(DT));				      \
-    H5T_CONV(H5T_CONV_su, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)              \
+    H5T_CONV(H5T_CONV_su, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, NULL)        \
 }
 
 #define H5T_CONV_us_CORE(STYPE,DTYPE,S,D,ST,DT,D_MIN,D_MAX) {			      \
@@ -455,12 +455,12 @@
 
 #define H5T_CONV_us(STYPE,DTYPE,ST,DT,D_MIN,D_MAX) {			      \
     HDcompile_assert(sizeof(ST)==sizeof(DT));				      \
-    H5T_CONV(H5T_CONV_us, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)              \
+    H5T_CONV(H5T_CONV_us, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, NULL)        \
 }
 
-#define H5T_CONV_fF(STYPE,DTYPE,ST,DT,D_MIN,D_MAX) {			      \
+#define H5T_CONV_fF(STYPE,DTYPE,ST,DT,D_MIN,D_MAX,VEC) {			      \
     HDcompile_assert(sizeof(ST)<=sizeof(DT));				      \
-    H5T_CONV(H5T_CONV_xX, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)              \
+    H5T_CONV(H5T_CONV_xX, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, VEC)         \
 }
 
 /* Same as H5T_CONV_Xx_CORE, except that instead of using D_MAX and D_MIN
@@ -497,9 +497,9 @@
         *(D) = (DT)(*(S));					              \
 }
 
-#define H5T_CONV_Ff(STYPE,DTYPE,ST,DT,D_MIN,D_MAX) {			      \
+#define H5T_CONV_Ff(STYPE,DTYPE,ST,DT,D_MIN,D_MAX,VEC) {			      \
     HDcompile_assert(sizeof(ST)>=sizeof(DT));				      \
-    H5T_CONV(H5T_CONV_Ff, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)              \
+    H5T_CONV(H5T_CONV_Ff, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, VEC)         \
 }
 
 #define H5T_HI_LO_BIT_SET(TYP, V, LO, HI) {                                   \
@@ -589,8 +589,8 @@
     *(D) = (DT)(*(S));							      \
 }
 
-#define H5T_CONV_xF(STYPE,DTYPE,ST,DT,D_MIN,D_MAX) {			      \
-    H5T_CONV(H5T_CONV_xF, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, Y)                 \
+#define H5T_CONV_xF(STYPE,DTYPE,ST,DT,D_MIN,D_MAX,VEC) {			      \
+    H5T_CONV(H5T_CONV_xF, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, Y, VEC)            \
 }
 
 /* Quincey added the condition branch (else if (*(S) != (ST)((DT)(*(S))))).
@@ -642,8 +642,8 @@
         *(D) = (DT)(*(S));					              \
 }
 
-#define H5T_CONV_Fx(STYPE,DTYPE,ST,DT,D_MIN,D_MAX) {			      \
-    H5T_CONV(H5T_CONV_Fx, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, Y)              \
+#define H5T_CONV_Fx(STYPE,DTYPE,ST,DT,D_MIN,D_MAX,VEC) {			      \
+    H5T_CONV(H5T_CONV_Fx, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, Y, VEC)         \
 }
 
 /* Since all "no exception" cores do the same thing (assign the value in the
@@ -657,8 +657,32 @@
 #endif /* H5_WANT_DCONV_EXCEPTION */
 
 
-/* The main part of every integer hardware conversion macro */
-#define H5T_CONV(GUTS,STYPE,DTYPE,ST,DT,D_MIN,D_MAX,PREC)  		      \
+/* Vectorized kernels for some of the conversions, which are defined below.
+ * H5T_CONV_VEC_EX names a kernel that clamps values like the "no exception"
+ * cores do, so it is only used with H5_WANT_DCONV_EXCEPTION (the conversions
+ * are plain casts without it).
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && \
+        (defined(__clang__) || __GNUC__ >= 6)
+#define H5T_CONV_X86
+#include <immintrin.h>
+
+#define H5T_CONV_TARGET(ISA)    __attribute__((target(ISA)))
+#define H5T_CONV_VEC(NAME)      H5T__conv_vec_##NAME
+#else /* H5T_CONV_X86 */
+#define H5T_CONV_VEC(NAME)      NULL
+#endif /* H5T_CONV_X86 */
+#ifdef H5_WANT_DCONV_EXCEPTION
+#define H5T_CONV_VEC_EX(NAME)   H5T_CONV_VEC(NAME)
+#else /* H5_WANT_DCONV_EXCEPTION */
+#define H5T_CONV_VEC_EX(NAME)   NULL
+#endif /* H5_WANT_DCONV_EXCEPTION */
+
+
+/* The main part of every integer hardware conversion macro.  VEC is the
+ * vectorized kernel for the conversion, or NULL if there isn't one.
+ */
+#define H5T_CONV(GUTS,STYPE,DTYPE,ST,DT,D_MIN,D_MAX,PREC,VEC)  	      \
 {                                                                             \
     herr_t      ret_value=SUCCEED;      /* Return value         */            \
                                                                               \
@@ -678,6 +702,7 @@
     ssize_t	s_stride, d_stride;	/*src and dst strides		*/    \
     size_t      safe;                   /*how many elements are safe to process in each pass */ \
     H5T_conv_cb_t       cb_struct;      /*conversion callback structure */    \
+    H5T_conv_vec_func_t vec_func = VEC; /*vectorized kernel, if any */        \
                                                                               \
     switch (cdata->command) {						      \
     case H5T_CONV_INIT:							      \
@@ -763,6 +788,19 @@
                 safe=nelmts;						      \
             } /* end else */						      \
                                                                               \
+            /* Convert as many contiguous elements as possible with the */    \
+            /* vectorized kernel, and the rest one at a time */		      \
+            if(vec_func && !cb_struct.func && !s_mv && !d_mv &&               \
+                    s_stride == (ssize_t)sizeof(ST) &&                        \
+                    d_stride == (ssize_t)sizeof(DT)) {                        \
+                size_t nvec = (vec_func)(src, dst, safe);                     \
+                                                                              \
+                src = (ST *)(src_buf = (void *)((uint8_t *)src_buf + nvec * sizeof(ST))); \
+                dst = (DT *)(dst_buf = (void *)((uint8_t *)dst_buf + nvec * sizeof(DT))); \
+                safe -= nvec;                                                 \
+                nelmts -= nvec;                                               \
+            } /* end if */						      \
+                                                                              \
             /* Perform loop over elements to convert */			      \
             if (s_mv && d_mv) {						      \
                 /* Alignment is required for both source and dest */	      \
@@ -981,6 +1019,10 @@ typedef struct H5T_conv_hw_t {
     size_t	d_aligned;		/*number destination elements aligned*/
 } H5T_conv_hw_t;
 
+/* Vectorized kernel for a hardware conversion, returning the number of
+ * elements it converted */
+typedef size_t (*H5T_conv_vec_func_t)(const void *src, void *dst, size_t nelmts);
+
 /********************/
 /* Package Typedefs */
 /********************/
@@ -1021,6 +1063,311 @@ H5FL_BLK_DEFINE_STATIC(array_seq);
 /* Declare a free list to manage pieces of reference data */
 H5FL_BLK_DEFINE_STATIC(ref_seq);
 
+#ifdef H5T_CONV_X86
+/*
+ * Vectorized kernels for the most common hardware conversions, used by
+ * H5T_CONV for contiguous elements when there is no exception callback.
+ * Like the checksum and shuffle kernels, they are compiled for AVX2 with the
+ * "target" function attribute and are only used if the CPU supports it at
+ * run time.  Each kernel converts as many whole vectors of elements as it
+ * can and returns the number of elements it converted; the scalar loop
+ * converts the rest.
+ *
+ * The kernels give exactly the same values as the scalar casts and
+ * (exception-free) clamps, including for NaN.  The buffer is converted in
+ * place, so each iteration loads all of its source elements before it
+ * stores any results, which never overwrites source elements that haven't
+ * been loaded yet in the passes H5T_CONV makes over the buffer.
+ */
+
+/* Define a kernel converting N elements per iteration with GUTS, and the
+ * function that checks for AVX2 support before calling it */
+#define H5T_CONV_VEC_KERNEL(NAME, ST, DT, N, GUTS)                            \
+static H5T_CONV_TARGET("avx2") size_t                                         \
+H5T__conv_vec_##NAME##_avx2(const ST *s, DT *d, size_t nelmts)                \
+{                                                                             \
+    size_t u;                                                                 \
+                                                                              \
+    for(u = 0; u + (N) <= nelmts; u += (N))                                   \
+        GUTS                                                                  \
+                                                                              \
+    return u;                                                                 \
+}                                                                             \
+                                                                              \
+static size_t                                                                 \
+H5T__conv_vec_##NAME(const void *src, void *dst, size_t nelmts)               \
+{                                                                             \
+    if(nelmts < (N))                                                          \
+        return 0;                                                             \
+    __builtin_cpu_init();                                                     \
+    if(!__builtin_cpu_supports("avx2"))                                       \
+        return 0;                                                             \
+                                                                              \
+    return H5T__conv_vec_##NAME##_avx2((const ST *)src, (DT *)dst, nelmts);   \
+}
+
+/* 8- and 16-bit integers to float: widen to 32-bit integers and convert */
+H5T_CONV_VEC_KERNEL(schar_float, signed char, float, 8, {
+    __m128i v = _mm_loadl_epi64((const __m128i *)(s + u));
+
+    _mm256_storeu_ps(d + u, _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(v)));
+})
+H5T_CONV_VEC_KERNEL(uchar_float, unsigned char, float, 8, {
+    __m128i v = _mm_loadl_epi64((const __m128i *)(s + u));
+
+    _mm256_storeu_ps(d + u, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(v)));
+})
+H5T_CONV_VEC_KERNEL(short_float, short, float, 8, {
+    __m128i v = _mm_loadu_si128((const __m128i *)(s + u));
+
+    _mm256_storeu_ps(d + u, _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(v)));
+})
+H5T_CONV_VEC_KERNEL(ushort_float, unsigned short, float, 8, {
+    __m128i v = _mm_loadu_si128((const __m128i *)(s + u));
+
+    _mm256_storeu_ps(d + u, _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(v)));
+})
+H5T_CONV_VEC_KERNEL(int_float, int, float, 8, {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(s + u));
+
+    _mm256_storeu_ps(d + u, _mm256_cvtepi32_ps(v));
+})
+
+/* 8-, 16- and 32-bit integers to double: widen to 32-bit integers and
+ * convert four at a time */
+H5T_CONV_VEC_KERNEL(schar_double, signed char, double, 8, {
+    __m128i v = _mm_loadl_epi64((const __m128i *)(s + u));
+
+    _mm256_storeu_pd(d + u, _mm256_cvtepi32_pd(_mm_cvtepi8_epi32(v)));
+    _mm256_storeu_pd(d + u + 4, _mm256_cvtepi32_pd(_mm_cvtepi8_epi32(_mm_srli_si128(v, 4))));
+})
+H5T_CONV_VEC_KERNEL(uchar_double, unsigned char, double, 8, {
+    __m128i v = _mm_loadl_epi64((const __m128i *)(s + u));
+
+    _mm256_storeu_pd(d + u, _mm256_cvtepi32_pd(_mm_cvtepu8_epi32(v)));
+    _mm256_storeu_pd(d + u + 4, _mm256_cvtepi32_pd(_mm_cvtepu8_epi32(_mm_srli_si128(v, 4))));
+})
+H5T_CONV_VEC_KERNEL(short_double, short, double, 8, {
+    __m128i v = _mm_loadu_si128((const __m128i *)(s + u));
+
+    _mm256_storeu_pd(d + u, _mm256_cvtepi32_pd(_mm_cvtepi16_epi32(v)));
+    _mm256_storeu_pd(d + u + 4, _mm256_cvtepi32_pd(_mm_cvtepi16_epi32(_mm_srli_si128(v, 8))));
+})
+H5T_CONV_VEC_KERNEL(ushort_double, unsigned short, double, 8, {
+    __m128i v = _mm_loadu_si128((const __m128i *)(s + u));
+
+    _mm256_storeu_pd(d + u, _mm256_cvtepi32_pd(_mm_cvtepu16_epi32(v)));
+    _mm256_storeu_pd(d + u + 4, _mm256_cvtepi32_pd(_mm_cvtepu16_epi32(_mm_srli_si128(v, 8))));
+})
+H5T_CONV_VEC_KERNEL(int_double, int, double, 8, {
+    __m128i lo = _mm_loadu_si128((const __m128i *)(s + u));
+    __m128i hi = _mm_loadu_si128((const __m128i *)(s + u + 4));
+
+    _mm256_storeu_pd(d + u, _mm256_cvtepi32_pd(lo));
+    _mm256_storeu_pd(d + u + 4, _mm256_cvtepi32_pd(hi));
+})
+
+/* float to double */
+H5T_CONV_VEC_KERNEL(float_double, float, double, 8, {
+    __m256 v = _mm256_loadu_ps(s + u);
+
+    _mm256_storeu_pd(d + u, _mm256_cvtps_pd(_mm256_castps256_ps128(v)));
+    _mm256_storeu_pd(d + u + 4, _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)));
+})
+
+#ifdef H5_WANT_DCONV_EXCEPTION
+/* double to float: values beyond +/-FLT_MAX become infinities, even those
+ * that would round to FLT_MAX, as in H5T_CONV_Ff_NOEX_CORE */
+H5T_CONV_VEC_KERNEL(double_float, double, float, 8, {
+    const __m256d max = _mm256_set1_pd((double)FLT_MAX);
+    const __m256d min = _mm256_set1_pd(-(double)FLT_MAX);
+    const __m256d pos_inf = _mm256_set1_pd((double)H5T_NATIVE_FLOAT_POS_INF_g);
+    const __m256d neg_inf = _mm256_set1_pd((double)H5T_NATIVE_FLOAT_NEG_INF_g);
+    __m256d lo = _mm256_loadu_pd(s + u);
+    __m256d hi = _mm256_loadu_pd(s + u + 4);
+
+    lo = _mm256_blendv_pd(lo, pos_inf, _mm256_cmp_pd(lo, max, _CMP_GT_OQ));
+    lo = _mm256_blendv_pd(lo, neg_inf, _mm256_cmp_pd(lo, min, _CMP_LT_OQ));
+    hi = _mm256_blendv_pd(hi, pos_inf, _mm256_cmp_pd(hi, max, _CMP_GT_OQ));
+    hi = _mm256_blendv_pd(hi, neg_inf, _mm256_cmp_pd(hi, min, _CMP_LT_OQ));
+    _mm_storeu_ps(d + u, _mm256_cvtpd_ps(lo));
+    _mm_storeu_ps(d + u + 4, _mm256_cvtpd_ps(hi));
+})
+
+/* float and double to int: values above INT_MAX are clamped to it, as in
+ * H5T_CONV_Fx_NOEX_CORE; the truncating conversion already gives INT_MIN
+ * for values below INT_MIN (and for NaN, like the scalar conversion) */
+H5T_CONV_VEC_KERNEL(float_int, float, int, 8, {
+    __m256 v = _mm256_loadu_ps(s + u);
+    __m256 over = _mm256_cmp_ps(v, _mm256_set1_ps((float)INT_MAX), _CMP_GT_OQ);
+    __m256i r = _mm256_cvttps_epi32(v);
+
+    r = _mm256_blendv_epi8(r, _mm256_set1_epi32(INT_MAX), _mm256_castps_si256(over));
+    _mm256_storeu_si256((__m256i *)(d + u), r);
+})
+H5T_CONV_VEC_KERNEL(double_int, double, int, 8, {
+    const __m256d max = _mm256_set1_pd((double)INT_MAX);
+    __m256d lo = _mm256_loadu_pd(s + u);
+    __m256d hi = _mm256_loadu_pd(s + u + 4);
+
+    /* (MINPD returns its second operand if either one is NaN) */
+    _mm_storeu_si128((__m128i *)(d + u), _mm256_cvttpd_epi32(_mm256_min_pd(max, lo)));
+    _mm_storeu_si128((__m128i *)(d + u + 4), _mm256_cvttpd_epi32(_mm256_min_pd(max, hi)));
+})
+#endif /* H5_WANT_DCONV_EXCEPTION */
+
+/*
+ * Byte order kernels for H5T__conv_order_opt and H5T__conv_order.  Contiguous
+ * buffers of 2-, 4-, 8- and 16-byte elements are swapped a vector at a time
+ * with PSHUFB (SSSE3, or AVX2 for two vectors' worth at once); for strided
+ * buffers each element is swapped with a single byte swap instruction, or a
+ * PSHUFB for 16-byte elements.
+ */
+
+/* PSHUFB masks reversing the bytes of each 2-, 4-, 8- and 16-byte element */
+static const uint8_t H5T_conv_order_mask_g[4][16] = {
+    {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14},
+    {3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12},
+    {7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8},
+    {15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0}
+};
+
+/* Swap the bytes of the whole vectors in the first NBYTES bytes of BUF with
+ * MASK, returning the number of bytes swapped */
+static H5T_CONV_TARGET("ssse3") size_t
+H5T__conv_order_ssse3(uint8_t *buf, const uint8_t *mask, size_t nbytes)
+{
+    const __m128i m = _mm_loadu_si128((const __m128i *)mask);
+    size_t u;
+
+    for(u = 0; u + 16 <= nbytes; u += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(buf + u));
+
+        _mm_storeu_si128((__m128i *)(buf + u), _mm_shuffle_epi8(v, m));
+    } /* end for */
+
+    return u;
+}
+
+static H5T_CONV_TARGET("avx2") size_t
+H5T__conv_order_avx2(uint8_t *buf, const uint8_t *mask, size_t nbytes)
+{
+    const __m128i m = _mm_loadu_si128((const __m128i *)mask);
+    const __m256i m2 = _mm256_broadcastsi128_si256(m);
+    size_t u;
+
+    for(u = 0; u + 64 <= nbytes; u += 64) {
+        __m256i v0 = _mm256_loadu_si256((const __m256i *)(buf + u));
+        __m256i v1 = _mm256_loadu_si256((const __m256i *)(buf + u + 32));
+
+        _mm256_storeu_si256((__m256i *)(buf + u), _mm256_shuffle_epi8(v0, m2));
+        _mm256_storeu_si256((__m256i *)(buf + u + 32), _mm256_shuffle_epi8(v1, m2));
+    } /* end for */
+    for(/*void*/; u + 16 <= nbytes; u += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(buf + u));
+
+        _mm_storeu_si128((__m128i *)(buf + u), _mm_shuffle_epi8(v, m));
+    } /* end for */
+
+    return u;
+}
+
+/* Swap the bytes of NELMTS 16-byte elements BUF_STRIDE bytes apart */
+static H5T_CONV_TARGET("ssse3") void
+H5T__conv_order_16_ssse3(uint8_t *buf, size_t nelmts, size_t buf_stride)
+{
+    const __m128i m = _mm_loadu_si128((const __m128i *)H5T_conv_order_mask_g[3]);
+    size_t u;
+
+    for(u = 0; u < nelmts; u++, buf += buf_stride) {
+        __m128i v = _mm_loadu_si128((const __m128i *)buf);
+
+        _mm_storeu_si128((__m128i *)buf, _mm_shuffle_epi8(v, m));
+    } /* end for */
+}
+
+/* Swap the bytes of NELMTS elements of type T BUF_STRIDE bytes apart */
+#define H5T_CONV_ORDER_BSWAP(T, BSWAP, BUF, NELMTS, BUF_STRIDE) {             \
+    size_t _u;                                                                \
+                                                                              \
+    for(_u = 0; _u < (NELMTS); _u++, (BUF) += (BUF_STRIDE)) {                 \
+        T _v;                                                                 \
+                                                                              \
+        HDmemcpy(&_v, (BUF), sizeof(T));                                      \
+        _v = BSWAP(_v);                                                       \
+        HDmemcpy((BUF), &_v, sizeof(T));                                      \
+    } /* end for */                                                           \
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__conv_order_vec
+ *
+ * Purpose:	Swaps the byte order of NELMTS elements of SIZE bytes each,
+ *		BUF_STRIDE bytes apart, with the kernels above.  Returns
+ *		without swapping anything if there's no kernel for SIZE or
+ *		the CPU doesn't support it.
+ *
+ * Return:	The number of leading elements swapped, which the caller
+ *		skips before swapping the rest itself.
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5T__conv_order_vec(uint8_t *buf, size_t size, size_t nelmts, size_t buf_stride)
+{
+    const uint8_t *mask;
+
+    switch(size) {
+        case 2:
+            mask = H5T_conv_order_mask_g[0];
+            break;
+        case 4:
+            mask = H5T_conv_order_mask_g[1];
+            break;
+        case 8:
+            mask = H5T_conv_order_mask_g[2];
+            break;
+        case 16:
+            mask = H5T_conv_order_mask_g[3];
+            break;
+        default:
+            return 0;
+    } /* end switch */
+
+    __builtin_cpu_init();
+
+    /* Contiguous elements: swap whole vectors, leaving any partial vector */
+    if(buf_stride == size) {
+        if(__builtin_cpu_supports("avx2"))
+            return H5T__conv_order_avx2(buf, mask, nelmts * size) / size;
+        if(__builtin_cpu_supports("ssse3"))
+            return H5T__conv_order_ssse3(buf, mask, nelmts * size) / size;
+        return 0;
+    } /* end if */
+
+    /* Strided elements, e.g. a compound datatype's members */
+    switch(size) {
+        case 2:
+            H5T_CONV_ORDER_BSWAP(uint16_t, __builtin_bswap16, buf, nelmts, buf_stride)
+            break;
+        case 4:
+            H5T_CONV_ORDER_BSWAP(uint32_t, __builtin_bswap32, buf, nelmts, buf_stride)
+            break;
+        case 8:
+            H5T_CONV_ORDER_BSWAP(uint64_t, __builtin_bswap64, buf, nelmts, buf_stride)
+            break;
+        default:
+            if(!__builtin_cpu_supports("ssse3"))
+                return 0;
+            H5T__conv_order_16_ssse3(buf, nelmts, buf_stride);
+            break;
+    } /* end switch */
+
+    return nelmts;
+} /* end H5T__conv_order_vec() */
+#endif /* H5T_CONV_X86 */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5T__conv_noop
@@ -1174,6 +1521,14 @@ H5T__conv_order_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
             } /* end if */
 
             buf_stride = buf_stride ? buf_stride : src->shared->size;
+#ifdef H5T_CONV_X86
+            {
+                size_t nvec = H5T__conv_order_vec(buf, src->shared->size, nelmts, buf_stride);
+
+                buf += nvec * buf_stride;
+                nelmts -= nvec;
+            }
+#endif /* H5T_CONV_X86 */
             switch(src->shared->size) {
                 case 1:
                     /*no-op*/
@@ -1562,6 +1917,11 @@ H5T__conv_order(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                 HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
 
             buf_stride = buf_stride ? buf_stride : src->shared->size;
+#ifdef H5T_CONV_X86
+            i = H5T__conv_order_vec(buf, src->shared->size, nelmts, buf_stride);
+            buf += i * buf_stride;
+            nelmts -= i;
+#endif /* H5T_CONV_X86 */
             md = src->shared->size / 2;
             for(i = 0; i < nelmts; i++, buf += buf_stride)
                 for(j = 0; j < md; j++)
@@ -6979,7 +7339,7 @@ H5T__conv_float_double (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_fF(FLOAT, DOUBLE, float, double, -, -);
+    H5T_CONV_fF(FLOAT, DOUBLE, float, double, -, -, H5T_CONV_VEC(float_double));
 }
 
 
@@ -7002,7 +7362,7 @@ H5T__conv_float_ldouble (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_fF(FLOAT, LDOUBLE, float, long double, -, -);
+    H5T_CONV_fF(FLOAT, LDOUBLE, float, long double, -, -, NULL);
 }
 #endif /* H5_SIZEOF_LONG_DOUBLE != 0 */
 
@@ -7025,7 +7385,7 @@ H5T__conv_double_float (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_Ff(DOUBLE, FLOAT, double, float, -FLT_MAX, FLT_MAX);
+    H5T_CONV_Ff(DOUBLE, FLOAT, double, float, -FLT_MAX, FLT_MAX, H5T_CONV_VEC_EX(double_float));
 }
 
 
@@ -7048,7 +7408,7 @@ H5T__conv_double_ldouble (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_fF(DOUBLE, LDOUBLE, double, long double, -, -);
+    H5T_CONV_fF(DOUBLE, LDOUBLE, double, long double, -, -, NULL);
 }
 #endif /* H5_SIZEOF_LONG_DOUBLE != 0 */
 
@@ -7072,7 +7432,7 @@ H5T__conv_ldouble_float (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_Ff(LDOUBLE, FLOAT, long double, float, -FLT_MAX, FLT_MAX);
+    H5T_CONV_Ff(LDOUBLE, FLOAT, long double, float, -FLT_MAX, FLT_MAX, NULL);
 }
 #endif /* H5_SIZEOF_LONG_DOUBLE != 0 */
 
@@ -7096,7 +7456,7 @@ H5T__conv_ldouble_double (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_Ff(LDOUBLE, DOUBLE, long double, double, -DBL_MAX, DBL_MAX);
+    H5T_CONV_Ff(LDOUBLE, DOUBLE, long double, double, -DBL_MAX, DBL_MAX, NULL);
 }
 #endif /* H5_SIZEOF_LONG_DOUBLE != 0 */
 
@@ -7119,7 +7479,7 @@ H5T__conv_schar_float (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(SCHAR, FLOAT, signed char, float, -, -);
+    H5T_CONV_xF(SCHAR, FLOAT, signed char, float, -, -, H5T_CONV_VEC(schar_float));
 }
 
 
@@ -7141,7 +7501,7 @@ H5T__conv_schar_double (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(SCHAR, DOUBLE, signed char, double, -, -);
+    H5T_CONV_xF(SCHAR, DOUBLE, signed char, double, -, -, H5T_CONV_VEC(schar_double));
 }
 
 
@@ -7163,7 +7523,7 @@ H5T__conv_schar_ldouble (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(SCHAR, LDOUBLE, signed char, long double, -, -);
+    H5T_CONV_xF(SCHAR, LDOUBLE, signed char, long double, -, -, NULL);
 }
 
 
@@ -7185,7 +7545,7 @@ H5T__conv_uchar_float (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(UCHAR, FLOAT, unsigned char, float, -, -);
+    H5T_CONV_xF(UCHAR, FLOAT, unsigned char, float, -, -, H5T_CONV_VEC(uchar_float));
 }
 
 
@@ -7207,7 +7567,7 @@ H5T__conv_uchar_double (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(UCHAR, DOUBLE, unsigned char, double, -, -);
+    H5T_CONV_xF(UCHAR, DOUBLE, unsigned char, double, -, -, H5T_CONV_VEC(uchar_double));
 }
 
 
@@ -7229,7 +7589,7 @@ H5T__conv_uchar_ldouble (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(UCHAR, LDOUBLE, unsigned char, long double, -, -);
+    H5T_CONV_xF(UCHAR, LDOUBLE, unsigned char, long double, -, -, NULL);
 }
 
 
@@ -7251,7 +7611,7 @@ H5T__conv_short_float (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(SHORT, FLOAT, short, float, -, -);
+    H5T_CONV_xF(SHORT, FLOAT, short, float, -, -, H5T_CONV_VEC(short_float));
 }
 
 
@@ -7273,7 +7633,7 @@ H5T__conv_short_double (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(SHORT, DOUBLE, short, double, -, -);
+    H5T_CONV_xF(SHORT, DOUBLE, short, double, -, -, H5T_CONV_VEC(short_double));
 }
 
 
@@ -7295,7 +7655,7 @@ H5T__conv_short_ldouble (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(SHORT, LDOUBLE, short, long double, -, -);
+    H5T_CONV_xF(SHORT, LDOUBLE, short, long double, -, -, NULL);
 }
 
 
@@ -7317,7 +7677,7 @@ H5T__conv_ushort_float (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(USHORT, FLOAT, unsigned short, float, -, -);
+    H5T_CONV_xF(USHORT, FLOAT, unsigned short, float, -, -, H5T_CONV_VEC(ushort_float));
 }
 
 
@@ -7339,7 +7699,7 @@ H5T__conv_ushort_double (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(USHORT, DOUBLE, unsigned short, double, -, -);
+    H5T_CONV_xF(USHORT, DOUBLE, unsigned short, double, -, -, H5T_CONV_VEC(ushort_double));
 }
 
 
@@ -7361,7 +7721,7 @@ H5T__conv_ushort_ldouble (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(USHORT, LDOUBLE, unsigned short, long double, -, -);
+    H5T_CONV_xF(USHORT, LDOUBLE, unsigned short, long double, -, -, NULL);
 }
 
 
@@ -7383,7 +7743,7 @@ H5T__conv_int_float (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(INT, FLOAT, int, float, -, -);
+    H5T_CONV_xF(INT, FLOAT, int, float, -, -, H5T_CONV_VEC(int_float));
 }
 
 
@@ -7405,7 +7765,7 @@ H5T__conv_int_double (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(INT, DOUBLE, int, double, -, -);
+    H5T_CONV_xF(INT, DOUBLE, int, double, -, -, H5T_CONV_VEC(int_double));
 }
 
 
@@ -7427,7 +7787,7 @@ H5T__conv_int_ldouble (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(INT, LDOUBLE, int, long double, -, -);
+    H5T_CONV_xF(INT, LDOUBLE, int, long double, -, -, NULL);
 }
 
 
@@ -7449,7 +7809,7 @@ H5T__conv_uint_float (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(UINT, FLOAT, unsigned int, float, -, -);
+    H5T_CONV_xF(UINT, FLOAT, unsigned int, float, -, -, NULL);
 }
 
 
@@ -7471,7 +7831,7 @@ H5T__conv_uint_double (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(UINT, DOUBLE, unsigned int, double, -, -);
+    H5T_CONV_xF(UINT, DOUBLE, unsigned int, double, -, -, NULL);
 }
 
 
@@ -7493,7 +7853,7 @@ H5T__conv_uint_ldouble (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(UINT, LDOUBLE, unsigned int, long double, -, -);
+    H5T_CONV_xF(UINT, LDOUBLE, unsigned int, long double, -, -, NULL);
 }
 
 
@@ -7515,7 +7875,7 @@ H5T__conv_long_float (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(LONG, FLOAT, long, float, -, -);
+    H5T_CONV_xF(LONG, FLOAT, long, float, -, -, NULL);
 }
 
 
@@ -7537,7 +7897,7 @@ H5T__conv_long_double (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(LONG, DOUBLE, long, double, -, -);
+    H5T_CONV_xF(LONG, DOUBLE, long, double, -, -, NULL);
 }
 
 
@@ -7559,7 +7919,7 @@ H5T__conv_long_ldouble (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(LONG, LDOUBLE, long, long double, -, -);
+    H5T_CONV_xF(LONG, LDOUBLE, long, long double, -, -, NULL);
 }
 
 
@@ -7581,7 +7941,7 @@ H5T__conv_ulong_float (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(ULONG, FLOAT, unsigned long, float, -, -);
+    H5T_CONV_xF(ULONG, FLOAT, unsigned long, float, -, -, NULL);
 }
 
 
@@ -7603,7 +7963,7 @@ H5T__conv_ulong_double (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(ULONG, DOUBLE, unsigned long, double, -, -);
+    H5T_CONV_xF(ULONG, DOUBLE, unsigned long, double, -, -, NULL);
 }
 
 
@@ -7625,7 +7985,7 @@ H5T__conv_ulong_ldouble (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(ULONG, LDOUBLE, unsigned long, long double, -, -);
+    H5T_CONV_xF(ULONG, LDOUBLE, unsigned long, long double, -, -, NULL);
 }
 
 
@@ -7647,7 +8007,7 @@ H5T__conv_llong_float (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(LLONG, FLOAT, long long, float, -, -);
+    H5T_CONV_xF(LLONG, FLOAT, long long, float, -, -, NULL);
 }
 
 
@@ -7669,7 +8029,7 @@ H5T__conv_llong_double (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(LLONG, DOUBLE, long long, double, -, -);
+    H5T_CONV_xF(LLONG, DOUBLE, long long, double, -, -, NULL);
 }
 
 
@@ -7692,7 +8052,7 @@ H5T__conv_llong_ldouble (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(LLONG, LDOUBLE, long long, long double, -, -);
+    H5T_CONV_xF(LLONG, LDOUBLE, long long, long double, -, -, NULL);
 }
 #endif /* H5T_CONV_INTERNAL_LLONG_LDOUBLE */
 
@@ -7715,7 +8075,7 @@ H5T__conv_ullong_float (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(ULLONG, FLOAT, unsigned long long, float, -, -);
+    H5T_CONV_xF(ULLONG, FLOAT, unsigned long long, float, -, -, NULL);
 }
 
 
@@ -7737,7 +8097,7 @@ H5T__conv_ullong_double (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(ULLONG, DOUBLE, unsigned long long, double, -, -);
+    H5T_CONV_xF(ULLONG, DOUBLE, unsigned long long, double, -, -, NULL);
 }
 
 
@@ -7760,7 +8120,7 @@ H5T__conv_ullong_ldouble (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     size_t nelmts, size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
-    H5T_CONV_xF(ULLONG, LDOUBLE, unsigned long long, long double, -, -);
+    H5T_CONV_xF(ULLONG, LDOUBLE, unsigned long long, long double, -, -, NULL);
 }
 #endif /*H5T_CONV_INTERNAL_ULLONG_LDOUBLE*/
 
@@ -7784,7 +8144,7 @@ H5T__conv_float_schar (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(FLOAT, SCHAR, float, signed char, SCHAR_MIN, SCHAR_MAX);
+    H5T_CONV_Fx(FLOAT, SCHAR, float, signed char, SCHAR_MIN, SCHAR_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -7808,7 +8168,7 @@ H5T__conv_float_uchar (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(FLOAT, UCHAR, float, unsigned char, 0, UCHAR_MAX);
+    H5T_CONV_Fx(FLOAT, UCHAR, float, unsigned char, 0, UCHAR_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -7832,7 +8192,7 @@ H5T__conv_double_schar (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(DOUBLE, SCHAR, double, signed char, SCHAR_MIN, SCHAR_MAX);
+    H5T_CONV_Fx(DOUBLE, SCHAR, double, signed char, SCHAR_MIN, SCHAR_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -7856,7 +8216,7 @@ H5T__conv_double_uchar (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(DOUBLE, UCHAR, double, unsigned char, 0, UCHAR_MAX);
+    H5T_CONV_Fx(DOUBLE, UCHAR, double, unsigned char, 0, UCHAR_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -7880,7 +8240,7 @@ H5T__conv_ldouble_schar (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(LDOUBLE, SCHAR, long double, signed char, SCHAR_MIN, SCHAR_MAX);
+    H5T_CONV_Fx(LDOUBLE, SCHAR, long double, signed char, SCHAR_MIN, SCHAR_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -7904,7 +8264,7 @@ H5T__conv_ldouble_uchar (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(LDOUBLE, UCHAR, long double, unsigned char, 0, UCHAR_MAX);
+    H5T_CONV_Fx(LDOUBLE, UCHAR, long double, unsigned char, 0, UCHAR_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -7928,7 +8288,7 @@ H5T__conv_float_short (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(FLOAT, SHORT, float, short, SHRT_MIN, SHRT_MAX);
+    H5T_CONV_Fx(FLOAT, SHORT, float, short, SHRT_MIN, SHRT_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -7952,7 +8312,7 @@ H5T__conv_float_ushort (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(FLOAT, USHORT, float, unsigned short, 0, USHRT_MAX);
+    H5T_CONV_Fx(FLOAT, USHORT, float, unsigned short, 0, USHRT_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -7976,7 +8336,7 @@ H5T__conv_double_short (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(DOUBLE, SHORT, double, short, SHRT_MIN, SHRT_MAX);
+    H5T_CONV_Fx(DOUBLE, SHORT, double, short, SHRT_MIN, SHRT_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -8000,7 +8360,7 @@ H5T__conv_double_ushort (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(DOUBLE, USHORT, double, unsigned short, 0, USHRT_MAX);
+    H5T_CONV_Fx(DOUBLE, USHORT, double, unsigned short, 0, USHRT_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -8024,7 +8384,7 @@ H5T__conv_ldouble_short (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(LDOUBLE, SHORT, long double, short, SHRT_MIN, SHRT_MAX);
+    H5T_CONV_Fx(LDOUBLE, SHORT, long double, short, SHRT_MIN, SHRT_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -8048,7 +8408,7 @@ H5T__conv_ldouble_ushort (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(LDOUBLE, USHORT, long double, unsigned short, 0, USHRT_MAX);
+    H5T_CONV_Fx(LDOUBLE, USHORT, long double, unsigned short, 0, USHRT_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -8072,7 +8432,7 @@ H5T__conv_float_int (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(FLOAT, INT, float, int, INT_MIN, INT_MAX);
+    H5T_CONV_Fx(FLOAT, INT, float, int, INT_MIN, INT_MAX, H5T_CONV_VEC_EX(float_int));
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -8096,7 +8456,7 @@ H5T__conv_float_uint (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(FLOAT, UINT, float, unsigned int, 0, UINT_MAX);
+    H5T_CONV_Fx(FLOAT, UINT, float, unsigned int, 0, UINT_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -8120,7 +8480,7 @@ H5T__conv_double_int (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(DOUBLE, INT, double, int, INT_MIN, INT_MAX);
+    H5T_CONV_Fx(DOUBLE, INT, double, int, INT_MIN, INT_MAX, H5T_CONV_VEC_EX(double_int));
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -8144,7 +8504,7 @@ H5T__conv_double_uint (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(DOUBLE, UINT, double, unsigned int, 0, UINT_MAX);
+    H5T_CONV_Fx(DOUBLE, UINT, double, unsigned int, 0, UINT_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -8168,7 +8528,7 @@ H5T__conv_ldouble_int (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(LDOUBLE, INT, long double, int, INT_MIN, INT_MAX);
+    H5T_CONV_Fx(LDOUBLE, INT, long double, int, INT_MIN, INT_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -8192,7 +8552,7 @@ H5T__conv_ldouble_uint (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(LDOUBLE, UINT, long double, unsigned int, 0, UINT_MAX);
+    H5T_CONV_Fx(LDOUBLE, UINT, long double, unsigned int, 0, UINT_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -8216,7 +8576,7 @@ H5T__conv_float_long (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(FLOAT, LONG, float, long, LONG_MIN, LONG_MAX);
+    H5T_CONV_Fx(FLOAT, LONG, float, long, LONG_MIN, LONG_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -8240,7 +8600,7 @@ H5T__conv_float_ulong (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(FLOAT, ULONG, float, unsigned long, 0, ULONG_MAX);
+    H5T_CONV_Fx(FLOAT, ULONG, float, unsigned long, 0, ULONG_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -8264,7 +8624,7 @@ H5T__conv_double_long (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(DOUBLE, LONG, double, long, LONG_MIN, LONG_MAX);
+    H5T_CONV_Fx(DOUBLE, LONG, double, long, LONG_MIN, LONG_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -8288,7 +8648,7 @@ H5T__conv_double_ulong (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(DOUBLE, ULONG, double, unsigned long, 0, ULONG_MAX);
+    H5T_CONV_Fx(DOUBLE, ULONG, double, unsigned long, 0, ULONG_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -8312,7 +8672,7 @@ H5T__conv_ldouble_long (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(LDOUBLE, LONG, long double, long, LONG_MIN, LONG_MAX);
+    H5T_CONV_Fx(LDOUBLE, LONG, long double, long, LONG_MIN, LONG_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -8336,7 +8696,7 @@ H5T__conv_ldouble_ulong (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(LDOUBLE, ULONG, long double, unsigned long, 0, ULONG_MAX);
+    H5T_CONV_Fx(LDOUBLE, ULONG, long double, unsigned long, 0, ULONG_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -8360,7 +8720,7 @@ H5T__conv_float_llong (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(FLOAT, LLONG, float, long long, LLONG_MIN, LLONG_MAX);
+    H5T_CONV_Fx(FLOAT, LLONG, float, long long, LLONG_MIN, LLONG_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -8384,7 +8744,7 @@ H5T__conv_float_ullong (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(FLOAT, ULLONG, float, unsigned long long, 0, ULLONG_MAX);
+    H5T_CONV_Fx(FLOAT, ULLONG, float, unsigned long long, 0, ULLONG_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -8408,7 +8768,7 @@ H5T__conv_double_llong (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(DOUBLE, LLONG, double, long long, LLONG_MIN, LLONG_MAX);
+    H5T_CONV_Fx(DOUBLE, LLONG, double, long long, LLONG_MIN, LLONG_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -8432,7 +8792,7 @@ H5T__conv_double_ullong (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(DOUBLE, ULLONG, double, unsigned long long, 0, ULLONG_MAX);
+    H5T_CONV_Fx(DOUBLE, ULLONG, double, unsigned long long, 0, ULLONG_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 
@@ -8457,7 +8817,7 @@ H5T__conv_ldouble_llong (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(LDOUBLE, LLONG, long double, long long, LLONG_MIN, LLONG_MAX);
+    H5T_CONV_Fx(LDOUBLE, LLONG, long double, long long, LLONG_MIN, LLONG_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 #endif /*H5T_CONV_INTERNAL_LDOUBLE_LLONG*/
@@ -8483,7 +8843,7 @@ H5T__conv_ldouble_ullong (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     void *buf, void H5_ATTR_UNUSED *bkg)
 {
 H5_GCC_DIAG_OFF(float-equal)
-    H5T_CONV_Fx(LDOUBLE, ULLONG, long double, unsigned long long, 0, ULLONG_MAX);
+    H5T_CONV_Fx(LDOUBLE, ULLONG, long double, unsigned long long, 0, ULLONG_MAX, NULL);
 H5_GCC_DIAG_ON(float-equal)
 }
 #endif /*H5T_CONV_INTERNAL_LDOUBLE_ULLONG*/
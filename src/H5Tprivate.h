@@ -35,6 +35,9 @@ typedef struct H5T_t H5T_t;
 /* Macro for size of temporary buffers to contain a single element */
 #define H5T_ELEM_BUF_SIZE       256
 
+/* Minimum # of bytes for each thread to convert in H5T_convert_parallel() */
+#define H5T_CONV_PARALLEL_MIN   (1024 * 1024)
+
 /* If the module using this macro is allowed access to the private variables, access them directly */
 #ifdef H5T_MODULE
 #define H5T_GET_SIZE(T)                 ((T)->shared->size)
@@ -130,9 +133,12 @@ H5_DLL htri_t H5T_is_relocatable(const H5T_t *dt);
 H5_DLL H5T_path_t *H5T_path_find(const H5T_t *src, const H5T_t *dst);
 H5_DLL hbool_t H5T_path_noop(const H5T_path_t *p);
 H5_DLL H5T_bkg_t H5T_path_bkg(const H5T_path_t *p);
+H5_DLL hbool_t H5T_path_parallel(const H5T_path_t *p);
 H5_DLL H5T_subset_info_t *H5T_path_compound_subset(const H5T_path_t *p);
 H5_DLL herr_t H5T_convert(H5T_path_t *tpath, hid_t src_id, hid_t dst_id,
     size_t nelmts, size_t buf_stride, size_t bkg_stride, void *buf, void *bkg);
+H5_DLL herr_t H5T_convert_parallel(H5T_path_t *tpath, hid_t src_id, hid_t dst_id,
+    size_t nelmts, void *buf, unsigned nthreads);
 H5_DLL herr_t H5T_reclaim(hid_t type_id, struct H5S_t *space, void *buf);
 H5_DLL herr_t H5T_reclaim_cb(void *elem, const H5T_t *dt, unsigned ndim, const hsize_t *point, void *op_data);
 H5_DLL herr_t H5T_ref_reclaim(void *elem, const H5T_t *dt);
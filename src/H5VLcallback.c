@@ -30,7 +30,9 @@
 /***********/
 
 #include "H5private.h"          /* Generic Functions                                */
+#include "H5CXprivate.h"        /* API Contexts                                     */
 #include "H5Eprivate.h"         /* Error handling                                   */
+#include "H5ESprivate.h"        /* Event Sets                                       */
 #include "H5Fprivate.h"		/* File access				            */
 #include "H5Iprivate.h"         /* IDs                                              */
 #include "H5MMprivate.h"        /* Memory management                                */
@@ -47,6 +49,35 @@
 /* Local Typedefs */
 /******************/
 
+/* Arguments of a dataset read or write inserted into an event set.  IDs
+ * are held (and looked up when the operation is performed), so the
+ * application may close them as soon as the call returns.
+ */
+typedef struct H5VL_dataset_io_async_t {
+    hid_t       dset_id;                /* Dataset to read or write */
+    hid_t       mem_type_id;            /* Memory datatype */
+    hid_t       mem_space_id;           /* Memory dataspace (or H5S_ALL) */
+    hid_t       file_space_id;          /* File dataspace (or H5S_ALL) */
+    hid_t       dxpl_id;                /* Dataset transfer property list */
+    void       *buf;                    /* Application's buffer */
+    hbool_t     write;                  /* Whether this is a write */
+} H5VL_dataset_io_async_t;
+
+/* Arguments of a file flush inserted into an event set */
+typedef struct H5VL_file_flush_async_t {
+    hid_t       obj_id;                 /* Object in the file to flush */
+    H5I_type_t  obj_type;               /* Type of the object */
+    H5F_scope_t scope;                  /* Scope of the flush */
+} H5VL_file_flush_async_t;
+
+/* Arguments of a dataset or group open inserted into an event set */
+typedef struct H5VL_object_open_async_t {
+    H5I_type_t  obj_type;               /* Type of object to open */
+    hid_t       loc_id;                 /* Location the name is relative to */
+    char       *name;                   /* Name of the object */
+    hid_t       apl_id;                 /* Access property list */
+} H5VL_object_open_async_t;
+
 
 /********************/
 /* Package Typedefs */
@@ -56,6 +87,16 @@
 /********************/
 /* Local Prototypes */
 /********************/
+static herr_t H5VL__hold_ids(size_t nids, const hid_t *ids);
+static herr_t H5VL__release_ids(size_t nids, const hid_t *ids);
+static herr_t H5VL__dataset_io_async_op(void *ctx, void **object);
+static herr_t H5VL__dataset_io_async_free(void *ctx);
+static herr_t H5VL__file_flush_async_op(void *ctx, void **object);
+static herr_t H5VL__file_flush_async_free(void *ctx);
+static herr_t H5VL__object_open_async_op(void *ctx, void **object);
+static herr_t H5VL__object_open_async_free(void *ctx);
+static hid_t H5VL__object_open_async(H5I_type_t obj_type, hid_t loc_id,
+    const char *name, hid_t apl_id, hid_t es_id);
 static void *H5VL__attr_create(void *obj, const H5VL_loc_params_t *loc_params,
     const H5VL_class_t *cls, const char *name, hid_t type_id, hid_t space_id,
     hid_t acpl_id, hid_t aapl_id, hid_t dxpl_id, void **req);
@@ -7773,3 +7814,522 @@ done:
     FUNC_LEAVE_API_NOINIT(ret_value)
 } /* end H5VLoptional() */
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__hold_ids
+ *
+ * Purpose:     Takes a library reference on IDs an asynchronous operation
+ *              will use, so they stay valid until it is performed.
+ *              Zero IDs (H5S_ALL and H5P_DEFAULT) are skipped.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__hold_ids(size_t nids, const hid_t *ids)
+{
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    for(u = 0; u < nids; u++)
+        if(ids[u] > 0 && H5I_inc_ref(ids[u], FALSE) < 0) {
+            /* Let go of the IDs held so far */
+            (void)H5VL__release_ids(u, ids);
+            HGOTO_ERROR(H5E_VOL, H5E_CANTINC, FAIL, "can't increment ID ref count")
+        } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__hold_ids() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__release_ids
+ *
+ * Purpose:     Lets go of IDs held with H5VL__hold_ids.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__release_ids(size_t nids, const hid_t *ids)
+{
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Try to release all of them, even if one fails */
+    for(u = 0; u < nids; u++)
+        if(ids[u] > 0 && H5I_dec_ref(ids[u]) < 0)
+            HDONE_ERROR(H5E_VOL, H5E_CANTDEC, FAIL, "can't decrement ID ref count")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__release_ids() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__dataset_io_async_op
+ *
+ * Purpose:     Performs a dataset read or write inserted into an event
+ *              set.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__dataset_io_async_op(void *_ctx, void H5_ATTR_UNUSED **object)
+{
+    H5VL_dataset_io_async_t *ctx = (H5VL_dataset_io_async_t *)_ctx;    /* Arguments */
+    H5VL_object_t  *vol_obj;            /* Dataset's VOL object */
+    herr_t          ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(ctx->dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset ID")
+
+    if(ctx->write) {
+        if(H5VL_dataset_write(vol_obj, ctx->mem_type_id, ctx->mem_space_id, ctx->file_space_id, ctx->dxpl_id, ctx->buf, H5_REQUEST_NULL) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_WRITEERROR, FAIL, "dataset write failed")
+    } /* end if */
+    else
+        if(H5VL_dataset_read(vol_obj, ctx->mem_type_id, ctx->mem_space_id, ctx->file_space_id, ctx->dxpl_id, ctx->buf, H5_REQUEST_NULL) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_READERROR, FAIL, "dataset read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__dataset_io_async_op() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__dataset_io_async_free
+ *
+ * Purpose:     Releases the arguments of a dataset read or write inserted
+ *              into an event set.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__dataset_io_async_free(void *_ctx)
+{
+    H5VL_dataset_io_async_t *ctx = (H5VL_dataset_io_async_t *)_ctx;    /* Arguments */
+    hid_t       ids[5];                 /* IDs held by the operation */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    ids[0] = ctx->dset_id;
+    ids[1] = ctx->mem_type_id;
+    ids[2] = ctx->mem_space_id;
+    ids[3] = ctx->file_space_id;
+    ids[4] = ctx->dxpl_id;
+    if(H5VL__release_ids((size_t)5, ids) < 0)
+        HDONE_ERROR(H5E_VOL, H5E_CANTRELEASE, FAIL, "can't release IDs")
+    ctx = (H5VL_dataset_io_async_t *)H5MM_xfree(ctx);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__dataset_io_async_free() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__dataset_io_async
+ *
+ * Purpose:     Inserts a dataset read or write into an event set.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__dataset_io_async(hbool_t write, hid_t dset_id, hid_t mem_type_id,
+    hid_t mem_space_id, hid_t file_space_id, hid_t dxpl_id, void *buf,
+    hid_t es_id)
+{
+    H5VL_dataset_io_async_t *ctx = NULL;    /* Arguments of the operation */
+    hid_t       ids[5];                 /* IDs the operation holds */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Hold on to the IDs */
+    ids[0] = dset_id;
+    ids[1] = mem_type_id;
+    ids[2] = mem_space_id;
+    ids[3] = file_space_id;
+    ids[4] = dxpl_id;
+    if(H5VL__hold_ids((size_t)5, ids) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTINC, FAIL, "can't hold IDs for asynchronous operation")
+
+    if(NULL == (ctx = (H5VL_dataset_io_async_t *)H5MM_malloc(sizeof(H5VL_dataset_io_async_t)))) {
+        (void)H5VL__release_ids((size_t)5, ids);
+        HGOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't allocate asynchronous operation")
+    } /* end if */
+    ctx->dset_id = dset_id;
+    ctx->mem_type_id = mem_type_id;
+    ctx->mem_space_id = mem_space_id;
+    ctx->file_space_id = file_space_id;
+    ctx->dxpl_id = dxpl_id;
+    ctx->buf = buf;
+    ctx->write = write;
+
+    /* Insert the operation (which releases the arguments, even on failure) */
+    if(H5ES_insert(es_id, H5VL__dataset_io_async_op, H5VL__dataset_io_async_free, ctx) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTINSERT, FAIL, "can't insert operation into event set")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__dataset_io_async() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL_dataset_read_async
+ *
+ * Purpose:     Reads data from a dataset through the VOL, as an operation
+ *              of an event set.  BUF must stay valid until the operation
+ *              has completed.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL_dataset_read_async(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
+    hid_t file_space_id, hid_t dxpl_id, void *buf, hid_t es_id)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if(H5VL__dataset_io_async(FALSE, dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf, es_id) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_READERROR, FAIL, "asynchronous dataset read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL_dataset_read_async() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL_dataset_write_async
+ *
+ * Purpose:     Writes data to a dataset through the VOL, as an operation
+ *              of an event set.  BUF must stay valid (and unchanged) until
+ *              the operation has completed.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL_dataset_write_async(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
+    hid_t file_space_id, hid_t dxpl_id, const void *buf, hid_t es_id)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* (Casting away const OK, the buffer is only read from) */
+    if(H5VL__dataset_io_async(TRUE, dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, (void *)buf, es_id) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_WRITEERROR, FAIL, "asynchronous dataset write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL_dataset_write_async() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__file_flush_async_op
+ *
+ * Purpose:     Performs a file flush inserted into an event set.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__file_flush_async_op(void *_ctx, void H5_ATTR_UNUSED **object)
+{
+    H5VL_file_flush_async_t *ctx = (H5VL_file_flush_async_t *)_ctx;    /* Arguments */
+    H5VL_object_t  *vol_obj;            /* File's VOL object */
+    herr_t          ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(NULL == (vol_obj = H5VL_vol_object(ctx->obj_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid object identifier")
+
+    if(H5VL_file_specific(vol_obj, H5VL_FILE_FLUSH, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL, (int)ctx->obj_type, (int)ctx->scope) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "unable to flush file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__file_flush_async_op() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__file_flush_async_free
+ *
+ * Purpose:     Releases the arguments of a file flush inserted into an
+ *              event set.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__file_flush_async_free(void *_ctx)
+{
+    H5VL_file_flush_async_t *ctx = (H5VL_file_flush_async_t *)_ctx;    /* Arguments */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(H5VL__release_ids((size_t)1, &ctx->obj_id) < 0)
+        HDONE_ERROR(H5E_VOL, H5E_CANTRELEASE, FAIL, "can't release IDs")
+    ctx = (H5VL_file_flush_async_t *)H5MM_xfree(ctx);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__file_flush_async_free() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL_file_flush_async
+ *
+ * Purpose:     Flushes the file an object is in through the VOL, as an
+ *              operation of an event set.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL_file_flush_async(hid_t obj_id, H5I_type_t obj_type, H5F_scope_t scope,
+    hid_t es_id)
+{
+    H5VL_file_flush_async_t *ctx = NULL;    /* Arguments of the operation */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Hold on to the object's ID */
+    if(H5VL__hold_ids((size_t)1, &obj_id) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTINC, FAIL, "can't hold IDs for asynchronous operation")
+
+    if(NULL == (ctx = (H5VL_file_flush_async_t *)H5MM_malloc(sizeof(H5VL_file_flush_async_t)))) {
+        (void)H5VL__release_ids((size_t)1, &obj_id);
+        HGOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't allocate asynchronous operation")
+    } /* end if */
+    ctx->obj_id = obj_id;
+    ctx->obj_type = obj_type;
+    ctx->scope = scope;
+
+    /* Insert the operation (which releases the arguments, even on failure) */
+    if(H5ES_insert(es_id, H5VL__file_flush_async_op, H5VL__file_flush_async_free, ctx) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTINSERT, FAIL, "can't insert operation into event set")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL_file_flush_async() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__object_open_async_op
+ *
+ * Purpose:     Performs a dataset or group open inserted into an event
+ *              set, returning the VOL object for the future ID in
+ *              *OBJECT.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__object_open_async_op(void *_ctx, void **object)
+{
+    H5VL_object_open_async_t *ctx = (H5VL_object_open_async_t *)_ctx;  /* Arguments */
+    H5VL_object_t      *vol_obj = NULL; /* Location's VOL object */
+    H5VL_loc_params_t   loc_params;     /* Location parameters */
+    void               *obj = NULL;     /* Object from the VOL connector */
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* The access property list isn't part of the saved API context */
+    if(H5CX_set_apl(&ctx->apl_id, (H5I_DATASET == ctx->obj_type ? H5P_CLS_DACC : H5P_CLS_GACC), ctx->loc_id, FALSE) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set access property list info")
+
+    /* Get the location object */
+    if(NULL == (vol_obj = (H5VL_object_t *)H5I_object(ctx->loc_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid location identifier")
+
+    /* Set the location parameters */
+    loc_params.type         = H5VL_OBJECT_BY_SELF;
+    loc_params.obj_type     = H5I_get_type(ctx->loc_id);
+
+    /* Open the object */
+    if(H5I_DATASET == ctx->obj_type) {
+        if(NULL == (obj = H5VL_dataset_open(vol_obj, &loc_params, ctx->name, ctx->apl_id, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, FAIL, "unable to open dataset")
+    } /* end if */
+    else
+        if(NULL == (obj = H5VL_group_open(vol_obj, &loc_params, ctx->name, ctx->apl_id, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL)))
+            HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to open group")
+
+    /* Set up the VOL object the future ID will refer to */
+    if(NULL == (*object = H5VL_create_object(ctx->obj_type, obj, vol_obj->connector)))
+        HGOTO_ERROR(H5E_VOL, H5E_CANTCREATE, FAIL, "can't create VOL object")
+
+done:
+    if(ret_value < 0 && obj) {
+        if(H5I_DATASET == ctx->obj_type) {
+            if(H5VL__dataset_close(obj, vol_obj->connector->cls, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL) < 0)
+                HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "unable to release dataset")
+        } /* end if */
+        else
+            if(H5VL__group_close(obj, vol_obj->connector->cls, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL) < 0)
+                HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "unable to release group")
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__object_open_async_op() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__object_open_async_free
+ *
+ * Purpose:     Releases the arguments of a dataset or group open inserted
+ *              into an event set.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__object_open_async_free(void *_ctx)
+{
+    H5VL_object_open_async_t *ctx = (H5VL_object_open_async_t *)_ctx;  /* Arguments */
+    hid_t       ids[2];                 /* IDs held by the operation */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    ids[0] = ctx->loc_id;
+    ids[1] = ctx->apl_id;
+    if(H5VL__release_ids((size_t)2, ids) < 0)
+        HDONE_ERROR(H5E_VOL, H5E_CANTRELEASE, FAIL, "can't release IDs")
+    H5MM_xfree(ctx->name);
+    ctx = (H5VL_object_open_async_t *)H5MM_xfree(ctx);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__object_open_async_free() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__object_open_async
+ *
+ * Purpose:     Inserts a dataset or group open into an event set.
+ *
+ * Return:      Success:    A future ID for the object
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+static hid_t
+H5VL__object_open_async(H5I_type_t obj_type, hid_t loc_id, const char *name,
+    hid_t apl_id, hid_t es_id)
+{
+    H5VL_object_open_async_t *ctx = NULL;   /* Arguments of the operation */
+    hid_t       ids[2];                 /* IDs the operation holds */
+    hid_t       ret_value = H5I_INVALID_HID;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Hold on to the IDs */
+    ids[0] = loc_id;
+    ids[1] = apl_id;
+    if(H5VL__hold_ids((size_t)2, ids) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTINC, H5I_INVALID_HID, "can't hold IDs for asynchronous operation")
+
+    if(NULL == (ctx = (H5VL_object_open_async_t *)H5MM_malloc(sizeof(H5VL_object_open_async_t)))) {
+        (void)H5VL__release_ids((size_t)2, ids);
+        HGOTO_ERROR(H5E_VOL, H5E_CANTALLOC, H5I_INVALID_HID, "can't allocate asynchronous operation")
+    } /* end if */
+    ctx->obj_type = obj_type;
+    ctx->loc_id = loc_id;
+    ctx->apl_id = apl_id;
+    if(NULL == (ctx->name = H5MM_strdup(name))) {
+        (void)H5VL__object_open_async_free(ctx);
+        HGOTO_ERROR(H5E_VOL, H5E_CANTALLOC, H5I_INVALID_HID, "can't copy object name")
+    } /* end if */
+
+    /* Insert the operation (which releases the arguments, even on failure) */
+    if((ret_value = H5ES_insert_open(es_id, obj_type, H5VL__object_open_async_op, H5VL__object_open_async_free, ctx)) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTINSERT, H5I_INVALID_HID, "can't insert operation into event set")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__object_open_async() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL_dataset_open_async
+ *
+ * Purpose:     Opens a dataset through the VOL, as an operation of an
+ *              event set.  The ID returned is a future ID, and using it
+ *              waits for the open to complete.
+ *
+ * Return:      Success:    A future ID for the dataset
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5VL_dataset_open_async(hid_t loc_id, const char *name, hid_t dapl_id,
+    hid_t es_id)
+{
+    hid_t       ret_value = H5I_INVALID_HID;    /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    if((ret_value = H5VL__object_open_async(H5I_DATASET, loc_id, name, dapl_id, es_id)) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTOPENOBJ, H5I_INVALID_HID, "asynchronous dataset open failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL_dataset_open_async() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL_group_open_async
+ *
+ * Purpose:     Opens a group through the VOL, as an operation of an event
+ *              set.  The ID returned is a future ID, and using it waits
+ *              for the open to complete.
+ *
+ * Return:      Success:    A future ID for the group
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5VL_group_open_async(hid_t loc_id, const char *name, hid_t gapl_id,
+    hid_t es_id)
+{
+    hid_t       ret_value = H5I_INVALID_HID;    /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    if((ret_value = H5VL__object_open_async(H5I_GROUP, loc_id, name, gapl_id, es_id)) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTOPENOBJ, H5I_INVALID_HID, "asynchronous group open failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL_group_open_async() */
@@ -733,6 +733,40 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5VL_register() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL_create_object
+ *
+ * Purpose:     Constructs an H5VL_object_t for an object returned by a VOL
+ *              callback, without registering an ID for it.  Used when the
+ *              object is handed to an ID that already exists, such as the
+ *              future ID of an asynchronous open.
+ *
+ * Return:      Success:    A pointer to the new VOL object
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+H5VL_object_t *
+H5VL_create_object(H5I_type_t type, void *object, H5VL_t *vol_connector)
+{
+    H5VL_object_t  *ret_value = NULL;       /* Return value */
+
+    FUNC_ENTER_NOAPI(NULL)
+
+    /* Check arguments */
+    HDassert(object);
+    HDassert(vol_connector);
+
+    /* Set up VOL object for the passed-in data */
+    /* (Does not wrap object, since it's from a VOL callback) */
+    if(NULL == (ret_value = H5VL__new_vol_obj(type, object, vol_connector, FALSE)))
+        HGOTO_ERROR(H5E_VOL, H5E_CANTCREATE, NULL, "can't create VOL object")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL_create_object() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5VL_register_using_existing_id
@@ -1812,6 +1846,7 @@ H5VL__object(hid_t id, H5I_type_t obj_type)
         case H5I_ERROR_MSG:
         case H5I_ERROR_STACK:
         case H5I_SPACE_SEL_ITER:
+        case H5I_EVENTSET:
         case H5I_NTYPES:
         default:
             HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "unknown data object type")
@@ -48,6 +48,8 @@
 #define H5VL_NATIVE_DATASET_CHUNK_READ              6   /* H5Dchunk_read                */
 #define H5VL_NATIVE_DATASET_CHUNK_WRITE             7   /* H5Dchunk_write               */
 #define H5VL_NATIVE_DATASET_GET_VLEN_BUF_SIZE       8   /* H5Dvlen_get_buf_size         */
+#define H5VL_NATIVE_DATASET_CHUNK_READ_MULTI        9   /* H5Dread_chunks               */
+#define H5VL_NATIVE_DATASET_CHUNK_WRITE_MULTI      10   /* H5Dwrite_chunks              */
 
 /* Values for native VOL connector file optional VOL operations */
 #define H5VL_NATIVE_FILE_CLEAR_ELINK_CACHE             0   /* H5Fclear_elink_file_cache            */
@@ -79,6 +81,8 @@
 #define H5VL_NATIVE_FILE_GET_MPI_ATOMICITY             26  /* H5Fget_mpi_atomicity                 */
 #define H5VL_NATIVE_FILE_SET_MPI_ATOMICITY             27  /* H5Fset_mpi_atomicity                 */
 #define H5VL_NATIVE_FILE_POST_OPEN                     28  /* Adjust file after open, with wrapping context */
+#define H5VL_NATIVE_FILE_GET_CHUNK_CACHE_STATS         29  /* H5Fget_chunk_cache_stats             */
+#define H5VL_NATIVE_FILE_RESET_CHUNK_CACHE_STATS       30  /* H5Freset_chunk_cache_stats           */
 
 /* Values for native VOL connector group optional VOL operations */
 #ifndef H5_NO_DEPRECATED_SYMBOLS
@@ -606,6 +606,51 @@ H5VL__native_dataset_optional(void *obj, H5VL_dataset_optional_t optional_type,
                 break;
             }
 
+        case H5VL_NATIVE_DATASET_CHUNK_READ_MULTI:
+            {   /* H5Dread_chunks */
+                size_t          count               = HDva_arg(arguments, size_t);
+                const hsize_t **offsets             = HDva_arg(arguments, const hsize_t **);
+                uint32_t       *filters             = HDva_arg(arguments, uint32_t *);
+                void          **bufs                = HDva_arg(arguments, void **);
+
+                dset = (H5D_t *)obj;
+
+                /* Check arguments */
+                if(NULL == dset->oloc.file)
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
+                if(H5D_CHUNKED != dset->shared->layout.type)
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+                /* Read the raw chunks */
+                if(H5D__chunk_direct_read_multi(dset, count, offsets, filters, bufs) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read unprocessed chunk data")
+
+                break;
+            }
+
+        case H5VL_NATIVE_DATASET_CHUNK_WRITE_MULTI:
+            {   /* H5Dwrite_chunks */
+                size_t          count               = HDva_arg(arguments, size_t);
+                const uint32_t *filters             = HDva_arg(arguments, const uint32_t *);
+                const hsize_t **offsets             = HDva_arg(arguments, const hsize_t **);
+                const size_t   *data_sizes          = HDva_arg(arguments, const size_t *);
+                const void    **bufs                = HDva_arg(arguments, const void **);
+
+                dset = (H5D_t *)obj;
+
+                /* Check arguments */
+                if(NULL == dset->oloc.file)
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
+                if(H5D_CHUNKED != dset->shared->layout.type)
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+                /* Write the chunks */
+                if(H5D__chunk_direct_write_multi(dset, count, filters, offsets, data_sizes, bufs) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write unprocessed chunk data")
+
+                break;
+            }
+
         case H5VL_NATIVE_DATASET_GET_VLEN_BUF_SIZE:
             {   /* H5Dvlen_get_buf_size */
                 hid_t type_id = HDva_arg(arguments, hid_t);
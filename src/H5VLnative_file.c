@@ -20,6 +20,7 @@
 #include "H5private.h"          /* Generic Functions                        */
 #include "H5ACprivate.h"        /* Metadata cache                           */
 #include "H5Cprivate.h"         /* Cache                                    */
+#include "H5Dprivate.h"         /* Datasets                                 */
 #include "H5Eprivate.h"         /* Error handling                           */
 #include "H5Fpkg.h"             /* Files                                    */
 #include "H5Gprivate.h"         /* Groups                                   */
@@ -703,7 +704,7 @@ H5VL__native_file_optional(void *obj, H5VL_file_optional_t optional_type,
                     HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "page buffering not enabled on file")
 
                 /* Get the statistics */
-                if(H5PB_get_stats(f->shared->page_buf, accesses, hits, misses, evictions, bypasses) < 0)
+                if(H5PB_get_stats(f->shared->page_buf, accesses, hits, misses, evictions, bypasses, NULL, NULL) < 0)
                     HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't retrieve stats for page buffering")
 
                 break;
@@ -828,6 +829,26 @@ H5VL__native_file_optional(void *obj, H5VL_file_optional_t optional_type,
                 break;
             }
 
+        /* H5Fget_chunk_cache_stats */
+        case H5VL_NATIVE_FILE_GET_CHUNK_CACHE_STATS:
+            {
+                H5F_chunk_cache_stats_t *stats = HDva_arg(arguments, H5F_chunk_cache_stats_t *);
+
+                /* Get the statistics */
+                if(H5D_chunk_file_cache_get_stats(f->shared->rdcc_file, stats) < 0)
+                    HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't retrieve chunk cache stats")
+                break;
+            }
+
+        /* H5Freset_chunk_cache_stats */
+        case H5VL_NATIVE_FILE_RESET_CHUNK_CACHE_STATS:
+            {
+                /* Reset the statistics */
+                if(H5D_chunk_file_cache_reset_stats(f->shared->rdcc_file) < 0)
+                    HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "can't reset chunk cache stats")
+                break;
+            }
+
         default:
             HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid optional operation")
     } /* end switch */
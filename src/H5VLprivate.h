@@ -115,6 +115,7 @@ H5_DLL herr_t H5VL_free_lib_state(void *state);
 
 /* ID registration functions */
 H5_DLL hid_t H5VL_register(H5I_type_t type, void *object, H5VL_t *vol_connector, hbool_t app_ref);
+H5_DLL H5VL_object_t *H5VL_create_object(H5I_type_t type, void *object, H5VL_t *vol_connector);
 H5_DLL hid_t H5VL_wrap_register(H5I_type_t type, void *obj, hbool_t app_ref);
 H5_DLL hid_t H5VL_register_using_vol_id(H5I_type_t type, void *obj, hid_t connector_id, hbool_t app_ref);
 H5_DLL herr_t H5VL_register_using_existing_id(H5I_type_t type, void *object, H5VL_t *vol_connector, hbool_t app_ref, hid_t existing_id);
@@ -203,6 +204,13 @@ H5_DLL herr_t H5VL_request_specific(const H5VL_object_t *vol_obj, H5VL_request_s
 H5_DLL herr_t H5VL_request_optional(const H5VL_object_t *vol_obj, H5VL_request_optional_t opt_type, ...);
 H5_DLL herr_t H5VL_request_free(const H5VL_object_t *vol_obj);
 
+/* Event set operations */
+H5_DLL herr_t H5VL_dataset_read_async(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id, hid_t dxpl_id, void *buf, hid_t es_id);
+H5_DLL herr_t H5VL_dataset_write_async(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id, hid_t dxpl_id, const void *buf, hid_t es_id);
+H5_DLL hid_t H5VL_dataset_open_async(hid_t loc_id, const char *name, hid_t dapl_id, hid_t es_id);
+H5_DLL hid_t H5VL_group_open_async(hid_t loc_id, const char *name, hid_t gapl_id, hid_t es_id);
+H5_DLL herr_t H5VL_file_flush_async(hid_t obj_id, H5I_type_t obj_type, H5F_scope_t scope, hid_t es_id);
+
 /* Blob functions */
 H5_DLL herr_t H5VL_blob_put(const H5VL_object_t *vol_obj, const void *buf, size_t size, void *blob_id, void *ctx);
 H5_DLL herr_t H5VL_blob_get(const H5VL_object_t *vol_obj, const void *blob_id, void *buf, size_t size, void *ctx);
@@ -0,0 +1,593 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     The bitshuffle filter, which transposes the bits of the
+ *              elements in a chunk so that bit N of all the elements is
+ *              stored together, optionally followed by LZ4 or Zstandard
+ *              compression.  The data is stored in the same format as the
+ *              bitshuffle filter plugin that was registered with this
+ *              filter identifier:
+ *
+ *              The elements are transposed in blocks of "block size"
+ *              elements (a multiple of 8).  The last block is cut down to
+ *              a multiple of 8 elements, and the last (up to 7) elements
+ *              are stored as is after the blocks.  Within a block of N
+ *              elements, bit B of byte J of element I is stored as bit
+ *              ((J * 8) + B) * N + I of the block, counting from the least
+ *              significant bit of the first byte.
+ *
+ *              When compression is used, the data starts with the size of
+ *              the uncompressed data (8 bytes, big-endian) and the size of
+ *              a block in bytes (4 bytes, big-endian), and each compressed
+ *              block is preceded by its size (4 bytes, big-endian).
+ */
+
+#include "H5Zmodule.h"          /* This source code file is part of the H5Z module */
+
+
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5Iprivate.h"		/* IDs			  		*/
+#include "H5MMprivate.h"	/* Memory management			*/
+#include "H5Pprivate.h"         /* Property lists                       */
+#include "H5Tprivate.h"		/* Datatypes         			*/
+#include "H5Zpkg.h"		/* Data filters				*/
+
+#ifdef H5_HAVE_FILTER_LZ4
+#include <lz4.h>
+#endif /* H5_HAVE_FILTER_LZ4 */
+#ifdef H5_HAVE_FILTER_ZSTD
+#include <zstd.h>
+#endif /* H5_HAVE_FILTER_ZSTD */
+
+/* Local macros */
+#define H5Z_BITSHUFFLE_VERSION_MAJOR    0       /* Version of the bitshuffle format, */
+#define H5Z_BITSHUFFLE_VERSION_MINOR    5       /* stored for the plugin's benefit */
+#define H5Z_BITSHUFFLE_BLOCK_MULT       8       /* Block sizes are a multiple of this */
+#define H5Z_BITSHUFFLE_TARGET_BLOCK     8192    /* Target size of a default block in bytes */
+#define H5Z_BITSHUFFLE_MIN_BLOCK        128     /* Minimum default number of elements in a block */
+#define H5Z_BITSHUFFLE_HDR_SIZE         12      /* Size of the header for compressed data */
+
+/* Transpose the 8x8 bit matrix in the bytes of X, so that bit B of byte J
+ * becomes bit J of byte B */
+#define H5Z_BITSHUFFLE_TRANS_8X8(x, t) {                                      \
+    (t) = ((x) ^ ((x) >> 7)) & 0x00AA00AA00AA00AAULL;                         \
+    (x) = (x) ^ (t) ^ ((t) << 7);                                             \
+    (t) = ((x) ^ ((x) >> 14)) & 0x0000CCCC0000CCCCULL;                        \
+    (x) = (x) ^ (t) ^ ((t) << 14);                                            \
+    (t) = ((x) ^ ((x) >> 28)) & 0x00000000F0F0F0F0ULL;                        \
+    (x) = (x) ^ (t) ^ ((t) << 28);                                            \
+}
+
+/* Local function prototypes */
+static htri_t H5Z_can_apply_bitshuffle(hid_t dcpl_id, hid_t type_id, hid_t space_id);
+static herr_t H5Z_set_local_bitshuffle(hid_t dcpl_id, hid_t type_id, hid_t space_id);
+static size_t H5Z_filter_bitshuffle(unsigned flags, size_t cd_nelmts,
+    const unsigned cd_values[], size_t nbytes, size_t *buf_size, void **buf);
+
+/* This message derives from H5Z */
+const H5Z_class2_t H5Z_BITSHUFFLE[1] = {{
+    H5Z_CLASS_T_VERS,       /* H5Z_class_t version */
+    H5Z_FILTER_BITSHUFFLE,	/* Filter id number		*/
+    1,              /* encoder_present flag (set to true) */
+    1,              /* decoder_present flag (set to true) */
+    "bitshuffle",		/* Filter name for debugging	*/
+    H5Z_can_apply_bitshuffle,   /* The "can apply" callback     */
+    H5Z_set_local_bitshuffle,   /* The "set local" callback     */
+    H5Z_filter_bitshuffle,	/* The actual filter function	*/
+}};
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z_can_apply_bitshuffle
+ *
+ * Purpose:	Check the parameters for bitshuffle compression for
+ *              validity and whether they fit a particular dataset.
+ *
+ * Return:	Success: Non-negative
+ *		Failure: Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5Z_can_apply_bitshuffle(hid_t dcpl_id, hid_t H5_ATTR_UNUSED type_id,
+    hid_t H5_ATTR_UNUSED space_id)
+{
+    H5P_genplist_t *dcpl_plist;         /* Property list pointer */
+    unsigned flags;                     /* Filter flags */
+    size_t cd_nelmts = H5Z_BITSHUFFLE_TOTAL_NPARMS;     /* Number of filter parameters */
+    unsigned cd_values[H5Z_BITSHUFFLE_TOTAL_NPARMS];    /* Filter parameters */
+    unsigned block_size = 0;            /* Block size */
+    unsigned compression = H5Z_BITSHUFFLE_COMP_NONE;    /* Compression */
+    htri_t ret_value = TRUE;            /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Get the plist structure */
+    if(NULL == (dcpl_plist = H5P_object_verify(dcpl_id, H5P_DATASET_CREATE)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get the filter's current parameters */
+    if(H5P_get_filter_by_id(dcpl_plist, H5Z_FILTER_BITSHUFFLE, &flags, &cd_nelmts, cd_values, (size_t)0, NULL, NULL) < 0)
+	HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't get bitshuffle parameters")
+
+    /* The parameters may or may not already include the "local" ones */
+    if(cd_nelmts > H5Z_BITSHUFFLE_USER_NPARMS) {
+        if(cd_nelmts > H5Z_BITSHUFFLE_PARM_BLOCK_SIZE)
+            block_size = cd_values[H5Z_BITSHUFFLE_PARM_BLOCK_SIZE];
+        if(cd_nelmts > H5Z_BITSHUFFLE_PARM_COMP)
+            compression = cd_values[H5Z_BITSHUFFLE_PARM_COMP];
+    } /* end if */
+    else {
+        if(cd_nelmts > 0)
+            block_size = cd_values[0];
+        if(cd_nelmts > 1)
+            compression = cd_values[1];
+    } /* end else */
+
+    if(block_size % H5Z_BITSHUFFLE_BLOCK_MULT)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FALSE, "bitshuffle block size must be a multiple of 8")
+    switch(compression) {
+        case H5Z_BITSHUFFLE_COMP_NONE:
+            break;
+
+        case H5Z_BITSHUFFLE_COMP_LZ4:
+#ifndef H5_HAVE_FILTER_LZ4
+            HGOTO_ERROR(H5E_PLINE, H5E_UNSUPPORTED, FALSE, "LZ4 compression is not available")
+#endif /* H5_HAVE_FILTER_LZ4 */
+            break;
+
+        case H5Z_BITSHUFFLE_COMP_ZSTD:
+#ifndef H5_HAVE_FILTER_ZSTD
+            HGOTO_ERROR(H5E_PLINE, H5E_UNSUPPORTED, FALSE, "Zstandard compression is not available")
+#endif /* H5_HAVE_FILTER_ZSTD */
+            break;
+
+        default:
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FALSE, "invalid bitshuffle compression")
+    } /* end switch */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_can_apply_bitshuffle() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z_set_local_bitshuffle
+ *
+ * Purpose:	Set the "local" dataset parameters for the bitshuffle
+ *              filter: the version of the format and the size of the
+ *              elements.  The user's parameters (block size, compression
+ *              and compression level) follow them, with defaults for the
+ *              ones that weren't set.
+ *
+ * Return:	Success: Non-negative
+ *		Failure: Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z_set_local_bitshuffle(hid_t dcpl_id, hid_t type_id, hid_t H5_ATTR_UNUSED space_id)
+{
+    H5P_genplist_t *dcpl_plist;         /* Property list pointer */
+    const H5T_t	*type;                  /* Datatype */
+    unsigned flags;                     /* Filter flags */
+    size_t cd_nelmts = H5Z_BITSHUFFLE_TOTAL_NPARMS;     /* Number of filter parameters */
+    unsigned cd_values[H5Z_BITSHUFFLE_TOTAL_NPARMS];    /* Filter parameters */
+    size_t elem_size;                   /* Size of the elements */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Get the plist structure */
+    if(NULL == (dcpl_plist = H5P_object_verify(dcpl_id, H5P_DATASET_CREATE)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get datatype */
+    if(NULL == (type = (const H5T_t *)H5I_object_verify(type_id, H5I_DATATYPE)))
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
+
+    /* Get the filter's current parameters */
+    if(H5P_get_filter_by_id(dcpl_plist, H5Z_FILTER_BITSHUFFLE, &flags, &cd_nelmts, cd_values, (size_t)0, NULL, NULL) < 0)
+	HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't get bitshuffle parameters")
+
+    /* Move the user's parameters after the "local" ones, if that hasn't
+     * been done already (when the property list came from a dataset) */
+    if(cd_nelmts <= H5Z_BITSHUFFLE_USER_NPARMS) {
+        unsigned user_values[H5Z_BITSHUFFLE_USER_NPARMS] = {0, H5Z_BITSHUFFLE_COMP_NONE, H5Z_ZSTD_DEFAULT_LEVEL};
+
+        if(cd_nelmts > 0)
+            H5MM_memcpy(user_values, cd_values, cd_nelmts * sizeof(unsigned));
+        H5MM_memcpy(&cd_values[H5Z_BITSHUFFLE_PARM_BLOCK_SIZE], user_values, sizeof(user_values));
+    } /* end if */
+    else if(cd_nelmts < H5Z_BITSHUFFLE_TOTAL_NPARMS) {
+        if(cd_nelmts <= H5Z_BITSHUFFLE_PARM_COMP)
+            cd_values[H5Z_BITSHUFFLE_PARM_COMP] = H5Z_BITSHUFFLE_COMP_NONE;
+        cd_values[H5Z_BITSHUFFLE_PARM_LEVEL] = H5Z_ZSTD_DEFAULT_LEVEL;
+    } /* end if */
+
+    /* Bit-shuffle the base type of an array datatype */
+    if(H5T_ARRAY == H5T_get_class(type, FALSE)) {
+        if(0 == (elem_size = H5T_get_size(H5T_get_super(type))))
+            HGOTO_ERROR(H5E_PLINE, H5E_BADTYPE, FAIL, "bad datatype size")
+    } /* end if */
+    else if(0 == (elem_size = H5T_get_size(type)))
+        HGOTO_ERROR(H5E_PLINE, H5E_BADTYPE, FAIL, "bad datatype size")
+
+    /* Set "local" parameters for this dataset */
+    cd_values[H5Z_BITSHUFFLE_PARM_MAJOR] = H5Z_BITSHUFFLE_VERSION_MAJOR;
+    cd_values[H5Z_BITSHUFFLE_PARM_MINOR] = H5Z_BITSHUFFLE_VERSION_MINOR;
+    H5_CHECKED_ASSIGN(cd_values[H5Z_BITSHUFFLE_PARM_ELEM_SIZE], unsigned, elem_size, size_t);
+
+    /* Modify the filter's parameters for this dataset */
+    if(H5P_modify_filter(dcpl_plist, H5Z_FILTER_BITSHUFFLE, flags, (size_t)H5Z_BITSHUFFLE_TOTAL_NPARMS, cd_values) < 0)
+	HGOTO_ERROR(H5E_PLINE, H5E_CANTSET, FAIL, "can't set local bitshuffle parameters")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_set_local_bitshuffle() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__bitshuffle_block
+ *
+ * Purpose:	Transpose the bits of NELMTS (a multiple of 8) elements of
+ *              ELEM_SIZE bytes, or undo that if REVERSE is set.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__bitshuffle_block(unsigned char *dst, const unsigned char *src,
+    size_t nelmts, size_t elem_size, hbool_t reverse)
+{
+    size_t nrow = nelmts / 8;           /* Number of bytes in each bit "row" */
+    size_t i, j;                        /* Local index variables */
+    unsigned b;                         /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(0 == nelmts % 8);
+
+    /* Transpose a group of 8 elements' byte J at a time */
+    for(j = 0; j < elem_size; j++)
+        for(i = 0; i < nrow; i++) {
+            uint64_t x = 0, t;
+
+            if(reverse) {
+                /* Gather bit rows (J * 8) through (J * 8) + 7 */
+                for(b = 0; b < 8; b++)
+                    x |= (uint64_t)src[(((j * 8) + b) * nrow) + i] << (8 * b);
+                H5Z_BITSHUFFLE_TRANS_8X8(x, t)
+                for(b = 0; b < 8; b++)
+                    dst[(((i * 8) + b) * elem_size) + j] = (unsigned char)(x >> (8 * b));
+            } /* end if */
+            else {
+                /* Gather byte J of the group's elements */
+                for(b = 0; b < 8; b++)
+                    x |= (uint64_t)src[(((i * 8) + b) * elem_size) + j] << (8 * b);
+                H5Z_BITSHUFFLE_TRANS_8X8(x, t)
+                for(b = 0; b < 8; b++)
+                    dst[(((j * 8) + b) * nrow) + i] = (unsigned char)(x >> (8 * b));
+            } /* end else */
+        } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__bitshuffle_block() */
+
+#if defined(H5_HAVE_FILTER_LZ4) || defined(H5_HAVE_FILTER_ZSTD)
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__bitshuffle_compress_bound
+ *
+ * Purpose:	Compute the largest size of a compressed block of NBYTES.
+ *
+ * Return:	Size of buffer needed
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__bitshuffle_compress_bound(unsigned compression, size_t nbytes)
+{
+    size_t ret_value = 0;       /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef H5_HAVE_FILTER_LZ4
+    if(H5Z_BITSHUFFLE_COMP_LZ4 == compression)
+        ret_value = (size_t)LZ4_compressBound((int)nbytes);
+#endif /* H5_HAVE_FILTER_LZ4 */
+#ifdef H5_HAVE_FILTER_ZSTD
+    if(H5Z_BITSHUFFLE_COMP_ZSTD == compression)
+        ret_value = ZSTD_compressBound(nbytes);
+#endif /* H5_HAVE_FILTER_ZSTD */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__bitshuffle_compress_bound() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__bitshuffle_compress_block
+ *
+ * Purpose:	Compress a bitshuffled block.
+ *
+ * Return:	Success: Size of compressed block
+ *		Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__bitshuffle_compress_block(unsigned compression, int level,
+    unsigned char *dst, size_t dst_nbytes, const unsigned char *src,
+    size_t nbytes)
+{
+    size_t ret_value = 0;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+#ifdef H5_HAVE_FILTER_LZ4
+    if(H5Z_BITSHUFFLE_COMP_LZ4 == compression) {
+        int comp_size;
+
+        if((comp_size = LZ4_compress_default((const char *)src, (char *)dst, (int)nbytes, (int)dst_nbytes)) <= 0)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "lz4 compression failed")
+        ret_value = (size_t)comp_size;
+    } /* end if */
+#endif /* H5_HAVE_FILTER_LZ4 */
+#ifdef H5_HAVE_FILTER_ZSTD
+    if(H5Z_BITSHUFFLE_COMP_ZSTD == compression) {
+        size_t status;
+
+        status = ZSTD_compress(dst, dst_nbytes, src, nbytes, level);
+        if(ZSTD_isError(status))
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "zstd error: %s", ZSTD_getErrorName(status))
+        ret_value = status;
+    } /* end if */
+#endif /* H5_HAVE_FILTER_ZSTD */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__bitshuffle_compress_block() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__bitshuffle_decompress_block
+ *
+ * Purpose:	Uncompress a block of NBYTES (uncompressed) bytes.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z__bitshuffle_decompress_block(unsigned compression, unsigned char *dst,
+    size_t nbytes, const unsigned char *src, size_t comp_nbytes)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+#ifdef H5_HAVE_FILTER_LZ4
+    if(H5Z_BITSHUFFLE_COMP_LZ4 == compression)
+        if(LZ4_decompress_safe((const char *)src, (char *)dst, (int)comp_nbytes, (int)nbytes) != (int)nbytes)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "lz4 uncompression failed")
+#endif /* H5_HAVE_FILTER_LZ4 */
+#ifdef H5_HAVE_FILTER_ZSTD
+    if(H5Z_BITSHUFFLE_COMP_ZSTD == compression)
+        if(ZSTD_decompress(dst, nbytes, src, comp_nbytes) != nbytes)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "zstd uncompression failed")
+#endif /* H5_HAVE_FILTER_ZSTD */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__bitshuffle_decompress_block() */
+#endif /* defined(H5_HAVE_FILTER_LZ4) || defined(H5_HAVE_FILTER_ZSTD) */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z_filter_bitshuffle
+ *
+ * Purpose:	Implement the bitshuffle filter, see the top of the file.
+ *
+ * Return:	Success: Size of buffer filtered
+ *		Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z_filter_bitshuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
+    size_t nbytes, size_t *buf_size, void **buf)
+{
+    unsigned char *outbuf = NULL;       /* Pointer to new buffer */
+    unsigned char *tmpbuf = NULL;       /* Block buffer, for compression */
+    const unsigned char *src;           /* Pointer into source buffer */
+    const unsigned char *src_end;       /* End of source buffer */
+    unsigned char *dst;                 /* Pointer into destination buffer */
+    size_t      elem_size;              /* Size of elements */
+    size_t      block_size = 0;         /* Number of elements in a block */
+    unsigned    compression = H5Z_BITSHUFFLE_COMP_NONE; /* Compression */
+#if defined(H5_HAVE_FILTER_LZ4) || defined(H5_HAVE_FILTER_ZSTD)
+    int         level = H5Z_ZSTD_DEFAULT_LEVEL; /* Compression level */
+#endif /* defined(H5_HAVE_FILTER_LZ4) || defined(H5_HAVE_FILTER_ZSTD) */
+    size_t      orig_nbytes;            /* Size of unfiltered data */
+    size_t      out_nbytes;             /* Size of output buffer */
+    size_t      nelmts;                 /* Number of elements */
+    size_t      done;                   /* Number of elements processed */
+    size_t      leftover;               /* Size of elements stored as is */
+    size_t      ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_NOAPI(0)
+
+    /* Check arguments */
+    if(cd_nelmts <= H5Z_BITSHUFFLE_PARM_ELEM_SIZE || 0 == cd_values[H5Z_BITSHUFFLE_PARM_ELEM_SIZE])
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "invalid bitshuffle parameters")
+    elem_size = cd_values[H5Z_BITSHUFFLE_PARM_ELEM_SIZE];
+    if(cd_nelmts > H5Z_BITSHUFFLE_PARM_BLOCK_SIZE)
+        block_size = cd_values[H5Z_BITSHUFFLE_PARM_BLOCK_SIZE];
+    if(cd_nelmts > H5Z_BITSHUFFLE_PARM_COMP)
+        compression = cd_values[H5Z_BITSHUFFLE_PARM_COMP];
+#if defined(H5_HAVE_FILTER_LZ4) || defined(H5_HAVE_FILTER_ZSTD)
+    if(cd_nelmts > H5Z_BITSHUFFLE_PARM_LEVEL)
+        level = (int)cd_values[H5Z_BITSHUFFLE_PARM_LEVEL];
+#endif /* defined(H5_HAVE_FILTER_LZ4) || defined(H5_HAVE_FILTER_ZSTD) */
+    switch(compression) {
+        case H5Z_BITSHUFFLE_COMP_NONE:
+            break;
+#ifdef H5_HAVE_FILTER_LZ4
+        case H5Z_BITSHUFFLE_COMP_LZ4:
+            break;
+#endif /* H5_HAVE_FILTER_LZ4 */
+#ifdef H5_HAVE_FILTER_ZSTD
+        case H5Z_BITSHUFFLE_COMP_ZSTD:
+            break;
+#endif /* H5_HAVE_FILTER_ZSTD */
+        default:
+            HGOTO_ERROR(H5E_PLINE, H5E_UNSUPPORTED, 0, "bitshuffle compression is not available")
+    } /* end switch */
+
+    src = (const unsigned char *)(*buf);
+    src_end = src + nbytes;
+    if(H5Z_BITSHUFFLE_COMP_NONE != compression && (flags & H5Z_FLAG_REVERSE)) {
+        uint64_t    enc_nbytes;             /* Size of uncompressed data */
+        uint32_t    enc_block_nbytes;       /* Size of blocks */
+
+        /* Decode the header, its block size overrides the parameter's */
+        if(nbytes < H5Z_BITSHUFFLE_HDR_SIZE)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "bitshuffle compressed data is too small")
+        H5Z_UINT64DECODE_BE(src, enc_nbytes)
+        H5Z_UINT32DECODE_BE(src, enc_block_nbytes)
+        H5_CHECKED_ASSIGN(orig_nbytes, size_t, enc_nbytes, uint64_t);
+        block_size = enc_block_nbytes / elem_size;
+    } /* end if */
+    else
+        orig_nbytes = nbytes;
+
+    /* Use the default block size, if not set */
+    if(0 == block_size) {
+        block_size = H5Z_BITSHUFFLE_TARGET_BLOCK / elem_size;
+        block_size = (block_size / H5Z_BITSHUFFLE_BLOCK_MULT) * H5Z_BITSHUFFLE_BLOCK_MULT;
+        block_size = MAX(block_size, H5Z_BITSHUFFLE_MIN_BLOCK);
+    } /* end if */
+    if(block_size % H5Z_BITSHUFFLE_BLOCK_MULT)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "invalid bitshuffle block size")
+    if(orig_nbytes % elem_size)
+	HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "bitshuffle data is not a whole number of elements")
+    nelmts = orig_nbytes / elem_size;
+    leftover = (nelmts % H5Z_BITSHUFFLE_BLOCK_MULT) * elem_size;
+
+    /* Allocate the output buffer */
+    if(H5Z_BITSHUFFLE_COMP_NONE == compression || (flags & H5Z_FLAG_REVERSE))
+        out_nbytes = orig_nbytes;
+    else {
+#if defined(H5_HAVE_FILTER_LZ4) || defined(H5_HAVE_FILTER_ZSTD)
+        size_t nblocks = (nelmts + block_size - 1) / block_size;
+
+        out_nbytes = H5Z_BITSHUFFLE_HDR_SIZE + (nblocks * (4 + H5Z__bitshuffle_compress_bound(compression, block_size * elem_size))) + leftover;
+#else /* defined(H5_HAVE_FILTER_LZ4) || defined(H5_HAVE_FILTER_ZSTD) */
+        HDassert(0 && "This Should never be executed!");
+        out_nbytes = 0;
+#endif /* defined(H5_HAVE_FILTER_LZ4) || defined(H5_HAVE_FILTER_ZSTD) */
+    } /* end else */
+    if(NULL == (outbuf = (unsigned char *)H5MM_malloc(MAX(out_nbytes, 1))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for bitshuffle buffer")
+    dst = outbuf;
+
+    if(H5Z_BITSHUFFLE_COMP_NONE == compression) {
+        /* [Un]shuffle each block */
+        for(done = 0; done + H5Z_BITSHUFFLE_BLOCK_MULT <= nelmts; done += block_size) {
+            size_t this_nelmts = MIN(block_size, nelmts - done);
+
+            /* The last block is cut down to a multiple of 8 elements */
+            this_nelmts -= this_nelmts % H5Z_BITSHUFFLE_BLOCK_MULT;
+            H5Z__bitshuffle_block(dst, src, this_nelmts, elem_size, (hbool_t)((flags & H5Z_FLAG_REVERSE) != 0));
+            src += this_nelmts * elem_size;
+            dst += this_nelmts * elem_size;
+        } /* end for */
+    } /* end if */
+#if defined(H5_HAVE_FILTER_LZ4) || defined(H5_HAVE_FILTER_ZSTD)
+    else {
+        size_t tmp_nbytes = MAX(H5Z__bitshuffle_compress_bound(compression, block_size * elem_size), block_size * elem_size);
+
+        if(NULL == (tmpbuf = (unsigned char *)H5MM_malloc(tmp_nbytes)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for bitshuffle buffer")
+
+        /* Encode the header */
+        if(!(flags & H5Z_FLAG_REVERSE)) {
+            H5Z_UINT64ENCODE_BE(dst, nbytes)
+            H5Z_UINT32ENCODE_BE(dst, block_size * elem_size)
+        } /* end if */
+
+        /* [Un]shuffle and [un]compress each block */
+        for(done = 0; done + H5Z_BITSHUFFLE_BLOCK_MULT <= nelmts; done += block_size) {
+            size_t this_nelmts = MIN(block_size, nelmts - done);
+            size_t this_nbytes;
+
+            /* The last block is cut down to a multiple of 8 elements */
+            this_nelmts -= this_nelmts % H5Z_BITSHUFFLE_BLOCK_MULT;
+            this_nbytes = this_nelmts * elem_size;
+
+            if(flags & H5Z_FLAG_REVERSE) {
+                uint32_t comp_nbytes;   /* Size of compressed block */
+
+                if((size_t)(src_end - src) < 4)
+                    HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "bitshuffle compressed data is truncated")
+                H5Z_UINT32DECODE_BE(src, comp_nbytes)
+                if(comp_nbytes > (size_t)(src_end - src))
+                    HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "bitshuffle compressed data is truncated")
+                if(H5Z__bitshuffle_decompress_block(compression, tmpbuf, this_nbytes, src, (size_t)comp_nbytes) < 0)
+                    HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "can't uncompress bitshuffle block")
+                H5Z__bitshuffle_block(dst, tmpbuf, this_nelmts, elem_size, TRUE);
+                src += comp_nbytes;
+                dst += this_nbytes;
+            } /* end if */
+            else {
+                size_t comp_nbytes;     /* Size of compressed block */
+
+                H5Z__bitshuffle_block(tmpbuf, src, this_nelmts, elem_size, FALSE);
+                if(0 == (comp_nbytes = H5Z__bitshuffle_compress_block(compression, level, dst + 4, (size_t)((outbuf + out_nbytes) - (dst + 4)), tmpbuf, this_nbytes)))
+                    HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "can't compress bitshuffle block")
+                H5Z_UINT32ENCODE_BE(dst, comp_nbytes)
+                src += this_nbytes;
+                dst += comp_nbytes;
+            } /* end else */
+        } /* end for */
+    } /* end else */
+#endif /* defined(H5_HAVE_FILTER_LZ4) || defined(H5_HAVE_FILTER_ZSTD) */
+
+    /* Copy the elements that don't fill a group of 8 */
+    if(leftover > 0) {
+        if((size_t)(src_end - src) < leftover)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "bitshuffle data is truncated")
+        H5MM_memcpy(dst, src, leftover);
+        dst += leftover;
+    } /* end if */
+
+    /* Free the input buffer */
+    H5MM_xfree(*buf);
+
+    /* Set return values */
+    ret_value = (size_t)(dst - outbuf);
+    *buf = outbuf;
+    outbuf = NULL;
+    *buf_size = MAX(out_nbytes, 1);
+
+done:
+    if(outbuf)
+        H5MM_xfree(outbuf);
+    if(tmpbuf)
+        H5MM_xfree(tmpbuf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_filter_bitshuffle() */
+
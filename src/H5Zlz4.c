@@ -0,0 +1,213 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     A filter around the LZ4 compression library, which stores
+ *              data in the same format as the LZ4 filter plugin that was
+ *              registered with this filter identifier:
+ *
+ *              - the size of the uncompressed data (8 bytes, big-endian)
+ *              - the block size (4 bytes, big-endian)
+ *              - for each block, the size of the compressed block (4
+ *                bytes, big-endian) followed by the compressed block.  A
+ *                block that doesn't compress is stored as is, and its
+ *                "compressed" size is then the block size.
+ *
+ *              The only filter parameter is the block size, which is
+ *              optional.
+ */
+
+#include "H5Zmodule.h"          /* This source code file is part of the H5Z module */
+
+
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5MMprivate.h"	/* Memory management			*/
+#include "H5Zpkg.h"		/* Data filters				*/
+
+#ifdef H5_HAVE_FILTER_LZ4
+
+#include <lz4.h>
+
+/* Size of the header of the compressed data */
+#define H5Z_LZ4_HDR_SIZE        12
+
+/* Local function prototypes */
+static size_t H5Z_filter_lz4(unsigned flags, size_t cd_nelmts,
+    const unsigned cd_values[], size_t nbytes, size_t *buf_size, void **buf);
+
+/* This message derives from H5Z */
+const H5Z_class2_t H5Z_LZ4[1] = {{
+    H5Z_CLASS_T_VERS,       /* H5Z_class_t version */
+    H5Z_FILTER_LZ4,		/* Filter id number		*/
+    1,              /* encoder_present flag (set to true) */
+    1,              /* decoder_present flag (set to true) */
+    "lz4",			/* Filter name for debugging	*/
+    NULL,                       /* The "can apply" callback     */
+    NULL,                       /* The "set local" callback     */
+    H5Z_filter_lz4,             /* The actual filter function	*/
+}};
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z_filter_lz4
+ *
+ * Purpose:	Implement an I/O filter around the LZ4 compression library.
+ *
+ * Return:	Success: Size of buffer filtered
+ *		Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z_filter_lz4(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
+    size_t nbytes, size_t *buf_size, void **buf)
+{
+    unsigned char *outbuf = NULL;       /* Pointer to new buffer */
+    const unsigned char *src;           /* Pointer into the source buffer */
+    unsigned char *dst;                 /* Pointer into the destination buffer */
+    size_t      block_size;             /* Size of each (uncompressed) block */
+    size_t      done;                   /* Number of uncompressed bytes processed */
+    size_t      ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_NOAPI(0)
+
+    /* Sanity check */
+    HDassert(*buf_size > 0);
+    HDassert(buf);
+    HDassert(*buf);
+
+    if(flags & H5Z_FLAG_REVERSE) {
+        /* Input; uncompress */
+        const unsigned char *src_end = (const unsigned char *)(*buf) + nbytes;
+        uint64_t    orig_size;          /* Size of uncompressed data */
+        uint32_t    enc_block_size;     /* Block size in the header */
+
+        if(nbytes < H5Z_LZ4_HDR_SIZE)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "lz4 compressed data is too small")
+
+        /* Decode the header */
+        src = (const unsigned char *)(*buf);
+        H5Z_UINT64DECODE_BE(src, orig_size)
+        H5Z_UINT32DECODE_BE(src, enc_block_size)
+        H5_CHECK_OVERFLOW(orig_size, uint64_t, size_t);
+        block_size = MIN((size_t)enc_block_size, (size_t)orig_size);
+        if(orig_size > 0 && (block_size == 0 || block_size > LZ4_MAX_INPUT_SIZE))
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "invalid lz4 block size")
+
+        /* Allocate space for the uncompressed buffer */
+	if(NULL == (outbuf = (unsigned char *)H5MM_malloc(MAX((size_t)orig_size, 1))))
+	    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for lz4 uncompression")
+
+        /* Uncompress each block */
+        for(done = 0, dst = outbuf; done < (size_t)orig_size; done += block_size) {
+            uint32_t    comp_size;      /* Size of compressed block */
+
+            /* The last block may be short */
+            if(block_size > (size_t)orig_size - done)
+                block_size = (size_t)orig_size - done;
+
+            if((size_t)(src_end - src) < 4)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "lz4 compressed data is truncated")
+            H5Z_UINT32DECODE_BE(src, comp_size)
+            if(comp_size > (size_t)(src_end - src))
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "lz4 compressed data is truncated")
+
+            if(comp_size == block_size)
+                /* The block was stored uncompressed */
+                H5MM_memcpy(dst, src, block_size);
+            else if(LZ4_decompress_safe((const char *)src, (char *)dst, (int)comp_size, (int)block_size) != (int)block_size)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "lz4 uncompression failed")
+
+            src += comp_size;
+            dst += block_size;
+        } /* end for */
+
+        /* Free the input buffer */
+	H5MM_xfree(*buf);
+
+        /* Set return values */
+	*buf = outbuf;
+	outbuf = NULL;
+	*buf_size = MAX((size_t)orig_size, 1);
+	ret_value = (size_t)orig_size;
+    } /* end if */
+    else {
+        /* Output; compress */
+        size_t  nblocks;                /* Number of blocks */
+        size_t  dst_nbytes;             /* Size of output buffer */
+
+        /* Get the block size */
+        if(cd_nelmts > H5Z_LZ4_PARM_BLOCK_SIZE && cd_values[H5Z_LZ4_PARM_BLOCK_SIZE] > 0)
+            block_size = cd_values[H5Z_LZ4_PARM_BLOCK_SIZE];
+        else
+            block_size = H5Z_LZ4_DEFAULT_BLOCK_SIZE;
+        if(block_size > LZ4_MAX_INPUT_SIZE)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "invalid lz4 block size")
+        if(block_size > nbytes)
+            block_size = nbytes;
+        nblocks = nbytes > 0 ? ((nbytes - 1) / block_size) + 1 : 0;
+
+        /* Allocate output (compressed) buffer */
+        dst_nbytes = H5Z_LZ4_HDR_SIZE + (nblocks * (4 + (size_t)LZ4_compressBound((int)block_size)));
+	if(NULL == (outbuf = (unsigned char *)H5MM_malloc(dst_nbytes)))
+	    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to allocate lz4 destination buffer")
+
+        /* Encode the header */
+        dst = outbuf;
+        H5Z_UINT64ENCODE_BE(dst, nbytes)
+        H5Z_UINT32ENCODE_BE(dst, block_size)
+
+        /* Compress each block */
+        for(done = 0, src = (const unsigned char *)(*buf); done < nbytes; done += block_size) {
+            unsigned char *comp_size_p = dst;   /* Where to encode the compressed size */
+            int     comp_size;                  /* Size of compressed block */
+
+            /* The last block may be short */
+            if(block_size > nbytes - done)
+                block_size = nbytes - done;
+
+            dst += 4;
+            comp_size = LZ4_compress_default((const char *)src, (char *)dst, (int)block_size, LZ4_compressBound((int)block_size));
+            if(comp_size <= 0)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "lz4 compression failed")
+
+            /* Store the block as is if compressing it didn't help */
+            if((size_t)comp_size >= block_size) {
+                H5MM_memcpy(dst, src, block_size);
+                comp_size = (int)block_size;
+            } /* end if */
+            H5Z_UINT32ENCODE_BE(comp_size_p, comp_size)
+
+            src += block_size;
+            dst += comp_size;
+        } /* end for */
+
+        /* Free the input buffer */
+        H5MM_xfree(*buf);
+
+        /* Set return values */
+        ret_value = (size_t)(dst - outbuf);
+        *buf = outbuf;
+        outbuf = NULL;
+        *buf_size = dst_nbytes;
+    } /* end else */
+
+done:
+    if(outbuf)
+        H5MM_xfree(outbuf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_filter_lz4() */
+
+#endif /* H5_HAVE_FILTER_LZ4 */
+
@@ -37,6 +37,9 @@ H5_DLLVAR H5Z_class2_t H5Z_NBIT[1];
 /* Scale/offset filter */
 H5_DLLVAR H5Z_class2_t H5Z_SCALEOFFSET[1];
 
+/* Bitshuffle filter */
+H5_DLLVAR const H5Z_class2_t H5Z_BITSHUFFLE[1];
+
 /********************/
 /* External filters */
 /********************/
@@ -51,6 +54,43 @@ H5_DLLVAR const H5Z_class2_t H5Z_DEFLATE[1];
 H5_DLLVAR H5Z_class2_t H5Z_SZIP[1];
 #endif /* H5_HAVE_FILTER_SZIP */
 
+/* LZ4 filter */
+#ifdef H5_HAVE_FILTER_LZ4
+H5_DLLVAR const H5Z_class2_t H5Z_LZ4[1];
+#endif /* H5_HAVE_FILTER_LZ4 */
+
+/* Zstandard filter */
+#ifdef H5_HAVE_FILTER_ZSTD
+H5_DLLVAR const H5Z_class2_t H5Z_ZSTD[1];
+#endif /* H5_HAVE_FILTER_ZSTD */
+
+/* Encode and decode the big-endian integers in the headers of the LZ4 and
+ * bitshuffle filters' data */
+#define H5Z_UINT32ENCODE_BE(p, n) {                                           \
+    uint32_t _n = (uint32_t)(n);                                              \
+                                                                              \
+    *(p)++ = (uint8_t)((_n >> 24) & 0xff);                                    \
+    *(p)++ = (uint8_t)((_n >> 16) & 0xff);                                    \
+    *(p)++ = (uint8_t)((_n >> 8) & 0xff);                                     \
+    *(p)++ = (uint8_t)(_n & 0xff);                                            \
+}
+#define H5Z_UINT64ENCODE_BE(p, n) {                                           \
+    H5Z_UINT32ENCODE_BE(p, ((uint64_t)(n)) >> 32)                             \
+    H5Z_UINT32ENCODE_BE(p, ((uint64_t)(n)) & 0xffffffff)                      \
+}
+#define H5Z_UINT32DECODE_BE(p, n) {                                           \
+    (n) = ((uint32_t)(p)[0] << 24) | ((uint32_t)(p)[1] << 16) |               \
+          ((uint32_t)(p)[2] << 8) | (uint32_t)(p)[3];                         \
+    (p) += 4;                                                                 \
+}
+#define H5Z_UINT64DECODE_BE(p, n) {                                           \
+    uint32_t _hi, _lo;                                                        \
+                                                                              \
+    H5Z_UINT32DECODE_BE(p, _hi)                                               \
+    H5Z_UINT32DECODE_BE(p, _lo)                                               \
+    (n) = ((uint64_t)_hi << 32) | (uint64_t)_lo;                              \
+}
+
 /* Package internal routines */
 H5_DLL herr_t H5Z__unregister(H5Z_filter_t filter_id);
 
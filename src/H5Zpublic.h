@@ -41,6 +41,12 @@ typedef int H5Z_filter_t;
 #define H5Z_FILTER_SCALEOFFSET  6       /*scale+offset compression      */
 #define H5Z_FILTER_RESERVED     256	/*filter ids below this value are reserved for library use */
 
+/* Filters built into the library with the identifiers registered for the
+ * plugins they are compatible with */
+#define H5Z_FILTER_LZ4          32004   /*LZ4 compression               */
+#define H5Z_FILTER_BITSHUFFLE   32008   /*bit-level shuffle             */
+#define H5Z_FILTER_ZSTD         32015   /*Zstandard compression         */
+
 #define H5Z_FILTER_MAX		65535	/*maximum filter id		*/
 
 /* General macros */
@@ -77,6 +83,33 @@ typedef int H5Z_filter_t;
 #define H5Z_SHUFFLE_USER_NPARMS    0    /* Number of parameters that users can set */
 #define H5Z_SHUFFLE_TOTAL_NPARMS   1    /* Total number of parameters for filter */
 
+/* Macros for the bitshuffle filter */
+#define H5Z_BITSHUFFLE_USER_NPARMS      3       /* Number of parameters that users can set */
+#define H5Z_BITSHUFFLE_TOTAL_NPARMS     6       /* Total number of parameters for filter */
+#define H5Z_BITSHUFFLE_PARM_MAJOR       0       /* "Local" parameter for format major version */
+#define H5Z_BITSHUFFLE_PARM_MINOR       1       /* "Local" parameter for format minor version */
+#define H5Z_BITSHUFFLE_PARM_ELEM_SIZE   2       /* "Local" parameter for element size */
+#define H5Z_BITSHUFFLE_PARM_BLOCK_SIZE  3       /* "User" parameter for elements per block */
+#define H5Z_BITSHUFFLE_PARM_COMP        4       /* "User" parameter for compression */
+#define H5Z_BITSHUFFLE_PARM_LEVEL       5       /* "User" parameter for Zstandard level */
+#define H5Z_BITSHUFFLE_COMP_NONE        0       /* No compression after bitshuffle */
+#define H5Z_BITSHUFFLE_COMP_LZ4         2       /* LZ4 compression after bitshuffle */
+#define H5Z_BITSHUFFLE_COMP_ZSTD        3       /* Zstandard compression after bitshuffle */
+
+/* Macros for the LZ4 filter */
+#define H5Z_LZ4_PARM_BLOCK_SIZE         0       /* "User" parameter for block size */
+#define H5Z_LZ4_DEFAULT_BLOCK_SIZE      (1 << 30) /* Default block size */
+
+/* Macros for the Zstandard filter */
+#define H5Z_ZSTD_PARM_LEVEL             0       /* "User" parameter for compression level */
+#define H5Z_ZSTD_PARM_DICT_SIZE         1       /* "User" parameter for dictionary size */
+#define H5Z_ZSTD_PARM_DICT              2       /* First "user" parameter of dictionary */
+#define H5Z_ZSTD_DICT_NPARMS(s)         (H5Z_ZSTD_PARM_DICT + (((s) + 3) / 4)) /* Number of parameters with a dictionary of 's' bytes */
+#define H5Z_ZSTD_DEFAULT_LEVEL          3       /* Default compression level */
+#define H5Z_ZSTD_MIN_LEVEL              (-(1 << 17)) /* Fastest (negative) compression level */
+#define H5Z_ZSTD_MAX_LEVEL              22      /* Best compression level */
+#define H5Z_ZSTD_MAX_DICT_SIZE          (60 * 1024) /* Largest dictionary, which has to fit in the object header */
+
 /* Macros for the szip filter */
 #define H5Z_SZIP_USER_NPARMS    2       /* Number of parameters that users can set */
 #define H5Z_SZIP_TOTAL_NPARMS   4       /* Total number of parameters for filter */
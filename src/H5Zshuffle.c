@@ -95,6 +95,279 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5Z_set_local_shuffle() */
 
+
+/*
+ * SIMD kernels for the shuffle filter.
+ *
+ * Shuffling a block of elements whose size is a power of two is a byte
+ * transpose, which can be done with a few passes that split the even and
+ * odd bytes of each 16-bit word into separate vectors (or, to unshuffle,
+ * interleave them back together).  After log2(bytesoftype) passes vector 'u'
+ * holds byte number H5Z__shuffle_bitrev(u) of every element in the block.
+ * The kernels handle whole blocks of elements only, the scalar code in
+ * H5Z_filter_shuffle() finishes off the remaining elements, so the layout
+ * of the shuffled data is the same whichever code path is taken.
+ *
+ * The kernels are compiled for each instruction set with the "target"
+ * function attribute and the best one the CPU supports is chosen at run
+ * time, so the library doesn't have to be built for a particular CPU.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && \
+        (defined(__clang__) || __GNUC__ >= 6)
+#define H5Z_SHUFFLE_X86
+#include <immintrin.h>
+
+#define H5Z_SHUFFLE_TARGET(ISA)     __attribute__((target(#ISA)))
+#define H5Z_SHUFFLE_INLINE(ISA)     __attribute__((target(#ISA), always_inline)) inline
+
+/* Largest element size the SIMD kernels handle */
+#define H5Z_SHUFFLE_SIMD_MAX_SIZE   16
+
+/* Position of byte number 'u' (in shuffled order) within an element of
+ * 'bytesoftype' bytes
+ */
+static H5_ATTR_CONST inline unsigned
+H5Z__shuffle_bitrev(unsigned u, unsigned bytesoftype)
+{
+    unsigned b;
+    unsigned ret_value = 0;
+
+    for(b = 1; b < bytesoftype; b <<= 1) {
+        ret_value = (ret_value << 1) | (u & 1);
+        u >>= 1;
+    } /* end for */
+
+    return ret_value;
+} /* end H5Z__shuffle_bitrev() */
+
+/* SSE2: 16 elements per block */
+static H5Z_SHUFFLE_INLINE(sse2) __m128i
+H5Z__shuffle_even_sse2(__m128i a, __m128i b)
+{
+    const __m128i mask = _mm_set1_epi16(0x00FF);
+
+    return _mm_packus_epi16(_mm_and_si128(a, mask), _mm_and_si128(b, mask));
+}
+static H5Z_SHUFFLE_INLINE(sse2) __m128i
+H5Z__shuffle_odd_sse2(__m128i a, __m128i b)
+{
+    return _mm_packus_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+}
+static H5Z_SHUFFLE_INLINE(sse2) __m128i
+H5Z__shuffle_lo_sse2(__m128i a, __m128i b)
+{
+    return _mm_unpacklo_epi8(a, b);
+}
+static H5Z_SHUFFLE_INLINE(sse2) __m128i
+H5Z__shuffle_hi_sse2(__m128i a, __m128i b)
+{
+    return _mm_unpackhi_epi8(a, b);
+}
+#define H5Z_SHUFFLE_LOAD_sse2(P)        _mm_loadu_si128((const __m128i *)(P))
+#define H5Z_SHUFFLE_STORE_sse2(P, V)    _mm_storeu_si128((__m128i *)(P), V)
+
+/* AVX2: 32 elements per block.  The pack and unpack instructions work
+ * within each 128-bit lane, so the 64-bit quarters are permuted to put the
+ * bytes back in order.
+ */
+static H5Z_SHUFFLE_INLINE(avx2) __m256i
+H5Z__shuffle_even_avx2(__m256i a, __m256i b)
+{
+    const __m256i mask = _mm256_set1_epi16(0x00FF);
+
+    return _mm256_permute4x64_epi64(_mm256_packus_epi16(_mm256_and_si256(a, mask), _mm256_and_si256(b, mask)), 0xD8);
+}
+static H5Z_SHUFFLE_INLINE(avx2) __m256i
+H5Z__shuffle_odd_avx2(__m256i a, __m256i b)
+{
+    return _mm256_permute4x64_epi64(_mm256_packus_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8)), 0xD8);
+}
+static H5Z_SHUFFLE_INLINE(avx2) __m256i
+H5Z__shuffle_lo_avx2(__m256i a, __m256i b)
+{
+    return _mm256_unpacklo_epi8(_mm256_permute4x64_epi64(a, 0xD8), _mm256_permute4x64_epi64(b, 0xD8));
+}
+static H5Z_SHUFFLE_INLINE(avx2) __m256i
+H5Z__shuffle_hi_avx2(__m256i a, __m256i b)
+{
+    return _mm256_unpackhi_epi8(_mm256_permute4x64_epi64(a, 0xD8), _mm256_permute4x64_epi64(b, 0xD8));
+}
+#define H5Z_SHUFFLE_LOAD_avx2(P)        _mm256_loadu_si256((const __m256i *)(P))
+#define H5Z_SHUFFLE_STORE_avx2(P, V)    _mm256_storeu_si256((__m256i *)(P), V)
+
+/* AVX-512BW: 64 elements per block, with the same lane fix-ups as AVX2.
+ * (The zero-masked permute is used to keep GCC from warning about the
+ * undefined pass-through operand of the unmasked one.)
+ */
+static H5Z_SHUFFLE_INLINE(avx512bw) __m512i
+H5Z__shuffle_even_avx512bw(__m512i a, __m512i b)
+{
+    const __m512i mask = _mm512_set1_epi16(0x00FF);
+
+    return _mm512_maskz_permutexvar_epi64(0xFF, _mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7), _mm512_packus_epi16(_mm512_and_si512(a, mask), _mm512_and_si512(b, mask)));
+}
+static H5Z_SHUFFLE_INLINE(avx512bw) __m512i
+H5Z__shuffle_odd_avx512bw(__m512i a, __m512i b)
+{
+    return _mm512_maskz_permutexvar_epi64(0xFF, _mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7), _mm512_packus_epi16(_mm512_srli_epi16(a, 8), _mm512_srli_epi16(b, 8)));
+}
+static H5Z_SHUFFLE_INLINE(avx512bw) __m512i
+H5Z__shuffle_lo_avx512bw(__m512i a, __m512i b)
+{
+    const __m512i idx = _mm512_setr_epi64(0, 4, 1, 5, 2, 6, 3, 7);
+
+    return _mm512_unpacklo_epi8(_mm512_maskz_permutexvar_epi64(0xFF, idx, a), _mm512_maskz_permutexvar_epi64(0xFF, idx, b));
+}
+static H5Z_SHUFFLE_INLINE(avx512bw) __m512i
+H5Z__shuffle_hi_avx512bw(__m512i a, __m512i b)
+{
+    const __m512i idx = _mm512_setr_epi64(0, 4, 1, 5, 2, 6, 3, 7);
+
+    return _mm512_unpackhi_epi8(_mm512_maskz_permutexvar_epi64(0xFF, idx, a), _mm512_maskz_permutexvar_epi64(0xFF, idx, b));
+}
+#define H5Z_SHUFFLE_LOAD_avx512bw(P)        _mm512_loadu_si512((const void *)(P))
+#define H5Z_SHUFFLE_STORE_avx512bw(P, V)    _mm512_storeu_si512((void *)(P), V)
+
+/* Define the block kernels and the entry point for one instruction set.
+ * The block kernels are inlined into a switch on the element size, so the
+ * loops over the vectors are unrolled by the compiler.
+ */
+#define H5Z_SHUFFLE_SIMD_FUNCS(ISA, VEC, WIDTH)                               \
+static H5Z_SHUFFLE_INLINE(ISA) void                                           \
+H5Z__shuffle_blocks_##ISA(unsigned char *dest, const unsigned char *src,      \
+    unsigned bytesoftype, size_t numofelements, size_t nblocks)               \
+{                                                                             \
+    size_t b;                                                                 \
+                                                                              \
+    for(b = 0; b < nblocks; b++) {                                            \
+        const unsigned char *s = src + b * (WIDTH) * bytesoftype;             \
+        VEC r[H5Z_SHUFFLE_SIMD_MAX_SIZE], t[H5Z_SHUFFLE_SIMD_MAX_SIZE];       \
+        unsigned g, u, v;                                                     \
+                                                                              \
+        for(u = 0; u < bytesoftype; u++)                                      \
+            r[u] = H5Z_SHUFFLE_LOAD_##ISA(s + u * (WIDTH));                   \
+        for(g = bytesoftype; g > 1; g /= 2) {                                 \
+            for(u = 0; u < bytesoftype; u += g)                               \
+                for(v = 0; v < g / 2; v++) {                                  \
+                    t[u + v] = H5Z__shuffle_even_##ISA(r[u + 2 * v], r[u + 2 * v + 1]); \
+                    t[u + g / 2 + v] = H5Z__shuffle_odd_##ISA(r[u + 2 * v], r[u + 2 * v + 1]); \
+                } /* end for */                                               \
+            for(u = 0; u < bytesoftype; u++)                                  \
+                r[u] = t[u];                                                  \
+        } /* end for */                                               \
+        for(u = 0; u < bytesoftype; u++)                                      \
+            H5Z_SHUFFLE_STORE_##ISA(dest + H5Z__shuffle_bitrev(u, bytesoftype) * numofelements + b * (WIDTH), r[u]); \
+    } /* end for */                                                           \
+}                                                                             \
+                                                                              \
+static H5Z_SHUFFLE_INLINE(ISA) void                                           \
+H5Z__unshuffle_blocks_##ISA(unsigned char *dest, const unsigned char *src,    \
+    unsigned bytesoftype, size_t numofelements, size_t nblocks)               \
+{                                                                             \
+    size_t b;                                                                 \
+                                                                              \
+    for(b = 0; b < nblocks; b++) {                                            \
+        unsigned char *d = dest + b * (WIDTH) * bytesoftype;                  \
+        VEC r[H5Z_SHUFFLE_SIMD_MAX_SIZE], t[H5Z_SHUFFLE_SIMD_MAX_SIZE];       \
+        unsigned g, u, v;                                                     \
+                                                                              \
+        for(u = 0; u < bytesoftype; u++)                                      \
+            r[u] = H5Z_SHUFFLE_LOAD_##ISA(src + H5Z__shuffle_bitrev(u, bytesoftype) * numofelements + b * (WIDTH)); \
+        for(g = 2; g <= bytesoftype; g *= 2) {                                \
+            for(u = 0; u < bytesoftype; u += g)                               \
+                for(v = 0; v < g / 2; v++) {                                  \
+                    t[u + 2 * v] = H5Z__shuffle_lo_##ISA(r[u + v], r[u + g / 2 + v]); \
+                    t[u + 2 * v + 1] = H5Z__shuffle_hi_##ISA(r[u + v], r[u + g / 2 + v]); \
+                } /* end for */                                               \
+            for(u = 0; u < bytesoftype; u++)                                  \
+                r[u] = t[u];                                                  \
+        } /* end for */                                                       \
+        for(u = 0; u < bytesoftype; u++)                                      \
+            H5Z_SHUFFLE_STORE_##ISA(d + u * (WIDTH), r[u]);                   \
+    } /* end for */                                                           \
+}                                                                             \
+                                                                              \
+static H5Z_SHUFFLE_TARGET(ISA) size_t                                         \
+H5Z__shuffle_##ISA(unsigned char *dest, const unsigned char *src,             \
+    unsigned bytesoftype, size_t numofelements, hbool_t reverse)              \
+{                                                                             \
+    size_t nblocks = numofelements / (WIDTH);                                 \
+                                                                              \
+    switch(bytesoftype) {                                                     \
+        case 2:                                                               \
+            if(reverse)                                                       \
+                H5Z__unshuffle_blocks_##ISA(dest, src, 2, numofelements, nblocks); \
+            else                                                              \
+                H5Z__shuffle_blocks_##ISA(dest, src, 2, numofelements, nblocks); \
+            break;                                                            \
+        case 4:                                                               \
+            if(reverse)                                                       \
+                H5Z__unshuffle_blocks_##ISA(dest, src, 4, numofelements, nblocks); \
+            else                                                              \
+                H5Z__shuffle_blocks_##ISA(dest, src, 4, numofelements, nblocks); \
+            break;                                                            \
+        case 8:                                                               \
+            if(reverse)                                                       \
+                H5Z__unshuffle_blocks_##ISA(dest, src, 8, numofelements, nblocks); \
+            else                                                              \
+                H5Z__shuffle_blocks_##ISA(dest, src, 8, numofelements, nblocks); \
+            break;                                                            \
+        case 16:                                                              \
+            if(reverse)                                                       \
+                H5Z__unshuffle_blocks_##ISA(dest, src, 16, numofelements, nblocks); \
+            else                                                              \
+                H5Z__shuffle_blocks_##ISA(dest, src, 16, numofelements, nblocks); \
+            break;                                                            \
+        default:                                                              \
+            return 0;                                                         \
+    } /* end switch */                                                        \
+                                                                              \
+    return nblocks * (WIDTH);                                                 \
+}
+
+H5Z_SHUFFLE_SIMD_FUNCS(sse2, __m128i, 16)
+H5Z_SHUFFLE_SIMD_FUNCS(avx2, __m256i, 32)
+H5Z_SHUFFLE_SIMD_FUNCS(avx512bw, __m512i, 64)
+#endif /* H5Z_SHUFFLE_X86 */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__shuffle_simd
+ *
+ * Purpose:	[Un]shuffle as many leading elements of a buffer as possible
+ *              with the widest SIMD kernel the CPU supports.
+ *
+ * Return:	Number of elements [un]shuffled, which may be zero if there
+ *              is no kernel for the element size or the CPU.
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__shuffle_simd(unsigned char *dest, const unsigned char *src,
+    unsigned bytesoftype, size_t numofelements, hbool_t reverse)
+{
+    size_t ret_value = 0;       /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef H5Z_SHUFFLE_X86
+    if(bytesoftype <= H5Z_SHUFFLE_SIMD_MAX_SIZE && 0 == (bytesoftype & (bytesoftype - 1))) {
+        __builtin_cpu_init();
+
+        if(__builtin_cpu_supports("avx512bw"))
+            ret_value = H5Z__shuffle_avx512bw(dest, src, bytesoftype, numofelements, reverse);
+        else if(__builtin_cpu_supports("avx2"))
+            ret_value = H5Z__shuffle_avx2(dest, src, bytesoftype, numofelements, reverse);
+        else if(__builtin_cpu_supports("sse2"))
+            ret_value = H5Z__shuffle_sse2(dest, src, bytesoftype, numofelements, reverse);
+    } /* end if */
+#else /* H5Z_SHUFFLE_X86 */
+    (void)dest; (void)src; (void)bytesoftype; (void)numofelements; (void)reverse;
+#endif /* H5Z_SHUFFLE_X86 */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__shuffle_simd() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Z_filter_shuffle
@@ -105,6 +378,8 @@ done:
  *              as: 012301230123, shuffling will store them as: 000111222333
  *              Usually, the bytes in each byte position are more related to
  *              each other and putting them together will increase compression.
+ *              Whole blocks of elements are [un]shuffled with SIMD
+ *              instructions when possible, see H5Z__shuffle_simd().
  *
  * Return:	Success: Size of buffer filtered
  *		Failure: 0
@@ -127,6 +402,8 @@ H5Z_filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
     unsigned char *_dest=NULL;  /* Alias for destination buffer */
     unsigned bytesoftype;       /* Number of bytes per element */
     size_t numofelements;       /* Number of elements in buffer */
+    size_t nsimd;               /* Number of elements [un]shuffled by SIMD kernels */
+    size_t nscalar;             /* Number of elements left to [un]shuffle */
     size_t i;                   /* Local index variables */
 #ifdef NO_DUFFS_DEVICE
     size_t j;                   /* Local index variable */
@@ -155,18 +432,21 @@ H5Z_filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
         if (NULL==(dest = H5MM_malloc(nbytes)))
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for shuffle buffer")
 
-        if(flags & H5Z_FLAG_REVERSE) {
-            /* Get the pointer to the source buffer */
-            _src =(unsigned char *)(*buf);
+        /* [Un]shuffle whole blocks of elements with SIMD instructions, if
+         * possible, and the rest of the elements below */
+        nsimd = H5Z__shuffle_simd((unsigned char *)dest, (const unsigned char *)(*buf), bytesoftype, numofelements, (hbool_t)((flags & H5Z_FLAG_REVERSE) != 0));
+        nscalar = numofelements - nsimd;
 
+        if(flags & H5Z_FLAG_REVERSE) {
             /* Input; unshuffle */
-            for(i=0; i<bytesoftype; i++) {
-                _dest=((unsigned char *)dest)+i;
+            for(i=0; i<bytesoftype && nscalar>0; i++) {
+                _src=((unsigned char *)(*buf))+(i*numofelements)+nsimd;
+                _dest=((unsigned char *)dest)+(nsimd*bytesoftype)+i;
 #define DUFF_GUTS							    \
     *_dest=*_src++;                             \
     _dest+=bytesoftype;
 #ifdef NO_DUFFS_DEVICE
-                j = numofelements;
+                j = nscalar;
                 while(j > 0) {
                     DUFF_GUTS;
 
@@ -176,8 +456,8 @@ H5Z_filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
             {
                 size_t duffs_index; /* Counting index for Duff's device */
 
-                duffs_index = (numofelements + 7) / 8;
-                switch (numofelements % 8) {
+                duffs_index = (nscalar + 7) / 8;
+                switch (nscalar % 8) {
                     default:
                         HDassert(0 && "This Should never be executed!");
                         break;
@@ -213,25 +493,17 @@ H5Z_filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
 #undef DUFF_GUTS
             } /* end for */
 
-            /* Add leftover to the end of data */
-            if(leftover>0) {
-                /* Adjust back to end of shuffled bytes */
-                _dest -= (bytesoftype - 1);     /*lint !e794 _dest is initialized */
-                H5MM_memcpy((void*)_dest, (void*)_src, leftover);
-            }
         } /* end if */
         else {
-            /* Get the pointer to the destination buffer */
-            _dest =(unsigned char *)dest;
-
             /* Output; shuffle */
-            for(i=0; i<bytesoftype; i++) {
-                _src=((unsigned char *)(*buf))+i;
+            for(i=0; i<bytesoftype && nscalar>0; i++) {
+                _dest=((unsigned char *)dest)+(i*numofelements)+nsimd;
+                _src=((unsigned char *)(*buf))+(nsimd*bytesoftype)+i;
 #define DUFF_GUTS							    \
     *_dest++=*_src;                             \
     _src+=bytesoftype;
 #ifdef NO_DUFFS_DEVICE
-                j = numofelements;
+                j = nscalar;
                 while(j > 0) {
                     DUFF_GUTS;
 
@@ -241,8 +513,8 @@ H5Z_filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
             {
                 size_t duffs_index; /* Counting index for Duff's device */
 
-                duffs_index = (numofelements + 7) / 8;
-                switch (numofelements % 8) {
+                duffs_index = (nscalar + 7) / 8;
+                switch (nscalar % 8) {
                     default:
                         HDassert(0 && "This Should never be executed!");
                         break;
@@ -278,14 +550,12 @@ H5Z_filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
 #undef DUFF_GUTS
             } /* end for */
 
-            /* Add leftover to the end of data */
-            if(leftover>0) {
-                /* Adjust back to end of shuffled bytes */
-                _src -= (bytesoftype - 1);      /*lint !e794 _src is initialized */
-                H5MM_memcpy((void*)_dest, (void*)_src, leftover);
-            }
         } /* end else */
 
+        /* Add leftover to the end of data */
+        if(leftover>0)
+            H5MM_memcpy(((unsigned char *)dest)+(numofelements*bytesoftype), ((unsigned char *)(*buf))+(numofelements*bytesoftype), leftover);
+
         /* Free the input buffer */
         H5MM_xfree(*buf);
 
@@ -58,17 +58,29 @@ typedef struct H5Z_node {
     H5Z_num_val         value;
 } H5Z_node;
 
+/* How an operation of a compiled transform gets its operands */
+typedef enum {
+    H5Z_XFORM_ARGS_XX,  /* Both operands are data: the top block of the stack is combined into the one below it */
+    H5Z_XFORM_ARGS_XC,  /* The top block of the stack is the left operand, the constant the right one */
+    H5Z_XFORM_ARGS_CX   /* The constant is the left operand, the top block of the stack the right one */
+} H5Z_xform_args_t;
+
+/* An operation of a compiled transform */
+typedef struct {
+    H5Z_token_type      type;   /* H5Z_XFORM_SYMBOL pushes a block of data on the stack, H5Z_XFORM_PLUS, etc. do arithmetic */
+    H5Z_xform_args_t    args;   /* The operands of arithmetic */
+    double              value;  /* The constant operand */
+} H5Z_xform_op_t;
+
 struct H5Z_data_xform_t {
     char*       xform_exp;
     H5Z_node*       parse_root;
     H5Z_datval_ptrs*	dat_val_pointers;
+    H5Z_xform_op_t     *prog;           /* Parse tree compiled to postfix operations (NULL if the tree is a number) */
+    size_t              nops;           /* # of operations in prog */
+    size_t              depth;          /* Max. # of blocks on the stack while evaluating prog */
 };
 
-typedef struct result {
-    H5Z_token_type type;
-    H5Z_num_val    value;
-} H5Z_result;
-
 
 /* The token */
 typedef struct {
@@ -95,7 +107,8 @@ static void H5Z_do_op(H5Z_node* tree);
 static hbool_t H5Z_op_is_numbs(H5Z_node* _tree);
 static hbool_t H5Z_op_is_numbs2(H5Z_node* _tree);
 static hid_t H5Z_xform_find_type(const H5T_t* type);
-static herr_t H5Z_xform_eval_full(H5Z_node *tree, const size_t array_size, const hid_t array_type, H5Z_result* res);
+static herr_t H5Z_xform_compile(H5Z_data_xform_t *data_xform_prop);
+static herr_t H5Z_xform_compile_tree(const H5Z_node *tree, H5Z_data_xform_t *data_xform_prop, size_t *sp);
 static void H5Z_xform_destroy_parse_tree(H5Z_node *tree);
 static void* H5Z_xform_parse(const char *expression, H5Z_datval_ptrs* dat_val_pointers);
 static void* H5Z_xform_copy_tree(H5Z_node* tree, H5Z_datval_ptrs* dat_val_pointers, H5Z_datval_ptrs* new_dat_val_pointers);
@@ -105,181 +118,6 @@ static void H5Z_XFORM_DEBUG(H5Z_node *tree);
 static void H5Z_print(H5Z_node *tree, FILE *stream);
 #endif  /* H5Z_XFORM_DEBUG */
 
-/* PGCC (11.8-0) has trouble with the command *p++ = *p OP tree_val. It increments P first before 
- * doing the operation.  So I break down the command into two lines:
- *     *p = *p OP tree_val; p++;
- * Actually, the behavior of *p++ = *p OP tree_val is undefined. (SLU - 2012/3/19) 
- */
-#define H5Z_XFORM_DO_OP1(RESL,RESR,TYPE,OP,SIZE)                            \
-{   								  	    \
-    size_t u;                                                               \
-                                                                            \
-    if(((RESL).type == H5Z_XFORM_SYMBOL) && ((RESR).type != H5Z_XFORM_SYMBOL)) \
-    {   								    \
-	TYPE* p;                                                            \
-	double tree_val;                                                    \
-		                                                            \
-	tree_val = ((RESR).type==H5Z_XFORM_INTEGER ? (double)(RESR).value.int_val : (RESR).value.float_val); \
-	p = (TYPE*)(RESL).value.dat_val;                                    \
-                                                                            \
-	for(u = 0; u < (SIZE); u++) {                                       \
-	    *p = (TYPE)((double)*p OP tree_val);                            \
-            p++;                                                            \
-        }                                                                   \
-    }									    \
-    else if(((RESR).type == H5Z_XFORM_SYMBOL) && ((RESL).type != H5Z_XFORM_SYMBOL)) \
-    {   								    \
-	TYPE* p;                                                            \
-	double tree_val;                                                    \
-		                                                            \
-        /* The case that the left operand is nothing, like -x or +x */      \
-	if((RESL).type == H5Z_XFORM_ERROR)                                  \
-            tree_val = 0;                                                   \
-	else                                                                \
-	    tree_val = ((RESL).type==H5Z_XFORM_INTEGER ? (double)(RESL).value.int_val : (RESL).value.float_val); \
-                                                                            \
-	p = (TYPE*)(RESR).value.dat_val;                                    \
-	for(u = 0; u < (SIZE); u++) {                                       \
-	    *p = (TYPE)(tree_val OP (double)*p);                            \
-            p++;                                                            \
-        }                                                                   \
-    }									    \
-    else if( ((RESL).type == H5Z_XFORM_SYMBOL) && ((RESR).type == H5Z_XFORM_SYMBOL))  \
-    {									    \
-	TYPE* pl = (TYPE*)(RESL).value.dat_val;                             \
-	TYPE* pr = (TYPE*)(RESR).value.dat_val;                             \
-									    \
-	for(u = 0; u < (SIZE); u++) {                                       \
-	    *pl = (TYPE)(*pl OP *pr);                                       \
-            pl++; pr++;                                                     \
-        }                                                                   \
-    }									    \
-    else								    \
-        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Unexpected type conversion operation")	\
-}
-
-#if H5_SIZEOF_LONG_DOUBLE != 0
-#if CHAR_MIN >= 0
-#define H5Z_XFORM_TYPE_OP(RESL,RESR,TYPE,OP,SIZE)			\
-{									\
-    if((TYPE) == H5T_NATIVE_CHAR)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), char, OP, (SIZE))		\
-    else if((TYPE) == H5T_NATIVE_SCHAR)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), signed char, OP, (SIZE))	\
-    else if((TYPE) == H5T_NATIVE_SHORT)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), short, OP, (SIZE))		\
-    else if((TYPE) == H5T_NATIVE_USHORT)				\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned short, OP, (SIZE))	\
-    else if((TYPE) == H5T_NATIVE_INT)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), int, OP, (SIZE))		\
-    else if((TYPE) == H5T_NATIVE_UINT)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned int, OP, (SIZE))	\
-    else if((TYPE) == H5T_NATIVE_LONG)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), long, OP, (SIZE))		\
-    else if((TYPE) == H5T_NATIVE_ULONG)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long, OP, (SIZE))	\
-    else if((TYPE) == H5T_NATIVE_LLONG)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), long long, OP, (SIZE))	        \
-    else if((TYPE) == H5T_NATIVE_ULLONG)				\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long long, OP, (SIZE)) \
-    else if((TYPE) == H5T_NATIVE_FLOAT)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), float, OP, (SIZE))		\
-    else if((TYPE) == H5T_NATIVE_DOUBLE)				\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), double, OP, (SIZE))		\
-    else if((TYPE) == H5T_NATIVE_LDOUBLE)				\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), long double, OP, (SIZE))	\
-}
-#else /* CHAR_MIN >= 0 */
-#define H5Z_XFORM_TYPE_OP(RESL,RESR,TYPE,OP,SIZE)			\
-{									\
-    if((TYPE) == H5T_NATIVE_CHAR)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), char, OP, (SIZE))		\
-    else if((TYPE) == H5T_NATIVE_UCHAR)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned char, OP, (SIZE))	\
-    else if((TYPE) == H5T_NATIVE_SHORT)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), short, OP, (SIZE))		\
-    else if((TYPE) == H5T_NATIVE_USHORT)				\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned short, OP, (SIZE))	\
-    else if((TYPE) == H5T_NATIVE_INT)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), int, OP, (SIZE))		\
-    else if((TYPE) == H5T_NATIVE_UINT)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned int, OP, (SIZE))	\
-    else if((TYPE) == H5T_NATIVE_LONG)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), long, OP, (SIZE))		\
-    else if((TYPE) == H5T_NATIVE_ULONG)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long, OP, (SIZE))	\
-    else if((TYPE) == H5T_NATIVE_LLONG)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), long long, OP, (SIZE))	        \
-    else if((TYPE) == H5T_NATIVE_ULLONG)				\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long long, OP, (SIZE)) \
-    else if((TYPE) == H5T_NATIVE_FLOAT)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), float, OP, (SIZE))		\
-    else if((TYPE) == H5T_NATIVE_DOUBLE)				\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), double, OP, (SIZE))		\
-    else if((TYPE) == H5T_NATIVE_LDOUBLE)				\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), long double, OP, (SIZE))	\
-}
-#endif /* CHAR_MIN >= 0 */
-#else
-#if CHAR_MIN >= 0
-#define H5Z_XFORM_TYPE_OP(RESL,RESR,TYPE,OP,SIZE)			\
-{									\
-    if((TYPE) == H5T_NATIVE_CHAR)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), char, OP, (SIZE))		\
-    else if((TYPE) == H5T_NATIVE_SCHAR)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), signed char, OP, (SIZE))	\
-    else if((TYPE) == H5T_NATIVE_SHORT)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), short, OP, (SIZE))		\
-    else if((TYPE) == H5T_NATIVE_USHORT)				\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned short, OP, (SIZE))	\
-    else if((TYPE) == H5T_NATIVE_INT)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), int, OP, (SIZE))		\
-    else if((TYPE) == H5T_NATIVE_UINT)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned int, OP, (SIZE))	\
-    else if((TYPE) == H5T_NATIVE_LONG)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), long, OP, (SIZE))		\
-    else if((TYPE) == H5T_NATIVE_ULONG)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long, OP, (SIZE))	\
-    else if((TYPE) == H5T_NATIVE_LLONG)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), long long, OP, (SIZE))	\
-    else if((TYPE) == H5T_NATIVE_ULLONG)				\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long long, OP, (SIZE)) \
-    else if((TYPE) == H5T_NATIVE_FLOAT)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), float, OP, (SIZE))		\
-    else if((TYPE) == H5T_NATIVE_DOUBLE)				\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), double, OP, (SIZE))		\
-}
-#else /* CHAR_MIN >= 0 */
-#define H5Z_XFORM_TYPE_OP(RESL,RESR,TYPE,OP,SIZE)			\
-{									\
-    if((TYPE) == H5T_NATIVE_CHAR)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), char, OP, (SIZE))		\
-    else if((TYPE) == H5T_NATIVE_UCHAR)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned char, OP, (SIZE))	\
-    else if((TYPE) == H5T_NATIVE_SHORT)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), short, OP, (SIZE))		\
-    else if((TYPE) == H5T_NATIVE_USHORT)				\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned short, OP, (SIZE))	\
-    else if((TYPE) == H5T_NATIVE_INT)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), int, OP, (SIZE))		\
-    else if((TYPE) == H5T_NATIVE_UINT)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned int, OP, (SIZE))	\
-    else if((TYPE) == H5T_NATIVE_LONG)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), long, OP, (SIZE))		\
-    else if((TYPE) == H5T_NATIVE_ULONG)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long, OP, (SIZE))	\
-    else if((TYPE) == H5T_NATIVE_LLONG)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), long long, OP, (SIZE))	\
-    else if((TYPE) == H5T_NATIVE_ULLONG)				\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long long, OP, (SIZE)) \
-    else if((TYPE) == H5T_NATIVE_FLOAT)					\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), float, OP, (SIZE))		\
-    else if((TYPE) == H5T_NATIVE_DOUBLE)				\
-	H5Z_XFORM_DO_OP1((RESL), (RESR), double, OP, (SIZE))		\
-}
-#endif /* CHAR_MIN >= 0 */
-#endif /*H5_SIZEOF_LONG_DOUBLE */
-
 #define H5Z_XFORM_DO_OP3(OP)                                                                                                                    \
 {                                                                                                                                               \
         if((tree->lchild->type == H5Z_XFORM_INTEGER) && (tree->rchild->type==H5Z_XFORM_INTEGER))                                                \
@@ -993,12 +831,232 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+
+/* Vectorized kernels for the arithmetic on float and double data, which are
+ * defined below. */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && \
+        (defined(__clang__) || __GNUC__ >= 6)
+#define H5Z_XFORM_X86
+#include <immintrin.h>
+
+#define H5Z_XFORM_TARGET(ISA)   __attribute__((target(ISA)))
+#define H5Z_XFORM_VEC_FLOAT     H5Z_xform_vec_float
+#define H5Z_XFORM_VEC_DOUBLE    H5Z_xform_vec_double
+#else /* H5Z_XFORM_X86 */
+#define H5Z_XFORM_VEC_FLOAT     H5Z_XFORM_NO_VEC
+#define H5Z_XFORM_VEC_DOUBLE    H5Z_XFORM_NO_VEC
+#endif /* H5Z_XFORM_X86 */
+
+/* The other types are only done with the scalar loops */
+#define H5Z_XFORM_NO_VEC(TYPE, ARGS, L, R, C, N)   0
+
+/* # of elements of each block that compiled transforms are evaluated on */
+#define H5Z_XFORM_BLOCK_SIZE    256
+
+/* Get block I of the stack, the first block being the data itself */
+#define H5Z_XFORM_STACK(DATA, SCRATCH, I)                                     \
+    ((I) == 0 ? (DATA) : (SCRATCH) + ((I) - 1) * H5Z_XFORM_BLOCK_SIZE)
+
+/* Do arithmetic operation OP on the N elements of block L, with the
+ * operands given by ARGS.  Arithmetic with a constant is done in double and
+ * arithmetic between two blocks of data in TYPE, and each result is cast
+ * back to TYPE. */
+#define H5Z_XFORM_DO_BLOCK_OP(TYPE, VEC, OP, TOKEN, ARGS, L, R, C, N)        \
+{                                                                             \
+    size_t _u = VEC((TOKEN), (ARGS), (L), (R), (C), (N));                     \
+                                                                              \
+    if((ARGS) == H5Z_XFORM_ARGS_XC)                                           \
+        for(; _u < (N); _u++)                                                 \
+            (L)[_u] = (TYPE)((double)(L)[_u] OP (C));                         \
+    else if((ARGS) == H5Z_XFORM_ARGS_CX)                                      \
+        for(; _u < (N); _u++)                                                 \
+            (L)[_u] = (TYPE)((C) OP (double)(L)[_u]);                         \
+    else                                                                      \
+        for(; _u < (N); _u++)                                                 \
+            (L)[_u] = (TYPE)((L)[_u] OP (R)[_u]);                             \
+}
+
+/* Define a function evaluating a compiled transform on an array of TYPE,
+ * one block at a time.  The first block on the stack is the block of the
+ * array itself, so linear transforms are done in place.  SCRATCH holds
+ * the rest of the stack and a copy of the block for the later "x"s of
+ * polynomial transforms to push, and is NULL for linear transforms. */
+#define H5Z_XFORM_EVAL_FUNC(NAME, TYPE, VEC)                                  \
+static void                                                                   \
+H5Z_xform_eval_##NAME(const H5Z_data_xform_t *data_xform_prop, void *_array,  \
+    size_t array_size, void *_scratch)                                        \
+{                                                                             \
+    TYPE *array = (TYPE *)_array;                                             \
+    TYPE *scratch = (TYPE *)_scratch;                                         \
+    TYPE *orig = NULL;                                                        \
+    size_t start, n;                                                          \
+                                                                              \
+    if(scratch)                                                               \
+        orig = scratch + (data_xform_prop->depth - 1) * H5Z_XFORM_BLOCK_SIZE; \
+                                                                              \
+    for(start = 0; start < array_size; start += n) {                          \
+        TYPE *block = array + start;                                          \
+        size_t sp = 0;                                                        \
+        size_t u;                                                             \
+                                                                              \
+        n = MIN(H5Z_XFORM_BLOCK_SIZE, array_size - start);                    \
+        if(orig)                                                              \
+            H5MM_memcpy(orig, block, n * sizeof(TYPE));                       \
+                                                                              \
+        for(u = 0; u < data_xform_prop->nops; u++) {                          \
+            const H5Z_xform_op_t *op = &data_xform_prop->prog[u];             \
+            TYPE *l, *r = NULL;                                               \
+                                                                              \
+            if(op->type == H5Z_XFORM_SYMBOL) {                                \
+                if(sp > 0)                                                    \
+                    H5MM_memcpy(H5Z_XFORM_STACK(block, scratch, sp), orig, n * sizeof(TYPE)); \
+                sp++;                                                         \
+                continue;                                                     \
+            } /* end if */                                                    \
+                                                                              \
+            if(op->args == H5Z_XFORM_ARGS_XX) {                               \
+                sp--;                                                         \
+                r = H5Z_XFORM_STACK(block, scratch, sp);                      \
+            } /* end if */                                                    \
+            l = H5Z_XFORM_STACK(block, scratch, sp - 1);                      \
+                                                                              \
+            if(op->type == H5Z_XFORM_PLUS)                                    \
+                H5Z_XFORM_DO_BLOCK_OP(TYPE, VEC, +, op->type, op->args, l, r, op->value, n) \
+            else if(op->type == H5Z_XFORM_MINUS)                              \
+                H5Z_XFORM_DO_BLOCK_OP(TYPE, VEC, -, op->type, op->args, l, r, op->value, n) \
+            else if(op->type == H5Z_XFORM_MULT)                               \
+                H5Z_XFORM_DO_BLOCK_OP(TYPE, VEC, *, op->type, op->args, l, r, op->value, n) \
+            else                                                              \
+                H5Z_XFORM_DO_BLOCK_OP(TYPE, VEC, /, op->type, op->args, l, r, op->value, n) \
+        } /* end for */                                                       \
+        HDassert(sp == 1);                                                    \
+    } /* end for */                                                           \
+}
+
+#ifdef H5Z_XFORM_X86
+/*
+ * Vectorized arithmetic for float and double data, compiled for AVX2 with
+ * the "target" function attribute like the conversion and shuffle kernels
+ * and only used if the CPU supports it at run time.  Each kernel does as
+ * many whole vectors of elements as it can and returns the number of
+ * elements it did; the scalar loops do the rest.  The kernels give exactly
+ * the same values as the scalar loops: float data is widened to double for
+ * arithmetic with a constant, and float arithmetic is used between two
+ * blocks of float data.
+ */
+
+/* Do the arithmetic in FUNC on the double data in L and R */
+#define H5Z_XFORM_VEC_PD(FUNC)                                                \
+{                                                                             \
+    if(args == H5Z_XFORM_ARGS_XC)                                             \
+        for(u = 0; u + 4 <= n; u += 4)                                        \
+            _mm256_storeu_pd(l + u, FUNC(_mm256_loadu_pd(l + u), vc));        \
+    else if(args == H5Z_XFORM_ARGS_CX)                                        \
+        for(u = 0; u + 4 <= n; u += 4)                                        \
+            _mm256_storeu_pd(l + u, FUNC(vc, _mm256_loadu_pd(l + u)));        \
+    else                                                                      \
+        for(u = 0; u + 4 <= n; u += 4)                                        \
+            _mm256_storeu_pd(l + u, FUNC(_mm256_loadu_pd(l + u), _mm256_loadu_pd(r + u))); \
+}
+
+/* Do the arithmetic in FUNC_PD or FUNC_PS on the float data in L and R */
+#define H5Z_XFORM_VEC_PS(FUNC_PD, FUNC_PS)                                    \
+{                                                                             \
+    if(args == H5Z_XFORM_ARGS_XC)                                             \
+        for(u = 0; u + 4 <= n; u += 4)                                        \
+            _mm_storeu_ps(l + u, _mm256_cvtpd_ps(FUNC_PD(_mm256_cvtps_pd(_mm_loadu_ps(l + u)), vc))); \
+    else if(args == H5Z_XFORM_ARGS_CX)                                        \
+        for(u = 0; u + 4 <= n; u += 4)                                        \
+            _mm_storeu_ps(l + u, _mm256_cvtpd_ps(FUNC_PD(vc, _mm256_cvtps_pd(_mm_loadu_ps(l + u))))); \
+    else                                                                      \
+        for(u = 0; u + 8 <= n; u += 8)                                        \
+            _mm256_storeu_ps(l + u, FUNC_PS(_mm256_loadu_ps(l + u), _mm256_loadu_ps(r + u))); \
+}
+
+static H5Z_XFORM_TARGET("avx2") size_t
+H5Z_xform_vec_double_avx2(H5Z_token_type type, H5Z_xform_args_t args,
+    double *l, const double *r, double c, size_t n)
+{
+    __m256d vc = _mm256_set1_pd(c);
+    size_t u;
+
+    if(type == H5Z_XFORM_PLUS)
+        H5Z_XFORM_VEC_PD(_mm256_add_pd)
+    else if(type == H5Z_XFORM_MINUS)
+        H5Z_XFORM_VEC_PD(_mm256_sub_pd)
+    else if(type == H5Z_XFORM_MULT)
+        H5Z_XFORM_VEC_PD(_mm256_mul_pd)
+    else
+        H5Z_XFORM_VEC_PD(_mm256_div_pd)
+
+    return u;
+}
+
+static H5Z_XFORM_TARGET("avx2") size_t
+H5Z_xform_vec_float_avx2(H5Z_token_type type, H5Z_xform_args_t args,
+    float *l, const float *r, double c, size_t n)
+{
+    __m256d vc = _mm256_set1_pd(c);
+    size_t u;
+
+    if(type == H5Z_XFORM_PLUS)
+        H5Z_XFORM_VEC_PS(_mm256_add_pd, _mm256_add_ps)
+    else if(type == H5Z_XFORM_MINUS)
+        H5Z_XFORM_VEC_PS(_mm256_sub_pd, _mm256_sub_ps)
+    else if(type == H5Z_XFORM_MULT)
+        H5Z_XFORM_VEC_PS(_mm256_mul_pd, _mm256_mul_ps)
+    else
+        H5Z_XFORM_VEC_PS(_mm256_div_pd, _mm256_div_ps)
+
+    return u;
+}
+
+static size_t
+H5Z_xform_vec_double(H5Z_token_type type, H5Z_xform_args_t args,
+    double *l, const double *r, double c, size_t n)
+{
+    __builtin_cpu_init();
+    if(!__builtin_cpu_supports("avx2"))
+        return 0;
+
+    return H5Z_xform_vec_double_avx2(type, args, l, r, c, n);
+}
+
+static size_t
+H5Z_xform_vec_float(H5Z_token_type type, H5Z_xform_args_t args,
+    float *l, const float *r, double c, size_t n)
+{
+    __builtin_cpu_init();
+    if(!__builtin_cpu_supports("avx2"))
+        return 0;
+
+    return H5Z_xform_vec_float_avx2(type, args, l, r, c, n);
+}
+#endif /* H5Z_XFORM_X86 */
+
+H5Z_XFORM_EVAL_FUNC(char, char, H5Z_XFORM_NO_VEC)
+H5Z_XFORM_EVAL_FUNC(schar, signed char, H5Z_XFORM_NO_VEC)
+H5Z_XFORM_EVAL_FUNC(uchar, unsigned char, H5Z_XFORM_NO_VEC)
+H5Z_XFORM_EVAL_FUNC(short, short, H5Z_XFORM_NO_VEC)
+H5Z_XFORM_EVAL_FUNC(ushort, unsigned short, H5Z_XFORM_NO_VEC)
+H5Z_XFORM_EVAL_FUNC(int, int, H5Z_XFORM_NO_VEC)
+H5Z_XFORM_EVAL_FUNC(uint, unsigned int, H5Z_XFORM_NO_VEC)
+H5Z_XFORM_EVAL_FUNC(long, long, H5Z_XFORM_NO_VEC)
+H5Z_XFORM_EVAL_FUNC(ulong, unsigned long, H5Z_XFORM_NO_VEC)
+H5Z_XFORM_EVAL_FUNC(llong, long long, H5Z_XFORM_NO_VEC)
+H5Z_XFORM_EVAL_FUNC(ullong, unsigned long long, H5Z_XFORM_NO_VEC)
+H5Z_XFORM_EVAL_FUNC(float, float, H5Z_XFORM_VEC_FLOAT)
+H5Z_XFORM_EVAL_FUNC(double, double, H5Z_XFORM_VEC_DOUBLE)
+#if H5_SIZEOF_LONG_DOUBLE !=0
+H5Z_XFORM_EVAL_FUNC(ldouble, long double, H5Z_XFORM_NO_VEC)
+#endif
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Z_xform_eval
  * Purpose: 	If the transform is trivial, this function applies it.
- * 		Otherwise, it calls H5Z_xform_eval_full to do the full
- * 		transform.
+ * 		Otherwise, it evaluates the compiled transform on the
+ * 		array, one block of elements at a time.
  * Return:      SUCCEED if transform applied successfully, FAIL otherwise
  * Programmer:  Leon Arber
  * 		5/1/04
@@ -1011,8 +1069,7 @@ H5Z_xform_eval(H5Z_data_xform_t *data_xform_prop, void* array, size_t array_size
 {
     H5Z_node *tree;
     hid_t array_type;
-    H5Z_result res;
-    size_t i;
+    void *scratch = NULL;               /* Stack blocks for polynomial transforms */
     herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -1066,147 +1123,169 @@ H5Z_xform_eval(H5Z_data_xform_t *data_xform_prop, void* array, size_t array_size
 #endif
 
     } /* end if */
-    /* Otherwise, do the full data transform */
-    else {
-	/* Optimization for linear transform: */
-	if(data_xform_prop->dat_val_pointers->num_ptrs == 1)
-	    data_xform_prop->dat_val_pointers->ptr_dat_val[0] = array;
-
-	/* If it's a quadratic transform, we have no choice but to store multiple copies of the data */
-	else {
-	    for(i = 0; i < data_xform_prop->dat_val_pointers->num_ptrs; i++) {
-		if(NULL == (data_xform_prop->dat_val_pointers->ptr_dat_val[i] = (void*)H5MM_malloc(array_size * H5T_get_size((H5T_t *)H5I_object(array_type)))))
-		    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "Ran out of memory trying to allocate space for data in data transform")
-
-                H5MM_memcpy(data_xform_prop->dat_val_pointers->ptr_dat_val[i], array, array_size * H5T_get_size((H5T_t *)H5I_object(array_type)));
-	    } /* end for */
-	} /* end else */
-
-	if(H5Z_xform_eval_full(tree, array_size, array_type, &res) < 0)
-	    HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error while performing data transform")
-
-	if(data_xform_prop->dat_val_pointers->num_ptrs > 1)
-	    H5MM_memcpy(array, res.value.dat_val, array_size * H5T_get_size((H5T_t *)H5I_object(array_type)));
-
-        /* Free the temporary arrays we used */
+    /* Otherwise, evaluate the compiled transform ("x" by itself leaves the data alone) */
+    else if(data_xform_prop->nops > 1) {
+        /* Polynomial transforms need the rest of the stack and a copy of
+         * each block of the data */
         if(data_xform_prop->dat_val_pointers->num_ptrs > 1)
-            for(i=0; i<data_xform_prop->dat_val_pointers->num_ptrs; i++)
-                H5MM_xfree(data_xform_prop->dat_val_pointers->ptr_dat_val[i]);
+            if(NULL == (scratch = H5MM_malloc(data_xform_prop->depth * H5Z_XFORM_BLOCK_SIZE * H5T_get_size(buf_type))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "Ran out of memory trying to allocate space for data in data transform")
+
+        if(array_type == H5T_NATIVE_CHAR)
+            H5Z_xform_eval_char(data_xform_prop, array, array_size, scratch);
+        else if(array_type == H5T_NATIVE_SCHAR)
+            H5Z_xform_eval_schar(data_xform_prop, array, array_size, scratch);
+        else if(array_type == H5T_NATIVE_UCHAR)
+            H5Z_xform_eval_uchar(data_xform_prop, array, array_size, scratch);
+        else if(array_type == H5T_NATIVE_SHORT)
+            H5Z_xform_eval_short(data_xform_prop, array, array_size, scratch);
+        else if(array_type == H5T_NATIVE_USHORT)
+            H5Z_xform_eval_ushort(data_xform_prop, array, array_size, scratch);
+        else if(array_type == H5T_NATIVE_INT)
+            H5Z_xform_eval_int(data_xform_prop, array, array_size, scratch);
+        else if(array_type == H5T_NATIVE_UINT)
+            H5Z_xform_eval_uint(data_xform_prop, array, array_size, scratch);
+        else if(array_type == H5T_NATIVE_LONG)
+            H5Z_xform_eval_long(data_xform_prop, array, array_size, scratch);
+        else if(array_type == H5T_NATIVE_ULONG)
+            H5Z_xform_eval_ulong(data_xform_prop, array, array_size, scratch);
+        else if(array_type == H5T_NATIVE_LLONG)
+            H5Z_xform_eval_llong(data_xform_prop, array, array_size, scratch);
+        else if(array_type == H5T_NATIVE_ULLONG)
+            H5Z_xform_eval_ullong(data_xform_prop, array, array_size, scratch);
+        else if(array_type == H5T_NATIVE_FLOAT)
+            H5Z_xform_eval_float(data_xform_prop, array, array_size, scratch);
+        else if(array_type == H5T_NATIVE_DOUBLE)
+            H5Z_xform_eval_double(data_xform_prop, array, array_size, scratch);
+#if H5_SIZEOF_LONG_DOUBLE !=0
+        else if(array_type == H5T_NATIVE_LDOUBLE)
+            H5Z_xform_eval_ldouble(data_xform_prop, array, array_size, scratch);
+#endif
     } /* end else */
 
 done:
-    if(ret_value < 0) {
-	/* If we ran out of memory above copying the array for temp storage (which we easily can for
-	 * polynomial transforms of high order) we free those arrays which we already allocated */
-	if(data_xform_prop->dat_val_pointers->num_ptrs > 1)
-	    for(i = 0; i < data_xform_prop->dat_val_pointers->num_ptrs; i++)
-		if(data_xform_prop->dat_val_pointers->ptr_dat_val[i])
-		    H5MM_xfree(data_xform_prop->dat_val_pointers->ptr_dat_val[i]);
-    } /* end if */
+    if(scratch)
+        H5MM_xfree(scratch);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5Z_xform_eval() */
 
 
 /*-------------------------------------------------------------------------
- * Function:    H5Z_xform_eval_full
- * Purpose: 	Does a full evaluation of the parse tree contained in tree
- * 		and applies this transform to array.
- * Return:      Nothing
- * Programmer:  Leon Arber
- * 		5/1/04
- * Modifications:
- *
+ * Function:    H5Z_xform_compile
+ * Purpose:     Compiles the parse tree of a transform that isn't a number
+ *              to the postfix operations that H5Z_xform_eval() runs.
+ * Return:      SUCCEED if the tree was compiled, FAIL otherwise
  *
- * Notes:   In the case of a polynomial data transform (ie, the left and right subtree
- * are both of type H5Z_XFORM_SYMBOL), the convention is that the left hand side
- * will accumulate changes and, at the end, the new data will be copied from the lhs.
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5Z_xform_eval_full(H5Z_node *tree, const size_t array_size,  const hid_t array_type, H5Z_result *res)
+H5Z_xform_compile(H5Z_data_xform_t *data_xform_prop)
 {
-    H5Z_result resl, resr;
+    H5Z_node *tree;
+    size_t sp = 0;                      /* # of blocks on the stack */
     herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_NOAPI_NOINIT
 
-    /* check args */
-    HDassert(tree);
+    HDassert(data_xform_prop);
+    HDassert(data_xform_prop->parse_root);
 
-    HDmemset(&resl, 0, sizeof(H5Z_result));
-    HDmemset(&resr, 0, sizeof(H5Z_result));
+    tree = data_xform_prop->parse_root;
 
-    if (tree->type == H5Z_XFORM_INTEGER) {
-	res->type = H5Z_XFORM_INTEGER;
-	res->value.int_val = tree->value.int_val;
-    } /* end if */
-    else if (tree->type == H5Z_XFORM_FLOAT) {
-	res->type = H5Z_XFORM_FLOAT;
-	res->value.float_val = tree->value.float_val;
-    } /* end if */
-    else if (tree->type == H5Z_XFORM_SYMBOL) {
-	res->type = H5Z_XFORM_SYMBOL;
+    /* Trivial transforms just fill the array with the number */
+    if(tree->type == H5Z_XFORM_INTEGER || tree->type == H5Z_XFORM_FLOAT)
+        HGOTO_DONE(SUCCEED)
 
-	/*since dat_val stores the address of the array which is really stored in the dat_val_pointers,
-	 * here we make dat_val store a pointer to the array itself instead of the address of it so that the
-	 * rest of the code below works normally. */
-	res->value.dat_val = *((void**)(tree->value.dat_val));
-    } /* end if */
-    else {
-	if(tree->lchild && H5Z_xform_eval_full(tree->lchild, array_size, array_type, &resl) < 0)
-	    HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error while performing data transform")
-	if(H5Z_xform_eval_full(tree->rchild, array_size, array_type, &resr) < 0)
-	    HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error while performing data transform")
-
-	res->type = H5Z_XFORM_SYMBOL;
-
-	/* For each type of operation:
-	 * 1.  See if "x" is on left hand side, right hand side, or if both sides are "x"
-	 * 2.  Figure out what type of data we're going to be manipulating
-	 * 3.  Do the operation on the data. */
-	switch (tree->type) {
-	    case H5Z_XFORM_PLUS:
-                H5Z_XFORM_TYPE_OP(resl, resr, array_type, +, array_size)
-                break;
+    /* Each operation comes from a symbol or an operator in the expression,
+     * so there are no more operations than characters */
+    if(NULL == (data_xform_prop->prog = (H5Z_xform_op_t *)H5MM_malloc(HDstrlen(data_xform_prop->xform_exp) * sizeof(H5Z_xform_op_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate memory for compiled data transform")
+    data_xform_prop->nops = 0;
+    data_xform_prop->depth = 0;
 
-	    case H5Z_XFORM_MINUS:
-                H5Z_XFORM_TYPE_OP(resl, resr, array_type, -, array_size)
-                break;
+    if(H5Z_xform_compile_tree(tree, data_xform_prop, &sp) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error while compiling data transform")
+    HDassert(sp == 1);
 
-	    case H5Z_XFORM_MULT:
-                H5Z_XFORM_TYPE_OP(resl, resr, array_type, *, array_size)
-                break;
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_xform_compile() */
 
-	    case H5Z_XFORM_DIVIDE:
-                H5Z_XFORM_TYPE_OP(resl, resr, array_type, /, array_size)
-                break;
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z_xform_compile_tree
+ * Purpose:     Appends the operations for the parse tree TREE to the
+ *              compiled transform.  SP is the number of blocks on the
+ *              stack, which the operations leave one higher.
+ * Return:      SUCCEED if the tree was compiled, FAIL otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z_xform_compile_tree(const H5Z_node *tree, H5Z_data_xform_t *data_xform_prop, size_t *sp)
+{
+    H5Z_xform_op_t *op;                 /* New operation */
+    herr_t ret_value = SUCCEED;         /* Return value */
 
-            case H5Z_XFORM_ERROR:
-            case H5Z_XFORM_INTEGER:
-            case H5Z_XFORM_FLOAT:
-            case H5Z_XFORM_SYMBOL:
-            case H5Z_XFORM_LPAREN:
-            case H5Z_XFORM_RPAREN:
-            case H5Z_XFORM_END:
-	    default:
-                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid expression tree")
-	} /* end switch */
-
-	/* The result stores a pointer to the new data */
-	/* So, if the left hand side got its data modified, the result stores a pointers
-	 * to the left hand side's data, ditto for rhs */
-	if(resl.type ==  H5Z_XFORM_SYMBOL)
-	    res->value.dat_val = resl.value.dat_val;
-	else if(resr.type == H5Z_XFORM_SYMBOL)
-	    res->value.dat_val = resr.value.dat_val;
-	else
-	    HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error during transform evaluation")
-    } /* end else */
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(tree);
+
+    if(tree->type == H5Z_XFORM_SYMBOL) {
+        op = &data_xform_prop->prog[data_xform_prop->nops++];
+        op->type = H5Z_XFORM_SYMBOL;
+        op->args = H5Z_XFORM_ARGS_XX;
+        op->value = 0.0;
+
+        if(++(*sp) > data_xform_prop->depth)
+            data_xform_prop->depth = *sp;
+    } /* end if */
+    else if(tree->type == H5Z_XFORM_PLUS || tree->type == H5Z_XFORM_MINUS ||
+            tree->type == H5Z_XFORM_MULT || tree->type == H5Z_XFORM_DIVIDE) {
+        hbool_t lnumb, rnumb;           /* Whether the operands are numbers */
+
+        HDassert(tree->rchild);
+
+        /* The left operand is missing for -x and +x, which are 0 - x and 0 + x */
+        lnumb = (NULL == tree->lchild || tree->lchild->type == H5Z_XFORM_INTEGER || tree->lchild->type == H5Z_XFORM_FLOAT);
+        rnumb = (tree->rchild->type == H5Z_XFORM_INTEGER || tree->rchild->type == H5Z_XFORM_FLOAT);
+
+        /* H5Z_xform_reduce_tree() has already done the arithmetic on numbers */
+        if(lnumb && rnumb)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Unexpected type conversion operation")
+
+        /* Push the operands that are data, the left one first */
+        if(!lnumb && H5Z_xform_compile_tree(tree->lchild, data_xform_prop, sp) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error while compiling data transform")
+        if(!rnumb && H5Z_xform_compile_tree(tree->rchild, data_xform_prop, sp) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error while compiling data transform")
+
+        op = &data_xform_prop->prog[data_xform_prop->nops++];
+        op->type = tree->type;
+        if(lnumb) {
+            op->args = H5Z_XFORM_ARGS_CX;
+            if(NULL == tree->lchild)
+                op->value = 0.0;
+            else
+                op->value = (tree->lchild->type == H5Z_XFORM_INTEGER ? (double)tree->lchild->value.int_val : tree->lchild->value.float_val);
+        } /* end if */
+        else if(rnumb) {
+            op->args = H5Z_XFORM_ARGS_XC;
+            op->value = (tree->rchild->type == H5Z_XFORM_INTEGER ? (double)tree->rchild->value.int_val : tree->rchild->value.float_val);
+        } /* end if */
+        else {
+            op->args = H5Z_XFORM_ARGS_XX;
+            op->value = 0.0;
+            (*sp)--;
+        } /* end else */
+    } /* end if */
+    else
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid expression tree")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5Z_xform_eval_full() */
+} /* end H5Z_xform_compile_tree() */
 
 
 /*-------------------------------------------------------------------------
@@ -1583,6 +1662,10 @@ H5Z_xform_create(const char *expr)
     if(count != data_xform_prop->dat_val_pointers->num_ptrs)
          HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "error copying the parse tree, did not find correct number of \"variables\"")
 
+    /* Compile the parse tree for evaluating */
+    if(H5Z_xform_compile(data_xform_prop) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "unable to compile data transform")
+
     /* Assign return value */
     ret_value=data_xform_prop;
 
@@ -1593,6 +1676,8 @@ done:
         if(data_xform_prop) {
             if(data_xform_prop->parse_root)
                 H5Z_xform_destroy_parse_tree(data_xform_prop->parse_root);
+            if(data_xform_prop->prog)
+                H5MM_xfree(data_xform_prop->prog);
             if(data_xform_prop->xform_exp)
                 H5MM_xfree(data_xform_prop->xform_exp);
 	    if(count > 0 && data_xform_prop->dat_val_pointers->ptr_dat_val)
@@ -1635,6 +1720,9 @@ H5Z_xform_destroy(H5Z_data_xform_t *data_xform_prop)
 	/* Destroy the parse tree */
         H5Z_xform_destroy_parse_tree(data_xform_prop->parse_root);
 
+        /* Free the compiled transform */
+        H5MM_xfree(data_xform_prop->prog);
+
         /* Free the expression */
         H5MM_xfree(data_xform_prop->xform_exp);
 
@@ -1715,6 +1803,10 @@ H5Z_xform_copy(H5Z_data_xform_t **data_xform_prop)
 	if(count != new_data_xform_prop->dat_val_pointers->num_ptrs)
             HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "error copying the parse tree, did not find correct number of \"variables\"")
 
+        /* Compile the new parse tree */
+        if(H5Z_xform_compile(new_data_xform_prop) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to compile data transform")
+
         /* Copy new information on top of old information */
         *data_xform_prop=new_data_xform_prop;
     } /* end if */
@@ -1725,6 +1817,8 @@ done:
         if(new_data_xform_prop) {
             if(new_data_xform_prop->parse_root)
                 H5Z_xform_destroy_parse_tree(new_data_xform_prop->parse_root);
+            if(new_data_xform_prop->prog)
+                H5MM_xfree(new_data_xform_prop->prog);
             if(new_data_xform_prop->xform_exp)
                 H5MM_xfree(new_data_xform_prop->xform_exp);
             H5MM_xfree(new_data_xform_prop);
@@ -0,0 +1,215 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     A filter around the Zstandard compression library.  The
+ *              data of a chunk is stored as a single Zstandard frame, which
+ *              is the same format as the Zstandard filter plugin that was
+ *              registered with this filter identifier.
+ *
+ *              The filter parameters are the compression level and,
+ *              optionally, the size and the contents of a dictionary,
+ *              packed four bytes at a time into the parameters so that the
+ *              dictionary is stored with the dataset.
+ */
+
+#include "H5Zmodule.h"          /* This source code file is part of the H5Z module */
+
+
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5MMprivate.h"	/* Memory management			*/
+#include "H5Zpkg.h"		/* Data filters				*/
+
+#ifdef H5_HAVE_FILTER_ZSTD
+
+#include <zstd.h>
+
+/* Local function prototypes */
+static size_t H5Z_filter_zstd(unsigned flags, size_t cd_nelmts,
+    const unsigned cd_values[], size_t nbytes, size_t *buf_size, void **buf);
+
+/* This message derives from H5Z */
+const H5Z_class2_t H5Z_ZSTD[1] = {{
+    H5Z_CLASS_T_VERS,       /* H5Z_class_t version */
+    H5Z_FILTER_ZSTD,		/* Filter id number		*/
+    1,              /* encoder_present flag (set to true) */
+    1,              /* decoder_present flag (set to true) */
+    "zstd",			/* Filter name for debugging	*/
+    NULL,                       /* The "can apply" callback     */
+    NULL,                       /* The "set local" callback     */
+    H5Z_filter_zstd,            /* The actual filter function	*/
+}};
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__zstd_unpack_dict
+ *
+ * Purpose:	Unpack the dictionary stored in the filter parameters, if
+ *              there is one.
+ *
+ * Return:	Success: Non-negative, with *dict set to a newly allocated
+ *                       dictionary (or NULL) and *dict_size to its size
+ *		Failure: Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z__zstd_unpack_dict(size_t cd_nelmts, const unsigned cd_values[],
+    unsigned char **dict, size_t *dict_size)
+{
+    unsigned char *p;                   /* Pointer into dictionary */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    *dict = NULL;
+    *dict_size = 0;
+
+    if(cd_nelmts > H5Z_ZSTD_PARM_DICT_SIZE) {
+        *dict_size = cd_values[H5Z_ZSTD_PARM_DICT_SIZE];
+        if(*dict_size > H5Z_ZSTD_MAX_DICT_SIZE || cd_nelmts != H5Z_ZSTD_DICT_NPARMS(*dict_size))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid zstd dictionary parameters")
+
+        if(*dict_size > 0) {
+            if(NULL == (*dict = (unsigned char *)H5MM_malloc(*dict_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for zstd dictionary")
+            for(u = 0, p = *dict; u < *dict_size; u++)
+                *p++ = (unsigned char)((cd_values[H5Z_ZSTD_PARM_DICT + (u / 4)] >> (8 * (u % 4))) & 0xff);
+        } /* end if */
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__zstd_unpack_dict() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z_filter_zstd
+ *
+ * Purpose:	Implement an I/O filter around the Zstandard compression
+ *              library.
+ *
+ * Return:	Success: Size of buffer filtered
+ *		Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z_filter_zstd(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
+    size_t nbytes, size_t *buf_size, void **buf)
+{
+    void        *outbuf = NULL;         /* Pointer to new buffer */
+    unsigned char *dict = NULL;         /* Dictionary */
+    size_t      dict_size;              /* Size of dictionary */
+    size_t      status;                 /* Status from zstd operation */
+    size_t      ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_NOAPI(0)
+
+    /* Sanity check */
+    HDassert(*buf_size > 0);
+    HDassert(buf);
+    HDassert(*buf);
+
+    /* Check arguments */
+    if(cd_nelmts < 1)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "invalid zstd parameters")
+    if(H5Z__zstd_unpack_dict(cd_nelmts, cd_values, &dict, &dict_size) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, 0, "can't get zstd dictionary")
+
+    if(flags & H5Z_FLAG_REVERSE) {
+        /* Input; uncompress */
+        unsigned long long content_size;        /* Size of uncompressed data */
+
+        /* The frame header holds the size of the uncompressed data */
+        content_size = ZSTD_getFrameContentSize(*buf, nbytes);
+        if(ZSTD_CONTENTSIZE_UNKNOWN == content_size || ZSTD_CONTENTSIZE_ERROR == content_size)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "can't get size of zstd uncompressed data")
+        H5_CHECK_OVERFLOW(content_size, unsigned long long, size_t);
+
+        /* Allocate space for the uncompressed buffer (zero bytes of data
+         * is possible, but not a zero byte buffer) */
+	if(NULL == (outbuf = H5MM_malloc(MAX((size_t)content_size, 1))))
+	    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for zstd uncompression")
+
+        if(dict) {
+            ZSTD_DCtx *dctx;            /* Decompression context */
+
+            if(NULL == (dctx = ZSTD_createDCtx()))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "can't create zstd decompression context")
+            status = ZSTD_decompress_usingDict(dctx, outbuf, (size_t)content_size, *buf, nbytes, dict, dict_size);
+            ZSTD_freeDCtx(dctx);
+        } /* end if */
+        else
+            status = ZSTD_decompress(outbuf, (size_t)content_size, *buf, nbytes);
+        if(ZSTD_isError(status))
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "zstd error: %s", ZSTD_getErrorName(status))
+        if(status != (size_t)content_size)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "zstd uncompressed data has the wrong size")
+
+        /* Free the input buffer */
+	H5MM_xfree(*buf);
+
+        /* Set return values */
+	*buf = outbuf;
+	outbuf = NULL;
+	*buf_size = MAX((size_t)content_size, 1);
+	ret_value = (size_t)content_size;
+    } /* end if */
+    else {
+        /* Output; compress */
+        size_t  dst_nbytes = ZSTD_compressBound(nbytes);        /* Size of output buffer */
+        int     level = (int)cd_values[H5Z_ZSTD_PARM_LEVEL];    /* Compression level */
+
+        if(level < ZSTD_minCLevel() || level > ZSTD_maxCLevel())
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "invalid zstd compression level")
+
+        /* Allocate output (compressed) buffer */
+	if(NULL == (outbuf = H5MM_malloc(dst_nbytes)))
+	    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to allocate zstd destination buffer")
+
+        if(dict) {
+            ZSTD_CCtx *cctx;            /* Compression context */
+
+            if(NULL == (cctx = ZSTD_createCCtx()))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "can't create zstd compression context")
+            status = ZSTD_compress_usingDict(cctx, outbuf, dst_nbytes, *buf, nbytes, dict, dict_size, level);
+            ZSTD_freeCCtx(cctx);
+        } /* end if */
+        else
+            status = ZSTD_compress(outbuf, dst_nbytes, *buf, nbytes, level);
+        if(ZSTD_isError(status))
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "zstd error: %s", ZSTD_getErrorName(status))
+
+        /* Free the input buffer */
+        H5MM_xfree(*buf);
+
+        /* Set return values */
+        *buf = outbuf;
+        outbuf = NULL;
+        *buf_size = dst_nbytes;
+        ret_value = status;
+    } /* end else */
+
+done:
+    if(outbuf)
+        H5MM_xfree(outbuf);
+    if(dict)
+        H5MM_xfree(dict);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_filter_zstd() */
+
+#endif /* H5_HAVE_FILTER_ZSTD */
+
@@ -41,6 +41,37 @@
 /* (same as the IEEE 802.3 (Ethernet) quotient) */
 #define H5_CRC_QUOTIENT 0x04C11DB7
 
+/* Polynomial quotient for CRC32C, bit-reversed */
+/* (the Castagnoli polynomial, as used by iSCSI and the SSE4.2 "crc32"
+ *  instruction) */
+#define H5_CRC32C_QUOTIENT 0x82F63B78
+
+/*
+ * SIMD versions of the checksums.  The kernels are compiled for each
+ * instruction set with the "target" function attribute and are chosen at
+ * run time if the CPU supports them, so the library doesn't have to be
+ * built for a particular CPU.  They return exactly the same checksums as
+ * the portable code.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && \
+        (defined(__clang__) || __GNUC__ >= 6)
+#define H5_CHECKSUM_X86
+#include <immintrin.h>
+
+#define H5_CHECKSUM_TARGET(ISA)     __attribute__((target(ISA)))
+
+/* Number of 32-byte vectors the AVX2 fletcher32 kernel sums before it
+ * reduces the sums, small enough that the 32-bit lanes can't overflow */
+#define H5_FLETCHER32_AVX2_BATCH    1024
+#endif /* H5_CHECKSUM_X86 */
+
+/* The words of a lookup3 block can be loaded directly on little-endian
+ * machines, instead of a byte at a time */
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && \
+        __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define H5_LOOKUP3_LITTLE_ENDIAN
+#endif
+
 
 /******************/
 /* Local Typedefs */
@@ -77,6 +108,92 @@ static uint32_t H5_crc_table[256];
 /* Flag: has the table been computed? */
 static hbool_t H5_crc_table_computed = FALSE;
 
+/* Table of CRC32Cs of all 8-bit messages, for CPUs without the
+ * instruction */
+static uint32_t H5_crc32c_table[256];
+
+/* Flag: has the CRC32C table been computed? */
+static hbool_t H5_crc32c_table_computed = FALSE;
+
+
+
+#ifdef H5_CHECKSUM_X86
+/*-------------------------------------------------------------------------
+ * Function:	H5__checksum_fletcher32_avx2
+ *
+ * Purpose:	Add NVECS 32-byte vectors of data to the running fletcher32
+ *              sums, with AVX2 instructions.
+ *
+ *              Each vector holds 16 big-endian words.  Adding them one at
+ *              a time would add each word to SUM2 once for every word
+ *              from there on, so a vector adds its words to SUM2 weighted
+ *              by 16 down to 1, and the words of the earlier vectors in
+ *              the batch 16 more times each.  The sums are reduced modulo
+ *              65535 after each batch.
+ *
+ * Return:	TRUE if any of the data is non-zero, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_CHECKSUM_TARGET("avx2") hbool_t
+H5__checksum_fletcher32_avx2(const uint8_t *data, size_t nvecs, uint32_t *sum1,
+    uint32_t *sum2)
+{
+    const __m256i hi_mask = _mm256_set1_epi16((short)0x00FF);
+    const __m256i lo_mask = _mm256_set1_epi16((short)0xFF00);
+    const __m256i hi_weights = _mm256_setr_epi8(16, 0, 15, 0, 14, 0, 13, 0,
+            12, 0, 11, 0, 10, 0, 9, 0, 8, 0, 7, 0, 6, 0, 5, 0, 4, 0, 3, 0,
+            2, 0, 1, 0);
+    const __m256i lo_weights = _mm256_slli_si256(hi_weights, 1);
+    const __m256i hi_scale = _mm256_set1_epi16(256);
+    const __m256i lo_scale = _mm256_set1_epi16(1);
+    uint64_t s1 = *sum1, s2 = *sum2;
+    hbool_t nonzero = FALSE;
+
+    while(nvecs) {
+        size_t n = MIN(nvecs, H5_FLETCHER32_AVX2_BATCH);
+        __m256i vs1 = _mm256_setzero_si256();      /* Sums of the words, in 64-bit lanes */
+        __m256i vps = _mm256_setzero_si256();      /* Sums of vs1 before each vector */
+        __m256i vs2 = _mm256_setzero_si256();      /* Weighted sums, in 32-bit lanes */
+        uint64_t lanes64[4];
+        uint32_t lanes32[8];
+        uint64_t batch_s1, batch_ps, batch_s2;
+        size_t u;
+
+        nvecs -= n;
+        for(u = 0; u < n; u++) {
+            __m256i v = _mm256_loadu_si256((const __m256i *)data);
+            __m256i hi_sums = _mm256_sad_epu8(_mm256_and_si256(v, hi_mask), _mm256_setzero_si256());
+            __m256i lo_sums = _mm256_sad_epu8(_mm256_and_si256(v, lo_mask), _mm256_setzero_si256());
+
+            vps = _mm256_add_epi64(vps, vs1);
+            vs1 = _mm256_add_epi64(vs1, _mm256_add_epi64(_mm256_slli_epi64(hi_sums, 8), lo_sums));
+            vs2 = _mm256_add_epi32(vs2, _mm256_madd_epi16(_mm256_maddubs_epi16(v, hi_weights), hi_scale));
+            vs2 = _mm256_add_epi32(vs2, _mm256_madd_epi16(_mm256_maddubs_epi16(v, lo_weights), lo_scale));
+            data += 32;
+        } /* end for */
+
+        /* Add up the lanes */
+        _mm256_storeu_si256((__m256i *)lanes64, vs1);
+        batch_s1 = lanes64[0] + lanes64[1] + lanes64[2] + lanes64[3];
+        _mm256_storeu_si256((__m256i *)lanes64, vps);
+        batch_ps = lanes64[0] + lanes64[1] + lanes64[2] + lanes64[3];
+        _mm256_storeu_si256((__m256i *)lanes32, vs2);
+        for(u = 0, batch_s2 = 0; u < 8; u++)
+            batch_s2 += lanes32[u];
+
+        s2 = (s2 + (16 * n * s1) + (16 * batch_ps) + batch_s2) % 65535;
+        s1 = (s1 + batch_s1) % 65535;
+        if(batch_s1)
+            nonzero = TRUE;
+    } /* end while */
+
+    *sum1 = (uint32_t)s1;
+    *sum2 = (uint32_t)s2;
+
+    return nonzero;
+} /* end H5__checksum_fletcher32_avx2() */
+#endif /* H5_CHECKSUM_X86 */
 
 
 /*-------------------------------------------------------------------------
@@ -112,6 +229,7 @@ H5_checksum_fletcher32(const void *_data, size_t _len)
     const uint8_t *data = (const uint8_t *)_data;  /* Pointer to the data to be summed */
     size_t len = _len / 2;      /* Length in 16-bit words */
     uint32_t sum1 = 0, sum2 = 0;
+    hbool_t nonzero = FALSE;    /* Whether the data summed with SIMD instructions is non-zero */
 
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
@@ -119,6 +237,21 @@ H5_checksum_fletcher32(const void *_data, size_t _len)
     HDassert(_data);
     HDassert(_len > 0);
 
+#ifdef H5_CHECKSUM_X86
+    /* Sum as many whole vectors as possible with SIMD instructions, the
+     * code below finishes off the rest from the (reduced) sums */
+    if(len >= 16) {
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx2")) {
+            size_t nvecs = len / 16;
+
+            nonzero = H5__checksum_fletcher32_avx2(data, nvecs, &sum1, &sum2);
+            data += nvecs * 32;
+            len -= nvecs * 16;
+        } /* end if */
+    } /* end if */
+#endif /* H5_CHECKSUM_X86 */
+
     /* Compute checksum for pairs of bytes */
     /* (the magic "360" value is is the largest number of sums that can be
      *  performed without numeric overflow)
@@ -147,6 +280,15 @@ H5_checksum_fletcher32(const void *_data, size_t _len)
     sum1 = (sum1 & 0xffff) + (sum1 >> 16);
     sum2 = (sum2 & 0xffff) + (sum2 >> 16);
 
+    /* Non-zero sums that are a multiple of 65535 reduce to 0xffff above,
+     * but to 0 if they were reduced modulo 65535 */
+    if(nonzero) {
+        if(0 == sum1)
+            sum1 = 0xffff;
+        if(0 == sum2)
+            sum2 = 0xffff;
+    } /* end if */
+
     FUNC_LEAVE_NOAPI((sum2 << 16) | sum1)
 } /* end H5_checksum_fletcher32() */
 
@@ -250,6 +392,125 @@ H5_checksum_crc(const void *_data, size_t len)
     FUNC_LEAVE_NOAPI(H5_checksum_crc_update((uint32_t)0xffffffffL, (const uint8_t *)_data, len) ^ 0xffffffffL)
 } /* end H5_checksum_crc() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5_checksum_crc32c_make_table
+ *
+ * Purpose:	Compute the CRC table for the CRC32C checksum algorithm
+ *
+ * Return:	none
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_checksum_crc32c_make_table(void)
+{
+    uint32_t c;         /* Checksum for each byte value */
+    unsigned n, k;      /* Local index variables */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Compute the checksum for each possible byte value */
+    for(n = 0; n < 256; n++) {
+        c = (uint32_t) n;
+        for(k = 0; k < 8; k++)
+            if(c & 1)
+                c = H5_CRC32C_QUOTIENT ^ (c >> 1);
+            else
+                c = c >> 1;
+        H5_crc32c_table[n] = c;
+    }
+    H5_crc32c_table_computed = TRUE;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5_checksum_crc32c_make_table() */
+
+#ifdef H5_CHECKSUM_X86
+
+/*-------------------------------------------------------------------------
+ * Function:	H5__checksum_crc32c_sse42
+ *
+ * Purpose:	Update a running CRC32C with the bytes buf[0..len-1], with
+ *              the SSE4.2 "crc32" instruction.
+ *
+ * Return:	Updated CRC (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_CHECKSUM_TARGET("sse4.2") uint32_t
+H5__checksum_crc32c_sse42(uint32_t crc, const uint8_t *buf, size_t len)
+{
+#ifdef __x86_64__
+    uint64_t crc64 = crc;
+
+    for(; len >= 8; len -= 8, buf += 8) {
+        uint64_t word;
+
+        HDmemcpy(&word, buf, sizeof(word));
+        crc64 = _mm_crc32_u64(crc64, word);
+    } /* end for */
+    crc = (uint32_t)crc64;
+#endif /* __x86_64__ */
+    for(; len >= 4; len -= 4, buf += 4) {
+        uint32_t word;
+
+        HDmemcpy(&word, buf, sizeof(word));
+        crc = _mm_crc32_u32(crc, word);
+    } /* end for */
+    for(; len > 0; len--, buf++)
+        crc = _mm_crc32_u8(crc, *buf);
+
+    return crc;
+} /* end H5__checksum_crc32c_sse42() */
+#endif /* H5_CHECKSUM_X86 */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5_checksum_crc32c
+ *
+ * Purpose:	Compute the CRC32C (Castagnoli) checksum of a buffer, with
+ *              the SSE4.2 "crc32" instruction if the CPU has it and with a
+ *              table otherwise.
+ *
+ *              This is the CRC used by iSCSI, ext4 and many storage
+ *              formats, and is much faster than H5_checksum_crc() on CPUs
+ *              that compute it in hardware.
+ *
+ * Return:	32-bit CRC32C checksum of input buffer (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+uint32_t
+H5_checksum_crc32c(const void *_data, size_t len)
+{
+    const uint8_t *data = (const uint8_t *)_data;  /* Pointer to the data to be summed */
+    uint32_t crc = 0xffffffff;  /* Running CRC */
+    size_t n;                   /* Local index variable */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(_data);
+    HDassert(len > 0);
+
+#ifdef H5_CHECKSUM_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("sse4.2"))
+        crc = H5__checksum_crc32c_sse42(crc, data, len);
+    else
+#endif /* H5_CHECKSUM_X86 */
+    {
+        /* Initialize the CRC table if necessary */
+        if(!H5_crc32c_table_computed)
+            H5_checksum_crc32c_make_table();
+
+        for(n = 0; n < len; n++)
+            crc = H5_crc32c_table[(crc ^ data[n]) & 0xff] ^ (crc >> 8);
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI(crc ^ 0xffffffff)
+} /* end H5_checksum_crc32c() */
+
 /*
 -------------------------------------------------------------------------------
 H5_lookup3_mix -- mix 3 32-bit values reversibly.
@@ -384,6 +645,21 @@ H5_checksum_lookup3(const void *key, size_t length, uint32_t initval)
     a = b = c = 0xdeadbeef + ((uint32_t)length) + initval;
 
     /*--------------- all but the last block: affect some 32 bits of (a,b,c) */
+#ifdef H5_LOOKUP3_LITTLE_ENDIAN
+    /* (the bytes of each word are already in the order they're added in) */
+    while (length > 12)
+    {
+      uint32_t w[3];
+
+      HDmemcpy(w, k, sizeof(w));
+      a += w[0];
+      b += w[1];
+      c += w[2];
+      H5_lookup3_mix(a, b, c);
+      length -= 12;
+      k += 12;
+    }
+#endif /* H5_LOOKUP3_LITTLE_ENDIAN */
     while (length > 12)
     {
       a += k[0];
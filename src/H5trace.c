@@ -660,6 +660,40 @@ H5_trace(const double *returning, const char *func, const char *type, ...)
                         } /* end else */
                         break;
 
+                    case 'p':
+                        if(ptr) {
+                            if(vp)
+                               HDfprintf(out, "0x%lx", (unsigned long)vp);
+                            else
+                               HDfprintf(out, "NULL");
+                        } /* end if */
+                        else {
+                            H5D_chunk_cache_policy_t policy = (H5D_chunk_cache_policy_t)HDva_arg(ap, int);
+
+                            switch(policy) {
+                                case H5D_CHUNK_CACHE_POLICY_ERROR:
+                                   HDfprintf(out, "H5D_CHUNK_CACHE_POLICY_ERROR");
+                                    break;
+
+                                case H5D_CHUNK_CACHE_POLICY_LRU:
+                                   HDfprintf(out, "H5D_CHUNK_CACHE_POLICY_LRU");
+                                    break;
+
+                                case H5D_CHUNK_CACHE_POLICY_2Q:
+                                   HDfprintf(out, "H5D_CHUNK_CACHE_POLICY_2Q");
+                                    break;
+
+                                case H5D_CHUNK_CACHE_POLICY_NTYPES:
+                                   HDfprintf(out, "H5D_CHUNK_CACHE_POLICY_NTYPES");
+                                    break;
+
+                                default:
+                                   HDfprintf(out, "%ld", (long)policy);
+                                    break;
+                            } /* end switch */
+                        } /* end else */
+                        break;
+
                     case 's':
                         if(ptr) {
                             if(vp)
@@ -1400,6 +1434,10 @@ H5_trace(const double *returning, const char *func, const char *type, ...)
                                 HDfprintf(out, "%ld (dataspace selection iterator)", (long)obj);
                                 break;
 
+                            case H5I_EVENTSET:
+                                HDfprintf(out, "%ld (event set)", (long)obj);
+                                break;
+
                             case H5I_NTYPES:
                                 HDfprintf (out, "%ld (ntypes - error)", (long)obj);
                                 break;
@@ -1589,6 +1627,10 @@ H5_trace(const double *returning, const char *func, const char *type, ...)
                                     HDfprintf(out, "H5I_SPACE_SEL_ITER");
                                     break;
 
+                                case H5I_EVENTSET:
+                                    HDfprintf(out, "H5I_EVENTSET");
+                                    break;
+
                                 case H5I_NTYPES:
                                     HDfprintf(out, "H5I_NTYPES");
                                     break;
@@ -3276,6 +3318,12 @@ H5_trace(const double *returning, const char *func, const char *type, ...)
                                 case H5VL_NATIVE_DATASET_GET_VLEN_BUF_SIZE:
                                     HDfprintf(out, "H5VL_NATIVE_DATASET_GET_VLEN_BUF_SIZE");
                                     break;
+                                case H5VL_NATIVE_DATASET_CHUNK_READ_MULTI:
+                                    HDfprintf(out, "H5VL_NATIVE_DATASET_CHUNK_READ_MULTI");
+                                    break;
+                                case H5VL_NATIVE_DATASET_CHUNK_WRITE_MULTI:
+                                    HDfprintf(out, "H5VL_NATIVE_DATASET_CHUNK_WRITE_MULTI");
+                                    break;
                                 default:
                                     HDfprintf(out, "%ld", (long)optional);
                                     break;
@@ -3399,6 +3447,12 @@ H5_trace(const double *returning, const char *func, const char *type, ...)
                                 case H5VL_NATIVE_FILE_POST_OPEN:
                                     HDfprintf(out, "H5VL_NATIVE_FILE_POST_OPEN");
                                     break;
+                                case H5VL_NATIVE_FILE_GET_CHUNK_CACHE_STATS:
+                                    HDfprintf(out, "H5VL_NATIVE_FILE_GET_CHUNK_CACHE_STATS");
+                                    break;
+                                case H5VL_NATIVE_FILE_RESET_CHUNK_CACHE_STATS:
+                                    HDfprintf(out, "H5VL_NATIVE_FILE_RESET_CHUNK_CACHE_STATS");
+                                    break;
                                 default:
                                     HDfprintf(out, "%ld", (long)optional);
                                     break;
@@ -61,6 +61,7 @@ static unsigned cache_image_api_error_check_4(hbool_t single_file_vfd);
 
 static unsigned get_free_sections_test(hbool_t single_file_vfd);
 static unsigned evict_on_close_test(hbool_t single_file_vfd);
+static unsigned cache_image_load_options_check(hbool_t single_file_vfd);
 
 
 /****************************************************************************/
@@ -8146,6 +8147,280 @@ evict_on_close_test(hbool_t single_file_vfd)
 } /* evict_on_close_test() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    cache_image_load_options_check()
+ *
+ * Purpose:     Verify that the options for loading a metadata cache
+ *        image (see H5Pset_mdc_image_load()) work as expected.
+ *
+ *        1) Create a HDF5 file WITHOUT the cache image FAPL entry,
+ *           and create some datasets.
+ *
+ *        2) Close the file.
+ *
+ *        3) Open the file WITH the cache image FAPL entry, and verify
+ *           the contents of the datasets, so that the image holds
+ *           clean entries.
+ *
+ *        4) Close the file.
+ *
+ *        5) Open the file READ ONLY, decoding the image in several
+ *           threads and leaving entries in the image until they
+ *           are used.
+ *
+ *        6) Verify the contents of some of the datasets, and verify
+ *           that entries were left in the image, and some of them
+ *           were inserted in the cache.
+ *
+ *        7) Verify the contents of all the datasets.
+ *
+ *        8) Close the file.
+ *
+ *        9) Open the file READ/WRITE with the same options, verify
+ *           the contents of the datasets, and verify that no entries
+ *           were left in the image.
+ *
+ *        10) Close and delete the file.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+
+static unsigned
+cache_image_load_options_check(hbool_t single_file_vfd)
+{
+    const char * fcn_name = "cache_image_load_options_check()";
+    char filename[512];
+    hbool_t show_progress = FALSE;
+    hid_t fapl_id = -1;
+    hid_t file_id = -1;
+    H5F_t *file_ptr = NULL;
+    H5C_t *cache_ptr = NULL;
+    unsigned nthreads = 0;
+    hbool_t lazy = FALSE;
+    int pass_num;
+    int cp = 0;
+
+    TESTING("metadata cache image load options");
+
+    /* Check for VFD that is a single file */
+    if(!single_file_vfd) {
+        SKIPPED();
+        HDputs("    Cache image not supported with the current VFD.");
+        return 0;
+    }
+
+    pass = TRUE;
+
+    if ( show_progress )
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+    /* setup the file name */
+    if ( pass ) {
+
+        if ( h5_fixname(FILENAMES[0], H5P_DEFAULT, filename, sizeof(filename))
+            == NULL ) {
+
+            pass = FALSE;
+            failure_mssg = "h5_fixname() failed.\n";
+        }
+    }
+
+
+    /* 1) Create a HDF5 file WITHOUT the cache image FAPL entry,
+     *    and create some datasets.
+     */
+
+    if ( pass ) {
+
+        open_hdf5_file(/* create_file        */ TRUE,
+                       /* mdci_sbem_expected */ FALSE,
+                       /* read_only          */ FALSE,
+                       /* set_mdci_fapl      */ FALSE,
+                       /* config_fsm         */ FALSE,
+                       /* set_eoc            */ FALSE,
+                       /* hdf_file_name      */ filename,
+                       /* cache_image_flags  */ 0,
+                       /* file_id_ptr        */ &file_id,
+                       /* file_ptr_ptr       */ &file_ptr,
+                       /* cache_ptr_ptr      */ &cache_ptr);
+    }
+
+    create_datasets(file_id, 1, 10);
+
+    if ( show_progress )
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 2) Close the file. */
+
+    if ( pass ) {
+
+        if ( H5Fclose(file_id) < 0  ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fclose() failed.\n";
+        }
+    }
+
+
+    /* 3) Open the file WITH the cache image FAPL entry, and verify the
+     *    contents of the datasets.
+     */
+
+    if ( pass ) {
+
+        open_hdf5_file(/* create_file        */ FALSE,
+                       /* mdci_sbem_expected */ FALSE,
+                       /* read_only          */ FALSE,
+                       /* set_mdci_fapl      */ TRUE,
+                       /* config_fsm         */ FALSE,
+                       /* set_eoc            */ FALSE,
+                       /* hdf_file_name      */ filename,
+                       /* cache_image_flags  */ H5C_CI__ALL_FLAGS,
+                       /* file_id_ptr        */ &file_id,
+                       /* file_ptr_ptr       */ &file_ptr,
+                       /* cache_ptr_ptr      */ &cache_ptr);
+    }
+
+    verify_datasets(file_id, 1, 10);
+
+    if ( show_progress )
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 4) Close the file. */
+
+    if ( pass ) {
+
+        if ( H5Fclose(file_id) < 0  ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fclose() failed.\n";
+        }
+    }
+
+
+    /* 5) - 10) Open the file READ ONLY, and then READ/WRITE, with
+     *    the image decoded in several threads and entries left in
+     *    the image until they are used.
+     */
+
+    for ( pass_num = 0; pass_num < 2; pass_num++ ) {
+        hbool_t read_only = (hbool_t)(pass_num == 0);
+
+        if ( pass ) {
+
+            if ( ( (fapl_id = h5_fileaccess()) < 0 ) ||
+                 ( H5Pset_libver_bounds(fapl_id, H5F_LIBVER_LATEST,
+                                        H5F_LIBVER_LATEST) < 0 ) ||
+                 ( H5Pset_mdc_image_load(fapl_id, 4, TRUE) < 0 ) ) {
+
+                pass = FALSE;
+                failure_mssg = "can't setup fapl.\n";
+
+            } else if ( ( H5Pget_mdc_image_load(fapl_id, &nthreads,
+                                                &lazy) < 0 ) ||
+                        ( nthreads != 4 ) || ( lazy != TRUE ) ) {
+
+                pass = FALSE;
+                failure_mssg = "unexpected image load options.\n";
+            }
+        }
+
+        if ( pass ) {
+
+            file_id = H5Fopen(filename, read_only ? H5F_ACC_RDONLY :
+                              H5F_ACC_RDWR, fapl_id);
+
+            if ( file_id < 0 ) {
+
+                pass = FALSE;
+                failure_mssg = "H5Fopen() failed.\n";
+
+            } else if ( NULL == (file_ptr = (H5F_t *)H5VL_object_verify(file_id, H5I_FILE)) ) {
+
+                pass = FALSE;
+                failure_mssg = "Can't get file_ptr.\n";
+
+            } else
+
+                cache_ptr = file_ptr->shared->cache;
+        }
+
+        if ( fapl_id >= 0 ) {
+
+            H5Pclose(fapl_id);
+            fapl_id = -1;
+        }
+
+        if ( show_progress )
+            HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+        verify_datasets(file_id, 1, 2);
+
+        if ( pass ) {
+
+            if ( ! cache_ptr->image_loaded ) {
+
+                pass = FALSE;
+                failure_mssg = "cache image not loaded.\n";
+
+            } else if ( read_only &&
+                        ( ( cache_ptr->num_lazy_image_entries == 0 ) ||
+                          ( cache_ptr->num_lazy_image_entries_left >=
+                            cache_ptr->num_lazy_image_entries ) ) ) {
+
+                pass = FALSE;
+                failure_mssg = "unexpected # of entries left in image.\n";
+
+            } else if ( ! read_only &&
+                        ( cache_ptr->num_lazy_image_entries != 0 ) ) {
+
+                pass = FALSE;
+                failure_mssg = "entries left in image of R/W file.\n";
+            }
+        }
+
+        verify_datasets(file_id, 1, 10);
+
+        if ( show_progress )
+            HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+        if ( pass ) {
+
+            if ( H5Fclose(file_id) < 0  ) {
+
+                pass = FALSE;
+                failure_mssg = "H5Fclose() failed.\n";
+            }
+        }
+    }
+
+
+    /* Delete the file */
+
+    if ( pass ) {
+
+        if ( HDremove(filename) < 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "HDremove() failed.\n";
+        }
+    }
+
+    if ( pass ) { PASSED(); } else { H5_FAILED(); }
+
+    if ( ! pass )
+        HDfprintf(stdout, "%s: failure_mssg = \"%s\".\n",
+                  FUNC, failure_mssg);
+
+    return !pass;
+
+} /* cache_image_load_options_check() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -8206,6 +8481,7 @@ main(void)
 
     nerrs += get_free_sections_test(single_file_vfd);
     nerrs += evict_on_close_test(single_file_vfd);
+    nerrs += cache_image_load_options_check(single_file_vfd);
 
     return(nerrs > 0);
 
@@ -36,6 +36,9 @@
 #define DATASETNAME10       "read_w_valid_cache"
 #define DATASETNAME11       "unallocated_chunk"
 #define DATASETNAME12       "unfiltered_data"
+/* Datasets for multiple chunk Direct Read/Write tests */
+#define DATASETNAME13       "multi_chunks"
+#define DATASETNAME14       "multi_chunks_unlimited"
 
 #define RANK         2
 #define NX     16
@@ -1980,6 +1983,238 @@ error:
     return 1;
 } /* test_read_unallocated_chunk() */
 
+/*-------------------------------------------------------------------------
+ * Function:    multi_store_chunk
+ *
+ * Purpose:     Sets up the bytes of chunk C of the test_direct_chunk_multi
+ *              dataset as they are stored in the file: the even chunks are
+ *              run through the shuffle filter, and the odd ones skip it.
+ *
+ * Return:      The chunk's filter mask
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint32_t
+multi_store_chunk(int c, const int *chunk, unsigned char *file_chunk)
+{
+    const unsigned char *bytes = (const unsigned char *)chunk;
+    size_t nelmts = CHUNK_NX * CHUNK_NY;
+    size_t u, b;
+
+    if(c % 2) {
+        HDmemcpy(file_chunk, chunk, nelmts * sizeof(int));
+        return 0x1;
+    }
+    for(u = 0; u < nelmts; u++)
+        for(b = 0; b < sizeof(int); b++)
+            file_chunk[(b * nelmts) + u] = bytes[(u * sizeof(int)) + b];
+    return 0;
+} /* multi_store_chunk() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_direct_chunk_multi
+ *
+ * Purpose:     Test writing and reading several chunks at once with
+ *              H5Dwrite_chunks and H5Dread_chunks, including chunks that
+ *              are dirty in the chunk cache, chunks that are requested more
+ *              than once and invalid requests.
+ *
+ * Return:      Success:        0
+ *              Failure:        1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define MULTI_NCHUNKS   ((NX / CHUNK_NX) * (NY / CHUNK_NY))
+static int
+test_direct_chunk_multi(hid_t file, hbool_t unlimited)
+{
+    hid_t       dataspace = -1, dataset = -1, mem_space = -1;
+    hid_t       cparms = -1;
+    hsize_t     dims[2]  = {NX, NY};
+    hsize_t     maxdims[2] = {H5S_UNLIMITED, H5S_UNLIMITED};
+    hsize_t     chunk_dims[2] = {CHUNK_NX, CHUNK_NY};
+    size_t      chunk_nbytes = CHUNK_NX * CHUNK_NY * sizeof(int);
+    int         data[NX][NY];       /* data read with H5Dread */
+    int         chunks[MULTI_NCHUNKS][CHUNK_NX][CHUNK_NY];  /* chunks written */
+    unsigned char file_chunks[MULTI_NCHUNKS][CHUNK_NX * CHUNK_NY * sizeof(int)];  /* chunks as stored */
+    uint32_t    file_filters[MULTI_NCHUNKS];    /* filter masks of chunks as stored */
+    unsigned char read_chunks[MULTI_NCHUNKS + 1][CHUNK_NX * CHUNK_NY * sizeof(int)]; /* chunks read */
+    hsize_t     offsets[MULTI_NCHUNKS + 1][2];  /* chunk offsets */
+    const hsize_t *offset_ptrs[MULTI_NCHUNKS + 1];
+    uint32_t    filters[MULTI_NCHUNKS + 1];
+    size_t      sizes[MULTI_NCHUNKS + 1];
+    const void  *write_bufs[MULTI_NCHUNKS + 1];
+    void        *read_bufs[MULTI_NCHUNKS + 1];
+    hsize_t     start[2] = {0, 0}, count[2] = {1, 1};
+    int         value = -1;
+    herr_t      status;
+    int         c, i, j;            /* local index variables */
+
+    TESTING(unlimited ? "H5Dwrite_chunks/H5Dread_chunks (unlimited dimensions)"
+            : "H5Dwrite_chunks/H5Dread_chunks (fixed dimensions)");
+
+    /* Create a dataset with an optional filter, which some chunks skip */
+    if((dataspace = H5Screate_simple(RANK, dims, unlimited ? maxdims : NULL)) < 0)
+        goto error;
+    if((mem_space = H5Screate_simple(1, count, NULL)) < 0)
+        goto error;
+    if((cparms = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if(H5Pset_chunk(cparms, RANK, chunk_dims) < 0)
+        goto error;
+    if(H5Pset_shuffle(cparms) < 0)
+        goto error;
+    if((dataset = H5Dcreate2(file, unlimited ? DATASETNAME14 : DATASETNAME13, H5T_NATIVE_INT,
+            dataspace, H5P_DEFAULT, cparms, H5P_DEFAULT)) < 0)
+        goto error;
+
+    /* Write all of the chunks at once, in reverse order */
+    for(c = 0; c < MULTI_NCHUNKS; c++) {
+        int chunk_row = c / (NY / CHUNK_NY), chunk_col = c % (NY / CHUNK_NY);
+
+        for(i = 0; i < CHUNK_NX; i++)
+            for(j = 0; j < CHUNK_NY; j++)
+                chunks[c][i][j] = ((chunk_row * CHUNK_NX) + i) * NY + (chunk_col * CHUNK_NY) + j;
+        file_filters[c] = multi_store_chunk(c, &chunks[c][0][0], file_chunks[c]);
+
+        offsets[MULTI_NCHUNKS - 1 - c][0] = (hsize_t)(chunk_row * CHUNK_NX);
+        offsets[MULTI_NCHUNKS - 1 - c][1] = (hsize_t)(chunk_col * CHUNK_NY);
+        offset_ptrs[MULTI_NCHUNKS - 1 - c] = offsets[MULTI_NCHUNKS - 1 - c];
+        filters[MULTI_NCHUNKS - 1 - c] = file_filters[c];
+        sizes[MULTI_NCHUNKS - 1 - c] = chunk_nbytes;
+        write_bufs[MULTI_NCHUNKS - 1 - c] = file_chunks[c];
+    }
+    if(H5Dwrite_chunks(dataset, H5P_DEFAULT, MULTI_NCHUNKS, filters, offset_ptrs, sizes, write_bufs) < 0)
+        goto error;
+
+    /* Check the data through the filter pipeline */
+    if(H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) < 0)
+        goto error;
+    for(i = 0; i < NX; i++)
+        for(j = 0; j < NY; j++)
+            if(data[i][j] != i * NY + j) {
+                HDprintf("\n    Read different values than written at index %d,%d\n", i, j);
+                goto error;
+            }
+
+    /* Overwrite the first element, leaving the first chunk dirty in the
+     * chunk cache */
+    if(H5Sselect_hyperslab(dataspace, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        goto error;
+    if(H5Dwrite(dataset, H5T_NATIVE_INT, mem_space, dataspace, H5P_DEFAULT, &value) < 0)
+        goto error;
+    chunks[0][0][0] = value;
+    file_filters[0] = multi_store_chunk(0, &chunks[0][0][0], file_chunks[0]);
+
+    /* Read all of the chunks back at once, in a different order, with one
+     * chunk requested twice */
+    for(c = 0; c <= MULTI_NCHUNKS; c++) {
+        int chunk = (c * 7) % MULTI_NCHUNKS;
+
+        offsets[c][0] = (hsize_t)(chunk / (NY / CHUNK_NY) * CHUNK_NX);
+        offsets[c][1] = (hsize_t)(chunk % (NY / CHUNK_NY) * CHUNK_NY);
+        offset_ptrs[c] = offsets[c];
+        read_bufs[c] = read_chunks[c];
+    }
+    HDmemset(read_chunks, 0, sizeof(read_chunks));
+    if(H5Dread_chunks(dataset, H5P_DEFAULT, MULTI_NCHUNKS + 1, offset_ptrs, filters, read_bufs) < 0)
+        goto error;
+    for(c = 0; c <= MULTI_NCHUNKS; c++) {
+        int chunk = (c * 7) % MULTI_NCHUNKS;
+
+        if(filters[c] != file_filters[chunk] || HDmemcmp(read_chunks[c], file_chunks[chunk], chunk_nbytes)) {
+            HDprintf("\n    Read different chunk than written: %d\n", chunk);
+            goto error;
+        }
+    }
+
+    /* Read a single chunk */
+    offsets[0][0] = CHUNK_NX;
+    offsets[0][1] = 2 * CHUNK_NY;
+    if(H5Dread_chunks(dataset, H5P_DEFAULT, 1, offset_ptrs, filters, read_bufs) < 0)
+        goto error;
+    c = (NY / CHUNK_NY) + 2;
+    if(filters[0] != file_filters[c] || HDmemcmp(read_chunks[0], file_chunks[c], chunk_nbytes))
+        goto error;
+
+    /* Overwrite some of the chunks */
+    for(c = 0; c < 4; c++) {
+        for(i = 0; i < CHUNK_NX; i++)
+            for(j = 0; j < CHUNK_NY; j++)
+                chunks[c * 5][i][j] = -chunks[c * 5][i][j];
+        file_filters[c * 5] = multi_store_chunk(c * 5, &chunks[c * 5][0][0], file_chunks[c * 5]);
+        offsets[c][0] = (hsize_t)((c * 5) / (NY / CHUNK_NY) * CHUNK_NX);
+        offsets[c][1] = (hsize_t)((c * 5) % (NY / CHUNK_NY) * CHUNK_NY);
+        filters[c] = file_filters[c * 5];
+        sizes[c] = chunk_nbytes;
+        write_bufs[c] = file_chunks[c * 5];
+    }
+    if(H5Dwrite_chunks(dataset, H5P_DEFAULT, 4, filters, offset_ptrs, sizes, write_bufs) < 0)
+        goto error;
+    if(H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) < 0)
+        goto error;
+    for(i = 0; i < NX; i++)
+        for(j = 0; j < NY; j++) {
+            c = (i / CHUNK_NX) * (NY / CHUNK_NY) + (j / CHUNK_NY);
+            if(data[i][j] != chunks[c][i % CHUNK_NX][j % CHUNK_NY]) {
+                HDprintf("\n    Read different values than written at index %d,%d\n", i, j);
+                goto error;
+            }
+        }
+
+    /* Writing nothing is allowed */
+    if(H5Dwrite_chunks(dataset, H5P_DEFAULT, 0, NULL, NULL, NULL, NULL) < 0)
+        goto error;
+    if(H5Dread_chunks(dataset, H5P_DEFAULT, 0, NULL, NULL, NULL) < 0)
+        goto error;
+
+    /* Writing a chunk twice in one call isn't */
+    offsets[1][0] = offsets[0][0];
+    offsets[1][1] = offsets[0][1];
+    H5E_BEGIN_TRY {
+        status = H5Dwrite_chunks(dataset, H5P_DEFAULT, 2, filters, offset_ptrs, sizes, write_bufs);
+    } H5E_END_TRY;
+    if(status >= 0)
+        goto error;
+
+    /* Nor are offsets that aren't on chunk boundaries */
+    offsets[1][1] = 1;
+    H5E_BEGIN_TRY {
+        status = H5Dread_chunks(dataset, H5P_DEFAULT, 2, offset_ptrs, filters, read_bufs);
+    } H5E_END_TRY;
+    if(status >= 0)
+        goto error;
+    H5E_BEGIN_TRY {
+        status = H5Dwrite_chunks(dataset, H5P_DEFAULT, 2, filters, offset_ptrs, sizes, write_bufs);
+    } H5E_END_TRY;
+    if(status >= 0)
+        goto error;
+
+    /* Close/release resources. */
+    if(H5Dclose(dataset) < 0)
+        goto error;
+    if(H5Sclose(mem_space) < 0)
+        goto error;
+    if(H5Sclose(dataspace) < 0)
+        goto error;
+    if(H5Pclose(cparms) < 0)
+        goto error;
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dataset);
+        H5Sclose(mem_space);
+        H5Sclose(dataspace);
+        H5Pclose(cparms);
+    } H5E_END_TRY;
+
+    H5_FAILED();
+    return 1;
+} /* test_direct_chunk_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_single_chunk
  *
@@ -2183,6 +2418,10 @@ int main( void )
     nerrors += test_read_unfiltered_dset(file_id);
     nerrors += test_read_unallocated_chunk(file_id);
 
+    /* Test direct chunk write and read of several chunks at once */
+    nerrors += test_direct_chunk_multi(file_id, FALSE);
+    nerrors += test_direct_chunk_multi(file_id, TRUE);
+
     /* Loop over test configurations */
     for(config = 0; config < CONFIG_END; config++) {
         hbool_t need_comma = FALSE;
@@ -83,6 +83,12 @@ const char *FILENAME[] = {
     "dls_01_strings",   /* 23 */
     "power2up",         /* 24 */
     "version_bounds",   /* 25 */
+    "filter_nthreads",  /* 26 */
+    "chunk_prefetch",   /* 27 */
+    "shared_chunk_cache", /* 28 */
+    "chunk_cache_policy", /* 29 */
+    "shuffle_sizes",    /* 30 */
+    "bitshuffle_format", /* 31 */
     NULL
 };
 
@@ -104,6 +110,8 @@ const char *FILENAME[] = {
 #define DSET_COMPACT_MAX2_NAME      "max_compact_2"
 #define DSET_CONV_BUF_NAME          "conv_buf"
 #define DSET_TCONV_NAME             "tconv"
+#define DSET_TCONV_SEL_NAME         "tconv_select"
+#define DSET_TCONV_NTHREADS_NAME    "tconv_nthreads"
 #define DSET_DEFLATE_NAME           "deflate"
 #define DSET_SHUFFLE_NAME           "shuffle"
 #define DSET_FLETCHER32_NAME        "fletcher32"
@@ -111,6 +119,16 @@ const char *FILENAME[] = {
 #define DSET_FLETCHER32_NAME_3      "fletcher32_3"
 #define DSET_SHUF_DEF_FLET_NAME     "shuffle+deflate+fletcher32"
 #define DSET_SHUF_DEF_FLET_NAME_2   "shuffle+deflate+fletcher32_2"
+#define DSET_BITSHUFFLE_NAME        "bitshuffle"
+#ifdef H5_HAVE_FILTER_ZSTD
+#define DSET_ZSTD_NAME              "zstd"
+#define DSET_ZSTD_DICT_NAME         "zstd_dict"
+#define DSET_BITSHUF_ZSTD_NAME      "bitshuffle+zstd"
+#endif /* H5_HAVE_FILTER_ZSTD */
+#ifdef H5_HAVE_FILTER_LZ4
+#define DSET_LZ4_NAME               "lz4"
+#define DSET_BITSHUF_LZ4_NAME       "bitshuffle+lz4"
+#endif /* H5_HAVE_FILTER_LZ4 */
 #ifdef H5_HAVE_FILTER_SZIP
 #define DSET_SZIP_NAME              "szip"
 #define DSET_SHUF_SZIP_FLET_NAME    "shuffle+szip+fletcher32"
@@ -202,6 +220,11 @@ const char *FILENAME[] = {
 #define DIM2         5000  /* Dim. Size of data member # 2 */
 #define DIM3           10  /* Dim. Size of data member # 3 */
 
+/* Dimensions for conversion with selections test */
+#define TCONV_SEL_DIM0  101
+#define TCONV_SEL_DIM1  103
+#define TCONV_NTHREADS_NELMTS   ((1024 * 1024) + 3)
+
 /* Parameters for internal filter test */
 #define FILTER_CHUNK_DIM1       2
 #define FILTER_CHUNK_DIM2       25
@@ -1482,6 +1505,305 @@ error:
     return FAIL;
 } /* end test_tconv() */
 
+/*-------------------------------------------------------------------------
+ * Function:  test_tconv_select
+ *
+ * Purpose:   Test reading with atomic data type conversions that widen,
+ *            narrow or keep the size of the elements, from contiguous and
+ *            chunked datasets, into contiguous and strided memory
+ *            selections, with the default and a small type conversion
+ *            buffer.
+ *
+ * Return:    Success:    0
+ *            Failure:    -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_tconv_select(hid_t file)
+{
+    hsize_t         dims[2] = {TCONV_SEL_DIM0, TCONV_SEL_DIM1};
+    hsize_t         mem_dims[2] = {TCONV_SEL_DIM0, 2 * TCONV_SEL_DIM1};
+    hsize_t         chunk_dims[2] = {16, 16};
+    hsize_t         start[2] = {0, 1}, stride[2] = {1, 2};
+    const size_t    nelmts = TCONV_SEL_DIM0 * TCONV_SEL_DIM1;
+    double          *wbuf = NULL;               /* Values written */
+    unsigned char   *rbuf = NULL;               /* Values read */
+    hid_t           space = -1, mem_space = -1, dcpl = -1, dxpl = -1;
+    hid_t           dsets[2][2] = {{-1, -1}, {-1, -1}};  /* [layout][double/short] */
+    hid_t           mem_types[4];               /* Memory types to read with */
+    const unsigned  conv_dset[4] = {0, 0, 1, 1};/* Dataset read with each memory type */
+    char            name[32];
+    unsigned        layout, small_buf, strided, conv;
+    size_t          i, j, k;
+
+    TESTING("data type conversion with selections");
+
+    /* Same size, narrowing, and widening (twice) conversions */
+    mem_types[0] = H5T_NATIVE_DOUBLE;
+    mem_types[1] = H5T_NATIVE_FLOAT;
+    mem_types[2] = H5T_NATIVE_DOUBLE;
+    mem_types[3] = H5T_NATIVE_INT;
+
+    if(NULL == (wbuf = (double *)HDmalloc(nelmts * sizeof(double))))
+        TEST_ERROR
+    if(NULL == (rbuf = (unsigned char *)HDmalloc(2 * nelmts * sizeof(double))))
+        TEST_ERROR
+
+    if((space = H5Screate_simple(2, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((mem_space = H5Screate_simple(2, mem_dims, NULL)) < 0) FAIL_STACK_ERROR
+    if(H5Sselect_hyperslab(mem_space, H5S_SELECT_SET, start, stride, dims, NULL) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_buffer(dxpl, (size_t)1000, NULL, NULL) < 0) FAIL_STACK_ERROR
+
+    /* Create big-endian double and short datasets, contiguous and chunked */
+    for(layout = 0; layout < 2; layout++) {
+        HDsnprintf(name, sizeof(name), "%s_%u_double", DSET_TCONV_SEL_NAME, layout);
+        if((dsets[layout][0] = H5Dcreate2(file, name, H5T_IEEE_F64BE, space,
+                H5P_DEFAULT, layout ? dcpl : H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        HDsnprintf(name, sizeof(name), "%s_%u_short", DSET_TCONV_SEL_NAME, layout);
+        if((dsets[layout][1] = H5Dcreate2(file, name, H5T_STD_I16BE, space,
+                H5P_DEFAULT, layout ? dcpl : H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+
+        for(k = 0; k < nelmts; k++)
+            wbuf[k] = (double)((long)k - 5000) + 0.25;
+        if(H5Dwrite(dsets[layout][0], H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+            FAIL_STACK_ERROR
+        for(k = 0; k < nelmts; k++)
+            wbuf[k] = (double)((long)k - 5000);
+        if(H5Dwrite(dsets[layout][1], H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    for(layout = 0; layout < 2; layout++)
+        for(small_buf = 0; small_buf < 2; small_buf++)
+            for(strided = 0; strided < 2; strided++)
+                for(conv = 0; conv < NELMTS(mem_types); conv++) {
+                    size_t elmt_size = H5Tget_size(mem_types[conv]);
+                    size_t row = strided ? 2 * TCONV_SEL_DIM1 : TCONV_SEL_DIM1;
+
+                    HDmemset(rbuf, 0xff, 2 * nelmts * sizeof(double));
+                    if(H5Dread(dsets[layout][conv_dset[conv]], mem_types[conv],
+                            strided ? mem_space : H5S_ALL, H5S_ALL,
+                            small_buf ? dxpl : H5P_DEFAULT, rbuf) < 0)
+                        FAIL_STACK_ERROR
+
+                    for(i = 0; i < TCONV_SEL_DIM0; i++)
+                        for(j = 0; j < row; j++) {
+                            const unsigned char *p = rbuf + (i * row + j) * elmt_size;
+                            double expect, value;
+
+                            /* Elements outside the selection must be untouched */
+                            if(strided && (j % 2) == 0) {
+                                for(k = 0; k < elmt_size; k++)
+                                    if(p[k] != 0xff)
+                                        break;
+                                if(k == elmt_size)
+                                    continue;
+                                expect = 0.0;
+                                value = 1.0;
+                            } /* end if */
+                            else {
+                                k = i * TCONV_SEL_DIM1 + (strided ? j / 2 : j);
+                                expect = (double)((long)k - 5000) + (conv_dset[conv] ? 0.0 : 0.25);
+                                if(conv == 1)
+                                    value = (double)*(const float *)p;
+                                else if(conv == 3)
+                                    value = (double)*(const int *)p;
+                                else
+                                    value = *(const double *)p;
+                            } /* end else */
+
+                            if(!H5_DBL_ABS_EQUAL(value, expect)) {
+                                H5_FAILED();
+                                HDprintf("    layout %u, small buffer %u, strided %u, conversion %u: element [%lu][%lu] is %f, should be %f\n",
+                                        layout, small_buf, strided, conv, (unsigned long)i,
+                                        (unsigned long)j, value, expect);
+                                goto error;
+                            } /* end if */
+                        } /* end for */
+                } /* end for */
+
+    for(layout = 0; layout < 2; layout++)
+        for(k = 0; k < 2; k++)
+            if(H5Dclose(dsets[layout][k]) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dxpl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(mem_space) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(space) < 0) FAIL_STACK_ERROR
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        for(layout = 0; layout < 2; layout++)
+            for(k = 0; k < 2; k++)
+                H5Dclose(dsets[layout][k]);
+        H5Pclose(dxpl);
+        H5Pclose(dcpl);
+        H5Sclose(mem_space);
+        H5Sclose(space);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+
+    return FAIL;
+} /* end test_tconv_select() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_tconv_nthreads
+ *
+ * Purpose:     Tests datatype conversions split across threads with
+ *              H5Pset_conv_nthreads, for same size, narrowing and
+ *              widening conversions, on reads and writes, with and
+ *              without a data transform.
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_tconv_nthreads(hid_t file)
+{
+    hsize_t         dims[1] = {TCONV_NTHREADS_NELMTS};
+    const size_t    nelmts = TCONV_NTHREADS_NELMTS;
+    double          *dbuf = NULL;
+    float           *fbuf = NULL;
+    int             *ibuf = NULL;
+    hid_t           space = -1, dxpl = -1, dxpl_xform = -1;
+    hid_t           dset_double = -1, dset_short = -1;
+    unsigned        nthreads;
+    herr_t          ret;
+    size_t          k;
+
+    TESTING("data type conversion with several threads");
+
+    if(NULL == (dbuf = (double *)HDmalloc(nelmts * sizeof(double))))
+        TEST_ERROR
+    if(NULL == (fbuf = (float *)HDmalloc(nelmts * sizeof(float))))
+        TEST_ERROR
+    if(NULL == (ibuf = (int *)HDmalloc(nelmts * sizeof(int))))
+        TEST_ERROR
+
+    /* Check the property */
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_conv_nthreads(dxpl, &nthreads) < 0) FAIL_STACK_ERROR
+    if(nthreads != 1) TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Pset_conv_nthreads(dxpl, 0);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    if(H5Pset_conv_nthreads(dxpl, 4) < 0) FAIL_STACK_ERROR
+    if(H5Pget_conv_nthreads(dxpl, &nthreads) < 0) FAIL_STACK_ERROR
+    if(nthreads != 4) TEST_ERROR
+
+    /* Convert the whole selection at once */
+    if(H5Pset_buffer(dxpl, nelmts * sizeof(double), NULL, NULL) < 0) FAIL_STACK_ERROR
+    if((dxpl_xform = H5Pcopy(dxpl)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_data_transform(dxpl_xform, "x+1") < 0) FAIL_STACK_ERROR
+
+    if((space = H5Screate_simple(1, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((dset_double = H5Dcreate2(file, DSET_TCONV_NTHREADS_NAME "_double", H5T_IEEE_F64BE, space,
+            H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if((dset_short = H5Dcreate2(file, DSET_TCONV_NTHREADS_NAME "_short", H5T_STD_I16BE, space,
+            H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Same size and narrowing conversions when writing */
+    for(k = 0; k < nelmts; k++) {
+        dbuf[k] = (double)k + 0.5;
+        ibuf[k] = (int)(k % 60000) - 30000;
+    } /* end for */
+    if(H5Dwrite(dset_double, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, dxpl, dbuf) < 0)
+        FAIL_STACK_ERROR
+    if(H5Dwrite(dset_short, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, ibuf) < 0)
+        FAIL_STACK_ERROR
+
+    /* Same size conversion when reading */
+    HDmemset(dbuf, 0, nelmts * sizeof(double));
+    if(H5Dread(dset_double, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, dxpl, dbuf) < 0)
+        FAIL_STACK_ERROR
+    for(k = 0; k < nelmts; k++)
+        if(!H5_DBL_ABS_EQUAL(dbuf[k], (double)k + 0.5)) {
+            H5_FAILED();
+            HDprintf("    double element %lu is %f\n", (unsigned long)k, dbuf[k]);
+            goto error;
+        } /* end if */
+
+    /* Narrowing conversion when reading */
+    HDmemset(fbuf, 0, nelmts * sizeof(float));
+    if(H5Dread(dset_double, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, dxpl, fbuf) < 0)
+        FAIL_STACK_ERROR
+    for(k = 0; k < nelmts; k++)
+        if(!H5_FLT_ABS_EQUAL(fbuf[k], (float)((double)k + 0.5))) {
+            H5_FAILED();
+            HDprintf("    float element %lu is %f\n", (unsigned long)k, (double)fbuf[k]);
+            goto error;
+        } /* end if */
+
+    /* Widening conversion when reading */
+    HDmemset(dbuf, 0, nelmts * sizeof(double));
+    if(H5Dread(dset_short, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, dxpl, dbuf) < 0)
+        FAIL_STACK_ERROR
+    for(k = 0; k < nelmts; k++)
+        if(!H5_DBL_ABS_EQUAL(dbuf[k], (double)((int)(k % 60000) - 30000))) {
+            H5_FAILED();
+            HDprintf("    short element %lu is %f\n", (unsigned long)k, dbuf[k]);
+            goto error;
+        } /* end if */
+
+    /* Widening conversion followed by a data transform */
+    HDmemset(ibuf, 0, nelmts * sizeof(int));
+    if(H5Dread(dset_short, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl_xform, ibuf) < 0)
+        FAIL_STACK_ERROR
+    for(k = 0; k < nelmts; k++)
+        if(ibuf[k] != (int)(k % 60000) - 29999) {
+            H5_FAILED();
+            HDprintf("    transformed element %lu is %d\n", (unsigned long)k, ibuf[k]);
+            goto error;
+        } /* end if */
+
+    if(H5Dclose(dset_double) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(dset_short) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(space) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dxpl_xform) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dxpl) < 0) FAIL_STACK_ERROR
+    HDfree(dbuf);
+    HDfree(fbuf);
+    HDfree(ibuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset_double);
+        H5Dclose(dset_short);
+        H5Sclose(space);
+        H5Pclose(dxpl_xform);
+        H5Pclose(dxpl);
+    } H5E_END_TRY;
+    if(dbuf)
+        HDfree(dbuf);
+    if(fbuf)
+        HDfree(fbuf);
+    if(ibuf)
+        HDfree(ibuf);
+
+    return FAIL;
+} /* end test_tconv_nthreads() */
+
 /* This message derives from H5Z */
 const H5Z_class2_t H5Z_BOGUS[1] = {{
     H5Z_CLASS_T_VERS,       /* H5Z_class_t version */
@@ -2330,6 +2652,18 @@ H5_ATTR_UNUSED
 #endif /* H5_HAVE_FILTER_SZIP */
 
     hsize_t     shuffle_size;       /* Size of dataset with shuffle filter */
+    hsize_t     bitshuffle_size;    /* Size of dataset with bitshuffle filter */
+
+#ifdef H5_HAVE_FILTER_ZSTD
+    hsize_t     zstd_size;          /* Size of dataset with zstd filter */
+    unsigned char zstd_dict[1024];  /* Zstandard dictionary */
+    size_t      u;                  /* Local index variable */
+    herr_t      ret;                /* Generic return value */
+#endif /* H5_HAVE_FILTER_ZSTD */
+
+#ifdef H5_HAVE_FILTER_LZ4
+    hsize_t     lz4_size;           /* Size of dataset with lz4 filter */
+#endif /* H5_HAVE_FILTER_LZ4 */
 
 #if defined(H5_HAVE_FILTER_DEFLATE) || defined(H5_HAVE_FILTER_SZIP)
     hsize_t     combo_size;         /* Size of dataset with multiple filters */
@@ -2471,6 +2805,112 @@ H5_ATTR_UNUSED
     /* Clean up objects used for this test */
     if(H5Pclose (dc) < 0) goto error;
 
+    /*----------------------------------------------------------
+     * STEP 4a: Test bit-shuffling by itself.
+     *----------------------------------------------------------
+     */
+    HDputs("Testing bitshuffle filter");
+    if((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0) goto error;
+    if(H5Pset_chunk (dc, 2, chunk_size) < 0) goto error;
+    if(H5Pset_bitshuffle (dc, 0, H5Z_BITSHUFFLE_COMP_NONE) < 0) goto error;
+
+    if(test_filter_internal(file,DSET_BITSHUFFLE_NAME,dc,DISABLE_FLETCHER32,DATA_NOT_CORRUPTED,&bitshuffle_size) < 0) goto error;
+    if(bitshuffle_size!=null_size) {
+        H5_FAILED();
+        HDputs("    Bit-shuffled size not the same as uncompressed size.");
+        goto error;
+    } /* end if */
+
+    /* Clean up objects used for this test */
+    if(H5Pclose (dc) < 0) goto error;
+
+    /*----------------------------------------------------------
+     * STEP 4b: Test Zstandard compression, with and without a
+     *          dictionary and after bitshuffle.
+     *----------------------------------------------------------
+     */
+#ifdef H5_HAVE_FILTER_ZSTD
+    HDputs("Testing zstd filter");
+    if((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0) goto error;
+    if(H5Pset_chunk (dc, 2, chunk_size) < 0) goto error;
+    if(H5Pset_zstd (dc, 9) < 0) goto error;
+
+    if(test_filter_internal(file,DSET_ZSTD_NAME,dc,DISABLE_FLETCHER32,DATA_NOT_CORRUPTED,&zstd_size) < 0) goto error;
+
+    /* Clean up objects used for this test */
+    if(H5Pclose (dc) < 0) goto error;
+
+    HDputs("Testing zstd filter with a dictionary");
+    if((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0) goto error;
+    if(H5Pset_chunk (dc, 2, chunk_size) < 0) goto error;
+
+    /* A "raw content" dictionary, which looks like the data */
+    for(u = 0; u < sizeof(zstd_dict); u++)
+        zstd_dict[u] = (unsigned char)((u % 4) == 0 ? u / 4 : 0);
+
+    /* Check that invalid dictionaries are rejected */
+    H5E_BEGIN_TRY {
+        ret = H5Pset_zstd_dict(dc, 3, NULL, sizeof(zstd_dict));
+    } H5E_END_TRY;
+    if(ret >= 0) goto error;
+    H5E_BEGIN_TRY {
+        ret = H5Pset_zstd_dict(dc, 3, zstd_dict, (size_t)H5Z_ZSTD_MAX_DICT_SIZE + 1);
+    } H5E_END_TRY;
+    if(ret >= 0) goto error;
+
+    if(H5Pset_zstd_dict (dc, 3, zstd_dict, sizeof(zstd_dict)) < 0) goto error;
+
+    if(test_filter_internal(file,DSET_ZSTD_DICT_NAME,dc,DISABLE_FLETCHER32,DATA_NOT_CORRUPTED,&zstd_size) < 0) goto error;
+
+    /* Clean up objects used for this test */
+    if(H5Pclose (dc) < 0) goto error;
+
+    HDputs("Testing bitshuffle+zstd filter");
+    if((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0) goto error;
+    if(H5Pset_chunk (dc, 2, chunk_size) < 0) goto error;
+    if(H5Pset_bitshuffle (dc, 0, H5Z_BITSHUFFLE_COMP_ZSTD) < 0) goto error;
+
+    if(test_filter_internal(file,DSET_BITSHUF_ZSTD_NAME,dc,DISABLE_FLETCHER32,DATA_NOT_CORRUPTED,&zstd_size) < 0) goto error;
+
+    /* Clean up objects used for this test */
+    if(H5Pclose (dc) < 0) goto error;
+#else /* H5_HAVE_FILTER_ZSTD */
+    TESTING("zstd filter");
+    SKIPPED();
+    HDputs("    Zstd filter not enabled");
+#endif /* H5_HAVE_FILTER_ZSTD */
+
+    /*----------------------------------------------------------
+     * STEP 4c: Test LZ4 compression, by itself and after
+     *          bitshuffle.
+     *----------------------------------------------------------
+     */
+#ifdef H5_HAVE_FILTER_LZ4
+    HDputs("Testing lz4 filter");
+    if((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0) goto error;
+    if(H5Pset_chunk (dc, 2, chunk_size) < 0) goto error;
+    if(H5Pset_lz4 (dc, 1024) < 0) goto error;
+
+    if(test_filter_internal(file,DSET_LZ4_NAME,dc,DISABLE_FLETCHER32,DATA_NOT_CORRUPTED,&lz4_size) < 0) goto error;
+
+    /* Clean up objects used for this test */
+    if(H5Pclose (dc) < 0) goto error;
+
+    HDputs("Testing bitshuffle+lz4 filter");
+    if((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0) goto error;
+    if(H5Pset_chunk (dc, 2, chunk_size) < 0) goto error;
+    if(H5Pset_bitshuffle (dc, 64, H5Z_BITSHUFFLE_COMP_LZ4) < 0) goto error;
+
+    if(test_filter_internal(file,DSET_BITSHUF_LZ4_NAME,dc,DISABLE_FLETCHER32,DATA_NOT_CORRUPTED,&lz4_size) < 0) goto error;
+
+    /* Clean up objects used for this test */
+    if(H5Pclose (dc) < 0) goto error;
+#else /* H5_HAVE_FILTER_LZ4 */
+    TESTING("lz4 filter");
+    SKIPPED();
+    HDputs("    LZ4 filter not enabled");
+#endif /* H5_HAVE_FILTER_LZ4 */
+
     /*----------------------------------------------------------
      * STEP 5: Test shuffle + deflate + checksum in any order.
      *----------------------------------------------------------
@@ -2912,91 +3352,368 @@ error:
 
 
 /*-------------------------------------------------------------------------
- * Function:    test_nbit_int
+ * Function:  test_shuffle_sizes
  *
- * Purpose:     Tests the integer datatype for nbit filter
+ * Purpose:   Tests the shuffle filter with every element size up to 16
+ *            bytes (and 32 bytes) and with every number of elements up to
+ *            two blocks of the widest SIMD kernel, so that all the tails
+ *            left over for the scalar code are covered.  The filtered
+ *            chunk is read with H5Dread_chunk and compared against the
+ *            byte-by-byte shuffle, to check that the on-disk format does
+ *            not depend on the code that shuffled the data.
  *
- * Return:      Success:        0
- *              Failure:        -1
+ * Return:    Success:    0
+ *            Failure:    -1
  *-------------------------------------------------------------------------
  */
+#define SHUF_SIZES_MAX_SIZE     32
+#define SHUF_SIZES_MAX_NELMTS   128
 static herr_t
-test_nbit_int(hid_t file)
+test_shuffle_sizes(hid_t fapl)
 {
-    hid_t               dataset, datatype, mem_datatype, space, dc;
-    hsize_t             size[2] = {2, 5};
-    hsize_t             chunk_size[2] = {2,5};
-    int                 orig_data[2][5];
-    int                 new_data[2][5];
-    unsigned int        mask;
-    size_t              precision, offset;
-    double              power;
-    size_t              i, j;
-
-    HDputs("Testing nbit filter");
-    TESTING("    nbit int (setup)");
-
-    /* Define dataset datatype (integer), and set precision, offset */
-    datatype = H5Tcopy(H5T_NATIVE_INT);
-    precision = 17; /* precision includes sign bit */
-    if(H5Tset_precision(datatype,precision) < 0) goto error;
-    offset = 4;
-    if(H5Tset_offset(datatype,offset) < 0) goto error;
-
-    /* Copy to memory datatype before setting order */
-    mem_datatype = H5Tcopy(datatype);
+    char            filename[FILENAME_BUF_SIZE];
+    char            dset_name[32];
+    hid_t           file = -1, dataset = -1, space = -1, dc = -1, type = -1;
+    hsize_t         size;
+    hsize_t         offset = 0;
+    uint32_t        filter_mask;
+    unsigned char   *orig_data = NULL;
+    unsigned char   *shuf_data = NULL;
+    unsigned char   *new_data = NULL;
+    size_t          elmt_size, nelmts;
+    size_t          i, j;
+
+    TESTING("shuffling for all element sizes and tails");
+
+    h5_fixname(FILENAME[30], fapl, filename, sizeof filename);
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) TEST_ERROR
+
+    if(NULL == (orig_data = (unsigned char *)HDmalloc(SHUF_SIZES_MAX_SIZE * SHUF_SIZES_MAX_NELMTS))) TEST_ERROR
+    if(NULL == (shuf_data = (unsigned char *)HDmalloc(SHUF_SIZES_MAX_SIZE * SHUF_SIZES_MAX_NELMTS))) TEST_ERROR
+    if(NULL == (new_data = (unsigned char *)HDmalloc(SHUF_SIZES_MAX_SIZE * SHUF_SIZES_MAX_NELMTS))) TEST_ERROR
+    for(i = 0; i < SHUF_SIZES_MAX_SIZE * SHUF_SIZES_MAX_NELMTS; i++)
+        orig_data[i] = (unsigned char)HDrandom();
+
+    for(elmt_size = 1; elmt_size <= SHUF_SIZES_MAX_SIZE; elmt_size++) {
+        /* Element sizes of 17 to 31 bytes don't add anything */
+        if(elmt_size > 16 && elmt_size < SHUF_SIZES_MAX_SIZE)
+            continue;
 
-    /* Set order of dataset datatype */
-    if(H5Tset_order(datatype, H5T_ORDER_BE) < 0) goto error;
+        if((type = H5Tcreate(H5T_OPAQUE, elmt_size)) < 0) TEST_ERROR
+        if(H5Tset_tag(type, "shuffle test") < 0) TEST_ERROR
+
+        for(nelmts = 1; nelmts <= SHUF_SIZES_MAX_NELMTS; nelmts++) {
+            size = (hsize_t)nelmts;
+            if((space = H5Screate_simple(1, &size, NULL)) < 0) TEST_ERROR
+            if((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0) TEST_ERROR
+            if(H5Pset_chunk(dc, 1, &size) < 0) TEST_ERROR
+            if(H5Pset_shuffle(dc) < 0) TEST_ERROR
+
+            HDsnprintf(dset_name, sizeof(dset_name), "shuffle_%u_%u", (unsigned)elmt_size, (unsigned)nelmts);
+            if((dataset = H5Dcreate2(file, dset_name, type, space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0) TEST_ERROR
+            if(H5Dwrite(dataset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0) TEST_ERROR
+
+            /* Check the shuffled chunk */
+            if(H5Dread_chunk(dataset, H5P_DEFAULT, &offset, &filter_mask, shuf_data) < 0) TEST_ERROR
+            if(filter_mask != 0) TEST_ERROR
+            for(i = 0; i < nelmts; i++)
+                for(j = 0; j < elmt_size; j++)
+                    if(shuf_data[(j * nelmts) + i] != orig_data[(i * elmt_size) + j]) {
+                        H5_FAILED();
+                        HDprintf("    Wrong shuffled byte for %u byte elements, %u elements\n",
+                            (unsigned)elmt_size, (unsigned)nelmts);
+                        HDprintf("    At element %u, byte %u\n", (unsigned)i, (unsigned)j);
+                        goto error;
+                    } /* end if */
 
-    /* Create the data space */
-    if((space = H5Screate_simple(2, size, NULL)) < 0) goto error;
+            /* Check that unshuffling restores the data */
+            if(H5Dread(dataset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0) TEST_ERROR
+            if(HDmemcmp(new_data, orig_data, elmt_size * nelmts) != 0) {
+                H5_FAILED();
+                HDprintf("    Read different values than written for %u byte elements, %u elements\n",
+                    (unsigned)elmt_size, (unsigned)nelmts);
+                goto error;
+            } /* end if */
 
-    /* Use nbit filter  */
-    if((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0) goto error;
-    if(H5Pset_chunk(dc, 2, chunk_size) < 0) goto error;
-    if(H5Pset_nbit(dc) < 0) goto error;
+            if(H5Dclose(dataset) < 0) TEST_ERROR
+            if(H5Pclose(dc) < 0) TEST_ERROR
+            if(H5Sclose(space) < 0) TEST_ERROR
+        } /* end for */
 
-    /* Create the dataset */
-    if((dataset = H5Dcreate2(file, DSET_NBIT_INT_NAME, datatype,
-                             space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0) goto error;
+        if(H5Tclose(type) < 0) TEST_ERROR
+    } /* end for */
 
-    /* Initialize data, assuming size of long long >= size of int */
-    for(i= 0;i< (size_t)size[0]; i++)
-        for(j = 0; j < (size_t)size[1]; j++) {
-            power = HDpow(2.0f, (double)(precision - 1));
-            orig_data[i][j] = (int)(((long long)HDrandom() % (long long)power) << offset);
+    if(H5Fclose(file) < 0) TEST_ERROR
 
-            /* even-numbered values are negtive */
-            if((i*size[1]+j+1)%2 == 0)
-                orig_data[i][j] = -orig_data[i][j];
-        }
+    HDfree(orig_data);
+    HDfree(shuf_data);
+    HDfree(new_data);
 
     PASSED();
 
-    /*----------------------------------------------------------------------
-     * STEP 1: Test nbit by setting up a chunked dataset and writing
-     * to it.
-     *----------------------------------------------------------------------
-     */
-    TESTING("    nbit int (write)");
+    return SUCCEED;
 
-    if(H5Dwrite(dataset, mem_datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
-        goto error;
-    PASSED();
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dataset);
+        H5Pclose(dc);
+        H5Sclose(space);
+        H5Tclose(type);
+        H5Fclose(file);
+    } H5E_END_TRY;
+    HDfree(orig_data);
+    HDfree(shuf_data);
+    HDfree(new_data);
 
-    /*----------------------------------------------------------------------
-     * STEP 2: Try to read the data we just wrote.
-     *----------------------------------------------------------------------
-     */
-    TESTING("    nbit int (read)");
+    return FAIL;
+} /* end test_shuffle_sizes() */
 
-    /* Read the dataset back */
-    if(H5Dread(dataset, mem_datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
-        goto error;
 
-    /* Check that the values read are the same as the values written
-     * Use mask for checking the significant bits, ignoring the padding bits
+/*-------------------------------------------------------------------------
+ * Function:  test_bitshuffle_format
+ *
+ * Purpose:   Tests that the bitshuffle filter stores data in the format of
+ *            the bitshuffle filter plugin, for a few element sizes, block
+ *            sizes and numbers of elements (including blocks cut down to
+ *            a multiple of 8 elements and elements left over after the
+ *            last block).  The filtered chunk is read with H5Dread_chunk
+ *            and compared against a bit-by-bit transpose of the data.
+ *
+ * Return:    Success:    0
+ *            Failure:    -1
+ *-------------------------------------------------------------------------
+ */
+#define BITSHUF_MAX_SIZE        16
+#define BITSHUF_MAX_NELMTS      1100
+static herr_t
+test_bitshuffle_format(hid_t fapl)
+{
+    const size_t    elmt_sizes[] = {1, 2, 3, 4, 8, 16};
+    const size_t    nelmts_list[] = {1, 7, 8, 9, 64, 100, 300, BITSHUF_MAX_NELMTS};
+    const unsigned  block_sizes[] = {0, 16, 136};
+    char            filename[FILENAME_BUF_SIZE];
+    char            dset_name[64];
+    hid_t           file = -1, dataset = -1, space = -1, dc = -1, type = -1;
+    hsize_t         size;
+    hsize_t         offset = 0;
+    uint32_t        filter_mask;
+    unsigned char   *orig_data = NULL;
+    unsigned char   *shuf_data = NULL;
+    unsigned char   *ref_data = NULL;
+    unsigned char   *new_data = NULL;
+    size_t          elmt_size, nelmts, block_nelmts;
+    size_t          start, n, pos;
+    size_t          i, j, k, l, m, b;
+    herr_t          ret;
+
+    TESTING("bitshuffle filter format");
+
+    h5_fixname(FILENAME[31], fapl, filename, sizeof filename);
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) TEST_ERROR
+
+    /* Check that invalid parameters are rejected */
+    if((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Pset_bitshuffle(dc, 12, H5Z_BITSHUFFLE_COMP_NONE);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Pset_bitshuffle(dc, 0, 1);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    if(H5Pclose(dc) < 0) TEST_ERROR
+
+    if(NULL == (orig_data = (unsigned char *)HDmalloc(BITSHUF_MAX_SIZE * BITSHUF_MAX_NELMTS))) TEST_ERROR
+    if(NULL == (shuf_data = (unsigned char *)HDmalloc(BITSHUF_MAX_SIZE * BITSHUF_MAX_NELMTS))) TEST_ERROR
+    if(NULL == (ref_data = (unsigned char *)HDmalloc(BITSHUF_MAX_SIZE * BITSHUF_MAX_NELMTS))) TEST_ERROR
+    if(NULL == (new_data = (unsigned char *)HDmalloc(BITSHUF_MAX_SIZE * BITSHUF_MAX_NELMTS))) TEST_ERROR
+    for(i = 0; i < BITSHUF_MAX_SIZE * BITSHUF_MAX_NELMTS; i++)
+        orig_data[i] = (unsigned char)HDrandom();
+
+    for(k = 0; k < NELMTS(elmt_sizes); k++) {
+        elmt_size = elmt_sizes[k];
+        if((type = H5Tcreate(H5T_OPAQUE, elmt_size)) < 0) TEST_ERROR
+        if(H5Tset_tag(type, "bitshuffle test") < 0) TEST_ERROR
+
+        for(l = 0; l < NELMTS(block_sizes); l++) {
+            /* The default block size is about 8 KiB */
+            if(block_sizes[l] > 0)
+                block_nelmts = block_sizes[l];
+            else
+                block_nelmts = MAX(((8192 / elmt_size) / 8) * 8, 128);
+
+            for(m = 0; m < NELMTS(nelmts_list); m++) {
+                nelmts = nelmts_list[m];
+                size = (hsize_t)nelmts;
+                if((space = H5Screate_simple(1, &size, NULL)) < 0) TEST_ERROR
+                if((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0) TEST_ERROR
+                if(H5Pset_chunk(dc, 1, &size) < 0) TEST_ERROR
+                if(H5Pset_bitshuffle(dc, block_sizes[l], H5Z_BITSHUFFLE_COMP_NONE) < 0) TEST_ERROR
+
+                HDsnprintf(dset_name, sizeof(dset_name), "bitshuffle_%u_%u_%u", (unsigned)elmt_size, block_sizes[l], (unsigned)nelmts);
+                if((dataset = H5Dcreate2(file, dset_name, type, space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0) TEST_ERROR
+                if(H5Dwrite(dataset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0) TEST_ERROR
+
+                /* Bit-shuffle the data, a block at a time.  The last block
+                 * is cut down to a multiple of 8 elements and the elements
+                 * after that are stored as is. */
+                HDmemset(ref_data, 0, elmt_size * nelmts);
+                for(start = 0; start + 8 <= nelmts; start += block_nelmts) {
+                    n = MIN(block_nelmts, nelmts - start);
+                    n -= n % 8;
+                    for(i = 0; i < n; i++)
+                        for(j = 0; j < elmt_size; j++)
+                            for(b = 0; b < 8; b++)
+                                if(orig_data[((start + i) * elmt_size) + j] & (1 << b)) {
+                                    pos = (((j * 8) + b) * n) + i;
+                                    ref_data[(start * elmt_size) + (pos / 8)] |= (unsigned char)(1 << (pos % 8));
+                                } /* end if */
+                } /* end for */
+                n = (nelmts % 8) * elmt_size;
+                HDmemcpy(ref_data + (elmt_size * nelmts) - n, orig_data + (elmt_size * nelmts) - n, n);
+
+                /* Check the bit-shuffled chunk */
+                if(H5Dread_chunk(dataset, H5P_DEFAULT, &offset, &filter_mask, shuf_data) < 0) TEST_ERROR
+                if(filter_mask != 0) TEST_ERROR
+                if(HDmemcmp(shuf_data, ref_data, elmt_size * nelmts) != 0) {
+                    H5_FAILED();
+                    HDprintf("    Wrong bit-shuffled data for %u byte elements, block size %u, %u elements\n",
+                        (unsigned)elmt_size, block_sizes[l], (unsigned)nelmts);
+                    goto error;
+                } /* end if */
+
+                /* Check that unshuffling restores the data */
+                if(H5Dread(dataset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0) TEST_ERROR
+                if(HDmemcmp(new_data, orig_data, elmt_size * nelmts) != 0) {
+                    H5_FAILED();
+                    HDprintf("    Read different values than written for %u byte elements, block size %u, %u elements\n",
+                        (unsigned)elmt_size, block_sizes[l], (unsigned)nelmts);
+                    goto error;
+                } /* end if */
+
+                if(H5Dclose(dataset) < 0) TEST_ERROR
+                if(H5Pclose(dc) < 0) TEST_ERROR
+                if(H5Sclose(space) < 0) TEST_ERROR
+            } /* end for */
+        } /* end for */
+
+        if(H5Tclose(type) < 0) TEST_ERROR
+    } /* end for */
+
+    if(H5Fclose(file) < 0) TEST_ERROR
+
+    HDfree(orig_data);
+    HDfree(shuf_data);
+    HDfree(ref_data);
+    HDfree(new_data);
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dataset);
+        H5Pclose(dc);
+        H5Sclose(space);
+        H5Tclose(type);
+        H5Fclose(file);
+    } H5E_END_TRY;
+    HDfree(orig_data);
+    HDfree(shuf_data);
+    HDfree(ref_data);
+    HDfree(new_data);
+
+    return FAIL;
+} /* end test_bitshuffle_format() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_nbit_int
+ *
+ * Purpose:     Tests the integer datatype for nbit filter
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_nbit_int(hid_t file)
+{
+    hid_t               dataset, datatype, mem_datatype, space, dc;
+    hsize_t             size[2] = {2, 5};
+    hsize_t             chunk_size[2] = {2,5};
+    int                 orig_data[2][5];
+    int                 new_data[2][5];
+    unsigned int        mask;
+    size_t              precision, offset;
+    double              power;
+    size_t              i, j;
+
+    HDputs("Testing nbit filter");
+    TESTING("    nbit int (setup)");
+
+    /* Define dataset datatype (integer), and set precision, offset */
+    datatype = H5Tcopy(H5T_NATIVE_INT);
+    precision = 17; /* precision includes sign bit */
+    if(H5Tset_precision(datatype,precision) < 0) goto error;
+    offset = 4;
+    if(H5Tset_offset(datatype,offset) < 0) goto error;
+
+    /* Copy to memory datatype before setting order */
+    mem_datatype = H5Tcopy(datatype);
+
+    /* Set order of dataset datatype */
+    if(H5Tset_order(datatype, H5T_ORDER_BE) < 0) goto error;
+
+    /* Create the data space */
+    if((space = H5Screate_simple(2, size, NULL)) < 0) goto error;
+
+    /* Use nbit filter  */
+    if((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0) goto error;
+    if(H5Pset_chunk(dc, 2, chunk_size) < 0) goto error;
+    if(H5Pset_nbit(dc) < 0) goto error;
+
+    /* Create the dataset */
+    if((dataset = H5Dcreate2(file, DSET_NBIT_INT_NAME, datatype,
+                             space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0) goto error;
+
+    /* Initialize data, assuming size of long long >= size of int */
+    for(i= 0;i< (size_t)size[0]; i++)
+        for(j = 0; j < (size_t)size[1]; j++) {
+            power = HDpow(2.0f, (double)(precision - 1));
+            orig_data[i][j] = (int)(((long long)HDrandom() % (long long)power) << offset);
+
+            /* even-numbered values are negtive */
+            if((i*size[1]+j+1)%2 == 0)
+                orig_data[i][j] = -orig_data[i][j];
+        }
+
+    PASSED();
+
+    /*----------------------------------------------------------------------
+     * STEP 1: Test nbit by setting up a chunked dataset and writing
+     * to it.
+     *----------------------------------------------------------------------
+     */
+    TESTING("    nbit int (write)");
+
+    if(H5Dwrite(dataset, mem_datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
+        goto error;
+    PASSED();
+
+    /*----------------------------------------------------------------------
+     * STEP 2: Try to read the data we just wrote.
+     *----------------------------------------------------------------------
+     */
+    TESTING("    nbit int (read)");
+
+    /* Read the dataset back */
+    if(H5Dread(dataset, mem_datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
+        goto error;
+
+    /* Check that the values read are the same as the values written
+     * Use mask for checking the significant bits, ignoring the padding bits
      */
     mask = ~((unsigned)~0 << (precision + offset)) & ((unsigned)~0 << offset);
     for(i=0; i<(size_t)size[0]; i++) {
@@ -10249,250 +10966,1036 @@ test_single_chunk(hid_t fapl)
             /* Close everything */
             if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
 
-             /* Get the size of the file */
-            if((file_size = h5_get_file_size(filename, fapl)) < 0)
-                TEST_ERROR
+             /* Get the size of the file */
+            if((file_size = h5_get_file_size(filename, fapl)) < 0)
+                TEST_ERROR
+
+            /* Verify the file is correct size */
+            if(file_size != empty_size)
+                TEST_ERROR
+
+        } /* end for */
+#ifdef H5_HAVE_FILTER_DEFLATE
+    } /* end for */
+#endif /* H5_HAVE_FILTER_DEFLATE */
+
+
+    /* Release buffers */
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(t_wbuf);
+    HDfree(t_rbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dcpl);
+        H5Pclose(t_dcpl);
+        H5Dclose(did);
+        H5Dclose(did_max);
+        H5Sclose(sid);
+        H5Sclose(sid_max);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+    if(t_wbuf)
+        HDfree(t_wbuf);
+    if(t_rbuf)
+        HDfree(t_rbuf);
+    return FAIL;
+} /* end test_single_chunk() */
+
+
+/*-------------------------------------------------------------------------
+ *
+ *  test_idx_compatible():
+ *    Verify that the library can read datasets created with
+ *    1.6/1.8 library that use the B-tree indexing method.
+ *
+ *  Programmer: Vailin Choi; 26th August, 2009
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_idx_compatible(void)
+{
+    hid_t    fid = -1;        /* File id */
+    hid_t       did = -1;        /* Dataset id */
+    const char  *filename = NULL;  /* old test file name */
+    unsigned    j;              /* Local index variable */
+    H5D_chunk_index_t idx_type; /* Chunked dataset index type */
+
+    /* Output message about test being performed */
+    TESTING("compatibility for 1.6/1.8 datasets that use B-tree indexing");
+
+    for(j = 0; j < NELMTS(OLD_FILENAME); j++) {
+
+    /* Generate correct name for test file by prepending the source path */
+    filename = H5_get_srcdir_filename(OLD_FILENAME[j]);
+
+    /* Open the file */
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Should be able to read the dataset w/o filter created under 1.8/1.6 */
+    if((did = H5Dopen2(fid, DSET, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Get the chunk index type */
+    if(H5D__layout_idx_type_test(did, &idx_type) < 0) FAIL_STACK_ERROR
+
+    /* Verify index type */
+    if(idx_type != H5D_CHUNK_IDX_BTREE)
+        FAIL_PUTS_ERROR("should be using v1 B-tree as index")
+
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+
+    /* Should be able to read the dataset w/ filter created under 1.8/1.6 */
+    if((did = H5Dopen2(fid, DSET_FILTER, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Get the chunk index type */
+    if(H5D__layout_idx_type_test(did, &idx_type) < 0) FAIL_STACK_ERROR
+
+    /* Verify index type */
+    if(idx_type != H5D_CHUNK_IDX_BTREE)
+        FAIL_PUTS_ERROR("should be using v1 B-tree as index")
+
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+
+    /* Close the file */
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    }
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+    H5Fclose(fid);
+    } H5E_END_TRY;
+    return FAIL;
+} /* end test_idx_compatible() */
+
+/*-------------------------------------------------------------------------
+ *
+ *  test_unfiltered_edge_chunks():
+ *      Tests that partial edge chunks aren't filtered when the
+ *      H5D_CHUNK_FILTER_PARTIAL_CHUNKS option is set.
+ *
+ *  Programmer: Neil Fortner; 17th March, 2010
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_unfiltered_edge_chunks(hid_t fapl)
+{
+    hid_t       fid = -1;            /* File id */
+    hid_t       did = -1;            /* Dataset id */
+    hid_t       sid = -1;            /* Dataspace id */
+    hid_t       dcpl = -1;           /* DCPL id */
+    hsize_t     dim[2] = {4, 3}; /* Dataset dimensions */
+    hsize_t     cdim[2] = {2, 2}; /* Chunk dimension */
+    char        wbuf[4][3];     /* Write buffer */
+    char        rbuf[4][3];     /* Read buffer */
+    char        filename[FILENAME_BUF_SIZE] = "";  /* old test file name */
+    unsigned    opts;           /* Chunk options */
+    unsigned    i, j;           /* Local index variables */
+
+    /* Output message about test being performed */
+    TESTING("disabled partial chunk filters");
+
+    h5_fixname(FILENAME[14], fapl, filename, sizeof filename);
+
+    /* Create the file */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+
+    /* Register byte-counting filter */
+    if(H5Zregister(H5Z_COUNT) < 0)
+        TEST_ERROR
+
+    /* Create dataspace */
+    if((sid = H5Screate_simple(2, dim, NULL)) < 0)
+        TEST_ERROR
+
+    /* Create DCPL */
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+
+    /* Set chunk dimensions */
+    if(H5Pset_chunk(dcpl, 2, cdim) < 0)
+        TEST_ERROR
+
+    /* Add "count" filter */
+    if(H5Pset_filter(dcpl, H5Z_FILTER_COUNT, 0u, (size_t)0, NULL) < 0)
+        TEST_ERROR
+
+    /* Disable filters on partial chunks */
+    if(H5Pget_chunk_opts(dcpl, &opts) < 0)
+        TEST_ERROR
+    opts |= H5D_CHUNK_DONT_FILTER_PARTIAL_CHUNKS;
+    if(H5Pset_chunk_opts(dcpl, opts) < 0)
+        TEST_ERROR
+
+    /* Initialize write buffer */
+    for(i=0; i<dim[0]; i++)
+        for(j=0; j<dim[1]; j++)
+            wbuf[i][j] = (char)((2 * i) - j);
+
+    /* Reset byte counts */
+    count_nbytes_read = (size_t)0;
+    count_nbytes_written = (size_t)0;
+
+    /* Create dataset */
+    if((did = H5Dcreate2(fid, DSET_CHUNKED_NAME, H5T_NATIVE_CHAR, sid,
+            H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Nothing should have been written, as we are not using early allocation */
+    if(count_nbytes_read != (size_t)0)
+        TEST_ERROR
+    if(count_nbytes_written != (size_t)0)
+        TEST_ERROR
+
+    /* Write data */
+    if(H5Dwrite(did, H5T_NATIVE_CHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR
+
+    /* Close dataset */
+    if(H5Dclose(did) < 0)
+        TEST_ERROR
+
+    /* Make sure only 2 of the 4 chunks were written through the filter (4 bytes
+     * each) */
+    if(count_nbytes_read != (size_t)0)
+        TEST_ERROR
+    if(count_nbytes_written != (size_t)(2 * cdim[0] * cdim[1]))
+        TEST_ERROR
+
+    /* Reopen the dataset */
+    if((did = H5Dopen2(fid, DSET_CHUNKED_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Read the dataset */
+    if(H5Dread(did, H5T_NATIVE_CHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+
+    /* Verify that data read == data written */
+    for(i=0; i<dim[0]; i++)
+        for(j=0; j<dim[1]; j++)
+            if(rbuf[i][j] != wbuf[i][j])
+                TEST_ERROR
+
+    /* Make sure only 2 of the 4 chunks were read through the filter (4 bytes
+     * each) */
+    if(count_nbytes_read != (size_t)(2 * cdim[0] * cdim[1]))
+        TEST_ERROR
+    if(count_nbytes_written != (size_t)(2 * cdim[0] * cdim[1]))
+        TEST_ERROR
+
+    /* Close IDs */
+    if(H5Dclose(did) < 0)
+        TEST_ERROR
+    if(H5Pclose(dcpl) < 0)
+        TEST_ERROR
+    if(H5Sclose(sid) < 0)
+        TEST_ERROR
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Pclose(dcpl);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return FAIL;
+} /* end test_unfiltered_edge_chunks() */
+
+
+/*-------------------------------------------------------------------------
+ *
+ *  test_filter_nthreads():
+ *      Tests reading and writing filtered chunks with the I/O pipeline
+ *      run by several threads (H5Pset_filter_nthreads), with a chunk
+ *      cache small enough that chunks are evicted while writing.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_filter_nthreads(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;               /* File ID */
+    hid_t       dcpl = -1;              /* Dataset creation property list ID */
+    hid_t       dapl = -1;              /* Dataset access property list ID */
+    hid_t       dxpl = -1;              /* Dataset transfer property list ID */
+    hid_t       sid = -1;               /* Dataspace ID */
+    hid_t       did = -1;               /* Dataset ID */
+    hsize_t     dim[2] = {95, 97};      /* Dataset dimensions */
+    hsize_t     cdim[2] = {10, 10};     /* Chunk dimensions */
+    int         *wbuf = NULL;           /* Write buffer */
+    int         *rbuf = NULL;           /* Read buffer */
+    unsigned    nthreads;               /* # of filter threads */
+    unsigned    opts;                   /* Chunk options */
+    unsigned    partial;                /* Whether partial chunks are filtered */
+    size_t      i;                      /* Local index variable */
+    herr_t      ret;                    /* Generic return value */
+
+    TESTING("filtering chunks with multiple threads");
+
+    h5_fixname(FILENAME[26], fapl, filename, sizeof filename);
+
+    if(NULL == (wbuf = (int *)HDmalloc(sizeof(int) * dim[0] * dim[1])))
+        TEST_ERROR
+    if(NULL == (rbuf = (int *)HDmalloc(sizeof(int) * dim[0] * dim[1])))
+        TEST_ERROR
+    for(i = 0; i < dim[0] * dim[1]; i++)
+        wbuf[i] = (int)(i * 7 + 3);
+
+    /* Check the property */
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR
+    if(H5Pget_filter_nthreads(dxpl, &nthreads) < 0)
+        TEST_ERROR
+    if(nthreads != 1)
+        TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Pset_filter_nthreads(dxpl, 0);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        TEST_ERROR
+    if(H5Pset_filter_nthreads(dxpl, 4) < 0)
+        TEST_ERROR
+    if(H5Pget_filter_nthreads(dxpl, &nthreads) < 0)
+        TEST_ERROR
+    if(nthreads != 4)
+        TEST_ERROR
+
+    /* Keep room for only a few chunks in the cache */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        TEST_ERROR
+    if(H5Pset_chunk_cache(dapl, (size_t)521, (size_t)(3 * cdim[0] * cdim[1] * sizeof(int)), 0.75) < 0)
+        TEST_ERROR
+
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+    if((sid = H5Screate_simple(2, dim, NULL)) < 0)
+        TEST_ERROR
+
+    /* Try with partial edge chunks both filtered and not */
+    for(partial = 0; partial < 2; partial++) {
+        if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+            TEST_ERROR
+        if(H5Pset_chunk(dcpl, 2, cdim) < 0)
+            TEST_ERROR
+        if(H5Pset_shuffle(dcpl) < 0)
+            TEST_ERROR
+        if(H5Pset_fletcher32(dcpl) < 0)
+            TEST_ERROR
+        if(!partial) {
+            if(H5Pget_chunk_opts(dcpl, &opts) < 0)
+                TEST_ERROR
+            opts |= H5D_CHUNK_DONT_FILTER_PARTIAL_CHUNKS;
+            if(H5Pset_chunk_opts(dcpl, opts) < 0)
+                TEST_ERROR
+        } /* end if */
+
+        /* Write the data with several filter threads */
+        if((did = H5Dcreate2(fid, partial ? "filter_nthreads_partial" : "filter_nthreads",
+                H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+            TEST_ERROR
+        if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, wbuf) < 0)
+            TEST_ERROR
+        if(H5Dclose(did) < 0)
+            TEST_ERROR
+
+        /* Read it back with several filter threads */
+        if((did = H5Dopen2(fid, partial ? "filter_nthreads_partial" : "filter_nthreads", dapl)) < 0)
+            TEST_ERROR
+        HDmemset(rbuf, 0, sizeof(int) * dim[0] * dim[1]);
+        if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, rbuf) < 0)
+            TEST_ERROR
+        for(i = 0; i < dim[0] * dim[1]; i++)
+            if(rbuf[i] != wbuf[i])
+                TEST_ERROR
+
+        /* Read it back again, one chunk at a time */
+        HDmemset(rbuf, 0, sizeof(int) * dim[0] * dim[1]);
+        if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            TEST_ERROR
+        for(i = 0; i < dim[0] * dim[1]; i++)
+            if(rbuf[i] != wbuf[i])
+                TEST_ERROR
+
+        if(H5Dclose(did) < 0)
+            TEST_ERROR
+        if(H5Pclose(dcpl) < 0)
+            TEST_ERROR
+    } /* end for */
+
+    if(H5Sclose(sid) < 0)
+        TEST_ERROR
+    if(H5Pclose(dapl) < 0)
+        TEST_ERROR
+    if(H5Pclose(dxpl) < 0)
+        TEST_ERROR
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Pclose(dcpl);
+        H5Pclose(dapl);
+        H5Pclose(dxpl);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+    return FAIL;
+} /* end test_filter_nthreads() */
+
+
+/*-------------------------------------------------------------------------
+ *
+ *  test_chunk_prefetch():
+ *      Tests reading chunked datasets with chunks read ahead of the
+ *      selection (H5Pset_chunk_prefetch), for filtered and unfiltered
+ *      datasets with some chunks unallocated or already in the chunk
+ *      cache, with and without filter threads.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_prefetch(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;               /* File ID */
+    hid_t       dcpl = -1;              /* Dataset creation property list ID */
+    hid_t       dapl = -1;              /* Dataset access property list ID */
+    hid_t       dxpl = -1;              /* Dataset transfer property list ID */
+    hid_t       sid = -1;               /* Dataspace ID */
+    hid_t       did = -1;               /* Dataset ID */
+    hsize_t     dim[2] = {65, 73};      /* Dataset dimensions */
+    hsize_t     cdim[2] = {8, 8};       /* Chunk dimensions */
+    hsize_t     start[2] = {0, 0};      /* Hyperslab start */
+    hsize_t     count[2];               /* Hyperslab count */
+    int         *wbuf = NULL;           /* Write buffer */
+    int         *rbuf = NULL;           /* Read buffer */
+    unsigned    prefetch;               /* # of chunks to prefetch */
+    unsigned    filtered;               /* Whether the dataset is filtered */
+    unsigned    nthreads;               /* # of filter threads */
+    size_t      i;                      /* Local index variable */
+
+    TESTING("prefetching chunks while reading");
+
+    h5_fixname(FILENAME[27], fapl, filename, sizeof filename);
+
+    if(NULL == (wbuf = (int *)HDmalloc(sizeof(int) * dim[0] * dim[1])))
+        TEST_ERROR
+    if(NULL == (rbuf = (int *)HDmalloc(sizeof(int) * dim[0] * dim[1])))
+        TEST_ERROR
+    for(i = 0; i < dim[0] * dim[1]; i++)
+        wbuf[i] = (int)(i * 5 + 1);
+
+    /* Check the property */
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR
+    if(H5Pget_chunk_prefetch(dxpl, &prefetch) < 0)
+        TEST_ERROR
+    if(prefetch != 0)
+        TEST_ERROR
+    if(H5Pset_chunk_prefetch(dxpl, 12) < 0)
+        TEST_ERROR
+    if(H5Pget_chunk_prefetch(dxpl, &prefetch) < 0)
+        TEST_ERROR
+    if(prefetch != 12)
+        TEST_ERROR
+
+    /* Keep room for fewer chunks in the cache than are prefetched */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        TEST_ERROR
+    if(H5Pset_chunk_cache(dapl, (size_t)521, (size_t)(5 * cdim[0] * cdim[1] * sizeof(int)), 0.75) < 0)
+        TEST_ERROR
+
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+    if((sid = H5Screate_simple(2, dim, NULL)) < 0)
+        TEST_ERROR
+
+    for(filtered = 0; filtered < 2; filtered++) {
+        if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+            TEST_ERROR
+        if(H5Pset_chunk(dcpl, 2, cdim) < 0)
+            TEST_ERROR
+        if(filtered) {
+            if(H5Pset_shuffle(dcpl) < 0)
+                TEST_ERROR
+            if(H5Pset_fletcher32(dcpl) < 0)
+                TEST_ERROR
+        } /* end if */
+
+        /* Write only the first rows, leaving the other chunks unallocated */
+        if((did = H5Dcreate2(fid, filtered ? "prefetch_filtered" : "prefetch",
+                H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+            TEST_ERROR
+        count[0] = 40;
+        count[1] = dim[1];
+        if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR
+        if(H5Dwrite(did, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wbuf) < 0)
+            TEST_ERROR
+        if(H5Dclose(did) < 0)
+            TEST_ERROR
+        if(H5Sselect_all(sid) < 0)
+            TEST_ERROR
+
+        for(nthreads = 1; nthreads <= 4; nthreads += 3) {
+            if(H5Pset_filter_nthreads(dxpl, nthreads) < 0)
+                TEST_ERROR
+
+            /* Read everything, with none of the chunks cached */
+            if((did = H5Dopen2(fid, filtered ? "prefetch_filtered" : "prefetch", dapl)) < 0)
+                TEST_ERROR
+            HDmemset(rbuf, 0xff, sizeof(int) * dim[0] * dim[1]);
+            if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, rbuf) < 0)
+                TEST_ERROR
+            for(i = 0; i < dim[0] * dim[1]; i++)
+                if(rbuf[i] != (i < 40 * dim[1] ? wbuf[i] : 0))
+                    TEST_ERROR
+
+            /* Read a part, so some chunks are cached, then everything again */
+            count[0] = 20;
+            count[1] = 20;
+            HDmemset(rbuf, 0xff, sizeof(int) * dim[0] * dim[1]);
+            if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                TEST_ERROR
+            if(H5Dread(did, H5T_NATIVE_INT, sid, sid, dxpl, rbuf) < 0)
+                TEST_ERROR
+            if(H5Sselect_all(sid) < 0)
+                TEST_ERROR
+            if(H5Dread(did, H5T_NATIVE_INT, sid, sid, dxpl, rbuf) < 0)
+                TEST_ERROR
+            for(i = 0; i < dim[0] * dim[1]; i++)
+                if(rbuf[i] != (i < 40 * dim[1] ? wbuf[i] : 0))
+                    TEST_ERROR
+
+            if(H5Dclose(did) < 0)
+                TEST_ERROR
+        } /* end for */
+
+        if(H5Pclose(dcpl) < 0)
+            TEST_ERROR
+    } /* end for */
+
+    if(H5Sclose(sid) < 0)
+        TEST_ERROR
+    if(H5Pclose(dapl) < 0)
+        TEST_ERROR
+    if(H5Pclose(dxpl) < 0)
+        TEST_ERROR
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Pclose(dcpl);
+        H5Pclose(dapl);
+        H5Pclose(dxpl);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+    return FAIL;
+} /* end test_chunk_prefetch() */
+
+
+/*-------------------------------------------------------------------------
+ *
+ *  test_shared_chunk_cache():
+ *      Tests the raw data chunk cache budget shared by the datasets in
+ *      a file (H5Pset_shared_chunk_cache) and the statistics reported by
+ *      H5Fget_chunk_cache_stats: chunks of several datasets are kept
+ *      within the budget, chunks evicted on behalf of other datasets are
+ *      flushed correctly, datasets with their own cache size don't use
+ *      the budget, and closing one of two IDs for a dataset is safe.
+ *
+ *-------------------------------------------------------------------------
+ */
+#define SHARED_CC_DIM           800
+#define SHARED_CC_CHUNK         100
+#define SHARED_CC_NCHUNKS       4
+static herr_t
+test_shared_chunk_cache(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    const char  *dset_names[3] = {"shared_a", "shared_b", "private"};
+    hid_t       fapl_local = -1;        /* File access property list ID */
+    hid_t       fapl2 = -1;             /* File access property list ID */
+    hid_t       fid = -1;               /* File ID */
+    hid_t       dcpl = -1;              /* Dataset creation property list ID */
+    hid_t       dapl = -1;              /* Dataset access property list ID */
+    hid_t       dapl2 = -1;             /* Dataset access property list ID */
+    hid_t       sid = -1;               /* Dataspace ID */
+    hid_t       did[3] = {-1, -1, -1};  /* Dataset IDs */
+    hid_t       did2 = -1;              /* Second ID for a dataset */
+    hsize_t     dim = SHARED_CC_DIM;    /* Dataset dimensions */
+    hsize_t     cdim = SHARED_CC_CHUNK; /* Chunk dimensions */
+    hsize_t     start, count;           /* Hyperslab selection */
+    size_t      budget = SHARED_CC_NCHUNKS * SHARED_CC_CHUNK * sizeof(int);
+    size_t      nbytes;                 /* Chunk cache size */
+    size_t      def_nbytes;             /* Default chunk cache size */
+    H5F_chunk_cache_stats_t stats;      /* Chunk cache statistics */
+    int         *wbuf = NULL;           /* Write buffer */
+    int         *rbuf = NULL;           /* Read buffer */
+    size_t      i, u;                   /* Local index variables */
+
+    TESTING("chunk cache budget shared by datasets");
+
+    h5_fixname(FILENAME[28], fapl, filename, sizeof filename);
+
+    if(NULL == (wbuf = (int *)HDmalloc(sizeof(int) * SHARED_CC_DIM)))
+        TEST_ERROR
+    if(NULL == (rbuf = (int *)HDmalloc(sizeof(int) * SHARED_CC_DIM)))
+        TEST_ERROR
+
+    /* Check the property */
+    if((fapl_local = H5Pcopy(fapl)) < 0)
+        TEST_ERROR
+    if(H5Pget_shared_chunk_cache(fapl_local, &nbytes) < 0)
+        TEST_ERROR
+    if(nbytes != 0)
+        TEST_ERROR
+    if(H5Pset_shared_chunk_cache(fapl_local, budget) < 0)
+        TEST_ERROR
+    if(H5Pget_shared_chunk_cache(fapl_local, &nbytes) < 0)
+        TEST_ERROR
+    if(nbytes != budget)
+        TEST_ERROR
+
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_local)) < 0)
+        TEST_ERROR
+
+    /* The budget should be reported by the file's access property list */
+    if((fapl2 = H5Fget_access_plist(fid)) < 0)
+        TEST_ERROR
+    if(H5Pget_shared_chunk_cache(fapl2, &nbytes) < 0)
+        TEST_ERROR
+    if(nbytes != budget)
+        TEST_ERROR
+    if(H5Pclose(fapl2) < 0)
+        TEST_ERROR
+
+    /* Two datasets use the shared budget, the third has its own cache */
+    if((sid = H5Screate_simple(1, &dim, NULL)) < 0)
+        TEST_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if(H5Pset_chunk(dcpl, 1, &cdim) < 0)
+        TEST_ERROR
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        TEST_ERROR
+    if(H5Pset_chunk_cache(dapl, (size_t)521, (size_t)(2 * SHARED_CC_CHUNK * sizeof(int)), 0.75) < 0)
+        TEST_ERROR
+    for(u = 0; u < 3; u++)
+        if((did[u] = H5Dcreate2(fid, dset_names[u], H5T_NATIVE_INT, sid, H5P_DEFAULT,
+                dcpl, u == 2 ? dapl : H5P_DEFAULT)) < 0)
+            TEST_ERROR
+
+    /* Datasets using the shared budget report the default cache size, which
+     * H5Pget_chunk_cache translates to the default file access value.
+     */
+    if(H5Pget_cache(H5P_FILE_ACCESS_DEFAULT, NULL, NULL, &def_nbytes, NULL) < 0)
+        TEST_ERROR
+    if((dapl2 = H5Dget_access_plist(did[0])) < 0)
+        TEST_ERROR
+    if(H5Pget_chunk_cache(dapl2, NULL, &nbytes, NULL) < 0)
+        TEST_ERROR
+    if(nbytes != def_nbytes)
+        TEST_ERROR
+    if(H5Pclose(dapl2) < 0)
+        TEST_ERROR
+
+    if(H5Freset_chunk_cache_stats(fid) < 0)
+        TEST_ERROR
+
+    /* Write the shared datasets one chunk at a time, interleaved, so that
+     * chunks of each dataset are evicted to make room for the other's.
+     */
+    for(i = 0; i < SHARED_CC_DIM / SHARED_CC_CHUNK; i++) {
+        start = i * SHARED_CC_CHUNK;
+        count = SHARED_CC_CHUNK;
+        if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0)
+            TEST_ERROR
+        for(u = 0; u < 2; u++) {
+            size_t  v;
+
+            for(v = 0; v < SHARED_CC_CHUNK; v++)
+                wbuf[start + v] = (int)(u * 100000 + start + v);
+            if(H5Dwrite(did[u], H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wbuf) < 0)
+                TEST_ERROR
+
+            if(H5Fget_chunk_cache_stats(fid, &stats) < 0)
+                TEST_ERROR
+            if(stats.nbytes_max != budget)
+                TEST_ERROR
+            if(stats.nbytes_used > budget)
+                TEST_ERROR
+            if(stats.nentries * SHARED_CC_CHUNK * sizeof(int) != stats.nbytes_used)
+                TEST_ERROR
+        } /* end for */
+    } /* end for */
+    if(H5Fget_chunk_cache_stats(fid, &stats) < 0)
+        TEST_ERROR
+    if(stats.nentries != SHARED_CC_NCHUNKS)
+        TEST_ERROR
+    if(stats.nevictions != 2 * (SHARED_CC_DIM / SHARED_CC_CHUNK) - SHARED_CC_NCHUNKS)
+        TEST_ERROR
+    if(stats.nflushes != stats.nevictions)
+        TEST_ERROR
+
+    /* The dataset with its own cache doesn't use the shared budget */
+    if(H5Sselect_all(sid) < 0)
+        TEST_ERROR
+    for(i = 0; i < SHARED_CC_DIM; i++)
+        wbuf[i] = (int)(200000 + i);
+    if(H5Dwrite(did[2], H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR
+    if(H5Fget_chunk_cache_stats(fid, &stats) < 0)
+        TEST_ERROR
+    if(stats.nentries != SHARED_CC_NCHUNKS)
+        TEST_ERROR
+
+    /* Read the datasets back, through the cache */
+    if(H5Freset_chunk_cache_stats(fid) < 0)
+        TEST_ERROR
+    for(u = 0; u < 3; u++) {
+        HDmemset(rbuf, 0, sizeof(int) * SHARED_CC_DIM);
+        if(H5Dread(did[u], H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, rbuf) < 0)
+            TEST_ERROR
+        for(i = 0; i < SHARED_CC_DIM; i++)
+            if(rbuf[i] != (int)(u * 100000 + i))
+                TEST_ERROR
+    } /* end for */
+    if(H5Fget_chunk_cache_stats(fid, &stats) < 0)
+        TEST_ERROR
+    if(stats.nmisses < (hsize_t)(SHARED_CC_DIM / SHARED_CC_CHUNK))
+        TEST_ERROR
+    if(stats.nbytes_used > budget)
+        TEST_ERROR
+
+    /* Re-reading the last chunk read from a dataset is a hit */
+    start = SHARED_CC_DIM - SHARED_CC_CHUNK;
+    count = SHARED_CC_CHUNK;
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0)
+        TEST_ERROR
+    if(H5Freset_chunk_cache_stats(fid) < 0)
+        TEST_ERROR
+    if(H5Dread(did[1], H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    if(H5Fget_chunk_cache_stats(fid, &stats) < 0)
+        TEST_ERROR
+    if(stats.nhits != 1 || stats.nmisses != 0)
+        TEST_ERROR
+
+    /* Dirty a chunk through a second ID, close that ID, and make sure
+     * the chunk still makes it to the file when it is evicted later.
+     */
+    if((did2 = H5Dopen2(fid, dset_names[0], H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    for(i = 0; i < SHARED_CC_CHUNK; i++)
+        wbuf[start + i] = -(int)(start + i);
+    if(H5Dwrite(did2, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR
+    if(H5Dclose(did2) < 0)
+        TEST_ERROR
+    did2 = -1;
+    if(H5Sselect_all(sid) < 0)
+        TEST_ERROR
+    if(H5Dread(did[1], H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    if(H5Dread(did[0], H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    for(i = 0; i < SHARED_CC_DIM; i++)
+        if(rbuf[i] != (i < start ? (int)i : -(int)i))
+            TEST_ERROR
+
+    for(u = 0; u < 3; u++) {
+        if(H5Dclose(did[u]) < 0)
+            TEST_ERROR
+        did[u] = -1;
+    } /* end for */
+
+    /* All chunks are released when the datasets are closed */
+    if(H5Fget_chunk_cache_stats(fid, &stats) < 0)
+        TEST_ERROR
+    if(stats.nbytes_used != 0 || stats.nentries != 0)
+        TEST_ERROR
 
-            /* Verify the file is correct size */
-            if(file_size != empty_size)
-                TEST_ERROR
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR
 
-        } /* end for */
-#ifdef H5_HAVE_FILTER_DEFLATE
-    } /* end for */
-#endif /* H5_HAVE_FILTER_DEFLATE */
+    /* Without a shared budget, statistics are still gathered for datasets
+     * with a chunk cache (the file access property list used here turns
+     * the default chunk cache off).
+     */
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        TEST_ERROR
+    if((did[0] = H5Dopen2(fid, dset_names[0], dapl)) < 0)
+        TEST_ERROR
+    if(H5Dread(did[0], H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    if(H5Fget_chunk_cache_stats(fid, &stats) < 0)
+        TEST_ERROR
+    if(stats.nbytes_max != 0 || stats.nbytes_used != 0)
+        TEST_ERROR
+    if(stats.nmisses != (hsize_t)(SHARED_CC_DIM / SHARED_CC_CHUNK))
+        TEST_ERROR
+    if(H5Dclose(did[0]) < 0)
+        TEST_ERROR
+    did[0] = -1;
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR
 
+    if(H5Sclose(sid) < 0)
+        TEST_ERROR
+    if(H5Pclose(dcpl) < 0)
+        TEST_ERROR
+    if(H5Pclose(dapl) < 0)
+        TEST_ERROR
+    if(H5Pclose(fapl_local) < 0)
+        TEST_ERROR
 
-    /* Release buffers */
     HDfree(wbuf);
     HDfree(rbuf);
-    HDfree(t_wbuf);
-    HDfree(t_rbuf);
 
     PASSED();
     return SUCCEED;
 
 error:
     H5E_BEGIN_TRY {
+        for(u = 0; u < 3; u++)
+            H5Dclose(did[u]);
+        H5Dclose(did2);
         H5Pclose(dcpl);
-        H5Pclose(t_dcpl);
-        H5Dclose(did);
-        H5Dclose(did_max);
+        H5Pclose(dapl);
+        H5Pclose(dapl2);
+        H5Pclose(fapl2);
+        H5Pclose(fapl_local);
         H5Sclose(sid);
-        H5Sclose(sid_max);
         H5Fclose(fid);
     } H5E_END_TRY;
     if(wbuf)
         HDfree(wbuf);
     if(rbuf)
         HDfree(rbuf);
-    if(t_wbuf)
-        HDfree(t_wbuf);
-    if(t_rbuf)
-        HDfree(t_rbuf);
     return FAIL;
-} /* end test_single_chunk() */
+} /* end test_shared_chunk_cache() */
 
 
 /*-------------------------------------------------------------------------
  *
- *  test_idx_compatible():
- *    Verify that the library can read datasets created with
- *    1.6/1.8 library that use the B-tree indexing method.
- *
- *  Programmer: Vailin Choi; 26th August, 2009
+ *  test_chunk_cache_policy():
+ *      Tests the chunk cache replacement policies.  A couple of chunks
+ *      are accessed repeatedly, interleaved with a scan of the rest of
+ *      the dataset.  With the LRU policy the scan pushes the hot chunks
+ *      out of the cache, with the 2Q policy they stay cached.
  *
  *-------------------------------------------------------------------------
  */
+#define CC_POLICY_CHUNK         100
+#define CC_POLICY_NCHUNKS       40
+#define CC_POLICY_CACHE_NCHUNKS 8
 static herr_t
-test_idx_compatible(void)
+test_chunk_cache_policy(hid_t fapl)
 {
-    hid_t    fid = -1;        /* File id */
-    hid_t       did = -1;        /* Dataset id */
-    const char  *filename = NULL;  /* old test file name */
-    unsigned    j;              /* Local index variable */
-    H5D_chunk_index_t idx_type; /* Chunked dataset index type */
-
-    /* Output message about test being performed */
-    TESTING("compatibility for 1.6/1.8 datasets that use B-tree indexing");
-
-    for(j = 0; j < NELMTS(OLD_FILENAME); j++) {
-
-    /* Generate correct name for test file by prepending the source path */
-    filename = H5_get_srcdir_filename(OLD_FILENAME[j]);
-
-    /* Open the file */
-    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, H5P_DEFAULT)) < 0)
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;               /* File ID */
+    hid_t       dcpl = -1;              /* Dataset creation property list ID */
+    hid_t       dapl = -1;              /* Dataset access property list ID */
+    hid_t       dapl2 = -1;             /* Dataset access property list ID */
+    hid_t       sid = -1;               /* Dataspace ID */
+    hid_t       msid = -1;              /* Memory dataspace ID */
+    hid_t       did = -1;               /* Dataset ID */
+    hsize_t     dim = CC_POLICY_CHUNK * CC_POLICY_NCHUNKS; /* Dataset dimensions */
+    hsize_t     cdim = CC_POLICY_CHUNK; /* Chunk dimensions */
+    hsize_t     start, count;           /* Hyperslab selection */
+    H5D_chunk_cache_policy_t policy;    /* Chunk cache policy */
+    H5F_chunk_cache_stats_t stats;      /* Chunk cache statistics */
+    int         *buf = NULL;            /* Data buffer */
+    int         rbuf[CC_POLICY_CHUNK];  /* Read buffer */
+    herr_t      ret;                    /* Generic return value */
+    unsigned    u, v;                   /* Local index variables */
+
+    TESTING("chunk cache replacement policies");
+
+    h5_fixname(FILENAME[29], fapl, filename, sizeof filename);
+
+    /* Check the property */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
         TEST_ERROR
-
-    /* Should be able to read the dataset w/o filter created under 1.8/1.6 */
-    if((did = H5Dopen2(fid, DSET, H5P_DEFAULT)) < 0)
+    if(H5Pget_chunk_cache_policy(dapl, &policy) < 0)
         TEST_ERROR
-
-    /* Get the chunk index type */
-    if(H5D__layout_idx_type_test(did, &idx_type) < 0) FAIL_STACK_ERROR
-
-    /* Verify index type */
-    if(idx_type != H5D_CHUNK_IDX_BTREE)
-        FAIL_PUTS_ERROR("should be using v1 B-tree as index")
-
-    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
-
-    /* Should be able to read the dataset w/ filter created under 1.8/1.6 */
-    if((did = H5Dopen2(fid, DSET_FILTER, H5P_DEFAULT)) < 0)
+    if(policy != H5D_CHUNK_CACHE_POLICY_LRU)
         TEST_ERROR
-
-    /* Get the chunk index type */
-    if(H5D__layout_idx_type_test(did, &idx_type) < 0) FAIL_STACK_ERROR
-
-    /* Verify index type */
-    if(idx_type != H5D_CHUNK_IDX_BTREE)
-        FAIL_PUTS_ERROR("should be using v1 B-tree as index")
-
-    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
-
-    /* Close the file */
-    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
-    }
-
-    PASSED();
-    return SUCCEED;
-
-error:
     H5E_BEGIN_TRY {
-        H5Dclose(did);
-    H5Fclose(fid);
+        ret = H5Pset_chunk_cache_policy(dapl, H5D_CHUNK_CACHE_POLICY_NTYPES);
     } H5E_END_TRY;
-    return FAIL;
-} /* end test_idx_compatible() */
-
-/*-------------------------------------------------------------------------
- *
- *  test_unfiltered_edge_chunks():
- *      Tests that partial edge chunks aren't filtered when the
- *      H5D_CHUNK_FILTER_PARTIAL_CHUNKS option is set.
- *
- *  Programmer: Neil Fortner; 17th March, 2010
- *
- *-------------------------------------------------------------------------
- */
-static herr_t
-test_unfiltered_edge_chunks(hid_t fapl)
-{
-    hid_t       fid = -1;            /* File id */
-    hid_t       did = -1;            /* Dataset id */
-    hid_t       sid = -1;            /* Dataspace id */
-    hid_t       dcpl = -1;           /* DCPL id */
-    hsize_t     dim[2] = {4, 3}; /* Dataset dimensions */
-    hsize_t     cdim[2] = {2, 2}; /* Chunk dimension */
-    char        wbuf[4][3];     /* Write buffer */
-    char        rbuf[4][3];     /* Read buffer */
-    char        filename[FILENAME_BUF_SIZE] = "";  /* old test file name */
-    unsigned    opts;           /* Chunk options */
-    unsigned    i, j;           /* Local index variables */
-
-    /* Output message about test being performed */
-    TESTING("disabled partial chunk filters");
-
-    h5_fixname(FILENAME[14], fapl, filename, sizeof filename);
-
-    /* Create the file */
-    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+    if(ret >= 0)
         TEST_ERROR
-
-    /* Register byte-counting filter */
-    if(H5Zregister(H5Z_COUNT) < 0)
+    if(H5Pset_chunk_cache(dapl, (size_t)521, (size_t)(CC_POLICY_CACHE_NCHUNKS * CC_POLICY_CHUNK * sizeof(int)), 0.75) < 0)
         TEST_ERROR
 
-    /* Create dataspace */
-    if((sid = H5Screate_simple(2, dim, NULL)) < 0)
+    /* Create the dataset */
+    if(NULL == (buf = (int *)HDmalloc(sizeof(int) * CC_POLICY_CHUNK * CC_POLICY_NCHUNKS)))
         TEST_ERROR
-
-    /* Create DCPL */
-    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+    for(u = 0; u < CC_POLICY_CHUNK * CC_POLICY_NCHUNKS; u++)
+        buf[u] = (int)u;
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
         TEST_ERROR
-
-    /* Set chunk dimensions */
-    if(H5Pset_chunk(dcpl, 2, cdim) < 0)
+    if((sid = H5Screate_simple(1, &dim, NULL)) < 0)
         TEST_ERROR
-
-    /* Add "count" filter */
-    if(H5Pset_filter(dcpl, H5Z_FILTER_COUNT, 0u, (size_t)0, NULL) < 0)
+    if((msid = H5Screate_simple(1, &cdim, NULL)) < 0)
         TEST_ERROR
-
-    /* Disable filters on partial chunks */
-    if(H5Pget_chunk_opts(dcpl, &opts) < 0)
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
         TEST_ERROR
-    opts |= H5D_CHUNK_DONT_FILTER_PARTIAL_CHUNKS;
-    if(H5Pset_chunk_opts(dcpl, opts) < 0)
+    if(H5Pset_chunk(dcpl, 1, &cdim) < 0)
         TEST_ERROR
-
-    /* Initialize write buffer */
-    for(i=0; i<dim[0]; i++)
-        for(j=0; j<dim[1]; j++)
-            wbuf[i][j] = (char)((2 * i) - j);
-
-    /* Reset byte counts */
-    count_nbytes_read = (size_t)0;
-    count_nbytes_written = (size_t)0;
-
-    /* Create dataset */
-    if((did = H5Dcreate2(fid, DSET_CHUNKED_NAME, H5T_NATIVE_CHAR, sid,
-            H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+    if((did = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
         TEST_ERROR
-
-    /* Nothing should have been written, as we are not using early allocation */
-    if(count_nbytes_read != (size_t)0)
+    if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
         TEST_ERROR
-    if(count_nbytes_written != (size_t)0)
+    if(H5Dclose(did) < 0)
         TEST_ERROR
+    did = -1;
 
-    /* Write data */
-    if(H5Dwrite(did, H5T_NATIVE_CHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
-        TEST_ERROR
+    for(u = 0; u < 2; u++) {
+        policy = u ? H5D_CHUNK_CACHE_POLICY_2Q : H5D_CHUNK_CACHE_POLICY_LRU;
+        if(H5Pset_chunk_cache_policy(dapl, policy) < 0)
+            TEST_ERROR
+        if((did = H5Dopen2(fid, "dset", dapl)) < 0)
+            TEST_ERROR
 
-    /* Close dataset */
-    if(H5Dclose(did) < 0)
-        TEST_ERROR
+        /* The policy should be reported by the dataset's access property list */
+        if((dapl2 = H5Dget_access_plist(did)) < 0)
+            TEST_ERROR
+        if(H5Pget_chunk_cache_policy(dapl2, &policy) < 0)
+            TEST_ERROR
+        if(policy != (u ? H5D_CHUNK_CACHE_POLICY_2Q : H5D_CHUNK_CACHE_POLICY_LRU))
+            TEST_ERROR
+        if(H5Pclose(dapl2) < 0)
+            TEST_ERROR
+        dapl2 = -1;
 
-    /* Make sure only 2 of the 4 chunks were written through the filter (4 bytes
-     * each) */
-    if(count_nbytes_read != (size_t)0)
-        TEST_ERROR
-    if(count_nbytes_written != (size_t)(2 * cdim[0] * cdim[1]))
-        TEST_ERROR
+        /* Read chunks 0-9, then the "hot" chunks 0 & 1 again, then scan the
+         * rest of the dataset.  With 2Q, chunks 0 & 1 are loaded again
+         * shortly after they were preempted, which moves them to the part
+         * of the cache that the scan doesn't preempt from.
+         */
+        for(v = 0; v < 10 + 2 + (CC_POLICY_NCHUNKS - 10); v++) {
+            start = (v < 10 ? v : (v < 12 ? v - 10 : v - 2)) * CC_POLICY_CHUNK;
+            count = CC_POLICY_CHUNK;
+            if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0)
+                TEST_ERROR
+            if(H5Dread(did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, rbuf) < 0)
+                TEST_ERROR
+            if(rbuf[0] != (int)start || rbuf[CC_POLICY_CHUNK - 1] != (int)(start + CC_POLICY_CHUNK - 1))
+                TEST_ERROR
+        } /* end for */
 
-    /* Reopen the dataset */
-    if((did = H5Dopen2(fid, DSET_CHUNKED_NAME, H5P_DEFAULT)) < 0)
-        TEST_ERROR
+        if(H5Fget_chunk_cache_stats(fid, &stats) < 0)
+            TEST_ERROR
+        if(stats.nghost_hits != (u ? 2 : 0))
+            TEST_ERROR
 
-    /* Read the dataset */
-    if(H5Dread(did, H5T_NATIVE_CHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
-        TEST_ERROR
+        /* Read the hot chunks again */
+        if(H5Freset_chunk_cache_stats(fid) < 0)
+            TEST_ERROR
+        for(v = 0; v < 2; v++) {
+            start = v * CC_POLICY_CHUNK;
+            count = CC_POLICY_CHUNK;
+            if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0)
+                TEST_ERROR
+            if(H5Dread(did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, rbuf) < 0)
+                TEST_ERROR
+            if(rbuf[0] != (int)start)
+                TEST_ERROR
+        } /* end for */
+        if(H5Fget_chunk_cache_stats(fid, &stats) < 0)
+            TEST_ERROR
+        if(u) {
+            if(stats.nhits != 2 || stats.nmisses != 0)
+                TEST_ERROR
+        } /* end if */
+        else
+            if(stats.nhits != 0 || stats.nmisses != 2)
+                TEST_ERROR
 
-    /* Verify that data read == data written */
-    for(i=0; i<dim[0]; i++)
-        for(j=0; j<dim[1]; j++)
-            if(rbuf[i][j] != wbuf[i][j])
+        /* Write the whole dataset through the cache and read it back */
+        for(v = 0; v < CC_POLICY_CHUNK * CC_POLICY_NCHUNKS; v++)
+            buf[v] = (int)(u * 100000 + v);
+        if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+            TEST_ERROR
+        if(H5Dclose(did) < 0)
+            TEST_ERROR
+        did = -1;
+        if((did = H5Dopen2(fid, "dset", dapl)) < 0)
+            TEST_ERROR
+        HDmemset(buf, 0, sizeof(int) * CC_POLICY_CHUNK * CC_POLICY_NCHUNKS);
+        if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+            TEST_ERROR
+        for(v = 0; v < CC_POLICY_CHUNK * CC_POLICY_NCHUNKS; v++)
+            if(buf[v] != (int)(u * 100000 + v))
                 TEST_ERROR
+        if(H5Dclose(did) < 0)
+            TEST_ERROR
+        did = -1;
+    } /* end for */
 
-    /* Make sure only 2 of the 4 chunks were read through the filter (4 bytes
-     * each) */
-    if(count_nbytes_read != (size_t)(2 * cdim[0] * cdim[1]))
+    if(H5Fclose(fid) < 0)
         TEST_ERROR
-    if(count_nbytes_written != (size_t)(2 * cdim[0] * cdim[1]))
+    if(H5Sclose(sid) < 0)
         TEST_ERROR
-
-    /* Close IDs */
-    if(H5Dclose(did) < 0)
+    if(H5Sclose(msid) < 0)
         TEST_ERROR
     if(H5Pclose(dcpl) < 0)
         TEST_ERROR
-    if(H5Sclose(sid) < 0)
-        TEST_ERROR
-    if(H5Fclose(fid) < 0)
+    if(H5Pclose(dapl) < 0)
         TEST_ERROR
 
+    HDfree(buf);
+
     PASSED();
     return SUCCEED;
 
@@ -10500,11 +12003,16 @@ error:
     H5E_BEGIN_TRY {
         H5Dclose(did);
         H5Pclose(dcpl);
+        H5Pclose(dapl);
+        H5Pclose(dapl2);
         H5Sclose(sid);
+        H5Sclose(msid);
         H5Fclose(fid);
     } H5E_END_TRY;
+    if(buf)
+        HDfree(buf);
     return FAIL;
-} /* end test_unfiltered_edge_chunks() */
+} /* end test_chunk_cache_policy() */
 
 
 /*-------------------------------------------------------------------------
@@ -13647,6 +15155,8 @@ main(void)
                 nerrors += (test_compact_open_close_dirty(my_fapl) < 0     ? 1 : 0);
                 nerrors += (test_conv_buffer(file) < 0            ? 1 : 0);
                 nerrors += (test_tconv(file) < 0            ? 1 : 0);
+                nerrors += (test_tconv_select(file) < 0     ? 1 : 0);
+                nerrors += (test_tconv_nthreads(file) < 0   ? 1 : 0);
                 nerrors += (test_filters(file, my_fapl) < 0        ? 1 : 0);
                 nerrors += (test_onebyte_shuffle(file) < 0         ? 1 : 0);
                 nerrors += (test_nbit_int(file) < 0                 ? 1 : 0);
@@ -13695,6 +15205,10 @@ main(void)
                 nerrors += (test_fixed_array(my_fapl) < 0        ? 1 : 0);
                 nerrors += (test_idx_compatible() < 0            ? 1 : 0);
                 nerrors += (test_unfiltered_edge_chunks(my_fapl) < 0    ? 1 : 0);
+                nerrors += (test_filter_nthreads(my_fapl) < 0           ? 1 : 0);
+                nerrors += (test_chunk_prefetch(my_fapl) < 0            ? 1 : 0);
+                nerrors += (test_shared_chunk_cache(my_fapl) < 0        ? 1 : 0);
+                nerrors += (test_chunk_cache_policy(my_fapl) < 0        ? 1 : 0);
                 nerrors += (test_single_chunk(my_fapl) < 0              ? 1 : 0);
                 nerrors += (test_large_chunk_shrink(my_fapl) < 0        ? 1 : 0);
                 nerrors += (test_zero_dim_dset(my_fapl) < 0             ? 1 : 0);
@@ -13726,6 +15240,10 @@ main(void)
     /* Tests version bounds using its own file */
     nerrors += (test_versionbounds() < 0                    ? 1 : 0);
 
+    /* Tests the shuffle filter for all element sizes, using its own file */
+    nerrors += (test_shuffle_sizes(fapl) < 0                ? 1 : 0);
+    nerrors += (test_bitshuffle_format(fapl) < 0            ? 1 : 0);
+
     nerrors += (test_object_header_minimization_dcpl() < 0 ? 1 : 0);
 
     /* Run misc tests */
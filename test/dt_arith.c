@@ -880,6 +880,150 @@ error:
 }
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_hard_vec
+ *
+ * Purpose:     Tests the vectorized hard conversions between integers and
+ *              floating numbers.  Converting a buffer of values at once
+ *              must give the same bytes as converting the values one at a
+ *              time, which the library does without vector instructions.
+ *              Besides random values, the buffers hold values that the
+ *              conversions clamp, round or turn into infinities, and NaN.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        number of errors
+ *-------------------------------------------------------------------------
+ */
+#define VEC_NELMTS      1029    /* Not a multiple of the vector lengths */
+static int
+test_hard_vec(void)
+{
+    hid_t       src_types[14], dst_types[14];   /* Conversions tested */
+    volatile double zero = 0.0;
+    double      inf = 1.0 / zero;
+    double      nan_value = zero / zero;
+    double      dspecial[21];   /* Special double values */
+    float       fspecial[16];   /* Special float values */
+    unsigned char *buf = NULL, *saved = NULL;
+    unsigned char one[16];      /* Buffer for converting one value */
+    size_t      src_size, dst_size;
+    unsigned    fails_this_test = 0;
+    size_t      u, j, k;
+
+    TESTING("vectorized hard conversions");
+
+    src_types[0] = H5T_NATIVE_SCHAR;    dst_types[0] = H5T_NATIVE_FLOAT;
+    src_types[1] = H5T_NATIVE_UCHAR;    dst_types[1] = H5T_NATIVE_FLOAT;
+    src_types[2] = H5T_NATIVE_SHORT;    dst_types[2] = H5T_NATIVE_FLOAT;
+    src_types[3] = H5T_NATIVE_USHORT;   dst_types[3] = H5T_NATIVE_FLOAT;
+    src_types[4] = H5T_NATIVE_INT;      dst_types[4] = H5T_NATIVE_FLOAT;
+    src_types[5] = H5T_NATIVE_SCHAR;    dst_types[5] = H5T_NATIVE_DOUBLE;
+    src_types[6] = H5T_NATIVE_UCHAR;    dst_types[6] = H5T_NATIVE_DOUBLE;
+    src_types[7] = H5T_NATIVE_SHORT;    dst_types[7] = H5T_NATIVE_DOUBLE;
+    src_types[8] = H5T_NATIVE_USHORT;   dst_types[8] = H5T_NATIVE_DOUBLE;
+    src_types[9] = H5T_NATIVE_INT;      dst_types[9] = H5T_NATIVE_DOUBLE;
+    src_types[10] = H5T_NATIVE_FLOAT;   dst_types[10] = H5T_NATIVE_DOUBLE;
+    src_types[11] = H5T_NATIVE_DOUBLE;  dst_types[11] = H5T_NATIVE_FLOAT;
+    src_types[12] = H5T_NATIVE_FLOAT;   dst_types[12] = H5T_NATIVE_INT;
+    src_types[13] = H5T_NATIVE_DOUBLE;  dst_types[13] = H5T_NATIVE_INT;
+
+    /* Values at and around the limits of the conversions */
+    dspecial[0] = 0.0;                          dspecial[1] = -0.0;
+    dspecial[2] = 2.5;                          dspecial[3] = -2.5;
+    dspecial[4] = (double)FLT_MAX;              dspecial[5] = -(double)FLT_MAX;
+    dspecial[6] = (double)FLT_MAX * (1.0 + 1e-9);   /* Rounds to FLT_MAX */
+    dspecial[7] = -(double)FLT_MAX * (1.0 + 1e-9);
+    dspecial[8] = 1e300;                        dspecial[9] = -1e300;
+    dspecial[10] = 2147483647.0;                dspecial[11] = 2147483647.5;
+    dspecial[12] = 2147483648.0;                dspecial[13] = -2147483648.5;
+    dspecial[14] = -2147483649.0;               dspecial[15] = 4294967296.0;
+    dspecial[16] = inf;                         dspecial[17] = -inf;
+    dspecial[18] = nan_value;                   dspecial[19] = (double)FLT_MIN / 3.0;
+    dspecial[20] = DBL_MIN;
+    fspecial[0] = 0.0F;                         fspecial[1] = -0.0F;
+    fspecial[2] = 2.5F;                         fspecial[3] = -2.5F;
+    fspecial[4] = FLT_MAX;                      fspecial[5] = -FLT_MAX;
+    fspecial[6] = 2147483520.0F;                fspecial[7] = 2147483648.0F;
+    fspecial[8] = -2147483648.0F;               fspecial[9] = -2147483904.0F;
+    fspecial[10] = 4294967296.0F;               fspecial[11] = (float)inf;
+    fspecial[12] = (float)-inf;                 fspecial[13] = (float)nan_value;
+    fspecial[14] = FLT_MIN / 3.0F;              fspecial[15] = 1e30F;
+
+    if(NULL == (buf = (unsigned char *)HDmalloc(VEC_NELMTS * sizeof(double))))
+        goto error;
+    if(NULL == (saved = (unsigned char *)HDmalloc(VEC_NELMTS * sizeof(double))))
+        goto error;
+
+    for(u = 0; u < NELMTS(src_types); u++) {
+        src_size = H5Tget_size(src_types[u]);
+        dst_size = H5Tget_size(dst_types[u]);
+
+        /* Every fourth value is a special one for floating-point sources,
+         * every other value is random and in range for the integers, and
+         * the rest are random bits */
+        for(j = 0; j < VEC_NELMTS; j++) {
+            unsigned char *p = saved + (j * src_size);
+
+            if(H5Tget_class(src_types[u]) == H5T_FLOAT && (j % 4) < 2) {
+                double d = (j % 4) == 0 ? dspecial[(j / 4) % NELMTS(dspecial)] :
+                        ((double)HDrandom() - (double)RAND_MAX / 2.0) * 1.37;
+                float f = (j % 4) == 0 ? fspecial[(j / 4) % NELMTS(fspecial)] : (float)d;
+
+                if(src_size == sizeof(double))
+                    HDmemcpy(p, &d, sizeof(double));
+                else
+                    HDmemcpy(p, &f, sizeof(float));
+            } /* end if */
+            else
+                for(k = 0; k < src_size; k++)
+                    p[k] = (unsigned char)HDrandom();
+        } /* end for */
+
+        /* Convert all the values at once */
+        HDmemcpy(buf, saved, VEC_NELMTS * src_size);
+        if(H5Tconvert(src_types[u], dst_types[u], (size_t)VEC_NELMTS, buf, NULL, H5P_DEFAULT) < 0)
+            goto error;
+
+        /* Compare with converting them one at a time */
+        for(j = 0; j < VEC_NELMTS; j++) {
+            HDmemcpy(one, saved + (j * src_size), src_size);
+            if(H5Tconvert(src_types[u], dst_types[u], (size_t)1, one, NULL, H5P_DEFAULT) < 0)
+                goto error;
+            if(HDmemcmp(one, buf + (j * dst_size), dst_size) != 0) {
+                if(0 == fails_this_test++)
+                    H5_FAILED();
+                HDprintf("    conversion %u differs at element %u\n", (unsigned)u, (unsigned)j);
+                break;
+            } /* end if */
+        } /* end for */
+    } /* end for */
+
+    if(fails_this_test)
+        goto error;
+
+    HDfree(buf);
+    HDfree(saved);
+
+    PASSED();
+    return 0;
+
+error:
+    HDfflush(stdout);
+    if(buf)
+        HDfree(buf);
+    if(saved)
+        HDfree(saved);
+
+    /* Restore the default error handler (set in h5_reset()) */
+    h5_restore_err();
+
+    reset_hdf5();
+
+    return MAX((int)fails_this_test, 1);
+}
+
+
 /*-------------------------------------------------------------------------
  * Function:    test_derived_flt
  *
@@ -5271,6 +5415,9 @@ main(void)
     /* Test a few special values for hardware float-integer conversions */
     nerrors += (unsigned long)test_particular_fp_integer();
 
+    /* Test the vectorized hardware integer-float conversion functions */
+    nerrors += (unsigned long)test_hard_vec();
+
     /*----------------------------------------------------------------------
      * Software tests
      *----------------------------------------------------------------------
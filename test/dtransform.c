@@ -16,12 +16,14 @@
 #define ROWS    12
 #define COLS    18
 #define FLOAT_TOL 0.0001F
+#define LONG_NELMTS 1003
 
 static int init_test(hid_t file_id);
 static int test_copy(const hid_t dxpl_id_c_to_f_copy, const hid_t dxpl_id_polynomial_copy);
 static int test_trivial(const hid_t dxpl_id_simple);
 static int test_poly(const hid_t dxpl_id_polynomial);
 static int test_specials(hid_t file);
+static int test_long(hid_t file);
 static int test_set(void);
 static int test_getset(const hid_t dxpl_id_simple);
 
@@ -325,6 +327,7 @@ int main(void)
     if(test_poly(dxpl_id_polynomial) < 0) TEST_ERROR;
     if(test_getset(dxpl_id_c_to_f) < 0) TEST_ERROR;
     if(test_specials(file_id) < 0) TEST_ERROR;
+    if(test_long(file_id) < 0) TEST_ERROR;
 
     /* Close the objects we opened/created */
     if(H5Dclose(dset_id_int) < 0) TEST_ERROR;
@@ -648,6 +651,105 @@ error:
      return -1;
 }
 
+/* Transforms of more elements than are evaluated at a time, with operators
+ * nested deeper than in the other tests */
+static int
+test_long(hid_t file)
+{
+    hid_t dxpl_id = -1, dset_id = -1, dataspace = -1;
+    hsize_t dim = LONG_NELMTS;
+    double *orig = NULL, *dblread = NULL;
+    float *fltread = NULL;
+    int *intread = NULL;
+    const char* expr1 = "x*x*x - (2*x+1)/(x+3) - -x";
+    const char* expr2 = "(x*x - 3*x)/2 + x";
+    size_t u;
+
+    TESTING("data transform of many elements")
+
+    if(NULL == (orig = (double *)HDmalloc(LONG_NELMTS * sizeof(double)))) TEST_ERROR
+    if(NULL == (dblread = (double *)HDmalloc(LONG_NELMTS * sizeof(double)))) TEST_ERROR
+    if(NULL == (fltread = (float *)HDmalloc(LONG_NELMTS * sizeof(float)))) TEST_ERROR
+    if(NULL == (intread = (int *)HDmalloc(LONG_NELMTS * sizeof(int)))) TEST_ERROR
+
+    for(u = 0; u < LONG_NELMTS; u++)
+        orig[u] = (double)(u % 97) - 47.5;
+
+    if((dataspace = H5Screate_simple(1, &dim, NULL)) < 0) TEST_ERROR
+    if((dset_id = H5Dcreate2(file, "/long", H5T_NATIVE_DOUBLE,
+            dataspace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Dwrite(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL,
+            H5P_DEFAULT, orig) < 0)
+        TEST_ERROR
+    if((dxpl_id = H5Pcreate(H5P_DATASET_XFER)) < 0) TEST_ERROR
+
+    /* Operation 1, read as double and as float */
+    if(H5Pset_data_transform(dxpl_id, expr1) < 0) TEST_ERROR
+    if(H5Dread(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL,
+            dxpl_id, dblread) < 0)
+        TEST_ERROR
+    if(H5Dread(dset_id, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL,
+            dxpl_id, fltread) < 0)
+        TEST_ERROR
+    for(u = 0; u < LONG_NELMTS; u++) {
+        double x = orig[u];
+        double res = x * x * x - (2 * x + 1) / (x + 3) - -x;
+
+        if(HDfabs(dblread[u] - res) > HDfabs(res) * 1e-12 ||
+                HDfabs((double)fltread[u] - res) > HDfabs(res) * 1e-5 + 1e-5) {
+            H5_FAILED();
+            HDfprintf(stderr, "    ERROR: element %lu is %g and %g, should be %g\n",
+                    (unsigned long)u, dblread[u], (double)fltread[u], res);
+            goto error;
+        } /* end if */
+    } /* end for */
+
+    /* Operation 2, read as int */
+    if(H5Pset_data_transform(dxpl_id, expr2) < 0) TEST_ERROR
+    if(H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL,
+            dxpl_id, intread) < 0)
+        TEST_ERROR
+    for(u = 0; u < LONG_NELMTS; u++) {
+        int x = (int)orig[u];
+        int res = (x * x - 3 * x) / 2 + x;
+
+        if(intread[u] != res) {
+            H5_FAILED();
+            HDfprintf(stderr, "    ERROR: element %lu is %d, should be %d\n",
+                    (unsigned long)u, intread[u], res);
+            goto error;
+        } /* end if */
+    } /* end for */
+
+    if(H5Pclose(dxpl_id) < 0) TEST_ERROR
+    if(H5Dclose(dset_id) < 0) TEST_ERROR
+    if(H5Sclose(dataspace) < 0) TEST_ERROR
+    HDfree(orig);
+    HDfree(dblread);
+    HDfree(fltread);
+    HDfree(intread);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dxpl_id);
+        H5Dclose(dset_id);
+        H5Sclose(dataspace);
+    } H5E_END_TRY
+    if(orig)
+        HDfree(orig);
+    if(dblread)
+        HDfree(dblread);
+    if(fltread)
+        HDfree(fltread);
+    if(intread)
+        HDfree(intread);
+    return -1;
+}
+
 static int
 test_copy(const hid_t dxpl_id_c_to_f_copy, const hid_t dxpl_id_polynomial_copy)
 {
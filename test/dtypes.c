@@ -4852,6 +4852,129 @@ error:
 }
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_conv_order
+ *
+ * Purpose:     Test byte order conversions of 2-, 4-, 8- and 16-byte
+ *              integers, for contiguous elements (with numbers of
+ *              elements that don't fill whole vectors and unaligned
+ *              buffers) and for strided elements in a compound datatype.
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_conv_order(void)
+{
+    const size_t    sizes[] = {2, 4, 8, 16};
+    const size_t    counts[] = {1, 7, 8, 33, 1029};
+    const size_t    max_nelmts = 1029;
+    hid_t           le = -1, be = -1;           /* Integer datatypes */
+    hid_t           le_cmpd = -1, be_cmpd = -1; /* Compound datatypes */
+    unsigned char   *buf = NULL, *orig = NULL;  /* Conversion buffers */
+    unsigned char   *bkg = NULL;                /* Background buffer */
+    size_t          buf_size;                   /* Size of buffers */
+    size_t          cmpd_size;                  /* Size of compound datatype */
+    size_t          i, j, k, u;
+
+    TESTING("byte order conversions");
+
+    /* Large enough for the compound datatype with 16-byte members */
+    buf_size = max_nelmts * (2 * 16 + 1) + 1;
+    if(NULL == (buf = (unsigned char *)HDmalloc(buf_size)))
+        TEST_ERROR
+    if(NULL == (orig = (unsigned char *)HDmalloc(buf_size)))
+        TEST_ERROR
+    if(NULL == (bkg = (unsigned char *)HDcalloc((size_t)1, buf_size)))
+        TEST_ERROR
+    for(u = 0; u < buf_size; u++)
+        orig[u] = (unsigned char)HDrandom();
+
+    for(i = 0; i < NELMTS(sizes); i++) {
+        size_t size = sizes[i];
+
+        if((le = H5Tcopy(H5T_STD_U8LE)) < 0) FAIL_STACK_ERROR
+        if(H5Tset_size(le, size) < 0) FAIL_STACK_ERROR
+        if(H5Tset_precision(le, 8 * size) < 0) FAIL_STACK_ERROR
+        if((be = H5Tcopy(le)) < 0) FAIL_STACK_ERROR
+        if(H5Tset_order(be, H5T_ORDER_BE) < 0) FAIL_STACK_ERROR
+
+        /* Contiguous elements, starting at aligned and unaligned addresses */
+        for(j = 0; j < NELMTS(counts); j++)
+            for(k = 0; k < 2; k++) {
+                HDmemcpy(buf + k, orig, counts[j] * size);
+                if(H5Tconvert(be, le, counts[j], buf + k, NULL, H5P_DEFAULT) < 0)
+                    FAIL_STACK_ERROR
+                for(u = 0; u < counts[j] * size; u++)
+                    if(buf[k + u] != orig[(u / size) * size + size - 1 - u % size]) {
+                        H5_FAILED();
+                        HDprintf("    %lu-byte elements: element %lu of %lu is wrong\n",
+                                (unsigned long)size, (unsigned long)(u / size),
+                                (unsigned long)counts[j]);
+                        goto error;
+                    } /* end if */
+            } /* end for */
+
+        /* Elements of a compound datatype, after a byte of padding */
+        cmpd_size = 2 * size + 1;
+        if((le_cmpd = H5Tcreate(H5T_COMPOUND, cmpd_size)) < 0) FAIL_STACK_ERROR
+        if(H5Tinsert(le_cmpd, "a", 1, le) < 0) FAIL_STACK_ERROR
+        if(H5Tinsert(le_cmpd, "b", 1 + size, le) < 0) FAIL_STACK_ERROR
+        if((be_cmpd = H5Tcreate(H5T_COMPOUND, cmpd_size)) < 0) FAIL_STACK_ERROR
+        if(H5Tinsert(be_cmpd, "a", 1, be) < 0) FAIL_STACK_ERROR
+        if(H5Tinsert(be_cmpd, "b", 1 + size, be) < 0) FAIL_STACK_ERROR
+
+        HDmemcpy(buf, orig, max_nelmts * cmpd_size);
+        if(H5Tconvert(le_cmpd, be_cmpd, max_nelmts, buf, bkg, H5P_DEFAULT) < 0)
+            FAIL_STACK_ERROR
+        for(u = 0; u < max_nelmts * cmpd_size; u++) {
+            size_t elmt = u / cmpd_size, off = u % cmpd_size;
+
+            /* (The padding comes from the background buffer) */
+            if(off == 0)
+                continue;
+            off -= 1;
+            if(buf[u] != orig[elmt * cmpd_size + 1 + (off / size) * size + size - 1 - off % size]) {
+                H5_FAILED();
+                HDprintf("    %lu-byte compound members: element %lu is wrong\n",
+                        (unsigned long)size, (unsigned long)elmt);
+                goto error;
+            } /* end if */
+        } /* end for */
+
+        if(H5Tclose(le_cmpd) < 0) FAIL_STACK_ERROR
+        if(H5Tclose(be_cmpd) < 0) FAIL_STACK_ERROR
+        if(H5Tclose(le) < 0) FAIL_STACK_ERROR
+        if(H5Tclose(be) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    HDfree(buf);
+    HDfree(orig);
+    HDfree(bkg);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Tclose(le_cmpd);
+        H5Tclose(be_cmpd);
+        H5Tclose(le);
+        H5Tclose(be);
+    } H5E_END_TRY;
+    if(buf)
+        HDfree(buf);
+    if(orig)
+        HDfree(orig);
+    if(bkg)
+        HDfree(bkg);
+
+    return 1;
+} /* end test_conv_order() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    test_bitfield_funcs
  *
@@ -7893,6 +8016,7 @@ main(void)
     nerrors += test_conv_enum_1();
     nerrors += test_conv_enum_2();
     nerrors += test_conv_bitfield();
+    nerrors += test_conv_order();
     nerrors += test_bitfield_funcs();
     nerrors += test_opaque();
     nerrors += test_set_order();
@@ -0,0 +1,512 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Tests event sets and the asynchronous dataset, group and
+ *              file operations that are inserted into them.
+ */
+#include "h5test.h"
+
+const char *FILENAME[] = {
+    "event_set",
+    NULL
+};
+
+#define DSET_NAME       "dset"
+#define GROUP_NAME      "group"
+#define NELMTS          1024
+#define NWRITES         8
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_es_create
+ *
+ * Purpose:     Tests creating, querying and closing an empty event set.
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_es_create(void)
+{
+    hid_t       es_id = H5I_INVALID_HID;
+    size_t      count;
+    size_t      num_in_progress;
+    size_t      num_errs;
+    hbool_t     err_occurred;
+
+    TESTING("event set creation");
+
+    if((es_id = H5EScreate()) < 0)
+        TEST_ERROR
+    if(H5Iget_type(es_id) != H5I_EVENTSET)
+        TEST_ERROR
+
+    if(H5ESget_count(es_id, &count) < 0)
+        TEST_ERROR
+    if(count != 0)
+        TEST_ERROR
+    if(H5ESget_err_status(es_id, &err_occurred) < 0)
+        TEST_ERROR
+    if(err_occurred)
+        TEST_ERROR
+    if(H5ESget_err_count(es_id, &num_errs) < 0)
+        TEST_ERROR
+    if(num_errs != 0)
+        TEST_ERROR
+
+    /* Waiting on an empty event set returns right away */
+    if(H5ESwait(es_id, H5ES_WAIT_NONE, &num_in_progress, &err_occurred) < 0)
+        TEST_ERROR
+    if(num_in_progress != 0 || err_occurred)
+        TEST_ERROR
+    if(H5ESwait(es_id, H5ES_WAIT_FOREVER, &num_in_progress, &err_occurred) < 0)
+        TEST_ERROR
+    if(num_in_progress != 0 || err_occurred)
+        TEST_ERROR
+
+    if(H5ESclose(es_id) < 0)
+        TEST_ERROR
+
+    /* The ID isn't valid any more */
+    H5E_BEGIN_TRY {
+        if(H5ESget_count(es_id, &count) >= 0)
+            TEST_ERROR
+    } H5E_END_TRY;
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5ESclose(es_id);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_es_create() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_es_dataset_io
+ *
+ * Purpose:     Tests asynchronous dataset writes and reads, a flush and
+ *              asynchronous opens, closing the IDs passed to them before
+ *              the operations are waited on.
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_es_dataset_io(hid_t fapl)
+{
+    char        filename[1024];
+    hid_t       file_id = H5I_INVALID_HID;
+    hid_t       dset_id = H5I_INVALID_HID;
+    hid_t       group_id = H5I_INVALID_HID;
+    hid_t       space_id = H5I_INVALID_HID;
+    hid_t       mspace_id = H5I_INVALID_HID;
+    hid_t       fspace_id = H5I_INVALID_HID;
+    hid_t       es_id = H5I_INVALID_HID;
+    hsize_t     dims[1] = {NELMTS};
+    hsize_t     start[1];
+    hsize_t     count[1];
+    int        *wbuf = NULL;
+    int        *rbuf = NULL;
+    size_t      num_in_progress;
+    hbool_t     err_occurred;
+    unsigned    u;
+
+    TESTING("asynchronous dataset I/O");
+
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+
+    if(NULL == (wbuf = (int *)HDmalloc(NELMTS * sizeof(int))))
+        TEST_ERROR
+    if(NULL == (rbuf = (int *)HDcalloc(NELMTS, sizeof(int))))
+        TEST_ERROR
+    for(u = 0; u < NELMTS; u++)
+        wbuf[u] = (int)u;
+
+    if((es_id = H5EScreate()) < 0)
+        TEST_ERROR
+
+    /* Set up the file */
+    if((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+    if((group_id = H5Gcreate2(file_id, GROUP_NAME, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Gclose(group_id) < 0)
+        TEST_ERROR
+    group_id = H5I_INVALID_HID;
+    if((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    if((dset_id = H5Dcreate2(file_id, DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Write the dataset in pieces, closing the dataspaces right away */
+    count[0] = NELMTS / NWRITES;
+    for(u = 0; u < NWRITES; u++) {
+        start[0] = u * count[0];
+        if((mspace_id = H5Screate_simple(1, dims, NULL)) < 0)
+            TEST_ERROR
+        if(H5Sselect_hyperslab(mspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR
+        if((fspace_id = H5Scopy(mspace_id)) < 0)
+            TEST_ERROR
+        if(H5Dwrite_async(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, H5P_DEFAULT, wbuf, es_id) < 0)
+            TEST_ERROR
+        if(H5Sclose(mspace_id) < 0)
+            TEST_ERROR
+        mspace_id = H5I_INVALID_HID;
+        if(H5Sclose(fspace_id) < 0)
+            TEST_ERROR
+        fspace_id = H5I_INVALID_HID;
+    } /* end for */
+    if(H5Fflush_async(dset_id, H5F_SCOPE_LOCAL, es_id) < 0)
+        TEST_ERROR
+
+    /* Close the dataset before the operations on it are waited for */
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    dset_id = H5I_INVALID_HID;
+
+    if(H5ESwait(es_id, H5ES_WAIT_FOREVER, &num_in_progress, &err_occurred) < 0)
+        TEST_ERROR
+    if(num_in_progress != 0 || err_occurred)
+        TEST_ERROR
+
+    /* Open the dataset and read it back, all in the event set */
+    if((dset_id = H5Dopen_async(file_id, DSET_NAME, H5P_DEFAULT, es_id)) < 0)
+        TEST_ERROR
+    if(H5Dread_async(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf, es_id) < 0)
+        TEST_ERROR
+    if((group_id = H5Gopen_async(file_id, GROUP_NAME, H5P_DEFAULT, es_id)) < 0)
+        TEST_ERROR
+
+    if(H5ESwait(es_id, H5ES_WAIT_FOREVER, &num_in_progress, &err_occurred) < 0)
+        TEST_ERROR
+    if(num_in_progress != 0 || err_occurred)
+        TEST_ERROR
+    for(u = 0; u < NELMTS; u++)
+        if(rbuf[u] != wbuf[u])
+            TEST_ERROR
+
+    /* The opened objects work like any others */
+    if(H5Iget_type(dset_id) != H5I_DATASET)
+        TEST_ERROR
+    if(H5Iget_type(group_id) != H5I_GROUP)
+        TEST_ERROR
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    dset_id = H5I_INVALID_HID;
+    if(H5Gclose(group_id) < 0)
+        TEST_ERROR
+    group_id = H5I_INVALID_HID;
+
+    if(H5ESclose(es_id) < 0)
+        TEST_ERROR
+    es_id = H5I_INVALID_HID;
+    if(H5Sclose(space_id) < 0)
+        TEST_ERROR
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5ESwait(es_id, H5ES_WAIT_FOREVER, &num_in_progress, &err_occurred);
+        H5ESclose(es_id);
+        H5Dclose(dset_id);
+        H5Gclose(group_id);
+        H5Sclose(mspace_id);
+        H5Sclose(fspace_id);
+        H5Sclose(space_id);
+        H5Fclose(file_id);
+    } H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    return -1;
+} /* end test_es_dataset_io() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_es_errors
+ *
+ * Purpose:     Tests that failed asynchronous operations are counted by
+ *              the event set, and that the ID from a failed open isn't
+ *              valid.
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_es_errors(hid_t fapl)
+{
+    char        filename[1024];
+    hid_t       file_id = H5I_INVALID_HID;
+    hid_t       dset_id = H5I_INVALID_HID;
+    hid_t       space_id = H5I_INVALID_HID;
+    hid_t       es_id = H5I_INVALID_HID;
+    hsize_t     dims[1] = {NELMTS};
+    hsize_t     big_dims[1] = {2 * NELMTS};
+    int        *buf = NULL;
+    size_t      num_in_progress;
+    size_t      num_errs;
+    hbool_t     err_occurred;
+    herr_t      ret;
+
+    TESTING("asynchronous operation errors");
+
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+
+    if(NULL == (buf = (int *)HDcalloc(2 * NELMTS, sizeof(int))))
+        TEST_ERROR
+
+    if((es_id = H5EScreate()) < 0)
+        TEST_ERROR
+    if((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+    if((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    if((dset_id = H5Dcreate2(file_id, DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Sclose(space_id) < 0)
+        TEST_ERROR
+
+    /* Bad arguments are still caught right away */
+    H5E_BEGIN_TRY {
+        ret = H5Dwrite_async(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf, H5I_INVALID_HID);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Dwrite_async(file_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf, es_id);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        TEST_ERROR
+
+    /* A write with a memory selection that doesn't match the file's fails,
+     * either right away or later, in the event set
+     */
+    if((space_id = H5Screate_simple(1, big_dims, NULL)) < 0)
+        TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Dwrite_async(dset_id, H5T_NATIVE_INT, space_id, H5S_ALL, H5P_DEFAULT, buf, es_id);
+        if(H5ESwait(es_id, H5ES_WAIT_FOREVER, &num_in_progress, &err_occurred) < 0)
+            TEST_ERROR
+    } H5E_END_TRY;
+    if(num_in_progress != 0)
+        TEST_ERROR
+    if(ret >= 0) {
+        if(!err_occurred)
+            TEST_ERROR
+        if(H5ESget_err_count(es_id, &num_errs) < 0)
+            TEST_ERROR
+        if(num_errs != 1)
+            TEST_ERROR
+    } /* end if */
+    if(H5Sclose(space_id) < 0)
+        TEST_ERROR
+    space_id = H5I_INVALID_HID;
+
+    /* Opening a dataset that doesn't exist fails right away or leaves an
+     * ID that can't be used
+     */
+    H5E_BEGIN_TRY {
+        hid_t bad_id = H5Dopen_async(file_id, "no_such_dataset", H5P_DEFAULT, es_id);
+
+        if(bad_id >= 0) {
+            if(H5Iis_valid(bad_id) > 0)
+                TEST_ERROR
+            if(H5Dclose(bad_id) >= 0)
+                TEST_ERROR
+        } /* end if */
+        if(H5ESwait(es_id, H5ES_WAIT_FOREVER, &num_in_progress, &err_occurred) < 0)
+            TEST_ERROR
+    } H5E_END_TRY;
+    if(num_in_progress != 0)
+        TEST_ERROR
+
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    dset_id = H5I_INVALID_HID;
+    if(H5ESclose(es_id) < 0)
+        TEST_ERROR
+    es_id = H5I_INVALID_HID;
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+
+    HDfree(buf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5ESwait(es_id, H5ES_WAIT_FOREVER, &num_in_progress, &err_occurred);
+        H5ESclose(es_id);
+        H5Dclose(dset_id);
+        H5Sclose(space_id);
+        H5Fclose(file_id);
+    } H5E_END_TRY;
+    HDfree(buf);
+    return -1;
+} /* end test_es_errors() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_es_cancel
+ *
+ * Purpose:     Tests canceling the operations of an event set, and that
+ *              an event set with operations in progress can't be closed.
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_es_cancel(hid_t fapl)
+{
+    char        filename[1024];
+    hid_t       file_id = H5I_INVALID_HID;
+    hid_t       dset_id = H5I_INVALID_HID;
+    hid_t       space_id = H5I_INVALID_HID;
+    hid_t       es_id = H5I_INVALID_HID;
+    hsize_t     dims[1] = {NELMTS};
+    int        *buf = NULL;
+    size_t      num_not_canceled;
+    size_t      num_in_progress;
+    size_t      count;
+    hbool_t     err_occurred;
+    unsigned    u;
+
+    TESTING("canceling asynchronous operations");
+
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+
+    if(NULL == (buf = (int *)HDcalloc(NELMTS, sizeof(int))))
+        TEST_ERROR
+
+    if((es_id = H5EScreate()) < 0)
+        TEST_ERROR
+    if((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+    if((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    if((dset_id = H5Dcreate2(file_id, DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    for(u = 0; u < NWRITES; u++)
+        if(H5Dwrite_async(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf, es_id) < 0)
+            TEST_ERROR
+
+    /* An event set with operations in progress can't be closed */
+    if(H5ESget_count(es_id, &count) < 0)
+        TEST_ERROR
+    if(count > 0) {
+        herr_t ret;
+
+        H5E_BEGIN_TRY {
+            ret = H5ESclose(es_id);
+        } H5E_END_TRY;
+        if(ret >= 0)
+            TEST_ERROR
+    } /* end if */
+
+    /* Cancel what hasn't been started; anything else runs to completion */
+    if(H5EScancel(es_id, &num_not_canceled, &err_occurred) < 0)
+        TEST_ERROR
+    if(err_occurred)
+        TEST_ERROR
+    if(H5ESwait(es_id, H5ES_WAIT_FOREVER, &num_in_progress, &err_occurred) < 0)
+        TEST_ERROR
+    if(num_in_progress != 0 || err_occurred)
+        TEST_ERROR
+    if(H5ESget_count(es_id, &count) < 0)
+        TEST_ERROR
+    if(count != 0)
+        TEST_ERROR
+
+    if(H5ESclose(es_id) < 0)
+        TEST_ERROR
+    es_id = H5I_INVALID_HID;
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if(H5Sclose(space_id) < 0)
+        TEST_ERROR
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+
+    HDfree(buf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5ESwait(es_id, H5ES_WAIT_FOREVER, &num_in_progress, &err_occurred);
+        H5ESclose(es_id);
+        H5Dclose(dset_id);
+        H5Sclose(space_id);
+        H5Fclose(file_id);
+    } H5E_END_TRY;
+    HDfree(buf);
+    return -1;
+} /* end test_es_cancel() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Tests event sets
+ *
+ * Return:      EXIT_SUCCESS/EXIT_FAILURE
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(void)
+{
+    hid_t       fapl = H5I_INVALID_HID;
+    int         nerrors = 0;
+
+    h5_reset();
+    fapl = h5_fileaccess();
+
+    nerrors += test_es_create() < 0 ? 1 : 0;
+    nerrors += test_es_dataset_io(fapl) < 0 ? 1 : 0;
+    nerrors += test_es_errors(fapl) < 0 ? 1 : 0;
+    nerrors += test_es_cancel(fapl) < 0 ? 1 : 0;
+
+    if(nerrors)
+        goto error;
+
+    HDputs("All event set tests passed.");
+    h5_cleanup(FILENAME, fapl);
+
+    HDexit(EXIT_SUCCESS);
+
+error:
+    HDprintf("***** %d EVENT SET TEST%s FAILED! *****\n", nerrors, 1 == nerrors ? "" : "S");
+    HDexit(EXIT_FAILURE);
+} /* end main() */
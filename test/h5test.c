@@ -1036,6 +1036,12 @@ h5_get_vfd_fapl(hid_t fapl)
          */
         if(H5Pset_fapl_direct(fapl, 1024, 4096, 8 * 4096) < 0)
             goto error;
+#endif
+#ifdef H5_HAVE_IOURING
+    } else if(!HDstrcmp(tok, "iouring")) {
+        /* Linux io_uring, with the default queue depth and buffered I/O */
+        if(H5Pset_fapl_iouring(fapl, 0, (size_t)0, (size_t)0) < 0)
+            goto error;
 #endif
     } else {
         /* Unknown driver */
@@ -1392,6 +1398,9 @@ h5_get_file_size(const char *filename, hid_t fapl)
 #ifdef H5_HAVE_DIRECT
                 driver == H5FD_DIRECT ||
 #endif /* H5_HAVE_DIRECT */
+#ifdef H5_HAVE_IOURING
+                driver == H5FD_IOURING ||
+#endif /* H5_HAVE_IOURING */
                 driver == H5FD_LOG) {
             /* Get the file's statistics */
             if(0 == HDstat(filename, &sb))
@@ -1939,6 +1948,8 @@ static const H5FD_class_t H5FD_dummy_g = {
     NULL,                       /* get_handle   */
     dummy_vfd_read,             /* read         */
     dummy_vfd_write,            /* write        */
+    NULL,                       /* read_vector  */
+    NULL,                       /* write_vector */
     NULL,                       /* flush        */
     NULL,                       /* truncate     */
     NULL,                       /* lock         */
@@ -53,6 +53,7 @@ static unsigned test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
 static unsigned test_lru_processing(hid_t orig_fapl, const char *env_h5_drvr);
 static unsigned test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr);
 static unsigned test_stats_collection(hid_t orig_fapl, const char *env_h5_drvr);
+static unsigned test_read_ahead(hid_t orig_fapl, const char *env_h5_drvr);
 
 /* helper routines */
 static unsigned create_file(char *filename, hid_t fcpl, hid_t fapl);
@@ -2008,6 +2009,183 @@ error:
 
     return 1;
 } /* test_stats_collection */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_read_ahead()
+ *
+ * Purpose:     Check that the page buffer reads pages ahead of sequential
+ *              page accesses in a file opened read-only, that the pages
+ *              read ahead hold the right data and are counted in the
+ *              statistics, and that pages aren't read ahead of backward
+ *              accesses or in a file opened read-write.
+ *
+ * Return:      0 if test is sucessful
+ *              1 if test fails
+ *
+ *-------------------------------------------------------------------------
+ */
+#define RA_PAGE_ELMTS   200
+#define RA_NPAGES       20
+static unsigned
+test_read_ahead(hid_t orig_fapl, const char *env_h5_drvr)
+{
+    char filename[FILENAME_LEN]; /* Filename to use */
+    hid_t file_id = -1;          /* File ID */
+    hid_t fcpl = -1;
+    hid_t fapl = -1;
+    hid_t fapl2 = -1;
+    const size_t page_size = sizeof(int) * RA_PAGE_ELMTS;
+    unsigned max_pages = 0;
+    unsigned accesses[2], hits[2], misses[2], evictions[2], bypasses[2];
+    unsigned prefetches[2], prefetch_hits[2];
+    haddr_t meta_addr = HADDR_UNDEF;
+    int *data = NULL;
+    int i, j, pass;
+    H5F_t *f = NULL;
+
+    TESTING("Read-Ahead");
+
+    h5_fixname(FILENAME[0], orig_fapl, filename, sizeof(filename));
+
+    if((fapl = H5Pcopy(orig_fapl)) < 0)
+        TEST_ERROR
+
+    if(set_multi_split(env_h5_drvr, fapl, page_size) != 0)
+        TEST_ERROR;
+
+    if((data = (int *)HDcalloc((size_t)(RA_PAGE_ELMTS * RA_NPAGES), sizeof(int))) == NULL)
+        TEST_ERROR
+
+    if((fcpl = H5Pcreate(H5P_FILE_CREATE)) < 0)
+        TEST_ERROR;
+    if(H5Pset_file_space_strategy(fcpl, H5F_FSPACE_STRATEGY_PAGE, 0, (hsize_t)1) < 0)
+        TEST_ERROR;
+    if(H5Pset_file_space_page_size(fcpl, (hsize_t)page_size) < 0)
+        TEST_ERROR;
+
+    /* The read-ahead limit defaults to off */
+    if(H5Pget_page_buffer_read_ahead(fapl, &max_pages) < 0)
+        FAIL_STACK_ERROR;
+    if(max_pages != 0)
+        TEST_ERROR;
+
+    /* Write a run of metadata pages, each element telling where it is */
+    if(H5Pset_page_buffer_size(fapl, page_size * 40, 0, 0) < 0)
+        TEST_ERROR;
+    if((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl)) < 0)
+        FAIL_STACK_ERROR;
+    if(NULL == (f = (H5F_t *)H5VL_object(file_id)))
+        FAIL_STACK_ERROR;
+
+    if(HADDR_UNDEF == (meta_addr = H5MF_alloc(f, H5FD_MEM_SUPER, page_size * RA_NPAGES)))
+        FAIL_STACK_ERROR;
+    if(0 != meta_addr % page_size)
+        TEST_ERROR;
+    for(i = 0; i < RA_PAGE_ELMTS * RA_NPAGES; i++)
+        data[i] = i;
+    if(H5F_block_write(f, H5FD_MEM_SUPER, meta_addr, page_size * RA_NPAGES, data) < 0)
+        FAIL_STACK_ERROR;
+
+    if(H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Read up to 8 pages ahead, from a page buffer of 40 pages */
+    if(H5Pset_page_buffer_read_ahead(fapl, 8) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Pget_page_buffer_read_ahead(fapl, &max_pages) < 0)
+        FAIL_STACK_ERROR;
+    if(max_pages != 8)
+        TEST_ERROR;
+
+    /* Read the first part of each page, forward and then backward, each
+     * time from a freshly opened file.  Then read forward in a file
+     * opened read-write.
+     */
+    for(pass = 0; pass < 3; pass++) {
+        if((file_id = H5Fopen(filename, (pass < 2 ? H5F_ACC_RDONLY : H5F_ACC_RDWR), fapl)) < 0)
+            FAIL_STACK_ERROR;
+        if(NULL == (f = (H5F_t *)H5VL_object(file_id)))
+            FAIL_STACK_ERROR;
+
+        /* The file's access property list has the read-ahead limit */
+        if((fapl2 = H5Fget_access_plist(file_id)) < 0)
+            FAIL_STACK_ERROR;
+        max_pages = 0;
+        if(H5Pget_page_buffer_read_ahead(fapl2, &max_pages) < 0)
+            FAIL_STACK_ERROR;
+        if(max_pages != 8)
+            TEST_ERROR;
+        if(H5Pclose(fapl2) < 0)
+            FAIL_STACK_ERROR;
+
+        if(H5Freset_page_buffering_stats(file_id) < 0)
+            FAIL_STACK_ERROR;
+
+        for(i = 0; i < RA_NPAGES; i++) {
+            int page = (1 == pass ? RA_NPAGES - 1 - i : i);
+
+            HDmemset(data, 0, page_size);
+            if(H5F_block_read(f, H5FD_MEM_SUPER, meta_addr + ((haddr_t)page * page_size), page_size / 2, data) < 0)
+                FAIL_STACK_ERROR;
+            for(j = 0; j < RA_PAGE_ELMTS / 2; j++)
+                if(data[j] != (page * RA_PAGE_ELMTS) + j)
+                    TEST_ERROR;
+        } /* end for */
+
+        if(H5PB_get_stats(f->shared->page_buf, accesses, hits, misses, evictions, bypasses, prefetches, prefetch_hits) < 0)
+            FAIL_STACK_ERROR;
+
+        /* Every page was either read or read ahead */
+        if(accesses[0] != RA_NPAGES)
+            TEST_ERROR;
+        if(misses[0] + prefetch_hits[0] != RA_NPAGES)
+            TEST_ERROR;
+        if(hits[0] != prefetch_hits[0])
+            TEST_ERROR;
+        if(prefetch_hits[0] > prefetches[0])
+            TEST_ERROR;
+
+        if(0 == pass) {
+            /* Reading forward, the window grows to 2, 4 and 8 pages */
+            if(misses[0] > 5)
+                TEST_ERROR;
+        } /* end if */
+        else {
+            /* No pages are read ahead of backward reads, or when the file
+             * can be written to
+             */
+            if(prefetches[0] != 0)
+                TEST_ERROR;
+            if(misses[0] != RA_NPAGES)
+                TEST_ERROR;
+        } /* end else */
+
+        if(H5Fclose(file_id) < 0)
+            FAIL_STACK_ERROR;
+    } /* end for */
+
+    if(H5Pclose(fcpl) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Pclose(fapl) < 0)
+        FAIL_STACK_ERROR;
+    HDfree(data);
+
+    PASSED()
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(fapl2);
+        H5Pclose(fapl);
+        H5Pclose(fcpl);
+        H5Fclose(file_id);
+        if(data)
+            HDfree(data);
+    } H5E_END_TRY;
+
+    return 1;
+} /* test_read_ahead */
 #endif /* #ifndef H5_HAVE_PARALLEL */
 
 
@@ -2187,6 +2365,7 @@ main(void)
     nerrors += test_lru_processing(fapl, env_h5_drvr);
     nerrors += test_min_threshold(fapl, env_h5_drvr);
     nerrors += test_stats_collection(fapl, env_h5_drvr);
+    nerrors += test_read_ahead(fapl, env_h5_drvr);
 
 #endif /* H5_HAVE_PARALLEL */
 
@@ -301,6 +301,88 @@ test_large(hid_t fcpl, hid_t fapl, hbool_t new_format)
 } /* end test_large() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    iterate_large_cb
+ *
+ * Purpose:     Link iteration callback for test_iterate_large(), which
+ *              checks that the links are visited in increasing name order.
+ *
+ * Return:      Success:    0
+ *
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+iterate_large_cb(hid_t H5_ATTR_UNUSED group_id, const char *link_name,
+    const H5L_info2_t H5_ATTR_UNUSED *info, void *_op_data)
+{
+    char *prev_name = (char *)_op_data;
+
+    if(*prev_name && HDstrcmp(prev_name, link_name) >= 0)
+        return -1;
+    HDstrncpy(prev_name, link_name, NAME_BUF_SIZE - 1);
+
+    return 0;
+} /* end iterate_large_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_iterate_large
+ *
+ * Purpose:     Iterates over the large directory created by test_large(),
+ *              after reopening the file, so that the B-tree nodes and
+ *              symbol table nodes are loaded into the metadata cache
+ *              together while iterating.
+ *
+ * Return:      Success:    0
+ *
+ *              Failure:    number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_iterate_large(hid_t fapl, hbool_t new_format)
+{
+    hid_t       fid = (-1);             /* File ID */
+    hid_t       cwg = (-1);             /* Group ID */
+    char        filename[NAME_BUF_SIZE];
+    char        prev_name[NAME_BUF_SIZE];
+    hsize_t     idx = 0;                /* Iteration index */
+    int         pass;
+
+    if(new_format)
+        TESTING("iterating over large directories (w/new group format)")
+    else
+        TESTING("iterating over large directories")
+
+    h5_fixname(FILENAME[0], fapl, filename, sizeof(filename));
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0) TEST_ERROR
+    if((cwg = H5Gopen2(fid, "/big", H5P_DEFAULT)) < 0) TEST_ERROR
+
+    /* Iterate twice, once loading the nodes and once with them cached */
+    for(pass = 0; pass < 2; pass++) {
+        idx = 0;
+        prev_name[0] = '\0';
+        if(H5Literate2(cwg, H5_INDEX_NAME, H5_ITER_INC, &idx, iterate_large_cb, prev_name) < 0) TEST_ERROR
+        if(idx != LARGE_NOBJS) TEST_ERROR
+    } /* end for */
+
+    if(H5Gclose(cwg) < 0) TEST_ERROR
+    if(H5Fclose(fid) < 0) TEST_ERROR
+
+    PASSED();
+    return 0;
+
+ error:
+    H5E_BEGIN_TRY {
+        H5Gclose(cwg);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_iterate_large() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    lifecycle
  *
@@ -1216,6 +1298,7 @@ main(void)
         nerrors += test_misc(my_fcpl, my_fapl, new_format);
         nerrors += test_long(my_fcpl, my_fapl, new_format);
         nerrors += test_large(my_fcpl, my_fapl, new_format);
+        nerrors += test_iterate_large(my_fapl, new_format);
     } /* end for */
 
     /* New format group specific tests (require new format features) */
@@ -219,6 +219,143 @@ test_chksum_large(void)
 } /* test_chksum_large() */
 
 
+/****************************************************************
+**
+**  test_chksum_crc32c(): Checksum buffers with CRC32C
+**
+****************************************************************/
+static void
+test_chksum_crc32c(void)
+{
+    const char *check = "123456789";    /* The standard "check" string */
+    uint8_t buf[BUF_LEN];               /* Buffer to checksum */
+    uint32_t chksum;                    /* Checksum value */
+    uint32_t ref;                       /* Reference checksum value */
+    size_t u, v, w;                     /* Local index variables */
+
+    /* Known values (from RFC 3720) */
+    chksum = H5_checksum_crc32c(check, HDstrlen(check));
+    VERIFY(chksum, 0xe3069283, "H5_checksum_crc32c");
+
+    HDmemset(buf, 0, 32);
+    chksum = H5_checksum_crc32c(buf, (size_t)32);
+    VERIFY(chksum, 0x8a9136aa, "H5_checksum_crc32c");
+
+    HDmemset(buf, 0xff, 32);
+    chksum = H5_checksum_crc32c(buf, (size_t)32);
+    VERIFY(chksum, 0x62a8ab43, "H5_checksum_crc32c");
+
+    /* Compare with the bit-at-a-time CRC for all the lengths and
+     * alignments the word-at-a-time code handles differently */
+    for(u = 0; u < BUF_LEN; u++)
+        buf[u] = (uint8_t)(u * 7);
+    for(u = 0; u < 8; u++)
+        for(v = 1; v <= 40; v++) {
+            ref = 0xffffffff;
+            for(w = u; w < u + v; w++) {
+                unsigned k;
+
+                ref ^= buf[w];
+                for(k = 0; k < 8; k++)
+                    ref = (ref & 1) ? (0x82F63B78 ^ (ref >> 1)) : (ref >> 1);
+            } /* end for */
+            ref ^= 0xffffffff;
+
+            chksum = H5_checksum_crc32c(buf + u, v);
+            VERIFY(chksum, ref, "H5_checksum_crc32c");
+        } /* end for */
+} /* test_chksum_crc32c() */
+
+
+/****************************************************************
+**
+**  test_chksum_fletcher32_ref(): Fletcher32 checksum a buffer a
+**      word at a time, like the library used to do.
+**
+****************************************************************/
+static uint32_t
+test_chksum_fletcher32_ref(const uint8_t *data, size_t nbytes)
+{
+    size_t len = nbytes / 2;
+    uint32_t sum1 = 0, sum2 = 0;
+
+    while(len) {
+        size_t tlen = len > 360 ? 360 : len;
+        len -= tlen;
+        do {
+            sum1 += (uint32_t)(((uint16_t)data[0]) << 8) | ((uint16_t)data[1]);
+            data += 2;
+            sum2 += sum1;
+        } while(--tlen);
+        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    } /* end while */
+    if(nbytes % 2) {
+        sum1 += (uint32_t)(((uint16_t)*data) << 8);
+        sum2 += sum1;
+        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    } /* end if */
+    sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+    sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+
+    return (sum2 << 16) | sum1;
+} /* test_chksum_fletcher32_ref() */
+
+
+/****************************************************************
+**
+**  test_chksum_vectorized(): Check that fletcher32 checksums
+**      computed with SIMD instructions are the same as the ones
+**      computed a word at a time, for many lengths and alignments,
+**      and that lookup3 doesn't depend on the alignment.  Buffers
+**      of all 0xff bytes have sums that are multiples of 65535,
+**      which fletcher32 must still report as 0xffff.
+**
+****************************************************************/
+#define VEC_BUF_LEN ((1024 * 1024) + 100)
+static void
+test_chksum_vectorized(void)
+{
+    uint8_t *buf;               /* Buffer for checksum calculations */
+    uint32_t chksum;            /* Checksum value */
+    const size_t large_lens[] = {32 * 1024, (32 * 1024) + 32, (32 * 1024) + 33,
+        (64 * 1024) - 2, 1024 * 1024, VEC_BUF_LEN - 8};
+    size_t u, v, w;             /* Local index variables */
+
+    buf = (uint8_t *)HDmalloc((size_t)VEC_BUF_LEN);
+    CHECK_PTR(buf, "HDmalloc");
+
+    for(w = 0; w < 3; w++) {
+        /* Random data, all 0xff bytes and mostly zero bytes */
+        for(u = 0; u < VEC_BUF_LEN; u++)
+            buf[u] = (uint8_t)(w == 0 ? HDrandom() : (w == 1 ? 0xff : (u % 1000 == 999)));
+
+        for(u = 0; u < 4; u++) {
+            for(v = 1; v < 300; v++) {
+                chksum = H5_checksum_fletcher32(buf + u, v);
+                VERIFY(chksum, test_chksum_fletcher32_ref(buf + u, v), "H5_checksum_fletcher32");
+            } /* end for */
+            for(v = 0; v < NELMTS(large_lens); v++) {
+                chksum = H5_checksum_fletcher32(buf + u, large_lens[v]);
+                VERIFY(chksum, test_chksum_fletcher32_ref(buf + u, large_lens[v]), "H5_checksum_fletcher32");
+            } /* end for */
+        } /* end for */
+    } /* end for */
+
+    /* lookup3 reads whole words of data at a time, check that it gets
+     * the same checksum as test_chksum_large() at other alignments */
+    for(u = 1; u < 4; u++) {
+        for(v = 0; v < BUF_LEN; v++)
+            buf[u + v] = (uint8_t)(v * 3);
+        chksum = H5_checksum_lookup3(buf + u, (size_t)BUF_LEN, 0);
+        VERIFY(chksum, 0x1bd2ee7b, "H5_checksum_lookup3");
+    } /* end for */
+
+    HDfree(buf);
+} /* test_chksum_vectorized() */
+
+
 /****************************************************************
 **
 **  test_checksum(): Main checksum testing routine.
@@ -236,6 +373,8 @@ test_checksum(void)
     test_chksum_size_three();		/* Test buffer w/only 3 bytes */
     test_chksum_size_four();		/* Test buffer w/only 4 bytes */
     test_chksum_large();		/* Test buffer w/larger # of bytes */
+    test_chksum_crc32c();		/* Test CRC32C checksums */
+    test_chksum_vectorized();		/* Test vectorized checksums */
 
 } /* test_checksum() */
 
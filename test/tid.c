@@ -756,6 +756,160 @@ out:
     return -1;
 } /* end test_remove_clear_type() */
 
+/* Number of IDs for test_many_ids */
+#define TEST_MANY_NIDS  5000
+
+/* User data for test_many_ids_cb */
+typedef struct test_many_ids_t {
+    H5I_type_t type;            /* Type of the IDs */
+    hid_t *ids;                 /* IDs, or H5I_INVALID_HID once removed */
+    hid_t prev_id;              /* Last ID visited */
+    long nvisited;              /* Number of IDs visited */
+    hbool_t remove_next;        /* Whether to remove the ID after each one visited */
+    hbool_t order_ok;           /* Whether the IDs were visited in order */
+} test_many_ids_t;
+
+/* Iteration callback that checks the IDs are visited in order, optionally
+ * removing the next ID */
+static herr_t
+test_many_ids_cb(hid_t id, void *_udata)
+{
+    test_many_ids_t *udata = (test_many_ids_t *)_udata;
+    int *obj = (int *)H5Iobject_verify(id, udata->type);
+
+    if(obj == NULL || udata->ids[*obj] != id || id <= udata->prev_id)
+        udata->order_ok = FALSE;
+    udata->prev_id = id;
+    udata->nvisited++;
+
+    if(udata->remove_next && *obj + 1 < TEST_MANY_NIDS && udata->ids[*obj + 1] != H5I_INVALID_HID) {
+        if(H5Iremove_verify(udata->ids[*obj + 1], udata->type) == NULL)
+            return -1;
+        udata->ids[*obj + 1] = H5I_INVALID_HID;
+    } /* end if */
+
+    return 0;
+} /* end test_many_ids_cb() */
+
+/* Test looking up, removing and iterating over many IDs */
+static int test_many_ids(void)
+{
+    H5I_type_t      type;
+    test_many_ids_t udata;
+    hid_t           ids[TEST_MANY_NIDS];
+    int             objs[TEST_MANY_NIDS];
+    long            nleft;
+    hsize_t         nmembers;
+    int             i;
+    herr_t          ret;        /* return value */
+
+    type = H5Iregister_type((size_t)64, 0, NULL);
+    CHECK(type, H5I_BADID, "H5Iregister_type");
+    if(type == H5I_BADID)
+        goto out;
+
+    for(i = 0; i < TEST_MANY_NIDS; i++) {
+        objs[i] = i;
+        ids[i] = H5Iregister(type, &objs[i]);
+        CHECK(ids[i], FAIL, "H5Iregister");
+        if(ids[i] == FAIL)
+            goto out;
+    } /* end for */
+
+    /* Remove every third ID, in reverse */
+    for(i = TEST_MANY_NIDS - 1; i >= 0; i--)
+        if(i % 3 == 0) {
+            if(H5Iremove_verify(ids[i], type) != &objs[i]) {
+                ERROR("H5Iremove_verify");
+                goto out;
+            } /* end if */
+            ids[i] = H5I_INVALID_HID;
+        } /* end if */
+
+    /* Check every object can be found from its ID, in a scattered order */
+    nleft = 0;
+    for(i = 0; i < TEST_MANY_NIDS; i++) {
+        int j = (int)(((long)i * 7919) % TEST_MANY_NIDS);
+
+        if(ids[j] != H5I_INVALID_HID) {
+            if(H5Iobject_verify(ids[j], type) != &objs[j]) {
+                ERROR("H5Iobject_verify");
+                goto out;
+            } /* end if */
+            nleft++;
+        } /* end if */
+    } /* end for */
+    ret = H5Inmembers(type, &nmembers);
+    CHECK(ret, FAIL, "H5Inmembers");
+    VERIFY(nmembers, (hsize_t)nleft, "H5Inmembers");
+    if(ret == FAIL || nmembers != (hsize_t)nleft)
+        goto out;
+
+    /* Removed IDs must not be valid */
+    H5E_BEGIN_TRY
+        ret = H5Iis_valid(ids[1] - 1);
+    H5E_END_TRY
+    VERIFY(ret, FALSE, "H5Iis_valid");
+    if(ret != FALSE)
+        goto out;
+
+    /* IDs are visited in increasing order */
+    udata.type = type;
+    udata.ids = ids;
+    udata.prev_id = 0;
+    udata.nvisited = 0;
+    udata.remove_next = FALSE;
+    udata.order_ok = TRUE;
+    ret = H5Iiterate(type, test_many_ids_cb, &udata);
+    CHECK(ret, FAIL, "H5Iiterate");
+    VERIFY(udata.order_ok, TRUE, "H5Iiterate order");
+    VERIFY(udata.nvisited, nleft, "H5Iiterate count");
+    if(ret == FAIL || !udata.order_ok || udata.nvisited != nleft)
+        goto out;
+
+    /* IDs removed by the callback are not visited */
+    udata.prev_id = 0;
+    udata.nvisited = 0;
+    udata.remove_next = TRUE;
+    ret = H5Iiterate(type, test_many_ids_cb, &udata);
+    CHECK(ret, FAIL, "H5Iiterate");
+    VERIFY(udata.order_ok, TRUE, "H5Iiterate order");
+    if(ret == FAIL || !udata.order_ok)
+        goto out;
+    ret = H5Inmembers(type, &nmembers);
+    CHECK(ret, FAIL, "H5Inmembers");
+    VERIFY(nmembers, (hsize_t)udata.nvisited, "H5Inmembers");
+    if(ret == FAIL || nmembers != (hsize_t)udata.nvisited)
+        goto out;
+
+    /* Register more IDs after the removals and look them all up again */
+    for(i = 0; i < TEST_MANY_NIDS; i++)
+        if(ids[i] == H5I_INVALID_HID) {
+            ids[i] = H5Iregister(type, &objs[i]);
+            CHECK(ids[i], FAIL, "H5Iregister");
+            if(ids[i] == FAIL)
+                goto out;
+        } /* end if */
+    for(i = 0; i < TEST_MANY_NIDS; i++)
+        if(H5Iobject_verify(ids[i], type) != &objs[i]) {
+            ERROR("H5Iobject_verify");
+            goto out;
+        } /* end if */
+
+    ret = H5Idestroy_type(type);
+    CHECK(ret, FAIL, "H5Idestroy_type");
+    if(ret == FAIL)
+        goto out;
+
+    return 0;
+
+out:
+    H5E_BEGIN_TRY
+        H5Idestroy_type(type);
+    H5E_END_TRY
+    return -1;
+} /* end test_many_ids() */
+
 void test_ids(void)
 {
     /* Set the random # seed */
@@ -767,5 +921,6 @@ void test_ids(void)
     if (test_get_type() < 0) TestErrPrintf("H5Iget_type test failed\n");
     if (test_id_type_list() < 0) TestErrPrintf("ID type list test failed\n");
     if (test_remove_clear_type() < 0) TestErrPrintf("ID remove during H5Iclear_type test failed\n");
+    if (test_many_ids() < 0) TestErrPrintf("Many IDs test failed\n");
 
 }
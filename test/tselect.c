@@ -183,6 +183,16 @@
 #define CHUNKSZ         20
 #define NUM_ELEMENTS    NUMCHUNKS * CHUNKSZ
 
+/* Defines for test_select_blocks() */
+#define SELECT_BLOCKS_RANK  3
+#define SELECT_BLOCKS_NUM   400
+#define SELECT_BLOCKS_SEED  12345
+
+/* Defines for test_select_hyper_seq_cache() */
+#define SEQ_CACHE_DIM1      12
+#define SEQ_CACHE_DIM2      30
+#define SEQ_CACHE_MAX_RUNS  128
+
 /* Location comparison function */
 static int compare_size_t(const void *s1, const void *s2);
 
@@ -15473,6 +15483,458 @@ test_hyper_io_1d(void)
 
 }   /* test_hyper_io_1d() */
 
+
+/****************************************************************
+**
+**  test_select_hyper_seq_cache_sel(): Select the union of two
+**  regular hyperslabs, and mark the elements selected, at the
+**  given selection offset, in a mask.
+**
+****************************************************************/
+static void
+test_select_hyper_seq_cache_sel(hid_t sid, const hsize_t *start,
+    const hssize_t *offset, hbool_t mask[SEQ_CACHE_DIM1][SEQ_CACHE_DIM2])
+{
+    hsize_t     start2[2];              /* Start of second hyperslab */
+    hsize_t     stride[2][2] = {{3, 5}, {4, 7}};    /* Hyperslab strides */
+    hsize_t     count[2][2] = {{3, 5}, {2, 3}};     /* Hyperslab counts */
+    hsize_t     block[2][2] = {{2, 3}, {1, 1}};     /* Hyperslab blocks */
+    hsize_t     u, v, w, x;             /* Local index variables */
+    unsigned    h;                      /* Hyperslab index */
+    herr_t      ret;                    /* Generic return value */
+
+    start2[0] = start[0] + 1;
+    start2[1] = start[1] + 2;
+    ret = H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, stride[0], count[0], block[0]);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    ret = H5Sselect_hyperslab(sid, H5S_SELECT_OR, start2, stride[1], count[1], block[1]);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    ret = H5Soffset_simple(sid, offset);
+    CHECK(ret, FAIL, "H5Soffset_simple");
+
+    HDmemset(mask, 0, sizeof(hbool_t) * SEQ_CACHE_DIM1 * SEQ_CACHE_DIM2);
+    for(h = 0; h < 2; h++)
+        for(u = 0; u < count[h][0]; u++)
+            for(v = 0; v < block[h][0]; v++)
+                for(w = 0; w < count[h][1]; w++)
+                    for(x = 0; x < block[h][1]; x++) {
+                        hsize_t row = (h ? start2[0] : start[0]) + (u * stride[h][0]) + v;
+                        hsize_t col = (h ? start2[1] : start[1]) + (w * stride[h][1]) + x;
+
+                        mask[(hssize_t)row + offset[0]][(hssize_t)col + offset[1]] = TRUE;
+                    } /* end for */
+}   /* test_select_hyper_seq_cache_sel() */
+
+
+/****************************************************************
+**
+**  test_select_hyper_seq_cache_check(): Check the sequences
+**  generated for a 2-D selection against a mask of the elements
+**  selected, retrieving them a few at a time.
+**
+****************************************************************/
+static void
+test_select_hyper_seq_cache_check(hid_t sid, size_t elmt_size,
+    hbool_t mask[SEQ_CACHE_DIM1][SEQ_CACHE_DIM2], size_t maxseq, size_t maxelem)
+{
+    hsize_t     exp_off[SEQ_CACHE_MAX_RUNS];    /* Expected offsets of runs */
+    size_t      exp_len[SEQ_CACHE_MAX_RUNS];    /* Expected lengths of runs */
+    hsize_t     act_off[SEQ_CACHE_MAX_RUNS];    /* Retrieved offsets of runs */
+    size_t      act_len[SEQ_CACHE_MAX_RUNS];    /* Retrieved lengths of runs */
+    hsize_t     off[SEQ_CACHE_MAX_RUNS];        /* Offsets of retrieved sequences */
+    size_t      len[SEQ_CACHE_MAX_RUNS];        /* Lengths of retrieved sequences */
+    size_t      nexp = 0, nact = 0;     /* # of runs */
+    size_t      nseq, nelem;            /* # of sequences & elements retrieved */
+    hsize_t     u, v;                   /* Local index variables */
+    hid_t       iter_id;                /* Selection iterator ID */
+    herr_t      ret;                    /* Generic return value */
+
+    /* Compute the runs of contiguous bytes selected */
+    for(u = 0; u < SEQ_CACHE_DIM1; u++)
+        for(v = 0; v < SEQ_CACHE_DIM2; v++)
+            if(mask[u][v]) {
+                hsize_t loc = ((u * SEQ_CACHE_DIM2) + v) * elmt_size;
+
+                if(nexp > 0 && exp_off[nexp - 1] + exp_len[nexp - 1] == loc)
+                    exp_len[nexp - 1] += elmt_size;
+                else if(nexp < SEQ_CACHE_MAX_RUNS) {
+                    exp_off[nexp] = loc;
+                    exp_len[nexp] = elmt_size;
+                    nexp++;
+                } /* end else */
+            } /* end if */
+
+    /* Retrieve the sequences and join them into runs */
+    iter_id = H5Ssel_iter_create(sid, elmt_size, 0);
+    CHECK(iter_id, FAIL, "H5Ssel_iter_create");
+    do {
+        ret = H5Ssel_iter_get_seq_list(iter_id, maxseq, maxelem, &nseq, &nelem, off, len);
+        CHECK(ret, FAIL, "H5Ssel_iter_get_seq_list");
+        if(nseq > maxseq || nelem > maxelem)
+            TestErrPrintf("%d: too many sequences or elements retrieved\n", __LINE__);
+        for(u = 0; u < nseq; u++) {
+            if(nact > 0 && act_off[nact - 1] + act_len[nact - 1] == off[u])
+                act_len[nact - 1] += len[u];
+            else if(nact < SEQ_CACHE_MAX_RUNS) {
+                act_off[nact] = off[u];
+                act_len[nact] = len[u];
+                nact++;
+            } /* end else */
+        } /* end for */
+    } while(nseq > 0);
+    ret = H5Ssel_iter_close(iter_id);
+    CHECK(ret, FAIL, "H5Ssel_iter_close");
+
+    /* Compare them */
+    VERIFY(nact, nexp, "H5Ssel_iter_get_seq_list");
+    for(u = 0; u < MIN(nact, nexp); u++) {
+        VERIFY(act_off[u], exp_off[u], "H5Ssel_iter_get_seq_list");
+        VERIFY(act_len[u], exp_len[u], "H5Ssel_iter_get_seq_list");
+    } /* end for */
+}   /* test_select_hyper_seq_cache_check() */
+
+
+/****************************************************************
+**
+**  test_select_hyper_seq_cache(): Test that the sequences for an
+**  irregular hyperslab selection are right when the selection is
+**  iterated over repeatedly, so its cached sequence list is used,
+**  including after it is moved and after it changes.
+**
+****************************************************************/
+static void
+test_select_hyper_seq_cache(void)
+{
+    hsize_t     dims[2] = {SEQ_CACHE_DIM1, SEQ_CACHE_DIM2};  /* Dataspace dimensions */
+    hsize_t     start[2] = {1, 2};      /* Hyperslab start */
+    hsize_t     one[2] = {1, 1};        /* Single element */
+    hssize_t    offset[2];              /* Selection offset */
+    hbool_t     mask[SEQ_CACHE_DIM1][SEQ_CACHE_DIM2];   /* Elements selected */
+    int         wbuf[SEQ_CACHE_DIM1][SEQ_CACHE_DIM2];   /* Dataset contents */
+    int         rbuf[SEQ_CACHE_DIM1 * SEQ_CACHE_DIM2];  /* Data read */
+    hid_t       fid, did, sid, mid;     /* HDF5 IDs */
+    hid_t       fapl;                   /* File access property list */
+    hssize_t    npoints;                /* # of elements selected */
+    unsigned    u, v, w, n;             /* Local index variables */
+    herr_t      ret;                    /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(6, ("Testing Cached Sequence Lists for Irregular Hyperslabs\n"));
+
+    sid = H5Screate_simple(2, dims, NULL);
+    CHECK(sid, FAIL, "H5Screate_simple");
+
+    /* Iterate over the same selection at different selection offsets, with
+     * sequences retrieved all at once and a few at a time */
+    offset[0] = offset[1] = 0;
+    test_select_hyper_seq_cache_sel(sid, start, offset, mask);
+    for(u = 0; u < 6; u++) {
+        offset[0] = (hssize_t)(u % 2);
+        offset[1] = -(hssize_t)(u % 3);
+        ret = H5Soffset_simple(sid, offset);
+        CHECK(ret, FAIL, "H5Soffset_simple");
+        test_select_hyper_seq_cache_sel(sid, start, offset, mask);
+
+        test_select_hyper_seq_cache_check(sid, sizeof(int), mask, (size_t)SEQ_CACHE_MAX_RUNS, (size_t)1024);
+        test_select_hyper_seq_cache_check(sid, sizeof(int), mask, (size_t)3, (size_t)7);
+        test_select_hyper_seq_cache_check(sid, sizeof(int), mask, (size_t)1, (size_t)1);
+        test_select_hyper_seq_cache_check(sid, (size_t)8, mask, (size_t)2, (size_t)5);
+        test_select_hyper_seq_cache_check(sid, (size_t)8, mask, (size_t)5, (size_t)2);
+    } /* end for */
+
+    /* Move the selection itself */
+    offset[0] = offset[1] = 0;
+    test_select_hyper_seq_cache_sel(sid, start, offset, mask);
+    test_select_hyper_seq_cache_check(sid, sizeof(int), mask, (size_t)4, (size_t)9);
+    test_select_hyper_seq_cache_check(sid, sizeof(int), mask, (size_t)4, (size_t)9);
+    offset[0] = offset[1] = 1;
+    ret = H5Sselect_adjust(sid, offset);
+    CHECK(ret, FAIL, "H5Sselect_adjust");
+    for(u = 0; u < SEQ_CACHE_DIM1; u++)
+        for(v = 0; v < SEQ_CACHE_DIM2; v++)
+            mask[u][v] = (u + 1 < SEQ_CACHE_DIM1 && v + 1 < SEQ_CACHE_DIM2) ? mask[u + 1][v + 1] : FALSE;
+    test_select_hyper_seq_cache_check(sid, sizeof(int), mask, (size_t)4, (size_t)9);
+
+    /* Change the selection */
+    start[0] = SEQ_CACHE_DIM1 - 1;
+    start[1] = SEQ_CACHE_DIM2 - 1;
+    ret = H5Sselect_hyperslab(sid, H5S_SELECT_OR, start, NULL, one, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    mask[SEQ_CACHE_DIM1 - 1][SEQ_CACHE_DIM2 - 1] = TRUE;
+    test_select_hyper_seq_cache_check(sid, sizeof(int), mask, (size_t)4, (size_t)9);
+    test_select_hyper_seq_cache_check(sid, sizeof(int), mask, (size_t)4, (size_t)9);
+    start[0] = 0;
+    start[1] = 0;
+    ret = H5Sselect_hyperslab(sid, H5S_SELECT_NOTB, start, NULL, one, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    mask[0][0] = FALSE;
+    test_select_hyper_seq_cache_check(sid, sizeof(int), mask, (size_t)4, (size_t)9);
+    start[0] = 1;
+    start[1] = 2;
+
+    /* Read a moving selection repeatedly, as a time-step loop would */
+    for(u = 0; u < SEQ_CACHE_DIM1; u++)
+        for(v = 0; v < SEQ_CACHE_DIM2; v++)
+            wbuf[u][v] = (int)((u * SEQ_CACHE_DIM2) + v);
+
+    fapl = H5Pcreate(H5P_FILE_ACCESS);
+    CHECK(fapl, FAIL, "H5Pcreate");
+    ret = H5Pset_fapl_core(fapl, (size_t)1024, FALSE);
+    CHECK(ret, FAIL, "H5Pset_fapl_core");
+    fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    CHECK(fid, FAIL, "H5Fcreate");
+    ret = H5Sselect_all(sid);
+    CHECK(ret, FAIL, "H5Sselect_all");
+    offset[0] = offset[1] = 0;
+    ret = H5Soffset_simple(sid, offset);
+    CHECK(ret, FAIL, "H5Soffset_simple");
+    did = H5Dcreate2(fid, "seq_cache", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(did, FAIL, "H5Dcreate2");
+    ret = H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf);
+    CHECK(ret, FAIL, "H5Dwrite");
+
+    test_select_hyper_seq_cache_sel(sid, start, offset, mask);
+    npoints = H5Sget_select_npoints(sid);
+    CHECK(npoints, FAIL, "H5Sget_select_npoints");
+    dims[0] = (hsize_t)npoints;
+    mid = H5Screate_simple(1, dims, NULL);
+    CHECK(mid, FAIL, "H5Screate_simple");
+
+    for(u = 0; u < 8; u++) {
+        offset[0] = (hssize_t)(u % 2);
+        offset[1] = (hssize_t)(u % 3) - 1;
+        ret = H5Soffset_simple(sid, offset);
+        CHECK(ret, FAIL, "H5Soffset_simple");
+        ret = H5Dread(did, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, rbuf);
+        CHECK(ret, FAIL, "H5Dread");
+
+        /* Check the elements read against the selection, moved by the offset */
+        for(v = 0, n = 0; v < SEQ_CACHE_DIM1; v++)
+            for(w = 0; w < SEQ_CACHE_DIM2; w++) {
+                if((hssize_t)v < offset[0] || (hssize_t)w < offset[1]
+                        || (hssize_t)w - offset[1] >= SEQ_CACHE_DIM2)
+                    continue;
+                if(mask[(hssize_t)v - offset[0]][(hssize_t)w - offset[1]]) {
+                    if(rbuf[n] != wbuf[v][w])
+                        TestErrPrintf("%d: read wrong value at step %u, element %u\n", __LINE__, u, n);
+                    n++;
+                } /* end if */
+            } /* end for */
+        VERIFY(n, (unsigned)npoints, "H5Dread");
+    } /* end for */
+
+    ret = H5Sclose(mid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Dclose(did);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+    ret = H5Pclose(fapl);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+}   /* test_select_hyper_seq_cache() */
+
+
+/****************************************************************
+**
+**  test_select_blocks_verify(): Check that two dataspaces select
+**  the same elements.
+**
+****************************************************************/
+static void
+test_select_blocks_verify(hid_t sid1, hid_t sid2)
+{
+    hid_t       tmp_sid;        /* Temporary dataspace ID */
+    hssize_t    npoints1, npoints2; /* Number of elements selected */
+    herr_t      ret;            /* Generic return value */
+
+    npoints1 = H5Sget_select_npoints(sid1);
+    CHECK(npoints1, FAIL, "H5Sget_select_npoints");
+    npoints2 = H5Sget_select_npoints(sid2);
+    VERIFY(npoints2, npoints1, "H5Sget_select_npoints");
+
+    /* The "exclusive or" of two hyperslab selections of the same elements is empty */
+    if(npoints1 > 0) {
+        VERIFY(H5Sget_select_type(sid1), H5S_SEL_HYPERSLABS, "H5Sget_select_type");
+        VERIFY(H5Sget_select_type(sid2), H5S_SEL_HYPERSLABS, "H5Sget_select_type");
+
+        tmp_sid = H5Scopy(sid1);
+        CHECK(tmp_sid, FAIL, "H5Scopy");
+        ret = H5Smodify_select(tmp_sid, H5S_SELECT_XOR, sid2);
+        CHECK(ret, FAIL, "H5Smodify_select");
+        npoints1 = H5Sget_select_npoints(tmp_sid);
+        VERIFY(npoints1, 0, "H5Sget_select_npoints");
+        ret = H5Sclose(tmp_sid);
+        CHECK(ret, FAIL, "H5Sclose");
+    } /* end if */
+}   /* test_select_blocks_verify() */
+
+
+/****************************************************************
+**
+**  test_select_blocks(): Test selecting a list of blocks at once
+**  with H5Sselect_blocks(), comparing against selecting the
+**  blocks one at a time with H5Sselect_hyperslab().
+**
+****************************************************************/
+static void
+test_select_blocks(void)
+{
+    hsize_t     dims[SELECT_BLOCKS_RANK] = {20, 24, 28};    /* Dataspace dimensions */
+    hsize_t     start[SELECT_BLOCKS_NUM][SELECT_BLOCKS_RANK];  /* Block starts */
+    hsize_t     block[SELECT_BLOCKS_NUM][SELECT_BLOCKS_RANK];  /* Block sizes */
+    hsize_t     reg_start[SELECT_BLOCKS_RANK] = {1, 0, 2};  /* Regular hyperslab start */
+    hsize_t     reg_stride[SELECT_BLOCKS_RANK] = {3, 4, 5}; /* Regular hyperslab stride */
+    hsize_t     reg_count[SELECT_BLOCKS_RANK] = {6, 6, 5};  /* Regular hyperslab count */
+    hsize_t     reg_block[SELECT_BLOCKS_RANK] = {2, 3, 3};  /* Regular hyperslab block */
+    hsize_t     ones[SELECT_BLOCKS_RANK] = {1, 1, 1};       /* Single element count */
+    hsize_t     bad_block[SELECT_BLOCKS_RANK] = {1, H5S_UNLIMITED, 1};  /* Invalid block size */
+    H5S_seloper_t ops[] = {H5S_SELECT_OR, H5S_SELECT_AND, H5S_SELECT_XOR,
+            H5S_SELECT_NOTB, H5S_SELECT_NOTA};          /* Operations to check */
+    hid_t       sid;            /* Dataspace built with H5Sselect_blocks() */
+    hid_t       ref_sid;        /* Dataspace built one block at a time */
+    hid_t       op_sid;         /* Dataspace for operations */
+    hid_t       copy_sid;       /* Copy of dataspace */
+    hssize_t    npoints;        /* Number of elements selected */
+    size_t      u, v;           /* Local index variables */
+    herr_t      ret;            /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(6, ("Testing Selecting Lists of Blocks\n"));
+
+    sid = H5Screate_simple(SELECT_BLOCKS_RANK, dims, NULL);
+    CHECK(sid, FAIL, "H5Screate_simple");
+    ref_sid = H5Screate_simple(SELECT_BLOCKS_RANK, dims, NULL);
+    CHECK(ref_sid, FAIL, "H5Screate_simple");
+
+    /* Make random blocks, some of them overlapping */
+    HDsrandom(SELECT_BLOCKS_SEED);
+    for(u = 0; u < SELECT_BLOCKS_NUM; u++)
+        for(v = 0; v < SELECT_BLOCKS_RANK; v++) {
+            start[u][v] = (hsize_t)HDrandom() % dims[v];
+            block[u][v] = ((hsize_t)HDrandom() % 4) + 1;
+            if(start[u][v] + block[u][v] > dims[v])
+                block[u][v] = dims[v] - start[u][v];
+        } /* end for */
+
+    /* Select the blocks one at a time */
+    ret = H5Sselect_none(ref_sid);
+    CHECK(ret, FAIL, "H5Sselect_none");
+    for(u = 0; u < SELECT_BLOCKS_NUM; u++) {
+        ret = H5Sselect_hyperslab(ref_sid, H5S_SELECT_OR, start[u], NULL, ones, block[u]);
+        CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    } /* end for */
+
+    /* Select them all at once */
+    ret = H5Sselect_blocks(sid, H5S_SELECT_SET, (size_t)SELECT_BLOCKS_NUM, &start[0][0], &block[0][0]);
+    CHECK(ret, FAIL, "H5Sselect_blocks");
+    test_select_blocks_verify(sid, ref_sid);
+
+    /* Combine them with a regular hyperslab, with each operation */
+    for(u = 0; u < sizeof(ops) / sizeof(ops[0]); u++) {
+        op_sid = H5Screate_simple(SELECT_BLOCKS_RANK, dims, NULL);
+        CHECK(op_sid, FAIL, "H5Screate_simple");
+        ret = H5Sselect_hyperslab(op_sid, H5S_SELECT_SET, reg_start, reg_stride, reg_count, reg_block);
+        CHECK(ret, FAIL, "H5Sselect_hyperslab");
+        copy_sid = H5Scopy(op_sid);
+        CHECK(copy_sid, FAIL, "H5Scopy");
+
+        ret = H5Sselect_blocks(op_sid, ops[u], (size_t)SELECT_BLOCKS_NUM, &start[0][0], &block[0][0]);
+        CHECK(ret, FAIL, "H5Sselect_blocks");
+        ret = H5Smodify_select(copy_sid, ops[u], ref_sid);
+        CHECK(ret, FAIL, "H5Smodify_select");
+        test_select_blocks_verify(op_sid, copy_sid);
+
+        ret = H5Sclose(copy_sid);
+        CHECK(ret, FAIL, "H5Sclose");
+        ret = H5Sclose(op_sid);
+        CHECK(ret, FAIL, "H5Sclose");
+    } /* end for */
+
+    /* Single elements, with duplicates */
+    for(u = 1; u < SELECT_BLOCKS_NUM; u += 2)
+        for(v = 0; v < SELECT_BLOCKS_RANK; v++)
+            start[u][v] = start[u - 1][v];
+    ret = H5Sselect_none(ref_sid);
+    CHECK(ret, FAIL, "H5Sselect_none");
+    for(u = 0; u < SELECT_BLOCKS_NUM; u++) {
+        ret = H5Sselect_hyperslab(ref_sid, H5S_SELECT_OR, start[u], NULL, ones, NULL);
+        CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    } /* end for */
+    ret = H5Sselect_blocks(sid, H5S_SELECT_SET, (size_t)SELECT_BLOCKS_NUM, &start[0][0], NULL);
+    CHECK(ret, FAIL, "H5Sselect_blocks");
+    test_select_blocks_verify(sid, ref_sid);
+
+    /* Blocks with no elements are skipped */
+    block[0][2] = 0;
+    ret = H5Sselect_blocks(sid, H5S_SELECT_SET, (size_t)2, &start[0][0], &block[0][0]);
+    CHECK(ret, FAIL, "H5Sselect_blocks");
+    npoints = H5Sget_select_npoints(sid);
+    VERIFY(npoints, (hssize_t)(block[1][0] * block[1][1] * block[1][2]), "H5Sget_select_npoints");
+    ret = H5Sselect_blocks(sid, H5S_SELECT_SET, (size_t)1, &start[0][0], &block[0][0]);
+    CHECK(ret, FAIL, "H5Sselect_blocks");
+    VERIFY(H5Sget_select_type(sid), H5S_SEL_NONE, "H5Sget_select_type");
+    ret = H5Sselect_blocks(sid, H5S_SELECT_SET, (size_t)0, NULL, NULL);
+    CHECK(ret, FAIL, "H5Sselect_blocks");
+    VERIFY(H5Sget_select_type(sid), H5S_SEL_NONE, "H5Sget_select_type");
+
+    /* "Or" with an "all" selection stays "all" */
+    ret = H5Sselect_all(sid);
+    CHECK(ret, FAIL, "H5Sselect_all");
+    ret = H5Sselect_blocks(sid, H5S_SELECT_OR, (size_t)SELECT_BLOCKS_NUM, &start[0][0], NULL);
+    CHECK(ret, FAIL, "H5Sselect_blocks");
+    VERIFY(H5Sget_select_type(sid), H5S_SEL_ALL, "H5Sget_select_type");
+
+    /* Adding blocks in order, one at a time, must not change a copy of
+     * the selection made along the way
+     */
+    ret = H5Sselect_none(sid);
+    CHECK(ret, FAIL, "H5Sselect_none");
+    copy_sid = H5I_INVALID_HID;
+    for(u = 0; u < dims[0]; u += 2) {
+        hsize_t row_start[SELECT_BLOCKS_RANK];
+        hsize_t row_block[SELECT_BLOCKS_RANK] = {1, 2, 3};
+
+        row_start[0] = u;
+        row_start[1] = u;
+        row_start[2] = 0;
+        ret = H5Sselect_hyperslab(sid, H5S_SELECT_OR, row_start, NULL, ones, row_block);
+        CHECK(ret, FAIL, "H5Sselect_hyperslab");
+        if(u == dims[0] / 2) {
+            copy_sid = H5Scopy(sid);
+            CHECK(copy_sid, FAIL, "H5Scopy");
+        } /* end if */
+    } /* end for */
+    npoints = H5Sget_select_npoints(sid);
+    VERIFY(npoints, (hssize_t)((dims[0] / 2) * 6), "H5Sget_select_npoints");
+    npoints = H5Sget_select_hyper_nblocks(sid);
+    VERIFY(npoints, (hssize_t)(dims[0] / 2), "H5Sget_select_hyper_nblocks");
+    npoints = H5Sget_select_npoints(copy_sid);
+    VERIFY(npoints, (hssize_t)(((dims[0] / 4) + 1) * 6), "H5Sget_select_npoints");
+    ret = H5Sclose(copy_sid);
+    CHECK(ret, FAIL, "H5Sclose");
+
+    /* Try bad parameters */
+    H5E_BEGIN_TRY {     /* Bad operation */
+        ret = H5Sselect_blocks(sid, H5S_SELECT_APPEND, (size_t)1, &start[0][0], NULL);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Sselect_blocks");
+    H5E_BEGIN_TRY {     /* No starts */
+        ret = H5Sselect_blocks(sid, H5S_SELECT_SET, (size_t)1, NULL, NULL);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Sselect_blocks");
+    H5E_BEGIN_TRY {     /* Unlimited block */
+        ret = H5Sselect_blocks(sid, H5S_SELECT_SET, (size_t)1, &start[0][0], bad_block);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Sselect_blocks");
+
+    ret = H5Sclose(ref_sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+}   /* test_select_blocks() */
+
 
 /****************************************************************
 **
@@ -15660,6 +16122,12 @@ test_select(void)
     /* Test reading of 1-d disjoint file space to 1-d single block memory space */
     test_hyper_io_1d();
 
+    /* Test reusing sequence lists for irregular hyperslabs */
+    test_select_hyper_seq_cache();
+
+    /* Test selecting lists of blocks */
+    test_select_blocks();
+
 }   /* test_select() */
 
 
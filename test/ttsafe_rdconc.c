@@ -0,0 +1,365 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/********************************************************************
+ *
+ * Testing concurrent raw data reads (H5Pset_concurrent_reads)
+ * ------------------------------------------------------------------
+ *
+ * Several threads read datasets at once from files opened with
+ * concurrent reads enabled, two threads to each file, opening and
+ * closing the datasets around the reads.  Each thread checks the values
+ * it reads, so a read that let go of the library's lock at the wrong
+ * time shows up as bad data or a crash.  Half the files use paged file
+ * space and are read through the page buffer, with chunks small enough
+ * to be cached in it.
+ *
+ * Temporary files generated:
+ *   ttsafe_rdconc0.h5 ... ttsafe_rdconc3.h5
+ *
+ ********************************************************************/
+#include "ttsafe.h"
+
+#ifdef H5_HAVE_THREADSAFE
+
+#define FILENAME_FORMAT     "ttsafe_rdconc%d.h5"
+#define NUM_FILES           4
+#define NUM_THREADS         8
+#define NUM_ITERS           20
+#define CONTIG_NAME         "contig"
+#define CHUNKED_NAME        "chunked"
+#define SMALL_NAME          "small"
+#define DSET_NELMTS         (256 * 1024)
+#define CHUNK_NELMTS        (16 * 1024)
+#define SMALL_NELMTS        (64 * 1024)
+#define SMALL_CHUNK_NELMTS  256
+#define NUM_SMALL_READS     32
+#define FS_PAGE_SIZE        4096
+#define PAGE_BUF_SIZE       (32 * FS_PAGE_SIZE)
+
+typedef struct rdconc_info_t {
+    int id;                     /* Number of the thread */
+    hid_t file;                 /* File to read from */
+    int file_num;               /* Number of the file */
+    hbool_t failed;             /* Whether the thread saw a problem */
+} rdconc_info_t;
+
+void *tts_rdconc_thread(void *);
+
+
+/*
+ **********************************************************************
+ * Value of element I of the datasets in file number F
+ **********************************************************************
+ */
+static int
+rdconc_value(int f, size_t i)
+{
+    return (int)(((unsigned)f * 1000003U) ^ (unsigned)i);
+}
+
+/*
+ **********************************************************************
+ * Thread safe test - concurrent raw data reads
+ **********************************************************************
+ */
+void
+tts_rdconc(void)
+{
+    H5TS_thread_t threads[NUM_THREADS];
+    rdconc_info_t info[NUM_THREADS];
+    hid_t   files[NUM_FILES];
+    hid_t   fapl        = H5I_INVALID_HID;
+    hid_t   fapl_pb     = H5I_INVALID_HID;
+    hid_t   fcpl_paged  = H5I_INVALID_HID;
+    hid_t   dcpl        = H5I_INVALID_HID;
+    hid_t   small_dcpl  = H5I_INVALID_HID;
+    hid_t   sid         = H5I_INVALID_HID;
+    hid_t   small_sid   = H5I_INVALID_HID;
+    hid_t   dset        = H5I_INVALID_HID;
+    hsize_t dims[1]     = {DSET_NELMTS};
+    hsize_t chunk_dims[1] = {CHUNK_NELMTS};
+    hsize_t small_dims[1] = {SMALL_NELMTS};
+    hsize_t small_chunk_dims[1] = {SMALL_CHUNK_NELMTS};
+    unsigned accesses[2], hits[2], misses[2], evictions[2], bypasses[2];
+    hbool_t concurrent  = FALSE;
+    int    *data        = NULL;
+    char    filename[32];
+    size_t  u;
+    int     i;
+    herr_t  status;
+
+    data = (int *)HDmalloc(DSET_NELMTS * sizeof(int));
+    CHECK_PTR(data, "HDmalloc");
+
+    /* Check the property */
+    fapl = H5Pcreate(H5P_FILE_ACCESS);
+    CHECK(fapl, H5I_INVALID_HID, "H5Pcreate");
+    status = H5Pget_concurrent_reads(fapl, &concurrent);
+    CHECK(status, FAIL, "H5Pget_concurrent_reads");
+    VERIFY(concurrent, FALSE, "H5Pget_concurrent_reads");
+    status = H5Pset_concurrent_reads(fapl, TRUE);
+    CHECK(status, FAIL, "H5Pset_concurrent_reads");
+    status = H5Pget_concurrent_reads(fapl, &concurrent);
+    CHECK(status, FAIL, "H5Pget_concurrent_reads");
+    VERIFY(concurrent, TRUE, "H5Pget_concurrent_reads");
+
+    /* The same, with a page buffer */
+    fapl_pb = H5Pcopy(fapl);
+    CHECK(fapl_pb, H5I_INVALID_HID, "H5Pcopy");
+    status = H5Pset_page_buffer_size(fapl_pb, PAGE_BUF_SIZE, 0, 0);
+    CHECK(status, FAIL, "H5Pset_page_buffer_size");
+
+    /* Paged file space, for the files read through the page buffer */
+    fcpl_paged = H5Pcreate(H5P_FILE_CREATE);
+    CHECK(fcpl_paged, H5I_INVALID_HID, "H5Pcreate");
+    status = H5Pset_file_space_strategy(fcpl_paged, H5F_FSPACE_STRATEGY_PAGE, FALSE, (hsize_t)1);
+    CHECK(status, FAIL, "H5Pset_file_space_strategy");
+    status = H5Pset_file_space_page_size(fcpl_paged, (hsize_t)FS_PAGE_SIZE);
+    CHECK(status, FAIL, "H5Pset_file_space_page_size");
+
+    /* Create the files, each with a contiguous and two chunked datasets */
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(dcpl, H5I_INVALID_HID, "H5Pcreate");
+    status = H5Pset_chunk(dcpl, 1, chunk_dims);
+    CHECK(status, FAIL, "H5Pset_chunk");
+    sid = H5Screate_simple(1, dims, NULL);
+    CHECK(sid, H5I_INVALID_HID, "H5Screate_simple");
+    small_dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(small_dcpl, H5I_INVALID_HID, "H5Pcreate");
+    status = H5Pset_chunk(small_dcpl, 1, small_chunk_dims);
+    CHECK(status, FAIL, "H5Pset_chunk");
+    small_sid = H5Screate_simple(1, small_dims, NULL);
+    CHECK(small_sid, H5I_INVALID_HID, "H5Screate_simple");
+
+    for(i = 0; i < NUM_FILES; i++) {
+        hid_t file;
+
+        for(u = 0; u < DSET_NELMTS; u++)
+            data[u] = rdconc_value(i, u);
+
+        HDsnprintf(filename, sizeof(filename), FILENAME_FORMAT, i);
+        file = H5Fcreate(filename, H5F_ACC_TRUNC, (i % 2) ? fcpl_paged : H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(file, H5I_INVALID_HID, "H5Fcreate");
+
+        dset = H5Dcreate2(file, CONTIG_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(dset, H5I_INVALID_HID, "H5Dcreate2");
+        status = H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+        CHECK(status, FAIL, "H5Dwrite");
+        status = H5Dclose(dset);
+        CHECK(status, FAIL, "H5Dclose");
+
+        dset = H5Dcreate2(file, CHUNKED_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+        CHECK(dset, H5I_INVALID_HID, "H5Dcreate2");
+        status = H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+        CHECK(status, FAIL, "H5Dwrite");
+        status = H5Dclose(dset);
+        CHECK(status, FAIL, "H5Dclose");
+
+        dset = H5Dcreate2(file, SMALL_NAME, H5T_NATIVE_INT, small_sid, H5P_DEFAULT, small_dcpl, H5P_DEFAULT);
+        CHECK(dset, H5I_INVALID_HID, "H5Dcreate2");
+        status = H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+        CHECK(status, FAIL, "H5Dwrite");
+        status = H5Dclose(dset);
+        CHECK(status, FAIL, "H5Dclose");
+
+        status = H5Fclose(file);
+        CHECK(status, FAIL, "H5Fclose");
+    } /* end for */
+
+    /* Open the files read-only with concurrent reads, the paged ones
+     * with the page buffer */
+    for(i = 0; i < NUM_FILES; i++) {
+        HDsnprintf(filename, sizeof(filename), FILENAME_FORMAT, i);
+        files[i] = H5Fopen(filename, H5F_ACC_RDONLY, (i % 2) ? fapl_pb : fapl);
+        CHECK(files[i], H5I_INVALID_HID, "H5Fopen");
+    } /* end for */
+
+    /* Start the threads, two to a file */
+    for(i = 0; i < NUM_THREADS; i++) {
+        info[i].id = i;
+        info[i].file_num = i % NUM_FILES;
+        info[i].file = files[info[i].file_num];
+        info[i].failed = FALSE;
+        threads[i] = H5TS_create_thread(tts_rdconc_thread, NULL, &info[i]);
+    } /* end for */
+
+    for(i = 0; i < NUM_THREADS; i++)
+        H5TS_wait_for_thread(threads[i]);
+
+    for(i = 0; i < NUM_THREADS; i++)
+        if(info[i].failed)
+            TestErrPrintf("Thread %d read wrong data - test failed\n", i);
+
+    /* The small chunks should have been found in the page buffer, and
+     * read into it */
+    for(i = 1; i < NUM_FILES; i += 2) {
+        status = H5Fget_page_buffering_stats(files[i], accesses, hits, misses, evictions, bypasses);
+        CHECK(status, FAIL, "H5Fget_page_buffering_stats");
+        if(0 == hits[1] || 0 == misses[1] || 0 == bypasses[1])
+            TestErrPrintf("Page buffer of file %d wasn't used for raw data - test failed\n", i);
+    } /* end for */
+
+    for(i = 0; i < NUM_FILES; i++) {
+        status = H5Fclose(files[i]);
+        CHECK(status, FAIL, "H5Fclose");
+    } /* end for */
+
+    status = H5Sclose(small_sid);
+    CHECK(status, FAIL, "H5Sclose");
+    status = H5Sclose(sid);
+    CHECK(status, FAIL, "H5Sclose");
+    status = H5Pclose(small_dcpl);
+    CHECK(status, FAIL, "H5Pclose");
+    status = H5Pclose(dcpl);
+    CHECK(status, FAIL, "H5Pclose");
+    status = H5Pclose(fcpl_paged);
+    CHECK(status, FAIL, "H5Pclose");
+    status = H5Pclose(fapl_pb);
+    CHECK(status, FAIL, "H5Pclose");
+    status = H5Pclose(fapl);
+    CHECK(status, FAIL, "H5Pclose");
+
+    HDfree(data);
+} /* end tts_rdconc() */
+
+void *
+tts_rdconc_thread(void *_info)
+{
+    rdconc_info_t *info = (rdconc_info_t *)_info;
+    hid_t   contig      = H5I_INVALID_HID;
+    hid_t   chunked     = H5I_INVALID_HID;
+    hid_t   small       = H5I_INVALID_HID;
+    hid_t   mspace      = H5I_INVALID_HID;
+    hid_t   fspace      = H5I_INVALID_HID;
+    hsize_t start[1], stride[1], count[1], block[1];
+    hsize_t mdims[1];
+    hsize_t offset[1];
+    hsize_t small_offsets[NUM_SMALL_READS][1];
+    const hsize_t *small_offset_ptrs[NUM_SMALL_READS];
+    void   *small_bufs[NUM_SMALL_READS];
+    uint32_t filters;
+    uint32_t small_filters[NUM_SMALL_READS];
+    int    *buf         = NULL;
+    long long *lbuf     = NULL;
+    size_t  nsel, u, v;
+    int     iter;
+    herr_t  status;
+
+    buf = (int *)HDmalloc(DSET_NELMTS * sizeof(int));
+    CHECK_PTR(buf, "HDmalloc");
+    lbuf = (long long *)HDmalloc(DSET_NELMTS * sizeof(long long));
+    CHECK_PTR(lbuf, "HDmalloc");
+
+    contig = H5Dopen2(info->file, CONTIG_NAME, H5P_DEFAULT);
+    CHECK(contig, H5I_INVALID_HID, "H5Dopen2");
+    chunked = H5Dopen2(info->file, CHUNKED_NAME, H5P_DEFAULT);
+    CHECK(chunked, H5I_INVALID_HID, "H5Dopen2");
+    small = H5Dopen2(info->file, SMALL_NAME, H5P_DEFAULT);
+    CHECK(small, H5I_INVALID_HID, "H5Dopen2");
+
+    /* Every other block of 32K elements, offset by thread */
+    fspace = H5Dget_space(contig);
+    CHECK(fspace, H5I_INVALID_HID, "H5Dget_space");
+    start[0] = (hsize_t)(info->id % 2) * 32 * 1024;
+    stride[0] = 64 * 1024;
+    count[0] = DSET_NELMTS / (64 * 1024);
+    block[0] = 32 * 1024;
+    status = H5Sselect_hyperslab(fspace, H5S_SELECT_SET, start, stride, count, block);
+    CHECK(status, FAIL, "H5Sselect_hyperslab");
+    mdims[0] = count[0] * block[0];
+    nsel = (size_t)mdims[0];
+    mspace = H5Screate_simple(1, mdims, NULL);
+    CHECK(mspace, H5I_INVALID_HID, "H5Screate_simple");
+
+    for(iter = 0; iter < NUM_ITERS && !info->failed; iter++) {
+        /* The whole contiguous dataset */
+        HDmemset(buf, 0, DSET_NELMTS * sizeof(int));
+        status = H5Dread(contig, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+        CHECK(status, FAIL, "H5Dread");
+        for(u = 0; u < DSET_NELMTS; u++)
+            if(buf[u] != rdconc_value(info->file_num, u)) {
+                info->failed = TRUE;
+                break;
+            } /* end if */
+
+        /* A hyperslab of it, converted to another type */
+        status = H5Dread(contig, H5T_NATIVE_LLONG, mspace, fspace, H5P_DEFAULT, lbuf);
+        CHECK(status, FAIL, "H5Dread");
+        for(u = 0; u < nsel; u++) {
+            size_t elmt = (size_t)start[0] + (u / (32 * 1024)) * (64 * 1024) + u % (32 * 1024);
+
+            if(lbuf[u] != (long long)rdconc_value(info->file_num, elmt)) {
+                info->failed = TRUE;
+                break;
+            } /* end if */
+        } /* end for */
+
+        /* A chunk, read directly */
+        offset[0] = (hsize_t)((info->id + iter) % (DSET_NELMTS / CHUNK_NELMTS)) * CHUNK_NELMTS;
+        HDmemset(buf, 0, CHUNK_NELMTS * sizeof(int));
+        status = H5Dread_chunk(chunked, H5P_DEFAULT, offset, &filters, buf);
+        CHECK(status, FAIL, "H5Dread_chunk");
+        for(u = 0; u < CHUNK_NELMTS; u++)
+            if(buf[u] != rdconc_value(info->file_num, (size_t)offset[0] + u)) {
+                info->failed = TRUE;
+                break;
+            } /* end if */
+
+        /* Small chunks scattered over the dataset, several to a page */
+        HDmemset(buf, 0, NUM_SMALL_READS * SMALL_CHUNK_NELMTS * sizeof(int));
+        for(v = 0; v < NUM_SMALL_READS; v++) {
+            size_t chunk = ((size_t)info->id * 7 + (size_t)iter * 13 + v * 37) % (SMALL_NELMTS / SMALL_CHUNK_NELMTS);
+
+            small_offsets[v][0] = (hsize_t)chunk * SMALL_CHUNK_NELMTS;
+            small_offset_ptrs[v] = small_offsets[v];
+            small_bufs[v] = buf + v * SMALL_CHUNK_NELMTS;
+        } /* end for */
+        status = H5Dread_chunks(small, H5P_DEFAULT, NUM_SMALL_READS, small_offset_ptrs, small_filters, small_bufs);
+        CHECK(status, FAIL, "H5Dread_chunks");
+        for(v = 0; v < NUM_SMALL_READS && !info->failed; v++)
+            for(u = 0; u < SMALL_CHUNK_NELMTS; u++)
+                if(buf[v * SMALL_CHUNK_NELMTS + u] != rdconc_value(info->file_num, (size_t)small_offsets[v][0] + u)) {
+                    info->failed = TRUE;
+                    break;
+                } /* end if */
+    } /* end for */
+
+    status = H5Sclose(mspace);
+    CHECK(status, FAIL, "H5Sclose");
+    status = H5Sclose(fspace);
+    CHECK(status, FAIL, "H5Sclose");
+    status = H5Dclose(small);
+    CHECK(status, FAIL, "H5Dclose");
+    status = H5Dclose(chunked);
+    CHECK(status, FAIL, "H5Dclose");
+    status = H5Dclose(contig);
+    CHECK(status, FAIL, "H5Dclose");
+
+    HDfree(lbuf);
+    HDfree(buf);
+
+    return NULL;
+} /* end tts_rdconc_thread() */
+
+void
+cleanup_rdconc(void)
+{
+    char filename[32];
+    int i;
+
+    for(i = 0; i < NUM_FILES; i++) {
+        HDsnprintf(filename, sizeof(filename), FILENAME_FORMAT, i);
+        HDunlink(filename);
+    } /* end for */
+}
+#endif /*H5_HAVE_THREADSAFE*/
@@ -37,6 +37,17 @@
 #define DSET1_DIM2   32
 #define DSET3_NAME   "dset3"
 
+/* Macros for vector I/O */
+#define VEC_NBLOCKS  8
+#define VEC_EOA      (128*KB)
+#define VEC_DSET_NAME "vec dset"
+#define VEC_DSET_DIM 4096
+
+/* Macros for io_uring VFD */
+#ifdef H5_HAVE_IOURING
+#define IOURING_ALIGN 4096
+#endif /* H5_HAVE_IOURING */
+
 /* Macros for Direct VFD */
 #ifdef H5_HAVE_DIRECT
 #define MBOUNDARY    512
@@ -59,6 +70,8 @@ const char *FILENAME[] = {
     "windows_file",      /*8*/
     "new_multi_file_v16",/*9*/
     "ro_s3_file",        /*10*/
+    "vector_file",       /*11*/
+    "iouring_file",      /*12*/
     NULL
 };
 
@@ -114,6 +127,11 @@ test_sec2(void)
     if(!(driver_flags & H5FD_FEAT_POSIX_COMPAT_HANDLE))     TEST_ERROR
     if(!(driver_flags & H5FD_FEAT_SUPPORTS_SWMR_IO))        TEST_ERROR
     if(!(driver_flags & H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))  TEST_ERROR
+#ifdef H5_HAVE_PREADWRITE
+    /* Reads with pread() don't use the file position */
+    if(!(driver_flags & H5FD_FEAT_CONCURRENT_READ))         TEST_ERROR
+    driver_flags &= ~H5FD_FEAT_CONCURRENT_READ;
+#endif /* H5_HAVE_PREADWRITE */
     /* Check for extra flags not accounted for above */
     if(driver_flags != (H5FD_FEAT_AGGREGATE_METADATA
                         | H5FD_FEAT_ACCUMULATE_METADATA
@@ -1960,6 +1978,414 @@ error:
 
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_iouring
+ *
+ * Purpose:     Tests the file handle interface for the io_uring driver,
+ *              with and without O_DIRECT
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_iouring(void)
+{
+#ifdef H5_HAVE_IOURING
+    hid_t       fid = -1;                   /* file ID                      */
+    hid_t       fapl_id = -1;               /* file access property list ID */
+    hid_t       fapl_id_out = -1;           /* from H5Fget_access_plist     */
+    hid_t       did = -1;                   /* dataset ID                   */
+    hid_t       sid = -1;                   /* dataspace ID                 */
+    unsigned long driver_flags = 0;         /* VFD feature flags            */
+    char        filename[1024];             /* filename                     */
+    void        *os_file_handle = NULL;     /* OS file handle               */
+    hsize_t     file_size;                  /* file size                    */
+    hsize_t     dims[2] = {DSET1_DIM1, DSET1_DIM2}; /* dataset dimensions   */
+    unsigned    queue_depth;                /* queue depth from the fapl    */
+    size_t      alignment;                  /* alignment from the fapl      */
+    size_t      buf_size;                   /* buffer size from the fapl    */
+    int         *wbuf = NULL;               /* buffer to write from         */
+    int         *rbuf = NULL;               /* buffer to read into          */
+    h5_stat_t   sb;                         /* file info                    */
+    unsigned    direct;                     /* whether to use O_DIRECT      */
+    size_t      u;                          /* local index variable         */
+#endif /* H5_HAVE_IOURING */
+
+    TESTING("IOURING file driver");
+
+#ifndef H5_HAVE_IOURING
+    SKIPPED();
+    return 0;
+#else /* H5_HAVE_IOURING */
+
+    if(NULL == (wbuf = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR
+    if(NULL == (rbuf = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR
+    for(u = 0; u < DSET1_DIM1 * DSET1_DIM2; u++)
+        wbuf[u] = (int)u;
+
+    for(direct = 0; direct < 2; direct++) {
+        if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+            TEST_ERROR
+        if(H5Pset_fapl_iouring(fapl_id, 16, (size_t)(direct ? IOURING_ALIGN : 0), (size_t)0) < 0)
+            TEST_ERROR
+        h5_fixname(FILENAME[12], fapl_id, filename, sizeof(filename));
+
+        /* Verify the file access properties */
+        if(H5Pget_fapl_iouring(fapl_id, &queue_depth, &alignment, &buf_size) < 0)
+            TEST_ERROR
+        if(queue_depth != 16 || alignment != (direct ? IOURING_ALIGN : 0) || buf_size != H5FD_IOURING_BUF_SIZE_DEF)
+            TEST_ERROR
+
+        /* Check that the VFD feature flags are correct */
+        if(H5FDdriver_query(H5FD_IOURING, &driver_flags) < 0)
+            TEST_ERROR
+        if(!(driver_flags & H5FD_FEAT_AGGREGATE_METADATA))      TEST_ERROR
+        if(!(driver_flags & H5FD_FEAT_ACCUMULATE_METADATA))     TEST_ERROR
+        if(!(driver_flags & H5FD_FEAT_DATA_SIEVE))              TEST_ERROR
+        if(!(driver_flags & H5FD_FEAT_AGGREGATE_SMALLDATA))     TEST_ERROR
+        if(!(driver_flags & H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))  TEST_ERROR
+
+        H5E_BEGIN_TRY {
+            fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+        } H5E_END_TRY;
+        if(fid < 0) {
+            H5Pclose(fapl_id);
+            SKIPPED();
+            HDputs(direct ? "    Probably the file system doesn't support direct I/O"
+                    : "    Probably the kernel doesn't support io_uring");
+            HDfree(wbuf);
+            HDfree(rbuf);
+            return 0;
+        } /* end if */
+
+        /* Retrieve the access property list... */
+        if((fapl_id_out = H5Fget_access_plist(fid)) < 0)
+            TEST_ERROR
+
+        /* Check that the driver is correct */
+        if(H5FD_IOURING != H5Pget_driver(fapl_id_out))
+            TEST_ERROR
+
+        /* ...and close the property list */
+        if(H5Pclose(fapl_id_out) < 0)
+            TEST_ERROR
+
+        /* Check that we can get an operating-system-specific handle from
+         * the library.
+         */
+        if(H5Fget_vfd_handle(fid, H5P_DEFAULT, &os_file_handle) < 0)
+            TEST_ERROR
+        if(os_file_handle == NULL)
+            FAIL_PUTS_ERROR("NULL os-specific vfd/file handle was returned from H5Fget_vfd_handle");
+
+        /* Write a dataset and read it back */
+        if((sid = H5Screate_simple(2, dims, NULL)) < 0)
+            TEST_ERROR
+        if((did = H5Dcreate2(fid, DSET1_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+            TEST_ERROR
+        if(H5Dclose(did) < 0)
+            TEST_ERROR
+        if(H5Sclose(sid) < 0)
+            TEST_ERROR
+        if(H5Fclose(fid) < 0)
+            TEST_ERROR
+
+        /* The file must not keep what O_DIRECT writes wrote past the end
+         * of the data
+         */
+        if(HDstat(filename, &sb) < 0)
+            TEST_ERROR
+        if((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0)
+            TEST_ERROR
+        if(H5Fget_filesize(fid, &file_size) < 0)
+            TEST_ERROR
+        if((hsize_t)sb.st_size != file_size)
+            FAIL_PUTS_ERROR("file size doesn't match the end of the data");
+
+        if((did = H5Dopen2(fid, DSET1_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        HDmemset(rbuf, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+        if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            TEST_ERROR
+        if(HDmemcmp(wbuf, rbuf, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)))
+            FAIL_PUTS_ERROR("read different values than written");
+        if(H5Dclose(did) < 0)
+            TEST_ERROR
+
+        /* Close and delete the file */
+        if(H5Fclose(fid) < 0)
+            TEST_ERROR
+        h5_delete_test_file(FILENAME[12], fapl_id);
+
+        /* Close the fapl */
+        if(H5Pclose(fapl_id) < 0)
+            TEST_ERROR
+    } /* end for */
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Sclose(sid);
+        H5Pclose(fapl_id);
+        H5Pclose(fapl_id_out);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+    return -1;
+#endif /* H5_HAVE_IOURING */
+} /* end test_iouring() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_vector_io
+ *
+ * Purpose:     Tests reading and writing several blocks at once with
+ *              H5FDread_vector/H5FDwrite_vector, and strided dataset I/O
+ *              going through the vector I/O path, for drivers with and
+ *              without the vector callbacks.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_vector_io(void)
+{
+    /* Blocks written, out of order in memory, some adjacent or close
+     * together in the file and one empty */
+    const haddr_t   addrs[VEC_NBLOCKS] = {0, 1000, 1500, 1600, 3000, 20000, 40000, 60000};
+    const size_t    sizes[VEC_NBLOCKS] = {1000, 500, 100, 0, 2000, 10000, 3000, 4000};
+    const size_t    offs[VEC_NBLOCKS] = {30000, 0, 1000, 0, 5000, 12000, 22000, 2000};
+    const char      *drivers[] = {"sec2", "core", "stdio"
+#ifdef H5_HAVE_IOURING
+                        , "io_uring", "io_uring O_DIRECT"
+#endif /* H5_HAVE_IOURING */
+                    };
+    unsigned char   *wbuf = NULL;               /* Buffer to write from */
+    unsigned char   *rbuf = NULL;               /* Buffer to read into */
+    unsigned char   *cbuf = NULL;               /* Buffer to check against */
+    int             *dwbuf = NULL;              /* Dataset write buffer */
+    int             *drbuf = NULL;              /* Dataset read buffer */
+    const void      *wbufs[VEC_NBLOCKS];        /* Buffers for each block written */
+    void            *rbufs[VEC_NBLOCKS];        /* Buffers for each block read */
+    haddr_t         eof_addr[2];                /* Addresses of blocks past the EOF */
+    size_t          eof_size[2];                /* Sizes of blocks past the EOF */
+    hid_t           fapl = -1;                  /* File access property list */
+    hid_t           fid = -1;                   /* File ID */
+    hid_t           sid = -1;                   /* Dataspace ID */
+    hid_t           did = -1;                   /* Dataset ID */
+    H5FD_t          *lf = NULL;                 /* VFD struct ptr */
+    hsize_t         dim = VEC_DSET_DIM;         /* Dataset dimensions */
+    hsize_t         start, stride, count;       /* Hyperslab parameters */
+    char            filename[1024];
+    char            test_name[64];
+    unsigned        d;                          /* Local index variable */
+    size_t          u;                          /* Local index variable */
+
+    if(NULL == (wbuf = (unsigned char *)HDmalloc(64 * KB)))
+        FAIL_STACK_ERROR
+    if(NULL == (rbuf = (unsigned char *)HDmalloc(64 * KB)))
+        FAIL_STACK_ERROR
+    if(NULL == (cbuf = (unsigned char *)HDmalloc(64 * KB)))
+        FAIL_STACK_ERROR
+    if(NULL == (dwbuf = (int *)HDmalloc(VEC_DSET_DIM * sizeof(int))))
+        FAIL_STACK_ERROR
+    if(NULL == (drbuf = (int *)HDmalloc(VEC_DSET_DIM * sizeof(int))))
+        FAIL_STACK_ERROR
+    for(u = 0; u < 64 * KB; u++)
+        wbuf[u] = (unsigned char)(u * 7 + u / 256);
+    for(u = 0; u < VEC_DSET_DIM; u++)
+        dwbuf[u] = (int)(u * 3 + 1);
+
+    for(d = 0; d < NELMTS(drivers); d++) {
+        HDsnprintf(test_name, sizeof(test_name), "vector I/O with %s file driver", drivers[d]);
+        TESTING(test_name);
+
+        if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+            TEST_ERROR
+        if(0 == d) {
+            if(H5Pset_fapl_sec2(fapl) < 0)
+                TEST_ERROR
+        } /* end if */
+        else if(1 == d) {
+            if(H5Pset_fapl_core(fapl, (size_t)CORE_INCREMENT, TRUE) < 0)
+                TEST_ERROR
+            if(H5Pset_core_write_tracking(fapl, TRUE, (size_t)1) < 0)
+                TEST_ERROR
+        } /* end else-if */
+        else if(2 == d) {
+            if(H5Pset_fapl_stdio(fapl) < 0)
+                TEST_ERROR
+        } /* end else-if */
+#ifdef H5_HAVE_IOURING
+        /* Use a small ring and small aligned buffers, so that the blocks
+         * take several rounds and are split across buffers
+         */
+        else if(3 == d) {
+            if(H5Pset_fapl_iouring(fapl, 4, (size_t)0, (size_t)0) < 0)
+                TEST_ERROR
+        } /* end else-if */
+        else {
+            if(H5Pset_fapl_iouring(fapl, 4, (size_t)IOURING_ALIGN, (size_t)(2 * IOURING_ALIGN)) < 0)
+                TEST_ERROR
+        } /* end else */
+#endif /* H5_HAVE_IOURING */
+        h5_fixname(FILENAME[11], fapl, filename, sizeof filename);
+
+        /* Write the blocks and read them back */
+        H5E_BEGIN_TRY {
+            lf = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl, HADDR_UNDEF);
+        } H5E_END_TRY;
+        if(NULL == lf && d > 2) {
+            H5Pclose(fapl);
+            SKIPPED();
+            HDputs("    Probably the file system doesn't support io_uring or direct I/O");
+            continue;
+        } /* end if */
+        if(NULL == lf)
+            TEST_ERROR
+        if(H5FDset_eoa(lf, H5FD_MEM_DRAW, (haddr_t)VEC_EOA) < 0)
+            TEST_ERROR
+        for(u = 0; u < VEC_NBLOCKS; u++) {
+            wbufs[u] = wbuf + offs[u];
+            rbufs[u] = rbuf + offs[u];
+        } /* end for */
+        if(H5FDwrite_vector(lf, H5FD_MEM_DRAW, H5P_DEFAULT, VEC_NBLOCKS, addrs, sizes, wbufs) < 0)
+            TEST_ERROR
+        HDmemset(rbuf, 0, 64 * KB);
+        if(H5FDread_vector(lf, H5FD_MEM_DRAW, H5P_DEFAULT, VEC_NBLOCKS, addrs, sizes, rbufs) < 0)
+            TEST_ERROR
+        for(u = 0; u < VEC_NBLOCKS; u++)
+            if(HDmemcmp(rbuf + offs[u], wbuf + offs[u], sizes[u]))
+                TEST_ERROR
+
+        /* Check the blocks landed at the right places in the file */
+        for(u = 0; u < VEC_NBLOCKS; u++) {
+            if(0 == sizes[u])
+                continue;
+            if(H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, addrs[u], sizes[u], cbuf) < 0)
+                TEST_ERROR
+            if(HDmemcmp(cbuf, wbuf + offs[u], sizes[u]))
+                TEST_ERROR
+        } /* end for */
+
+        /* Blocks past the end of the file read as zeros */
+        eof_addr[0] = addrs[VEC_NBLOCKS - 1];
+        eof_size[0] = 8 * KB;
+        eof_addr[1] = 100 * KB;
+        eof_size[1] = 1000;
+        rbufs[0] = rbuf;
+        rbufs[1] = rbuf + 8 * KB;
+        HDmemset(rbuf, 0xff, 64 * KB);
+        if(H5FDread_vector(lf, H5FD_MEM_DRAW, H5P_DEFAULT, 2, eof_addr, eof_size, rbufs) < 0)
+            TEST_ERROR
+        if(HDmemcmp(rbuf, wbuf + offs[VEC_NBLOCKS - 1], sizes[VEC_NBLOCKS - 1]))
+            TEST_ERROR
+        for(u = sizes[VEC_NBLOCKS - 1]; u < 8 * KB + 1000; u++)
+            if(rbuf[u] != 0)
+                TEST_ERROR
+
+        if(H5FDclose(lf) < 0)
+            TEST_ERROR
+        lf = NULL;
+
+        /* Strided dataset I/O, without a sieve buffer so each sequence
+         * goes through vector I/O */
+        if(H5Pset_sieve_buf_size(fapl, (size_t)0) < 0)
+            TEST_ERROR
+        if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+            TEST_ERROR
+        if((sid = H5Screate_simple(1, &dim, NULL)) < 0)
+            TEST_ERROR
+        if((did = H5Dcreate2(fid, VEC_DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, dwbuf) < 0)
+            TEST_ERROR
+
+        /* Read every third element */
+        start = 1;
+        stride = 3;
+        count = (VEC_DSET_DIM - 1) / 3;
+        if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, &start, &stride, &count, NULL) < 0)
+            TEST_ERROR
+        HDmemset(drbuf, 0, VEC_DSET_DIM * sizeof(int));
+        if(H5Dread(did, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, drbuf) < 0)
+            TEST_ERROR
+        for(u = 0; u < VEC_DSET_DIM; u++)
+            if(drbuf[u] != ((u % 3) == 1 && u / 3 < count ? dwbuf[u] : 0))
+                TEST_ERROR
+
+        /* Overwrite every third element and read everything back */
+        for(u = 0; u < VEC_DSET_DIM; u++)
+            drbuf[u] = -dwbuf[u];
+        if(H5Dwrite(did, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, drbuf) < 0)
+            TEST_ERROR
+        if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, drbuf) < 0)
+            TEST_ERROR
+        for(u = 0; u < VEC_DSET_DIM; u++)
+            if(drbuf[u] != ((u % 3) == 1 && u / 3 < count ? -dwbuf[u] : dwbuf[u]))
+                TEST_ERROR
+
+        if(H5Dclose(did) < 0)
+            TEST_ERROR
+        if(H5Sclose(sid) < 0)
+            TEST_ERROR
+        if(H5Fclose(fid) < 0)
+            TEST_ERROR
+        h5_delete_test_file(FILENAME[11], fapl);
+        if(H5Pclose(fapl) < 0)
+            TEST_ERROR
+
+        PASSED();
+    } /* end for */
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(cbuf);
+    HDfree(dwbuf);
+    HDfree(drbuf);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        if(lf)
+            H5FDclose(lf);
+        H5Dclose(did);
+        H5Sclose(sid);
+        H5Fclose(fid);
+        H5Pclose(fapl);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+    if(cbuf)
+        HDfree(cbuf);
+    if(dwbuf)
+        HDfree(dwbuf);
+    if(drbuf)
+        HDfree(drbuf);
+    return -1;
+} /* end test_vector_io() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    test_windows
  *
@@ -2213,6 +2639,8 @@ main(void)
     nerrors += test_stdio() < 0          ? 1 : 0;
     nerrors += test_windows() < 0        ? 1 : 0;
     nerrors += test_ros3() < 0           ? 1 : 0;
+    nerrors += test_iouring() < 0        ? 1 : 0;
+    nerrors += test_vector_io() < 0      ? 1 : 0;
 
     if(nerrors) {
         HDprintf("***** %d Virtual File Driver TEST%s FAILED! *****\n",
@@ -46,6 +46,12 @@ if (HDF5_TEST_SERIAL)
           overhead.txt.err
           perf_meta.txt
           perf_meta.txt.err
+          dt_conv_perf.txt
+          dt_conv_perf.txt.err
+          id_churn_perf.txt
+          id_churn_perf.txt.err
+          ts_read_perf.txt
+          ts_read_perf.txt.err
           zip_perf-h.txt
           zip_perf-h.txt.err
           zip_perf.txt
@@ -152,6 +158,63 @@ if (HDF5_TEST_SERIAL)
       DEPENDS "PERFORM_h5perform-clearall-objects"
   )
 
+  if (HDF5_ENABLE_USING_MEMCHECKER)
+    add_test (NAME PERFORM_dt_conv_perf COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:dt_conv_perf>)
+  else ()
+    add_test (NAME PERFORM_dt_conv_perf COMMAND "${CMAKE_COMMAND}"
+        -D "TEST_EMULATOR=${CMAKE_CROSSCOMPILING_EMULATOR}"
+        -D "TEST_PROGRAM=$<TARGET_FILE:dt_conv_perf>"
+        -D "TEST_ARGS:STRING="
+        -D "TEST_EXPECT=0"
+        -D "TEST_SKIP_COMPARE=TRUE"
+        -D "TEST_OUTPUT=dt_conv_perf.txt"
+        #-D "TEST_REFERENCE=dt_conv_perf.out"
+        -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+        -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+    )
+  endif ()
+  set_tests_properties (PERFORM_dt_conv_perf PROPERTIES
+      DEPENDS "PERFORM_h5perform-clearall-objects"
+  )
+
+  if (HDF5_ENABLE_USING_MEMCHECKER)
+    add_test (NAME PERFORM_id_churn_perf COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:id_churn_perf>)
+  else ()
+    add_test (NAME PERFORM_id_churn_perf COMMAND "${CMAKE_COMMAND}"
+        -D "TEST_EMULATOR=${CMAKE_CROSSCOMPILING_EMULATOR}"
+        -D "TEST_PROGRAM=$<TARGET_FILE:id_churn_perf>"
+        -D "TEST_ARGS:STRING="
+        -D "TEST_EXPECT=0"
+        -D "TEST_SKIP_COMPARE=TRUE"
+        -D "TEST_OUTPUT=id_churn_perf.txt"
+        #-D "TEST_REFERENCE=id_churn_perf.out"
+        -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+        -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+    )
+  endif ()
+  set_tests_properties (PERFORM_id_churn_perf PROPERTIES
+      DEPENDS "PERFORM_h5perform-clearall-objects"
+  )
+
+  if (HDF5_ENABLE_USING_MEMCHECKER)
+    add_test (NAME PERFORM_ts_read_perf COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:ts_read_perf>)
+  else ()
+    add_test (NAME PERFORM_ts_read_perf COMMAND "${CMAKE_COMMAND}"
+        -D "TEST_EMULATOR=${CMAKE_CROSSCOMPILING_EMULATOR}"
+        -D "TEST_PROGRAM=$<TARGET_FILE:ts_read_perf>"
+        -D "TEST_ARGS:STRING="
+        -D "TEST_EXPECT=0"
+        -D "TEST_SKIP_COMPARE=TRUE"
+        -D "TEST_OUTPUT=ts_read_perf.txt"
+        #-D "TEST_REFERENCE=ts_read_perf.out"
+        -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+        -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+    )
+  endif ()
+  set_tests_properties (PERFORM_ts_read_perf PROPERTIES
+      DEPENDS "PERFORM_h5perform-clearall-objects"
+  )
+
   if (HDF5_ENABLE_USING_MEMCHECKER)
     add_test (NAME PERFORM_zip_perf_help COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:zip_perf> "-h")
   else ()
@@ -0,0 +1,224 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Measures the speed of the hardware conversions between
+ *              integers and floating-point numbers, as tested by
+ *              test/dt_arith.c, against a loop of the compiler's casts.
+ *              The values are in range for all the conversions, so the
+ *              casts give the same values as the library.  The ratio is
+ *              how many times faster H5Tconvert() is than the casts.
+ *
+ *              Usage: dt_conv_perf [nelmts [repeats]]
+ */
+
+/* See H5private.h for how to include headers */
+#include "hdf5.h"
+#include "H5private.h"
+
+#define DEF_NELMTS      (4 * 1024 * 1024)
+#define DEF_REPEATS     5
+
+
+/* Convert N values of type ST in S to type DT in D with a plain loop */
+#define CAST_LOOP(ST, DT, S, D, N) {                                          \
+    const ST *_s = (const ST *)(S);                                           \
+    DT *_d = (DT *)(D);                                                       \
+    size_t _i;                                                                \
+                                                                              \
+    for(_i = 0; _i < (N); _i++)                                               \
+        _d[_i] = (DT)_s[_i];                                                  \
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:    cast_loop
+ *
+ * Purpose:     Converts NELMTS values in SRC_BUF to DST_BUF with the
+ *              compiler's casts, for conversion number N of main().
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+cast_loop(unsigned n, const void *src_buf, void *dst_buf, size_t nelmts)
+{
+    switch(n) {
+        case 0:  CAST_LOOP(signed char, float, src_buf, dst_buf, nelmts) break;
+        case 1:  CAST_LOOP(unsigned char, float, src_buf, dst_buf, nelmts) break;
+        case 2:  CAST_LOOP(short, float, src_buf, dst_buf, nelmts) break;
+        case 3:  CAST_LOOP(unsigned short, float, src_buf, dst_buf, nelmts) break;
+        case 4:  CAST_LOOP(int, float, src_buf, dst_buf, nelmts) break;
+        case 5:  CAST_LOOP(signed char, double, src_buf, dst_buf, nelmts) break;
+        case 6:  CAST_LOOP(unsigned char, double, src_buf, dst_buf, nelmts) break;
+        case 7:  CAST_LOOP(short, double, src_buf, dst_buf, nelmts) break;
+        case 8:  CAST_LOOP(unsigned short, double, src_buf, dst_buf, nelmts) break;
+        case 9:  CAST_LOOP(int, double, src_buf, dst_buf, nelmts) break;
+        case 10: CAST_LOOP(float, double, src_buf, dst_buf, nelmts) break;
+        case 11: CAST_LOOP(double, float, src_buf, dst_buf, nelmts) break;
+        case 12: CAST_LOOP(float, int, src_buf, dst_buf, nelmts) break;
+        case 13: CAST_LOOP(double, int, src_buf, dst_buf, nelmts) break;
+        default: break;
+    } /* end switch */
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:    time_conv
+ *
+ * Purpose:     Converts NELMTS values for conversion number N of main()
+ *              REPEATS times, starting from the values in SAVED each time.
+ *              The values are converted in place with H5Tconvert(), or
+ *              into a separate buffer with cast_loop() if CAST is set.
+ *
+ * Return:      Success:        The fastest time of the conversions, in
+ *                              seconds
+ *
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static double
+time_conv(unsigned n, hid_t src, hid_t dst, size_t nelmts, unsigned repeats,
+    hbool_t cast, const void *saved, void *buf)
+{
+    double best = -1.0;
+    unsigned u;
+
+    for(u = 0; u < repeats; u++) {
+        double start, elapsed;
+
+        if(!cast)
+            HDmemcpy(buf, saved, nelmts * H5Tget_size(src));
+        start = H5_get_time();
+        if(cast)
+            cast_loop(n, saved, buf, nelmts);
+        else if(H5Tconvert(src, dst, nelmts, buf, NULL, H5P_DEFAULT) < 0)
+            return -1.0;
+        elapsed = H5_get_time() - start;
+        if(best < 0.0 || elapsed < best)
+            best = elapsed;
+    } /* end for */
+
+    return best;
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Times the conversions and prints the results.
+ *
+ * Return:      Success:        EXIT_SUCCESS
+ *
+ *              Failure:        EXIT_FAILURE
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, char *argv[])
+{
+    const char *names[] = {
+        "schar -> float", "uchar -> float", "short -> float",
+        "ushort -> float", "int -> float", "schar -> double",
+        "uchar -> double", "short -> double", "ushort -> double",
+        "int -> double", "float -> double", "double -> float",
+        "float -> int", "double -> int"
+    };
+    hid_t       src_types[NELMTS(names)], dst_types[NELMTS(names)];
+    size_t      nelmts = DEF_NELMTS;
+    unsigned    repeats = DEF_REPEATS;
+    unsigned char *buf = NULL, *saved = NULL;
+    size_t      u, j;
+
+    if(argc > 1 && (nelmts = (size_t)HDstrtoul(argv[1], NULL, 0)) == 0) {
+        HDfprintf(stderr, "usage: %s [nelmts [repeats]]\n", argv[0]);
+        HDexit(EXIT_FAILURE);
+    } /* end if */
+    if(argc > 2 && (repeats = (unsigned)HDstrtoul(argv[2], NULL, 0)) == 0) {
+        HDfprintf(stderr, "usage: %s [nelmts [repeats]]\n", argv[0]);
+        HDexit(EXIT_FAILURE);
+    } /* end if */
+
+    src_types[0] = H5T_NATIVE_SCHAR;    dst_types[0] = H5T_NATIVE_FLOAT;
+    src_types[1] = H5T_NATIVE_UCHAR;    dst_types[1] = H5T_NATIVE_FLOAT;
+    src_types[2] = H5T_NATIVE_SHORT;    dst_types[2] = H5T_NATIVE_FLOAT;
+    src_types[3] = H5T_NATIVE_USHORT;   dst_types[3] = H5T_NATIVE_FLOAT;
+    src_types[4] = H5T_NATIVE_INT;      dst_types[4] = H5T_NATIVE_FLOAT;
+    src_types[5] = H5T_NATIVE_SCHAR;    dst_types[5] = H5T_NATIVE_DOUBLE;
+    src_types[6] = H5T_NATIVE_UCHAR;    dst_types[6] = H5T_NATIVE_DOUBLE;
+    src_types[7] = H5T_NATIVE_SHORT;    dst_types[7] = H5T_NATIVE_DOUBLE;
+    src_types[8] = H5T_NATIVE_USHORT;   dst_types[8] = H5T_NATIVE_DOUBLE;
+    src_types[9] = H5T_NATIVE_INT;      dst_types[9] = H5T_NATIVE_DOUBLE;
+    src_types[10] = H5T_NATIVE_FLOAT;   dst_types[10] = H5T_NATIVE_DOUBLE;
+    src_types[11] = H5T_NATIVE_DOUBLE;  dst_types[11] = H5T_NATIVE_FLOAT;
+    src_types[12] = H5T_NATIVE_FLOAT;   dst_types[12] = H5T_NATIVE_INT;
+    src_types[13] = H5T_NATIVE_DOUBLE;  dst_types[13] = H5T_NATIVE_INT;
+
+    if(NULL == (buf = (unsigned char *)HDmalloc(nelmts * sizeof(double))))
+        goto error;
+    if(NULL == (saved = (unsigned char *)HDmalloc(nelmts * sizeof(double))))
+        goto error;
+
+    HDfprintf(stdout, "%lu elements, best of %u conversions\n",
+            (unsigned long)nelmts, repeats);
+    HDfprintf(stdout, "%-18s %14s %14s %8s\n", "conversion",
+            "H5Tconvert MB/s", "cast MB/s", "ratio");
+
+    for(u = 0; u < NELMTS(names); u++) {
+        size_t src_size = H5Tget_size(src_types[u]);
+        double nbytes, conv_time, cast_time;
+
+        /* Values in range of all the destination types */
+        for(j = 0; j < nelmts; j++) {
+            long value = (long)(HDrandom() % 255) - 127;
+
+            if(H5Tget_class(src_types[u]) == H5T_FLOAT) {
+                if(src_size == sizeof(float))
+                    ((float *)saved)[j] = (float)value * 0.75F;
+                else
+                    ((double *)saved)[j] = (double)value * 0.75;
+            } /* end if */
+            else if(src_size == sizeof(int))
+                ((int *)saved)[j] = (int)value * 1000;
+            else if(src_size == sizeof(short))
+                ((short *)saved)[j] = (short)(value * 100);
+            else
+                ((signed char *)saved)[j] = (signed char)value;
+        } /* end for */
+
+        if((conv_time = time_conv((unsigned)u, src_types[u], dst_types[u], nelmts, repeats, FALSE, saved, buf)) < 0)
+            goto error;
+        cast_time = time_conv((unsigned)u, src_types[u], dst_types[u], nelmts, repeats, TRUE, saved, buf);
+
+        nbytes = (double)(nelmts * src_size);
+        HDfprintf(stdout, "%-18s %14.1f %14.1f %8.2f\n", names[u],
+                nbytes / (conv_time * 1024.0 * 1024.0),
+                nbytes / (cast_time * 1024.0 * 1024.0),
+                cast_time / conv_time);
+    } /* end for */
+
+    HDfree(buf);
+    HDfree(saved);
+
+    return EXIT_SUCCESS;
+
+error:
+    HDfprintf(stderr, "conversion benchmark failed\n");
+    if(buf)
+        HDfree(buf);
+    if(saved)
+        HDfree(saved);
+
+    return EXIT_FAILURE;
+}
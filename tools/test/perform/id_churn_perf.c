@@ -0,0 +1,209 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Measures how fast IDs are created, looked up and closed
+ *              while many IDs are open.  It opens NIDS IDs of an
+ *              application ID type, looks each of them up in random order,
+ *              then repeatedly closes a random half of them and opens as
+ *              many new ones ("churn"), and finally closes them all.  The
+ *              lookups and the churn are then repeated with dataspace IDs,
+ *              which also go through the public API's argument checks.
+ *
+ *              Usage: id_churn_perf [nids [repeats]]
+ */
+
+/* See H5private.h for how to include headers */
+#include "hdf5.h"
+#include "H5private.h"
+
+#define DEF_NIDS        (256 * 1024)
+#define DEF_REPEATS     5
+
+
+/*-------------------------------------------------------------------------
+ * Function:    shuffle
+ *
+ * Purpose:     Puts the N values in ORDER in a random order.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+shuffle(size_t *order, size_t n)
+{
+    size_t u;
+
+    for(u = n; u > 1; u--) {
+        size_t j = (size_t)HDrandom() % u;
+        size_t tmp = order[u - 1];
+
+        order[u - 1] = order[j];
+        order[j] = tmp;
+    } /* end for */
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:    print_rate
+ *
+ * Purpose:     Prints the number of operations per second for N operations
+ *              that took ELAPSED seconds.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+print_rate(const char *name, size_t n, double elapsed)
+{
+    HDfprintf(stdout, "%-34s %12.0f ops/s\n", name,
+            elapsed > 0.0 ? (double)n / elapsed : 0.0);
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Times the ID operations and prints the results.
+ *
+ * Return:      Success:        EXIT_SUCCESS
+ *
+ *              Failure:        EXIT_FAILURE
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, char *argv[])
+{
+    static int  objects[16];
+    H5I_type_t  type = H5I_BADID;
+    hsize_t     dim = 10;
+    size_t      nids = DEF_NIDS;
+    unsigned    repeats = DEF_REPEATS;
+    hid_t      *ids = NULL;
+    size_t     *order = NULL;
+    double      start;
+    size_t      u;
+    unsigned    r;
+
+    if(argc > 1 && (nids = (size_t)HDstrtoul(argv[1], NULL, 0)) < 2) {
+        HDfprintf(stderr, "usage: %s [nids [repeats]]\n", argv[0]);
+        HDexit(EXIT_FAILURE);
+    } /* end if */
+    if(argc > 2 && (repeats = (unsigned)HDstrtoul(argv[2], NULL, 0)) == 0) {
+        HDfprintf(stderr, "usage: %s [nids [repeats]]\n", argv[0]);
+        HDexit(EXIT_FAILURE);
+    } /* end if */
+
+    if(NULL == (ids = (hid_t *)HDmalloc(nids * sizeof(hid_t))))
+        goto error;
+    if(NULL == (order = (size_t *)HDmalloc(nids * sizeof(size_t))))
+        goto error;
+    for(u = 0; u < nids; u++)
+        order[u] = u;
+
+    HDfprintf(stdout, "%lu IDs open, %u rounds of churn\n",
+            (unsigned long)nids, repeats);
+
+    /* Application IDs */
+    if((type = H5Iregister_type((size_t)0, 0, NULL)) < 0)
+        goto error;
+
+    start = H5_get_time();
+    for(u = 0; u < nids; u++)
+        if((ids[u] = H5Iregister(type, &objects[u % NELMTS(objects)])) < 0)
+            goto error;
+    print_rate("H5Iregister", nids, H5_get_time() - start);
+
+    shuffle(order, nids);
+    start = H5_get_time();
+    for(r = 0; r < repeats; r++)
+        for(u = 0; u < nids; u++)
+            if(NULL == H5Iobject_verify(ids[order[u]], type))
+                goto error;
+    print_rate("H5Iobject_verify", nids * repeats, H5_get_time() - start);
+
+    start = H5_get_time();
+    for(r = 0; r < repeats; r++) {
+        shuffle(order, nids);
+        for(u = 0; u < nids / 2; u++)
+            if(NULL == H5Iremove_verify(ids[order[u]], type))
+                goto error;
+        for(u = 0; u < nids / 2; u++)
+            if((ids[order[u]] = H5Iregister(type, &objects[u % NELMTS(objects)])) < 0)
+                goto error;
+    } /* end for */
+    print_rate("H5Iremove_verify + H5Iregister", (nids / 2) * repeats * 2, H5_get_time() - start);
+
+    shuffle(order, nids);
+    start = H5_get_time();
+    for(u = 0; u < nids; u++)
+        if(NULL == H5Iremove_verify(ids[order[u]], type))
+            goto error;
+    print_rate("H5Iremove_verify", nids, H5_get_time() - start);
+
+    if(H5Idestroy_type(type) < 0)
+        goto error;
+    type = H5I_BADID;
+
+    /* Dataspace IDs */
+    start = H5_get_time();
+    for(u = 0; u < nids; u++)
+        if((ids[u] = H5Screate_simple(1, &dim, NULL)) < 0)
+            goto error;
+    print_rate("H5Screate_simple", nids, H5_get_time() - start);
+
+    shuffle(order, nids);
+    start = H5_get_time();
+    for(r = 0; r < repeats; r++)
+        for(u = 0; u < nids; u++)
+            if(H5Sget_simple_extent_npoints(ids[order[u]]) != (hssize_t)dim)
+                goto error;
+    print_rate("H5Sget_simple_extent_npoints", nids * repeats, H5_get_time() - start);
+
+    start = H5_get_time();
+    for(r = 0; r < repeats; r++) {
+        shuffle(order, nids);
+        for(u = 0; u < nids / 2; u++)
+            if(H5Sclose(ids[order[u]]) < 0)
+                goto error;
+        for(u = 0; u < nids / 2; u++)
+            if((ids[order[u]] = H5Screate_simple(1, &dim, NULL)) < 0)
+                goto error;
+    } /* end for */
+    print_rate("H5Sclose + H5Screate_simple", (nids / 2) * repeats * 2, H5_get_time() - start);
+
+    shuffle(order, nids);
+    start = H5_get_time();
+    for(u = 0; u < nids; u++)
+        if(H5Sclose(ids[order[u]]) < 0)
+            goto error;
+    print_rate("H5Sclose", nids, H5_get_time() - start);
+
+    HDfree(ids);
+    HDfree(order);
+
+    return EXIT_SUCCESS;
+
+error:
+    HDfprintf(stderr, "ID benchmark failed\n");
+    if(type > 0)
+        H5Idestroy_type(type);
+    if(ids)
+        HDfree(ids);
+    if(order)
+        HDfree(order);
+
+    return EXIT_FAILURE;
+}
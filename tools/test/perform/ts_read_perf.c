@@ -0,0 +1,259 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Measures how raw data read throughput scales with the
+ *              number of threads in a thread-safe build.  Each thread
+ *              opens its own file and reads a contiguous dataset of
+ *              NELMTS integers REPEATS times, for 1, 2, 4 and 8 threads,
+ *              first with the files opened normally and then with
+ *              concurrent reads (H5Pset_concurrent_reads) enabled.
+ *
+ *              Usage: ts_read_perf [nelmts [repeats]]
+ */
+
+/* See H5private.h for how to include headers */
+#include "hdf5.h"
+#include "H5private.h"
+
+#ifdef H5_HAVE_THREADSAFE
+
+#define MAX_THREADS     8
+#define DEF_NELMTS      (2 * 1024 * 1024)
+#define DEF_REPEATS     5
+#define FILENAME_FORMAT "ts_read_perf%d.h5"
+#define DSET_NAME       "data"
+
+/* Work for one thread */
+typedef struct thread_info_t {
+    hid_t       file;           /* File to read from */
+    size_t      nelmts;         /* Number of elements in the dataset */
+    unsigned    repeats;        /* Number of times to read it */
+    hbool_t     failed;         /* Whether a read failed */
+} thread_info_t;
+
+
+/*-------------------------------------------------------------------------
+ * Function:    read_thread
+ *
+ * Purpose:     Reads the dataset of the thread's file the number of times
+ *              asked for.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+read_thread(void *_info)
+{
+    thread_info_t *info = (thread_info_t *)_info;
+    hid_t       dset = H5I_INVALID_HID;
+    int        *buf = NULL;
+    unsigned    u;
+
+    if(NULL == (buf = (int *)HDmalloc(info->nelmts * sizeof(int))))
+        goto error;
+    if((dset = H5Dopen2(info->file, DSET_NAME, H5P_DEFAULT)) < 0)
+        goto error;
+    for(u = 0; u < info->repeats; u++)
+        if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+            goto error;
+    if(H5Dclose(dset) < 0)
+        goto error;
+    HDfree(buf);
+
+    return NULL;
+
+error:
+    info->failed = TRUE;
+    if(dset >= 0)
+        H5Dclose(dset);
+    if(buf)
+        HDfree(buf);
+
+    return NULL;
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:    time_reads
+ *
+ * Purpose:     Opens NTHREADS files with FAPL and times NTHREADS threads
+ *              each reading its own file.
+ *
+ * Return:      Success:        Elapsed time, in seconds
+ *
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static double
+time_reads(unsigned nthreads, hid_t fapl, size_t nelmts, unsigned repeats)
+{
+    H5TS_thread_t threads[MAX_THREADS];
+    thread_info_t info[MAX_THREADS];
+    char        filename[32];
+    double      start, elapsed;
+    hbool_t     failed = FALSE;
+    unsigned    u;
+
+    for(u = 0; u < nthreads; u++) {
+        HDsnprintf(filename, sizeof(filename), FILENAME_FORMAT, (int)u);
+        if((info[u].file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+            return -1.0;
+        info[u].nelmts = nelmts;
+        info[u].repeats = repeats;
+        info[u].failed = FALSE;
+    } /* end for */
+
+    start = H5_get_time();
+    for(u = 0; u < nthreads; u++)
+        threads[u] = H5TS_create_thread(read_thread, NULL, &info[u]);
+    for(u = 0; u < nthreads; u++)
+        H5TS_wait_for_thread(threads[u]);
+    elapsed = H5_get_time() - start;
+
+    for(u = 0; u < nthreads; u++) {
+        if(info[u].failed)
+            failed = TRUE;
+        if(H5Fclose(info[u].file) < 0)
+            failed = TRUE;
+    } /* end for */
+
+    return failed ? -1.0 : elapsed;
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Creates the files, times the reads and prints the results.
+ *
+ * Return:      Success:        EXIT_SUCCESS
+ *
+ *              Failure:        EXIT_FAILURE
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, char *argv[])
+{
+    hid_t       fapls[2] = {H5I_INVALID_HID, H5I_INVALID_HID};
+    hid_t       file = H5I_INVALID_HID, sid = H5I_INVALID_HID, dset = H5I_INVALID_HID;
+    hsize_t     dims[1];
+    size_t      nelmts = DEF_NELMTS;
+    unsigned    repeats = DEF_REPEATS;
+    int        *buf = NULL;
+    char        filename[32];
+    size_t      v;
+    unsigned    u, nthreads;
+    int         i;
+
+    if(argc > 1 && (nelmts = (size_t)HDstrtoul(argv[1], NULL, 0)) == 0) {
+        HDfprintf(stderr, "usage: %s [nelmts [repeats]]\n", argv[0]);
+        HDexit(EXIT_FAILURE);
+    } /* end if */
+    if(argc > 2 && (repeats = (unsigned)HDstrtoul(argv[2], NULL, 0)) == 0) {
+        HDfprintf(stderr, "usage: %s [nelmts [repeats]]\n", argv[0]);
+        HDexit(EXIT_FAILURE);
+    } /* end if */
+
+    /* Create a file for each thread */
+    if(NULL == (buf = (int *)HDmalloc(nelmts * sizeof(int))))
+        goto error;
+    for(v = 0; v < nelmts; v++)
+        buf[v] = (int)v;
+    dims[0] = (hsize_t)nelmts;
+    if((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        goto error;
+    for(u = 0; u < MAX_THREADS; u++) {
+        HDsnprintf(filename, sizeof(filename), FILENAME_FORMAT, (int)u);
+        if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            goto error;
+        if((dset = H5Dcreate2(file, DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            goto error;
+        if(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+            goto error;
+        if(H5Dclose(dset) < 0)
+            goto error;
+        dset = H5I_INVALID_HID;
+        if(H5Fclose(file) < 0)
+            goto error;
+        file = H5I_INVALID_HID;
+    } /* end for */
+    HDfree(buf);
+    buf = NULL;
+
+    /* File access property lists without and with concurrent reads */
+    for(i = 0; i < 2; i++) {
+        if((fapls[i] = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+            goto error;
+        if(H5Pset_concurrent_reads(fapls[i], (hbool_t)i) < 0)
+            goto error;
+    } /* end for */
+
+    HDfprintf(stdout, "%lu elements per file, %u reads per thread\n",
+            (unsigned long)nelmts, repeats);
+    HDfprintf(stdout, "%-8s %16s %16s %8s\n", "threads", "locked MB/s",
+            "concurrent MB/s", "ratio");
+
+    for(nthreads = 1; nthreads <= MAX_THREADS; nthreads *= 2) {
+        double nbytes = (double)nelmts * sizeof(int) * repeats * nthreads;
+        double times[2];
+
+        for(i = 0; i < 2; i++)
+            if((times[i] = time_reads(nthreads, fapls[i], nelmts, repeats)) < 0)
+                goto error;
+
+        HDfprintf(stdout, "%-8u %16.1f %16.1f %8.2f\n", nthreads,
+                nbytes / (times[0] * 1024.0 * 1024.0),
+                nbytes / (times[1] * 1024.0 * 1024.0),
+                times[0] / times[1]);
+    } /* end for */
+
+    for(i = 0; i < 2; i++)
+        H5Pclose(fapls[i]);
+    H5Sclose(sid);
+    for(u = 0; u < MAX_THREADS; u++) {
+        HDsnprintf(filename, sizeof(filename), FILENAME_FORMAT, (int)u);
+        HDremove(filename);
+    } /* end for */
+
+    return EXIT_SUCCESS;
+
+error:
+    HDfprintf(stderr, "thread read benchmark failed\n");
+    for(i = 0; i < 2; i++)
+        if(fapls[i] >= 0)
+            H5Pclose(fapls[i]);
+    if(dset >= 0)
+        H5Dclose(dset);
+    if(file >= 0)
+        H5Fclose(file);
+    if(sid >= 0)
+        H5Sclose(sid);
+    if(buf)
+        HDfree(buf);
+
+    return EXIT_FAILURE;
+}
+
+#else /* H5_HAVE_THREADSAFE */
+
+int
+main(void)
+{
+    HDfprintf(stdout, "Test skipped because THREADSAFE not enabled\n");
+    return EXIT_SUCCESS;
+}
+
+#endif /* H5_HAVE_THREADSAFE */